@@ -43,6 +43,10 @@
 */
 
 #define  APP_CFG_GUI_EN                          DEF_ENABLED
+#define  APP_CFG_ISR_BENCH_EN                    DEF_DISABLED
+#define  APP_CFG_MEM_BENCH_EN                    DEF_DISABLED
+#define  APP_CFG_MUTEX_BENCH_EN                  DEF_DISABLED
+#define  APP_CFG_CTX_BENCH_EN                    DEF_DISABLED
 
 /*
 *********************************************************************************************************
@@ -70,6 +74,76 @@
 #define  APP_CFG_TOUCH_TASK_STK_SIZE              128u
 
 
+/*
+*********************************************************************************************************
+*                                    ISR POST BENCHMARK CONFIGURATION
+*                             Size of the Task Stacks (# of OS_STK Entries)
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_ISR_BENCH_WAIT_PRIO                8u          /* Priority of the first waiting task                 */
+#define  APP_CFG_ISR_BENCH_WAIT_STK_SIZE          128u
+#define  APP_CFG_ISR_BENCH_NBR_WAIT                 4u          /* Number of tasks pending on the semaphore           */
+
+#define  APP_CFG_ISR_BENCH_TASK_PRIO               12u          /* Must be lower than all the waiting tasks           */
+#define  APP_CFG_ISR_BENCH_TASK_STK_SIZE          256u
+
+#define  APP_CFG_ISR_BENCH_NBR_SAMPLES           1000u          /* Number of interrupts per run                       */
+
+
+/*
+*********************************************************************************************************
+*                                MEMORY PARTITION BENCHMARK CONFIGURATION
+*                             Size of the Task Stacks (# of OS_STK Entries)
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_MEM_BENCH_TASK_PRIO               13u
+#define  APP_CFG_MEM_BENCH_TASK_STK_SIZE          256u
+
+#define  APP_CFG_MEM_BENCH_NBR_BLKS                16u
+#define  APP_CFG_MEM_BENCH_BLK_SIZE                32u          /* Bytes, multiple of 4                               */
+
+#define  APP_CFG_MEM_BENCH_NBR_SAMPLES           1000u          /* Number of get/put pairs per run                    */
+
+
+/*
+*********************************************************************************************************
+*                                 MUTEX PROTOCOL BENCHMARK CONFIGURATION
+*                             Size of the Task Stacks (# of OS_STK Entries)
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_MUTEX_BENCH_HIGH_PRIO             16u          /* Also the ceiling of the ceiling mutex              */
+#define  APP_CFG_MUTEX_BENCH_HIGH_STK_SIZE        128u
+
+#define  APP_CFG_MUTEX_BENCH_LOW_PRIO              18u          /* Must be lower than the high priority task          */
+#define  APP_CFG_MUTEX_BENCH_LOW_STK_SIZE         256u
+
+#define  APP_CFG_MUTEX_BENCH_NBR_SAMPLES         1000u          /* Number of sections per protocol and run            */
+#define  APP_CFG_MUTEX_BENCH_WORK_TIME          2000u           /* Length of a contended section (CPU_TS)             */
+#define  APP_CFG_MUTEX_BENCH_LOW_CONT_PERIOD       16u          /* Low contention: 1 contended section out of N       */
+
+
+/*
+*********************************************************************************************************
+*                                 CONTEXT SWITCH BENCHMARK CONFIGURATION
+*                             Size of the Task Stacks (# of OS_STK Entries)
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_CTX_BENCH_PONG_PRIO                4u
+#define  APP_CFG_CTX_BENCH_PONG_STK_SIZE          128u
+
+#define  APP_CFG_CTX_BENCH_PING_PRIO                5u          /* Must be lower than the pong tasks                  */
+#define  APP_CFG_CTX_BENCH_PING_STK_SIZE          128u
+
+#define  APP_CFG_CTX_BENCH_TASK_PRIO               17u          /* Must be lower than the ping tasks                  */
+#define  APP_CFG_CTX_BENCH_TASK_STK_SIZE          256u
+
+#define  APP_CFG_CTX_BENCH_NBR_SAMPLES           1000u          /* Number of round trips per pair and run             */
+
+
 /*
 *********************************************************************************************************
 *                                     TRACE / DEBUG CONFIGURATION
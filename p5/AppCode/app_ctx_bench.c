@@ -0,0 +1,463 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     CONTEXT SWITCH BENCHMARK
+*
+*                                         STM32F746G-DISCO
+*                                         Evaluation Board
+*
+* Filename      : app_ctx_bench.c
+* Version       : V1.00
+*
+* Note(s)       : (1) Two pairs of tasks ping-pong through their task semaphores : the ping task posts
+*                     the pong task, of higher priority, which runs at once then pends again so that
+*                     the ping task resumes.  Each round trip is two context switches.
+*
+*                     (a) The tasks of the APP_CTX_BENCH_PAIR_INT pair never use the FPU : their frames
+*                         hold R0-R12, LR, PC, xPSR and EXC_RETURN only.
+*
+*                     (b) The tasks of the APP_CTX_BENCH_PAIR_FP pair are created with
+*                         OS_OPT_TASK_SAVE_FP and do some floating point work before each switch : the
+*                         port also saves S0-S31 and FPSCR.
+*
+*                     Once per second, the control task starts APP_CFG_CTX_BENCH_NBR_SAMPLES round trips
+*                     of each pair in turn and reads the stack usage of the tasks.
+*
+*                 (2) With OS_CPU_CFG_STK_GUARD_EN enabled, every switch also moves the MPU stack guard :
+*                     the control task times OS_CPU_StkGuardSet() alone, the cost it adds to each switch.
+*
+*                 (3) The results are in App_Ctx_BenchResult, which can be watched from the debugger.
+*                     They are also printed through APP_TRACE_INFO().
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "stdio.h"
+#include  "stm32f7xx_hal.h"
+
+#include  "cpu.h"
+#include  "lib_mem.h"
+#include  "os.h"
+
+#include  "app_cfg.h"
+#include  "app_ctx_bench.h"
+#include  "bsp.h"
+
+
+#if (APP_CFG_CTX_BENCH_EN == DEF_ENABLED)
+#if (OS_CFG_TS_EN != DEF_ENABLED)
+#error  "app_ctx_bench.c: OS_CFG_TS_EN must be enabled in os_cfg.h"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+APP_CTX_BENCH_RESULT  App_Ctx_BenchResult;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB       App_Ctx_BenchTaskTCB;
+static  CPU_STK      App_Ctx_BenchTaskStk[APP_CFG_CTX_BENCH_TASK_STK_SIZE];
+
+static  OS_TCB       App_Ctx_BenchPingTaskTCB[APP_CTX_BENCH_NBR_PAIRS];
+static  CPU_STK      App_Ctx_BenchPingTaskStk[APP_CTX_BENCH_NBR_PAIRS][APP_CFG_CTX_BENCH_PING_STK_SIZE];
+
+static  OS_TCB       App_Ctx_BenchPongTaskTCB[APP_CTX_BENCH_NBR_PAIRS];
+static  CPU_STK      App_Ctx_BenchPongTaskStk[APP_CTX_BENCH_NBR_PAIRS][APP_CFG_CTX_BENCH_PONG_STK_SIZE];
+
+static  CPU_TS       App_Ctx_BenchPongTs;                       /* Timestamp of the pong task running                 */
+static  volatile  CPU_FP32  App_Ctx_BenchFpAcc[APP_CTX_BENCH_NBR_PAIRS];
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  App_Ctx_BenchTask     (void        *p_arg);
+
+static  void  App_Ctx_BenchPingTask (void        *p_arg);
+
+static  void  App_Ctx_BenchPongTask (void        *p_arg);
+
+static  void  App_Ctx_BenchFpWork   (CPU_INT32U   pair);
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+static  void  App_Ctx_BenchGuard    (void);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          App_Ctx_BenchInit()
+*
+* Description : Create the tasks of the benchmark.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application, after OSInit().
+*
+* Note(s)     : (1) The tasks of the APP_CTX_BENCH_PAIR_INT pair get a frame without FP registers,
+*                   see 'app_ctx_bench.c  Note #1'.
+*********************************************************************************************************
+*/
+
+void  App_Ctx_BenchInit (void)
+{
+    CPU_INT32U  pair;
+    CPU_TS      ts;
+    OS_OPT      opt;
+    OS_ERR      err;
+
+
+    Mem_Clr((void     *)&App_Ctx_BenchResult,
+            (CPU_SIZE_T) sizeof(App_Ctx_BenchResult));
+
+    ts                             = OS_TS_GET();
+    App_Ctx_BenchResult.TsOverhead = OS_TS_GET() - ts;
+
+    for (pair = 0u; pair < APP_CTX_BENCH_NBR_PAIRS; pair++) {
+        opt = (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR);
+        if (pair == APP_CTX_BENCH_PAIR_FP) {                    /* See Note #1                                        */
+            opt |= OS_OPT_TASK_SAVE_FP;
+        }
+
+        OSTaskCreate(&App_Ctx_BenchPongTaskTCB[pair],
+                     "Ctx Bench Pong",
+                      App_Ctx_BenchPongTask,
+                     (void *)pair,
+                      APP_CFG_CTX_BENCH_PONG_PRIO,
+                     &App_Ctx_BenchPongTaskStk[pair][0],
+                     (APP_CFG_CTX_BENCH_PONG_STK_SIZE / 10u),
+                      APP_CFG_CTX_BENCH_PONG_STK_SIZE,
+                      0u,
+                      0u,
+                      0,
+                      opt,
+                     &err);
+        my_assert(OS_ERR_NONE == err);
+
+        OSTaskCreate(&App_Ctx_BenchPingTaskTCB[pair],
+                     "Ctx Bench Ping",
+                      App_Ctx_BenchPingTask,
+                     (void *)pair,
+                      APP_CFG_CTX_BENCH_PING_PRIO,
+                     &App_Ctx_BenchPingTaskStk[pair][0],
+                     (APP_CFG_CTX_BENCH_PING_STK_SIZE / 10u),
+                      APP_CFG_CTX_BENCH_PING_STK_SIZE,
+                      0u,
+                      0u,
+                      0,
+                      opt,
+                     &err);
+        my_assert(OS_ERR_NONE == err);
+    }
+
+    OSTaskCreate(&App_Ctx_BenchTaskTCB,
+                 "Ctx Bench",
+                  App_Ctx_BenchTask,
+                  0,
+                  APP_CFG_CTX_BENCH_TASK_PRIO,
+                 &App_Ctx_BenchTaskStk[0],
+                 (APP_CFG_CTX_BENCH_TASK_STK_SIZE / 10u),
+                  APP_CFG_CTX_BENCH_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &err);
+    my_assert(OS_ERR_NONE == err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          App_Ctx_BenchTask()
+*
+* Description : Run both pairs once per second and print the results.
+*
+* Argument(s) : p_arg       Argument passed to 'App_Ctx_BenchTask()' by 'OSTaskCreate()'.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : (1) The ping task has a higher priority than this task : it runs all its round trips
+*                   before OSTaskSemPost() returns.
+*********************************************************************************************************
+*/
+
+static  void  App_Ctx_BenchTask (void  *p_arg)
+{
+    CPU_INT32U                  pair;
+    APP_CTX_BENCH_PAIR_RESULT  *p_result;
+    OS_ERR                      err;
+#if (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED)
+    CPU_STK_SIZE                stk_free;
+#endif
+
+
+    (void)p_arg;
+
+    for (;;) {
+        for (pair = 0u; pair < APP_CTX_BENCH_NBR_PAIRS; pair++) {
+            (void)OSTaskSemPost(&App_Ctx_BenchPingTaskTCB[pair], OS_OPT_POST_NONE, &err);
+            my_assert(OS_ERR_NONE == err);                      /* See Note #1                                        */
+
+#if (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED)
+            p_result = &App_Ctx_BenchResult.Pair[pair];
+            OSTaskStkChk(&App_Ctx_BenchPingTaskTCB[pair], &stk_free, &p_result->PingStkUsed, &err);
+            my_assert(OS_ERR_NONE == err);
+            OSTaskStkChk(&App_Ctx_BenchPongTaskTCB[pair], &stk_free, &p_result->PongStkUsed, &err);
+            my_assert(OS_ERR_NONE == err);
+#endif
+        }
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+        App_Ctx_BenchGuard();
+#endif
+        App_Ctx_BenchResult.NbrRuns++;
+        App_Ctx_BenchResult.NbrSamples = APP_CFG_CTX_BENCH_NBR_SAMPLES;
+
+        for (pair = 0u; pair < APP_CTX_BENCH_NBR_PAIRS; pair++) {
+            p_result = &App_Ctx_BenchResult.Pair[pair];
+            APP_TRACE_INFO(("Ctx bench (%s): switch %u/%u/%u (min/avg/max), round trip %u/%u (avg/max), "
+                            "stack %u/%u (ping/pong)\n",
+                            (pair == APP_CTX_BENCH_PAIR_FP) ? "FPU" : "integer",
+                            (unsigned)p_result->SwTimeMin,
+                            (unsigned)p_result->SwTimeAvg,
+                            (unsigned)p_result->SwTimeMax,
+                            (unsigned)p_result->RoundTripAvg,
+                            (unsigned)p_result->RoundTripMax,
+                            (unsigned)p_result->PingStkUsed,
+                            (unsigned)p_result->PongStkUsed));
+        }
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+        APP_TRACE_INFO(("Ctx bench: stack guard %u/%u/%u (min/avg/max) per switch\n",
+                        (unsigned)App_Ctx_BenchResult.GuardTimeMin,
+                        (unsigned)App_Ctx_BenchResult.GuardTimeAvg,
+                        (unsigned)App_Ctx_BenchResult.GuardTimeMax));
+#endif
+
+        OSTimeDlyHMSM(0u, 0u, 1u, 0u, OS_OPT_TIME_HMSM_STRICT, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        App_Ctx_BenchPingTask()
+*
+* Description : Run APP_CFG_CTX_BENCH_NBR_SAMPLES round trips with the pong task of the same pair each
+*               time the control task readies this task.
+*
+* Argument(s) : p_arg       Index of the pair, APP_CTX_BENCH_PAIR_xxx.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : (1) The pong task has a higher priority than this task : it has run and pends again by
+*                   the time OSTaskSemPost() returns.
+*********************************************************************************************************
+*/
+
+static  void  App_Ctx_BenchPingTask (void  *p_arg)
+{
+    CPU_INT32U                  pair;
+    CPU_INT32U                  i;
+    CPU_INT32U                  sw_sum;
+    CPU_INT32U                  rt_sum;
+    CPU_TS                      ts;
+    CPU_TS                      sw_time;
+    CPU_TS                      rt_time;
+    APP_CTX_BENCH_PAIR_RESULT  *p_result;
+    OS_ERR                      err;
+
+
+    pair     = (CPU_INT32U)p_arg;
+    p_result = &App_Ctx_BenchResult.Pair[pair];
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, 0, &err);
+        my_assert(OS_ERR_NONE == err);
+
+        sw_sum                 = 0u;
+        rt_sum                 = 0u;
+        p_result->SwTimeMin    = (CPU_TS)-1;
+        p_result->SwTimeMax    = 0u;
+        p_result->RoundTripMax = 0u;
+        for (i = 0u; i < APP_CFG_CTX_BENCH_NBR_SAMPLES; i++) {
+            if (pair == APP_CTX_BENCH_PAIR_FP) {
+                App_Ctx_BenchFpWork(pair);
+            }
+
+            ts      = OS_TS_GET();
+            (void)OSTaskSemPost(&App_Ctx_BenchPongTaskTCB[pair], OS_OPT_POST_NONE, &err);
+            rt_time = OS_TS_GET() - ts - App_Ctx_BenchResult.TsOverhead;
+            sw_time = App_Ctx_BenchPongTs - ts - App_Ctx_BenchResult.TsOverhead;
+            my_assert(OS_ERR_NONE == err);                      /* See Note #1                                        */
+
+            sw_sum += sw_time;
+            if (p_result->SwTimeMin > sw_time) {
+                p_result->SwTimeMin = sw_time;
+            }
+            if (p_result->SwTimeMax < sw_time) {
+                p_result->SwTimeMax = sw_time;
+            }
+            rt_sum += rt_time;
+            if (p_result->RoundTripMax < rt_time) {
+                p_result->RoundTripMax = rt_time;
+            }
+        }
+        p_result->SwTimeAvg    = sw_sum / APP_CFG_CTX_BENCH_NBR_SAMPLES;
+        p_result->RoundTripAvg = rt_sum / APP_CFG_CTX_BENCH_NBR_SAMPLES;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        App_Ctx_BenchPongTask()
+*
+* Description : Take the timestamp of each switch from the ping task of the same pair.
+*
+* Argument(s) : p_arg       Index of the pair, APP_CTX_BENCH_PAIR_xxx.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  App_Ctx_BenchPongTask (void  *p_arg)
+{
+    CPU_INT32U  pair;
+    OS_ERR      err;
+
+
+    pair = (CPU_INT32U)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, 0, &err);
+        App_Ctx_BenchPongTs = OS_TS_GET();
+        my_assert(OS_ERR_NONE == err);
+
+        if (pair == APP_CTX_BENCH_PAIR_FP) {
+            App_Ctx_BenchFpWork(pair);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         App_Ctx_BenchFpWork()
+*
+* Description : Do some floating point work so that the task has a live FP context when it is switched
+*               out.
+*
+* Argument(s) : pair        Index of the pair, APP_CTX_BENCH_PAIR_xxx.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : App_Ctx_BenchPingTask(),
+*               App_Ctx_BenchPongTask().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  App_Ctx_BenchFpWork (CPU_INT32U  pair)
+{
+    App_Ctx_BenchFpAcc[pair] = (App_Ctx_BenchFpAcc[pair] * 0.5f) + 1.0f;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         App_Ctx_BenchGuard()
+*
+* Description : Time the move of the MPU stack guard done by OSTaskSwHook() on each context switch.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : App_Ctx_BenchTask().
+*
+* Note(s)     : (1) The guard is set on the stack of the running task, where it already is : the region
+*                   registers are written with the same values, the task keeps running with its guard.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+static  void  App_Ctx_BenchGuard (void)
+{
+    CPU_INT32U  i;
+    CPU_INT32U  sum;
+    CPU_TS      ts;
+    CPU_TS      time;
+    CPU_SR_ALLOC();
+
+
+    sum                              = 0u;
+    App_Ctx_BenchResult.GuardTimeMin = (CPU_TS)-1;
+    App_Ctx_BenchResult.GuardTimeMax = 0u;
+    for (i = 0u; i < APP_CFG_CTX_BENCH_NBR_SAMPLES; i++) {
+        CPU_CRITICAL_ENTER();                                   /* As in OSTaskSwHook()                               */
+        ts   = OS_TS_GET();
+        OS_CPU_StkGuardSet(OSTCBCurPtr->StkBasePtr);            /* See Note #1                                        */
+        time = OS_TS_GET() - ts - App_Ctx_BenchResult.TsOverhead;
+        CPU_CRITICAL_EXIT();
+
+        sum += time;
+        if (App_Ctx_BenchResult.GuardTimeMin > time) {
+            App_Ctx_BenchResult.GuardTimeMin = time;
+        }
+        if (App_Ctx_BenchResult.GuardTimeMax < time) {
+            App_Ctx_BenchResult.GuardTimeMax = time;
+        }
+    }
+    App_Ctx_BenchResult.GuardTimeAvg = sum / APP_CFG_CTX_BENCH_NBR_SAMPLES;
+}
+#endif
+#endif
@@ -0,0 +1,112 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                     CONTEXT SWITCH BENCHMARK
+*
+*                                         STM32F746G-DISCO
+*                                         Evaluation Board
+*
+* Filename      : app_ctx_bench.h
+* Version       : V1.00
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CTX_BENCH_MODULE_PRESENT
+#define  APP_CTX_BENCH_MODULE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_CTX_BENCH_PAIR_INT                            0u   /* Tasks which never use the FPU                      */
+#define  APP_CTX_BENCH_PAIR_FP                             1u   /* Tasks using the FPU between switches               */
+#define  APP_CTX_BENCH_NBR_PAIRS                           2u
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*
+* Note(s) : (1) All times are in CPU timestamp counts (CPU clock cycles when the DWT cycle counter is
+*               used as the timestamp timer), less the time to read the timestamp.
+*********************************************************************************************************
+*/
+
+typedef  struct  app_ctx_bench_pair_result {
+    CPU_TS        SwTimeMin;                                    /* OSTaskSemPost() by ping to pong running            */
+    CPU_TS        SwTimeMax;
+    CPU_TS        SwTimeAvg;
+    CPU_TS        RoundTripMax;                                 /* OSTaskSemPost() by ping to ping running again      */
+    CPU_TS        RoundTripAvg;
+    CPU_STK_SIZE  PingStkUsed;                                  /* Stack used by the tasks, in CPU_STK elements       */
+    CPU_STK_SIZE  PongStkUsed;
+} APP_CTX_BENCH_PAIR_RESULT;
+
+typedef  struct  app_ctx_bench_result {
+    CPU_INT32U                 NbrRuns;
+    CPU_INT32U                 NbrSamples;                      /* Number of round trips per pair in the last run     */
+    CPU_TS                     TsOverhead;                      /* Time to read the timestamp, subtracted             */
+    CPU_TS                     GuardTimeMin;                    /* Moving the MPU stack guard, per context switch     */
+    CPU_TS                     GuardTimeMax;
+    CPU_TS                     GuardTimeAvg;
+    APP_CTX_BENCH_PAIR_RESULT  Pair[APP_CTX_BENCH_NBR_PAIRS];   /* Indexed by APP_CTX_BENCH_PAIR_xxx                  */
+} APP_CTX_BENCH_RESULT;
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  APP_CTX_BENCH_RESULT  App_Ctx_BenchResult;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  App_Ctx_BenchInit (void);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
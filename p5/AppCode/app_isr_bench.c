@@ -0,0 +1,361 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                         ISR POST BENCHMARK
+*
+*                                         STM32F746G-DISCO
+*                                         Evaluation Board
+*
+* Filename      : app_isr_bench.c
+* Version       : V1.00
+*
+* Note(s)       : (1) An unused peripheral interrupt (CAN2 SCE) is pended by software.  Its handler
+*                     posts a semaphore with OS_OPT_POST_ALL to APP_CFG_ISR_BENCH_NBR_WAIT waiting
+*                     tasks.  For every interrupt the benchmark records:
+*
+*                         (a) The time the ISR spends in OSSemPost().
+*                         (b) The time from ISR entry to the highest priority waiter running.
+*
+*                     Build once with OS_CFG_ISR_POST_DEFERRED_EN enabled and once with it disabled
+*                     to compare the deferred and the direct ISR posts.  With direct posts, (a) and
+*                     the interrupt disable time grow with the number of waiters.  With deferred
+*                     posts, they don't, at the cost of a context switch to the ISR post queue task
+*                     in (b).
+*
+*                 (2) The results are in App_ISR_BenchResult, which can be watched from the debugger.
+*                     They are also printed through APP_TRACE_INFO().
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "stdio.h"
+#include  "stm32f7xx_hal.h"
+
+#include  "cpu.h"
+#include  "lib_mem.h"
+#include  "os.h"
+
+#include  "app_cfg.h"
+#include  "app_isr_bench.h"
+#include  "bsp.h"
+
+
+#if (APP_CFG_ISR_BENCH_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_ISR_BENCH_IRQ                      CAN2_SCE_IRQn   /* See Note #1                                        */
+#define  APP_ISR_BENCH_IRQ_PRIO                 0x05u
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+APP_ISR_BENCH_RESULT  App_ISR_BenchResult;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB       App_ISR_BenchTaskTCB;
+static  CPU_STK      App_ISR_BenchTaskStk[APP_CFG_ISR_BENCH_TASK_STK_SIZE];
+
+static  OS_TCB       App_ISR_BenchWaitTaskTCB[APP_CFG_ISR_BENCH_NBR_WAIT];
+static  CPU_STK      App_ISR_BenchWaitTaskStk[APP_CFG_ISR_BENCH_NBR_WAIT][APP_CFG_ISR_BENCH_WAIT_STK_SIZE];
+
+static  OS_SEM       App_ISR_BenchSem;
+
+static  CPU_TS       App_ISR_BenchEntryTS;                      /* Timestamp of the ISR entry                         */
+static  CPU_TS       App_ISR_BenchPostTime;                     /* Time spent in OSSemPost() by the last ISR          */
+static  CPU_TS       App_ISR_BenchLat;                          /* ISR entry to first waiter for the last ISR         */
+static  CPU_INT32U   App_ISR_BenchWakeCtr;                      /* Number of waiters that ran since the last ISR      */
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  App_ISR_BenchTask     (void  *p_arg);
+static  void  App_ISR_BenchWaitTask (void  *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                          App_ISR_BenchInit()
+*
+* Description : Create the semaphore and the tasks of the benchmark and enable its interrupt.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application, after OSInit().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  App_ISR_BenchInit (void)
+{
+    CPU_INT32U  i;
+    OS_ERR      err;
+
+
+    Mem_Clr((void     *)&App_ISR_BenchResult,
+            (CPU_SIZE_T) sizeof(App_ISR_BenchResult));
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    App_ISR_BenchResult.Deferred = DEF_YES;
+#else
+    App_ISR_BenchResult.Deferred = DEF_NO;
+#endif
+
+    OSSemCreate(&App_ISR_BenchSem,
+                "ISR Bench Sem",
+                 0u,
+                &err);
+    my_assert(OS_ERR_NONE == err);
+
+    for (i = 0u; i < APP_CFG_ISR_BENCH_NBR_WAIT; i++) {
+        OSTaskCreate(&App_ISR_BenchWaitTaskTCB[i],
+                     "ISR Bench Wait Task",
+                      App_ISR_BenchWaitTask,
+                      0,
+                     (APP_CFG_ISR_BENCH_WAIT_PRIO + i),
+                     &App_ISR_BenchWaitTaskStk[i][0],
+                     (APP_CFG_ISR_BENCH_WAIT_STK_SIZE / 10u),
+                      APP_CFG_ISR_BENCH_WAIT_STK_SIZE,
+                      0u,
+                      0u,
+                      0,
+                     (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                     &err);
+        my_assert(OS_ERR_NONE == err);
+    }
+
+    OSTaskCreate(&App_ISR_BenchTaskTCB,
+                 "ISR Bench Task",
+                  App_ISR_BenchTask,
+                  0,
+                  APP_CFG_ISR_BENCH_TASK_PRIO,
+                 &App_ISR_BenchTaskStk[0],
+                 (APP_CFG_ISR_BENCH_TASK_STK_SIZE / 10u),
+                  APP_CFG_ISR_BENCH_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &err);
+    my_assert(OS_ERR_NONE == err);
+
+    HAL_NVIC_SetPriority(APP_ISR_BENCH_IRQ, APP_ISR_BENCH_IRQ_PRIO, 0u);
+    HAL_NVIC_EnableIRQ(APP_ISR_BENCH_IRQ);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          App_ISR_BenchTask()
+*
+* Description : Trigger APP_CFG_ISR_BENCH_NBR_SAMPLES interrupts once per second and update the results.
+*
+* Argument(s) : p_arg       Argument passed to 'App_ISR_BenchTask()' by 'OSTaskCreate()'.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : (1) All the waiters have a higher priority than this task.  When the interrupt returns,
+*                   they all ran and are pending on the semaphore again.
+*********************************************************************************************************
+*/
+
+static  void  App_ISR_BenchTask (void  *p_arg)
+{
+    CPU_INT32U  i;
+    CPU_INT32U  post_sum;
+    CPU_INT32U  lat_sum;
+    CPU_TS      post_min;
+    CPU_TS      post_max;
+    CPU_TS      lat_min;
+    CPU_TS      lat_max;
+    OS_ERR      err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        post_sum = 0u;
+        lat_sum  = 0u;
+        post_min = (CPU_TS)-1;
+        post_max = 0u;
+        lat_min  = (CPU_TS)-1;
+        lat_max  = 0u;
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+        OSLatReset(&err);
+#endif
+
+        for (i = 0u; i < APP_CFG_ISR_BENCH_NBR_SAMPLES; i++) {
+            App_ISR_BenchWakeCtr = 0u;
+            HAL_NVIC_SetPendingIRQ(APP_ISR_BENCH_IRQ);          /* The ISR runs right away                            */
+            __DSB();
+            __ISB();
+                                                                /* See Note #1                                        */
+            my_assert(App_ISR_BenchWakeCtr == APP_CFG_ISR_BENCH_NBR_WAIT);
+
+            post_sum += App_ISR_BenchPostTime;
+            if (post_min > App_ISR_BenchPostTime) {
+                post_min = App_ISR_BenchPostTime;
+            }
+            if (post_max < App_ISR_BenchPostTime) {
+                post_max = App_ISR_BenchPostTime;
+            }
+
+            lat_sum  += App_ISR_BenchLat;
+            if (lat_min > App_ISR_BenchLat) {
+                lat_min = App_ISR_BenchLat;
+            }
+            if (lat_max < App_ISR_BenchLat) {
+                lat_max = App_ISR_BenchLat;
+            }
+        }
+
+        App_ISR_BenchResult.NbrRuns++;
+        App_ISR_BenchResult.NbrSamples  = APP_CFG_ISR_BENCH_NBR_SAMPLES;
+        App_ISR_BenchResult.PostTimeMin = post_min;
+        App_ISR_BenchResult.PostTimeMax = post_max;
+        App_ISR_BenchResult.PostTimeAvg = post_sum / APP_CFG_ISR_BENCH_NBR_SAMPLES;
+        App_ISR_BenchResult.LatMin      = lat_min;
+        App_ISR_BenchResult.LatMax      = lat_max;
+        App_ISR_BenchResult.LatAvg      = lat_sum  / APP_CFG_ISR_BENCH_NBR_SAMPLES;
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+        App_ISR_BenchResult.IntDisP999  = OSLatPercentileGet(OS_LAT_HIST_INT_DIS, 999u, &err);
+#endif
+
+        APP_TRACE_INFO(("ISR bench (%s, %u waiters): post %u/%u/%u, lat %u/%u/%u (min/avg/max), int dis p99.9 %u\n",
+                        (App_ISR_BenchResult.Deferred == DEF_YES) ? "deferred" : "direct",
+                        (unsigned)APP_CFG_ISR_BENCH_NBR_WAIT,
+                        (unsigned)App_ISR_BenchResult.PostTimeMin,
+                        (unsigned)App_ISR_BenchResult.PostTimeAvg,
+                        (unsigned)App_ISR_BenchResult.PostTimeMax,
+                        (unsigned)App_ISR_BenchResult.LatMin,
+                        (unsigned)App_ISR_BenchResult.LatAvg,
+                        (unsigned)App_ISR_BenchResult.LatMax,
+                        (unsigned)App_ISR_BenchResult.IntDisP999));
+
+        OSTimeDlyHMSM(0u, 0u, 1u, 0u, OS_OPT_TIME_HMSM_STRICT, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        App_ISR_BenchWaitTask()
+*
+* Description : Pend on the benchmark semaphore.  The first waiter to run measures the latency.
+*
+* Argument(s) : p_arg       Argument passed to 'App_ISR_BenchWaitTask()' by 'OSTaskCreate()'.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  App_ISR_BenchWaitTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSSemPend(&App_ISR_BenchSem,
+                         0u,
+                         OS_OPT_PEND_BLOCKING,
+                         DEF_NULL,
+                        &err);
+        if (App_ISR_BenchWakeCtr == 0u) {
+            App_ISR_BenchLat = OS_TS_GET() - App_ISR_BenchEntryTS;
+        }
+        App_ISR_BenchWakeCtr++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CAN2_SCE_IRQHandler()
+*
+* Description : Benchmark interrupt, pended by App_ISR_BenchTask().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is an ISR.
+*
+* Note(s)     : (1) Overrides the weak handler of the startup file.  The OS-Aware sequence is described
+*                   in the 'README_ISR_HANDLER.txt' file.
+*********************************************************************************************************
+*/
+
+void  CAN2_SCE_IRQHandler (void)
+{
+    CPU_TS  ts_post;
+    OS_ERR  err;
+    CPU_SR_ALLOC();                                             /* Allocate storage for CPU Status Register           */
+
+
+    App_ISR_BenchEntryTS = OS_TS_GET();
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell OS that we are starting an ISR                */
+    CPU_CRITICAL_EXIT();
+
+    ts_post = OS_TS_GET();
+    (void)OSSemPost(&App_ISR_BenchSem,
+                     OS_OPT_POST_ALL,
+                    &err);
+    App_ISR_BenchPostTime = OS_TS_GET() - ts_post;
+
+    OSIntExit();                                                /* Tell OS that we are leaving the ISR                */
+}
+#endif
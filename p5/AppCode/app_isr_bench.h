@@ -0,0 +1,94 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                         ISR POST BENCHMARK
+*
+*                                         STM32F746G-DISCO
+*                                         Evaluation Board
+*
+* Filename      : app_isr_bench.h
+* Version       : V1.00
+*********************************************************************************************************
+*/
+
+#ifndef  APP_ISR_BENCH_MODULE_PRESENT
+#define  APP_ISR_BENCH_MODULE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*
+* Note(s) : (1) All times are in CPU timestamp counts (CPU clock cycles when the DWT cycle counter is
+*               used as the timestamp timer).
+*********************************************************************************************************
+*/
+
+typedef  struct  app_isr_bench_result {
+    CPU_BOOLEAN  Deferred;                                      /* DEF_YES if ISR posts go through the ISR post queue */
+    CPU_INT32U   NbrRuns;
+    CPU_INT32U   NbrSamples;                                    /* Number of samples in the last run                  */
+    CPU_TS       PostTimeMin;                                   /* Time spent in OSSemPost() by the ISR               */
+    CPU_TS       PostTimeMax;
+    CPU_TS       PostTimeAvg;
+    CPU_TS       LatMin;                                        /* ISR entry to highest priority waiter running       */
+    CPU_TS       LatMax;
+    CPU_TS       LatAvg;
+    CPU_TS       IntDisP999;                                    /* 99.9th percentile of the int. disable time         */
+} APP_ISR_BENCH_RESULT;
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  APP_ISR_BENCH_RESULT  App_ISR_BenchResult;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  App_ISR_BenchInit (void);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -49,6 +49,10 @@
 #include  "os_app_hooks.h"
 
 #include  "app_cfg.h"
+#include  "app_ctx_bench.h"
+#include  "app_isr_bench.h"
+#include  "app_mem_bench.h"
+#include  "app_mutex_bench.h"
 #include  "bsp.h"
 #include  "bsp_led.h"
 #include  "bsp_clock.h"
@@ -97,6 +101,18 @@ static void led_task(void * p_arg)
     LED_Task_arg * p_LED_Task_arg = (LED_Task_arg *) p_arg;
     OS_ERR  err;
     CPU_TS  ts;
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    // One job per toggle, due by the next toggle: a GPIO toggle
+    // takes well under the 1 tick WCET
+    OSTaskEdfSet((OS_TCB *) 0,
+                 (OS_TICK ) ((p_LED_Task_arg->period_ms * OS_CFG_TICK_RATE_HZ) / 1000u),
+                 (OS_TICK ) 0,
+                 (OS_TICK ) 1,
+                 &err);
+    my_assert(OS_ERR_NONE == err);
+#endif
+
     for (;;)
     {
 
@@ -114,11 +130,34 @@ static void led_task(void * p_arg)
                     (OS_ERR   *) &err);
         my_assert(OS_ERR_NONE == err);
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+        OSTaskEdfWait(&err);  // Job done, wait for the next period
+#else
         OSTimeDlyHMSM(0,0,0, p_LED_Task_arg->period_ms, OS_OPT_TASK_NONE, &err);
+#endif
         my_assert(OS_ERR_NONE == err);
     }
 }
 
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+// Name the owner of a memory allocation for Mem_TrackOutput():
+// the running task, "ISR" in an interrupt, "Other" before OSStart()
+// Called by uC/LIB with interrupts disabled
+// *****************************************************************
+static const CPU_CHAR * mem_owner_get(void)
+{
+    if (OSIntNestingCtr > 0u)
+    {
+        return ((const CPU_CHAR *)"ISR");
+    }
+    if (OSTCBCurPtr == (OS_TCB *)0)
+    {
+        return ((const CPU_CHAR *)0);
+    }
+    return ((const CPU_CHAR *)OSTCBCurPtr->NamePtr);
+}
+#endif
+
 // Flash LED1 at 1 Hz (500ms on / 500ms off)
 // *****************************************************************
 static void startup_task(void * p_arg)
@@ -136,9 +175,25 @@ static void startup_task(void * p_arg)
     LED_Task_arg[1].period_ms   = 100;
     LED_Task_arg[1].p_Led_Mutex = &Led_Mutex;
 
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    // A GPIO toggle is rarely contended: an inheritance mutex is
+    // taken and released without entering the kernel (a ceiling
+    // mutex always does to raise its owner)
     OSMutexCreate (&Led_Mutex,
                    "LED_MUTEX",
                    &err);
+#elif (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    // Short sections shared by the LED tasks only: the ceiling is
+    // the priority of the highest priority LED task
+    OSMutexCreateCeiling (&Led_Mutex,
+                          "LED_MUTEX",
+                          TASK_LED_PRIO,
+                          &err);
+#else
+    OSMutexCreate (&Led_Mutex,
+                   "LED_MUTEX",
+                   &err);
+#endif
     my_assert(OS_ERR_NONE == err);
 
     // Create the BLINKY task
@@ -148,7 +203,11 @@ static void startup_task(void * p_arg)
                      "Blinky Task",
                      (OS_TASK_PTR ) led_task,
                      &LED_Task_arg[i],
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+                     OS_CFG_SCHED_EDF_PRIO,  // Ordered by deadline, see led_task()
+#else
                      TASK_LED_PRIO + i,
+#endif
                      &TaskLED_Stk[i][0],
                      (TASK_LED_STK_SIZE / 10u),
                      TASK_LED_STK_SIZE,
@@ -187,7 +246,50 @@ int main(void)
     OSInit(&err);
     my_assert(OS_ERR_NONE == err);
 
-    // Create the GUI task
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+    // Tasks sharing a priority and created with a 0 time quanta
+    // take turns every 5 ms
+    OSSchedRoundRobinCfg(DEF_ENABLED,
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+                         5000u,
+#else
+                         (OS_CFG_TICK_RATE_HZ / 200u),
+#endif
+                         &err);
+    my_assert(OS_ERR_NONE == err);
+#endif
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+    // STOP mode stops the PLLSAI clocking the LTDC and the SDRAM
+    // refresh: the idle task goes no deeper than SLEEP while the
+    // display is on
+    OSPwrLatMaxSet(OS_CFG_PWR_SLEEP_LAT_US, &err);
+    my_assert(OS_ERR_NONE == err);
+#endif
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+    Mem_TrackOwnerFnctSet(mem_owner_get);  // Account allocations to tasks (see Mem_TrackOutput())
+#endif
+
+    OS_TRACE_INIT();      // Init. the trace recorder and measure its overhead
+    OS_TRACE_START();     // Record from here, stop with OS_TRACE_STOP()
+
+#if (APP_CFG_ISR_BENCH_EN == DEF_ENABLED)
+    App_ISR_BenchInit();  // Compare direct and deferred ISR posts (see app_isr_bench.c)
+#endif
+#if (APP_CFG_MEM_BENCH_EN == DEF_ENABLED)
+    App_Mem_BenchInit();  // Compare lock-free and critical section partitions (see app_mem_bench.c)
+#endif
+#if (APP_CFG_MUTEX_BENCH_EN == DEF_ENABLED)
+    App_Mutex_BenchInit();  // Compare priority inheritance and ceiling mutexes (see app_mutex_bench.c)
+#endif
+#if (APP_CFG_CTX_BENCH_EN == DEF_ENABLED)
+    App_Ctx_BenchInit();  // Compare integer and FPU context switches (see app_ctx_bench.c)
+#endif
+
+    // Create the GUI task: anti-aliasing and the zoom/rotate demos use
+    // the FPU, the other tasks are created without OS_OPT_TASK_SAVE_FP
+    // and switch without FP registers
     OSTaskCreate(&AppTaskGUI_TCB,
                  "uC/GUI Task",
                  (OS_TASK_PTR ) GUI_DemoTask,
@@ -199,7 +301,7 @@ int main(void)
                  0u,
                  0u,
                  0,
-                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR | OS_OPT_TASK_SAVE_FP),
                  &err
             );
     my_assert(OS_ERR_NONE == err);
@@ -221,6 +323,19 @@ int main(void)
                  &err);
     my_assert(OS_ERR_NONE == err);
 
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    // The startup task spins once the LED tasks are created: allow it
+    // 10 ms every 100 ms and suspend it for the rest of the period so
+    // the lower priority tasks and the idle task still get the CPU
+    OSTaskBudgetSet(&StartupTask_TCB,
+                    (OS_TICK) (OS_CFG_TICK_RATE_HZ / 100u),
+                    (OS_TICK) (OS_CFG_TICK_RATE_HZ / 10u),
+                    (OS_PRIO) 0u,
+                    OS_OPT_BUDGET_SUSPEND,
+                    &err);
+    my_assert(OS_ERR_NONE == err);
+#endif
+
     // TODO: Start multitasking (i.e. give control to uC/OS-III)
     OSStart(&err);
     my_assert(OS_ERR_NONE == err);
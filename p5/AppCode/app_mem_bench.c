@@ -0,0 +1,325 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      MEMORY PARTITION BENCHMARK
+*
+*                                         STM32F746G-DISCO
+*                                         Evaluation Board
+*
+* Filename      : app_mem_bench.c
+* Version       : V1.00
+*
+* Note(s)       : (1) Once per second, the benchmark task gets and releases blocks of a partition
+*                     APP_CFG_MEM_BENCH_NBR_SAMPLES times and records the cycles spent in OSMemGet()
+*                     and OSMemPut().  The same number of times, it pends an unused peripheral
+*                     interrupt (CAN2 RX1) whose handler gets and releases a block.
+*
+*                     Build once with OS_CFG_MEM_LOCK_FREE_EN enabled and once with it disabled to
+*                     compare the lock-free partitions with the critical section ones.  The maximum
+*                     interrupt disable time seen while the task measures is also recorded, it drops
+*                     to the kernel's other critical sections with the lock-free partitions.
+*
+*                 (2) The results are in App_Mem_BenchResult, which can be watched from the debugger.
+*                     They are also printed through APP_TRACE_INFO().
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "stdio.h"
+#include  "stm32f7xx_hal.h"
+
+#include  "cpu.h"
+#include  "lib_mem.h"
+#include  "os.h"
+
+#include  "app_cfg.h"
+#include  "app_mem_bench.h"
+#include  "bsp.h"
+
+
+#if (APP_CFG_MEM_BENCH_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_MEM_BENCH_IRQ                      CAN2_RX1_IRQn   /* See Note #1                                        */
+#define  APP_MEM_BENCH_IRQ_PRIO                 0x05u
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+APP_MEM_BENCH_RESULT  App_Mem_BenchResult;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB       App_Mem_BenchTaskTCB;
+static  CPU_STK      App_Mem_BenchTaskStk[APP_CFG_MEM_BENCH_TASK_STK_SIZE];
+
+static  OS_MEM       App_Mem_BenchPart;
+static  CPU_INT32U   App_Mem_BenchPartStorage[APP_CFG_MEM_BENCH_NBR_BLKS][APP_CFG_MEM_BENCH_BLK_SIZE / 4u];
+
+static  CPU_TS       App_Mem_BenchIsrTime;                      /* OSMemGet() + OSMemPut() time of the last ISR       */
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  App_Mem_BenchTask (void  *p_arg);
+
+
+/*
+*********************************************************************************************************
+*                                          App_Mem_BenchInit()
+*
+* Description : Create the partition and the task of the benchmark and enable its interrupt.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application, after OSInit().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  App_Mem_BenchInit (void)
+{
+    OS_ERR  err;
+
+
+    Mem_Clr((void     *)&App_Mem_BenchResult,
+            (CPU_SIZE_T) sizeof(App_Mem_BenchResult));
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    App_Mem_BenchResult.LockFree = DEF_YES;
+#else
+    App_Mem_BenchResult.LockFree = DEF_NO;
+#endif
+
+    OSMemCreate(&App_Mem_BenchPart,
+                "Mem Bench Partition",
+                &App_Mem_BenchPartStorage[0][0],
+                 APP_CFG_MEM_BENCH_NBR_BLKS,
+                 APP_CFG_MEM_BENCH_BLK_SIZE,
+                &err);
+    my_assert(OS_ERR_NONE == err);
+
+    OSTaskCreate(&App_Mem_BenchTaskTCB,
+                 "Mem Bench Task",
+                  App_Mem_BenchTask,
+                  0,
+                  APP_CFG_MEM_BENCH_TASK_PRIO,
+                 &App_Mem_BenchTaskStk[0],
+                 (APP_CFG_MEM_BENCH_TASK_STK_SIZE / 10u),
+                  APP_CFG_MEM_BENCH_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &err);
+    my_assert(OS_ERR_NONE == err);
+
+    HAL_NVIC_SetPriority(APP_MEM_BENCH_IRQ, APP_MEM_BENCH_IRQ_PRIO, 0u);
+    HAL_NVIC_EnableIRQ(APP_MEM_BENCH_IRQ);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          App_Mem_BenchTask()
+*
+* Description : Measure OSMemGet() and OSMemPut() once per second and update the results.
+*
+* Argument(s) : p_arg       Argument passed to 'App_Mem_BenchTask()' by 'OSTaskCreate()'.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : (1) Half of the blocks are held while measuring so that the free list is neither
+*                   empty nor full.
+*********************************************************************************************************
+*/
+
+static  void  App_Mem_BenchTask (void  *p_arg)
+{
+    void        *p_held[APP_CFG_MEM_BENCH_NBR_BLKS / 2u];
+    void        *p_blk;
+    CPU_INT32U   i;
+    CPU_INT32U   get_sum;
+    CPU_INT32U   put_sum;
+    CPU_INT32U   isr_sum;
+    CPU_TS       ts;
+    CPU_TS       get_time;
+    CPU_TS       put_time;
+    CPU_TS       get_min;
+    CPU_TS       get_max;
+    CPU_TS       put_min;
+    CPU_TS       put_max;
+    CPU_TS       isr_max;
+    CPU_TS_TMR   int_dis_max;
+    OS_ERR       err;
+
+
+    (void)p_arg;
+
+    for (i = 0u; i < (APP_CFG_MEM_BENCH_NBR_BLKS / 2u); i++) { /* See Note #1                                        */
+        p_held[i] = OSMemGet(&App_Mem_BenchPart, &err);
+        my_assert(OS_ERR_NONE == err);
+    }
+
+    for (;;) {
+        get_sum = 0u;
+        put_sum = 0u;
+        isr_sum = 0u;
+        get_min = (CPU_TS)-1;
+        get_max = 0u;
+        put_min = (CPU_TS)-1;
+        put_max = 0u;
+        isr_max = 0u;
+
+        (void)CPU_IntDisMeasMaxCurReset();
+        for (i = 0u; i < APP_CFG_MEM_BENCH_NBR_SAMPLES; i++) {
+            ts       = OS_TS_GET();
+            p_blk    = OSMemGet(&App_Mem_BenchPart, &err);
+            get_time = OS_TS_GET() - ts;
+            my_assert(OS_ERR_NONE == err);
+
+            ts       = OS_TS_GET();
+            OSMemPut(&App_Mem_BenchPart, p_blk, &err);
+            put_time = OS_TS_GET() - ts;
+            my_assert(OS_ERR_NONE == err);
+
+            get_sum += get_time;
+            if (get_min > get_time) {
+                get_min = get_time;
+            }
+            if (get_max < get_time) {
+                get_max = get_time;
+            }
+            put_sum += put_time;
+            if (put_min > put_time) {
+                put_min = put_time;
+            }
+            if (put_max < put_time) {
+                put_max = put_time;
+            }
+
+            HAL_NVIC_SetPendingIRQ(APP_MEM_BENCH_IRQ);          /* The ISR runs right away                            */
+            __DSB();
+            __ISB();
+            isr_sum += App_Mem_BenchIsrTime;
+            if (isr_max < App_Mem_BenchIsrTime) {
+                isr_max = App_Mem_BenchIsrTime;
+            }
+        }
+        int_dis_max = CPU_IntDisMeasMaxCurGet();
+
+        App_Mem_BenchResult.NbrRuns++;
+        App_Mem_BenchResult.NbrSamples = APP_CFG_MEM_BENCH_NBR_SAMPLES;
+        App_Mem_BenchResult.GetTimeMin = get_min;
+        App_Mem_BenchResult.GetTimeMax = get_max;
+        App_Mem_BenchResult.GetTimeAvg = get_sum / APP_CFG_MEM_BENCH_NBR_SAMPLES;
+        App_Mem_BenchResult.PutTimeMin = put_min;
+        App_Mem_BenchResult.PutTimeMax = put_max;
+        App_Mem_BenchResult.PutTimeAvg = put_sum / APP_CFG_MEM_BENCH_NBR_SAMPLES;
+        App_Mem_BenchResult.IsrTimeMax = isr_max;
+        App_Mem_BenchResult.IsrTimeAvg = isr_sum / APP_CFG_MEM_BENCH_NBR_SAMPLES;
+        App_Mem_BenchResult.IntDisMax  = (CPU_TS)int_dis_max;
+
+        APP_TRACE_INFO(("Mem bench (%s): get %u/%u/%u, put %u/%u/%u (min/avg/max), "
+                        "ISR get+put %u/%u (avg/max), int dis max %u\n",
+                        (App_Mem_BenchResult.LockFree == DEF_YES) ? "lock-free" : "critical section",
+                        (unsigned)App_Mem_BenchResult.GetTimeMin,
+                        (unsigned)App_Mem_BenchResult.GetTimeAvg,
+                        (unsigned)App_Mem_BenchResult.GetTimeMax,
+                        (unsigned)App_Mem_BenchResult.PutTimeMin,
+                        (unsigned)App_Mem_BenchResult.PutTimeAvg,
+                        (unsigned)App_Mem_BenchResult.PutTimeMax,
+                        (unsigned)App_Mem_BenchResult.IsrTimeAvg,
+                        (unsigned)App_Mem_BenchResult.IsrTimeMax,
+                        (unsigned)App_Mem_BenchResult.IntDisMax));
+
+        OSTimeDlyHMSM(0u, 0u, 1u, 0u, OS_OPT_TIME_HMSM_STRICT, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CAN2_RX1_IRQHandler()
+*
+* Description : Benchmark interrupt, pended by App_Mem_BenchTask().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is an ISR.
+*
+* Note(s)     : (1) Overrides the weak handler of the startup file.  The OS-Aware sequence is described
+*                   in the 'README_ISR_HANDLER.txt' file.
+*********************************************************************************************************
+*/
+
+void  CAN2_RX1_IRQHandler (void)
+{
+    void    *p_blk;
+    CPU_TS   ts;
+    OS_ERR   err;
+    CPU_SR_ALLOC();                                             /* Allocate storage for CPU Status Register           */
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell OS that we are starting an ISR                */
+    CPU_CRITICAL_EXIT();
+
+    ts    = OS_TS_GET();
+    p_blk = OSMemGet(&App_Mem_BenchPart, &err);
+    if (err == OS_ERR_NONE) {
+        OSMemPut(&App_Mem_BenchPart, p_blk, &err);
+    }
+    App_Mem_BenchIsrTime = OS_TS_GET() - ts;
+
+    OSIntExit();                                                /* Tell OS that we are leaving the ISR                */
+}
+#endif
@@ -0,0 +1,96 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                         MEMORY PARTITION BENCHMARK
+*
+*                                         STM32F746G-DISCO
+*                                         Evaluation Board
+*
+* Filename      : app_mem_bench.h
+* Version       : V1.00
+*********************************************************************************************************
+*/
+
+#ifndef  APP_MEM_BENCH_MODULE_PRESENT
+#define  APP_MEM_BENCH_MODULE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*
+* Note(s) : (1) All times are in CPU timestamp counts (CPU clock cycles when the DWT cycle counter is
+*               used as the timestamp timer).
+*********************************************************************************************************
+*/
+
+typedef  struct  app_mem_bench_result {
+    CPU_BOOLEAN  LockFree;                                      /* DEF_YES if OSMemGet()/OSMemPut() are lock-free     */
+    CPU_INT32U   NbrRuns;
+    CPU_INT32U   NbrSamples;                                    /* Number of samples in the last run                  */
+    CPU_TS       GetTimeMin;                                    /* Time spent in OSMemGet() by a task                 */
+    CPU_TS       GetTimeMax;
+    CPU_TS       GetTimeAvg;
+    CPU_TS       PutTimeMin;                                    /* Time spent in OSMemPut() by a task                 */
+    CPU_TS       PutTimeMax;
+    CPU_TS       PutTimeAvg;
+    CPU_TS       IsrTimeMax;                                    /* OSMemGet() + OSMemPut() by an ISR                  */
+    CPU_TS       IsrTimeAvg;
+    CPU_TS       IntDisMax;                                     /* Max. int. disable time while the task measured     */
+} APP_MEM_BENCH_RESULT;
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  APP_MEM_BENCH_RESULT  App_Mem_BenchResult;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  App_Mem_BenchInit (void);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
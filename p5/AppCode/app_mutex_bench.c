@@ -0,0 +1,471 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                        MUTEX PROTOCOL BENCHMARK
+*
+*                                         STM32F746G-DISCO
+*                                         Evaluation Board
+*
+* Filename      : app_mutex_bench.c
+* Version       : V1.00
+*
+* Note(s)       : (1) Once per second, the low priority task of the benchmark runs the same measures on a
+*                     priority inheritance mutex then on a priority ceiling mutex whose ceiling is the
+*                     priority of the high priority task :
+*
+*                     (a) APP_CFG_MUTEX_BENCH_NBR_SAMPLES uncontended OSMutexPend()/OSMutexPost() pairs.
+*
+*                     (b) APP_CFG_MUTEX_BENCH_NBR_SAMPLES contended sections.  The low priority task gets
+*                         the mutex, readies the high priority task which pends on the mutex, works for
+*                         APP_CFG_MUTEX_BENCH_WORK_TIME then releases the mutex.
+*
+*                     With inheritance, the high priority task preempts the owner, blocks on the mutex,
+*                     raises the owner and preempts it again when the mutex is released : 4 context
+*                     switches per section.  With the ceiling, the owner already runs at the priority of
+*                     the high priority task which only runs once the mutex is released and gets it
+*                     without blocking : 2 context switches per section.
+*
+*                     (c) APP_CFG_MUTEX_BENCH_NBR_SAMPLES acquire/release cycles at three contention levels :
+*                         no contended section, one out of APP_CFG_MUTEX_BENCH_LOW_CONT_PERIOD and all of
+*                         them.  A cycle is the time spent in OSMutexPend() and OSMutexPost(), the latter
+*                         includes the run of the high priority task when the section was contended.
+*
+*                     Build once with OS_CFG_MUTEX_FAST_EN enabled and once with it disabled to compare
+*                     the fast path of the inheritance mutex with the kernel path.  Ceiling mutexes
+*                     always take the kernel path.
+*
+*                 (2) The results are in App_Mutex_BenchResult, which can be watched from the debugger.
+*                     They are also printed through APP_TRACE_INFO().
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "stdio.h"
+#include  "stm32f7xx_hal.h"
+
+#include  "cpu.h"
+#include  "lib_mem.h"
+#include  "os.h"
+
+#include  "app_cfg.h"
+#include  "app_mutex_bench.h"
+#include  "bsp.h"
+
+
+#if (APP_CFG_MUTEX_BENCH_EN == DEF_ENABLED)
+#if (OS_CFG_MUTEX_CEILING_EN != DEF_ENABLED)
+#error  "app_mutex_bench.c: OS_CFG_MUTEX_CEILING_EN must be enabled in os_cfg.h"
+#endif
+#if ((OS_CFG_DBG_EN          != DEF_ENABLED) && \
+     (OS_CFG_TASK_PROFILE_EN != DEF_ENABLED))
+#error  "app_mutex_bench.c: OS_CFG_DBG_EN or OS_CFG_TASK_PROFILE_EN must be enabled to count context switches"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+APP_MUTEX_BENCH_RESULT  App_Mutex_BenchResult;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB       App_Mutex_BenchLowTaskTCB;
+static  CPU_STK      App_Mutex_BenchLowTaskStk[APP_CFG_MUTEX_BENCH_LOW_STK_SIZE];
+
+static  OS_TCB       App_Mutex_BenchHighTaskTCB;
+static  CPU_STK      App_Mutex_BenchHighTaskStk[APP_CFG_MUTEX_BENCH_HIGH_STK_SIZE];
+
+static  OS_MUTEX     App_Mutex_BenchInheritMutex;
+static  OS_MUTEX     App_Mutex_BenchCeilingMutex;
+
+static  OS_MUTEX    *App_Mutex_BenchCurPtr;                     /* Mutex the high priority task pends on              */
+static  CPU_TS       App_Mutex_BenchReadyTs;                    /* High prio task readied                             */
+static  CPU_TS       App_Mutex_BenchBlockTime;                  /* Measured by the high priority task                 */
+static  CPU_TS       App_Mutex_BenchRespTime;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  App_Mutex_BenchLowTask  (void                          *p_arg);
+
+static  void  App_Mutex_BenchHighTask (void                          *p_arg);
+
+static  void  App_Mutex_BenchRun      (OS_MUTEX                      *p_mutex,
+                                       APP_MUTEX_BENCH_PROTO_RESULT  *p_result);
+
+static  CPU_TS  App_Mutex_BenchCycle  (OS_MUTEX                      *p_mutex,
+                                       CPU_INT32U                     period);
+
+
+/*
+*********************************************************************************************************
+*                                         App_Mutex_BenchInit()
+*
+* Description : Create the mutexes and the tasks of the benchmark.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application, after OSInit().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  App_Mutex_BenchInit (void)
+{
+    OS_ERR  err;
+
+
+    Mem_Clr((void     *)&App_Mutex_BenchResult,
+            (CPU_SIZE_T) sizeof(App_Mutex_BenchResult));
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    App_Mutex_BenchResult.Fast = DEF_YES;
+#else
+    App_Mutex_BenchResult.Fast = DEF_NO;
+#endif
+
+    OSMutexCreate(&App_Mutex_BenchInheritMutex,
+                  "Mutex Bench Inherit",
+                  &err);
+    my_assert(OS_ERR_NONE == err);
+
+    OSMutexCreateCeiling(&App_Mutex_BenchCeilingMutex,
+                         "Mutex Bench Ceiling",
+                          APP_CFG_MUTEX_BENCH_HIGH_PRIO,
+                         &err);
+    my_assert(OS_ERR_NONE == err);
+
+    OSTaskCreate(&App_Mutex_BenchHighTaskTCB,
+                 "Mutex Bench High",
+                  App_Mutex_BenchHighTask,
+                  0,
+                  APP_CFG_MUTEX_BENCH_HIGH_PRIO,
+                 &App_Mutex_BenchHighTaskStk[0],
+                 (APP_CFG_MUTEX_BENCH_HIGH_STK_SIZE / 10u),
+                  APP_CFG_MUTEX_BENCH_HIGH_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &err);
+    my_assert(OS_ERR_NONE == err);
+
+    OSTaskCreate(&App_Mutex_BenchLowTaskTCB,
+                 "Mutex Bench Low",
+                  App_Mutex_BenchLowTask,
+                  0,
+                  APP_CFG_MUTEX_BENCH_LOW_PRIO,
+                 &App_Mutex_BenchLowTaskStk[0],
+                 (APP_CFG_MUTEX_BENCH_LOW_STK_SIZE / 10u),
+                  APP_CFG_MUTEX_BENCH_LOW_STK_SIZE,
+                  0u,
+                  0u,
+                  0,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &err);
+    my_assert(OS_ERR_NONE == err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       App_Mutex_BenchLowTask()
+*
+* Description : Measure both mutex protocols once per second and print the results.
+*
+* Argument(s) : p_arg       Argument passed to 'App_Mutex_BenchLowTask()' by 'OSTaskCreate()'.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  App_Mutex_BenchLowTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        App_Mutex_BenchRun(&App_Mutex_BenchInheritMutex, &App_Mutex_BenchResult.Inherit);
+        App_Mutex_BenchRun(&App_Mutex_BenchCeilingMutex, &App_Mutex_BenchResult.Ceiling);
+        App_Mutex_BenchResult.NbrRuns++;
+        App_Mutex_BenchResult.NbrSamples = APP_CFG_MUTEX_BENCH_NBR_SAMPLES;
+
+        APP_TRACE_INFO(("Mutex bench (inherit/ceiling): lock %u/%u, unlock %u/%u, "
+                        "block %u/%u, resp %u/%u (avg), ctx sw %u/%u\n",
+                        (unsigned)App_Mutex_BenchResult.Inherit.LockTimeAvg,
+                        (unsigned)App_Mutex_BenchResult.Ceiling.LockTimeAvg,
+                        (unsigned)App_Mutex_BenchResult.Inherit.UnlockTimeAvg,
+                        (unsigned)App_Mutex_BenchResult.Ceiling.UnlockTimeAvg,
+                        (unsigned)App_Mutex_BenchResult.Inherit.BlockTimeAvg,
+                        (unsigned)App_Mutex_BenchResult.Ceiling.BlockTimeAvg,
+                        (unsigned)App_Mutex_BenchResult.Inherit.RespTimeAvg,
+                        (unsigned)App_Mutex_BenchResult.Ceiling.RespTimeAvg,
+                        (unsigned)App_Mutex_BenchResult.Inherit.CtxSwAvg,
+                        (unsigned)App_Mutex_BenchResult.Ceiling.CtxSwAvg));
+        APP_TRACE_INFO(("Mutex bench (inherit/ceiling, %s): cycle %u/%u none, %u/%u low, %u/%u high contention\n",
+                        (App_Mutex_BenchResult.Fast == DEF_YES) ? "fast path" : "kernel path",
+                        (unsigned)App_Mutex_BenchResult.Inherit.CycleZeroAvg,
+                        (unsigned)App_Mutex_BenchResult.Ceiling.CycleZeroAvg,
+                        (unsigned)App_Mutex_BenchResult.Inherit.CycleLowAvg,
+                        (unsigned)App_Mutex_BenchResult.Ceiling.CycleLowAvg,
+                        (unsigned)App_Mutex_BenchResult.Inherit.CycleHighAvg,
+                        (unsigned)App_Mutex_BenchResult.Ceiling.CycleHighAvg));
+
+        OSTimeDlyHMSM(0u, 0u, 1u, 0u, OS_OPT_TIME_HMSM_STRICT, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       App_Mutex_BenchHighTask()
+*
+* Description : Get and release the current mutex each time the low priority task readies this task.
+*
+* Argument(s) : p_arg       Argument passed to 'App_Mutex_BenchHighTask()' by 'OSTaskCreate()'.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is a task.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  App_Mutex_BenchHighTask (void  *p_arg)
+{
+    CPU_TS  ts;
+    CPU_TS  ts_acq;
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, 0, &err);
+        my_assert(OS_ERR_NONE == err);
+
+        ts     = OS_TS_GET();
+        OSMutexPend(App_Mutex_BenchCurPtr, 0u, OS_OPT_PEND_BLOCKING, 0, &err);
+        ts_acq = OS_TS_GET();
+        my_assert(OS_ERR_NONE == err);
+
+        App_Mutex_BenchBlockTime = ts_acq - ts;
+        App_Mutex_BenchRespTime  = ts_acq - App_Mutex_BenchReadyTs;
+
+        OSMutexPost(App_Mutex_BenchCurPtr, OS_OPT_POST_NONE, &err);
+        my_assert(OS_ERR_NONE == err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         App_Mutex_BenchRun()
+*
+* Description : Measure one mutex protocol.
+*
+* Argument(s) : p_mutex     Pointer to the mutex to measure.
+*
+*               p_result    Pointer to the results of the protocol.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : App_Mutex_BenchLowTask().
+*
+* Note(s)     : (1) See 'app_mutex_bench.c  Note #1'.
+*
+*               (2) The high priority task has a higher base priority than this task, it has released
+*                   the mutex and pends on its task semaphore again by the time OSMutexPost() returns.
+*********************************************************************************************************
+*/
+
+static  void  App_Mutex_BenchRun (OS_MUTEX                      *p_mutex,
+                                  APP_MUTEX_BENCH_PROTO_RESULT  *p_result)
+{
+    CPU_INT32U     i;
+    CPU_INT32U     lock_sum;
+    CPU_INT32U     unlock_sum;
+    CPU_INT32U     block_sum;
+    CPU_INT32U     resp_sum;
+    CPU_INT32U     ctx_sw_sum;
+    CPU_TS         ts;
+    CPU_TS         lock_time;
+    CPU_TS         unlock_time;
+    OS_CTX_SW_CTR  ctx_sw;
+    OS_ERR         err;
+
+
+    lock_sum                = 0u;
+    unlock_sum              = 0u;
+    p_result->LockTimeMax   = 0u;
+    p_result->UnlockTimeMax = 0u;
+    for (i = 0u; i < APP_CFG_MUTEX_BENCH_NBR_SAMPLES; i++) {   /* See Note #1a                                       */
+        ts          = OS_TS_GET();
+        OSMutexPend(p_mutex, 0u, OS_OPT_PEND_BLOCKING, 0, &err);
+        lock_time   = OS_TS_GET() - ts;
+        my_assert(OS_ERR_NONE == err);
+
+        ts          = OS_TS_GET();
+        OSMutexPost(p_mutex, OS_OPT_POST_NONE, &err);
+        unlock_time = OS_TS_GET() - ts;
+        my_assert(OS_ERR_NONE == err);
+
+        lock_sum   += lock_time;
+        if (p_result->LockTimeMax < lock_time) {
+            p_result->LockTimeMax = lock_time;
+        }
+        unlock_sum += unlock_time;
+        if (p_result->UnlockTimeMax < unlock_time) {
+            p_result->UnlockTimeMax = unlock_time;
+        }
+    }
+    p_result->LockTimeAvg   = lock_sum   / APP_CFG_MUTEX_BENCH_NBR_SAMPLES;
+    p_result->UnlockTimeAvg = unlock_sum / APP_CFG_MUTEX_BENCH_NBR_SAMPLES;
+
+    block_sum              = 0u;
+    resp_sum               = 0u;
+    ctx_sw_sum             = 0u;
+    p_result->BlockTimeMax = 0u;
+    p_result->RespTimeMax  = 0u;
+    App_Mutex_BenchCurPtr  = p_mutex;
+    for (i = 0u; i < APP_CFG_MUTEX_BENCH_NBR_SAMPLES; i++) {   /* See Note #1b                                       */
+        OSMutexPend(p_mutex, 0u, OS_OPT_PEND_BLOCKING, 0, &err);
+        my_assert(OS_ERR_NONE == err);
+
+        ctx_sw                 = OSTaskCtxSwCtr;
+        App_Mutex_BenchReadyTs = OS_TS_GET();
+        (void)OSTaskSemPost(&App_Mutex_BenchHighTaskTCB, OS_OPT_POST_NONE, &err);
+        my_assert(OS_ERR_NONE == err);
+
+        ts = OS_TS_GET();
+        while ((CPU_TS)(OS_TS_GET() - ts) < APP_CFG_MUTEX_BENCH_WORK_TIME) {
+            ;
+        }
+
+        OSMutexPost(p_mutex, OS_OPT_POST_NONE, &err);           /* See Note #2                                        */
+        my_assert(OS_ERR_NONE == err);
+        ctx_sw_sum += OSTaskCtxSwCtr - ctx_sw;
+
+        block_sum  += App_Mutex_BenchBlockTime;
+        if (p_result->BlockTimeMax < App_Mutex_BenchBlockTime) {
+            p_result->BlockTimeMax = App_Mutex_BenchBlockTime;
+        }
+        resp_sum   += App_Mutex_BenchRespTime;
+        if (p_result->RespTimeMax < App_Mutex_BenchRespTime) {
+            p_result->RespTimeMax = App_Mutex_BenchRespTime;
+        }
+    }
+    p_result->BlockTimeAvg = block_sum  / APP_CFG_MUTEX_BENCH_NBR_SAMPLES;
+    p_result->RespTimeAvg  = resp_sum   / APP_CFG_MUTEX_BENCH_NBR_SAMPLES;
+    p_result->CtxSwAvg     = ctx_sw_sum / APP_CFG_MUTEX_BENCH_NBR_SAMPLES;
+
+    p_result->CycleZeroAvg = App_Mutex_BenchCycle(p_mutex, 0u); /* See Note #1c                                       */
+    p_result->CycleLowAvg  = App_Mutex_BenchCycle(p_mutex, APP_CFG_MUTEX_BENCH_LOW_CONT_PERIOD);
+    p_result->CycleHighAvg = App_Mutex_BenchCycle(p_mutex, 1u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        App_Mutex_BenchCycle()
+*
+* Description : Measure the acquire/release cycles of a mutex at one contention level.
+*
+* Argument(s) : p_mutex     Pointer to the mutex to measure.
+*
+*               period      One section out of 'period' is contended, none if 0.
+*
+* Return(s)   : Average cycle time.
+*
+* Caller(s)   : App_Mutex_BenchRun().
+*
+* Note(s)     : (1) Every section works for APP_CFG_MUTEX_BENCH_WORK_TIME, contended or not, so that
+*                   the levels only differ by the contention.  The work is not measured.
+*********************************************************************************************************
+*/
+
+static  CPU_TS  App_Mutex_BenchCycle (OS_MUTEX    *p_mutex,
+                                      CPU_INT32U   period)
+{
+    CPU_INT32U  i;
+    CPU_INT32U  cycle_sum;
+    CPU_TS      ts;
+    CPU_TS      lock_time;
+    OS_ERR      err;
+
+
+    cycle_sum             = 0u;
+    App_Mutex_BenchCurPtr = p_mutex;
+    for (i = 0u; i < APP_CFG_MUTEX_BENCH_NBR_SAMPLES; i++) {
+        ts        = OS_TS_GET();
+        OSMutexPend(p_mutex, 0u, OS_OPT_PEND_BLOCKING, 0, &err);
+        lock_time = OS_TS_GET() - ts;
+        my_assert(OS_ERR_NONE == err);
+
+        if ((period != 0u) &&
+            ((i % period) == 0u)) {                             /* Contended section: the high prio task pends        */
+            App_Mutex_BenchReadyTs = OS_TS_GET();
+            (void)OSTaskSemPost(&App_Mutex_BenchHighTaskTCB, OS_OPT_POST_NONE, &err);
+            my_assert(OS_ERR_NONE == err);
+        }
+
+        ts = OS_TS_GET();                                       /* See Note #1                                        */
+        while ((CPU_TS)(OS_TS_GET() - ts) < APP_CFG_MUTEX_BENCH_WORK_TIME) {
+            ;
+        }
+
+        ts         = OS_TS_GET();
+        OSMutexPost(p_mutex, OS_OPT_POST_NONE, &err);
+        cycle_sum += lock_time + (OS_TS_GET() - ts);
+        my_assert(OS_ERR_NONE == err);
+    }
+
+    return ((CPU_TS)(cycle_sum / APP_CFG_MUTEX_BENCH_NBR_SAMPLES));
+}
+#endif
@@ -0,0 +1,104 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                        MUTEX PROTOCOL BENCHMARK
+*
+*                                         STM32F746G-DISCO
+*                                         Evaluation Board
+*
+* Filename      : app_mutex_bench.h
+* Version       : V1.00
+*********************************************************************************************************
+*/
+
+#ifndef  APP_MUTEX_BENCH_MODULE_PRESENT
+#define  APP_MUTEX_BENCH_MODULE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*
+* Note(s) : (1) All times are in CPU timestamp counts (CPU clock cycles when the DWT cycle counter is
+*               used as the timestamp timer).
+*********************************************************************************************************
+*/
+
+typedef  struct  app_mutex_bench_proto_result {
+    CPU_TS       LockTimeAvg;                                   /* Uncontended OSMutexPend()                          */
+    CPU_TS       LockTimeMax;
+    CPU_TS       UnlockTimeAvg;                                 /* Uncontended OSMutexPost()                          */
+    CPU_TS       UnlockTimeMax;
+    CPU_TS       BlockTimeAvg;                                  /* High prio task blocked in OSMutexPend()            */
+    CPU_TS       BlockTimeMax;
+    CPU_TS       RespTimeAvg;                                   /* High prio task readied to mutex acquired           */
+    CPU_TS       RespTimeMax;
+    CPU_INT32U   CtxSwAvg;                                      /* Context switches per contended section             */
+    CPU_TS       CycleZeroAvg;                                  /* OSMutexPend() + OSMutexPost(), no contention       */
+    CPU_TS       CycleLowAvg;                                   /* ... low contention                                 */
+    CPU_TS       CycleHighAvg;                                  /* ... every section contended                        */
+} APP_MUTEX_BENCH_PROTO_RESULT;
+
+typedef  struct  app_mutex_bench_result {
+    CPU_INT32U                    NbrRuns;
+    CPU_INT32U                    NbrSamples;                   /* Number of samples per protocol in the last run     */
+    CPU_BOOLEAN                   Fast;                         /* OS_CFG_MUTEX_FAST_EN was enabled                   */
+    APP_MUTEX_BENCH_PROTO_RESULT  Inherit;                      /* Mutex created by OSMutexCreate()                   */
+    APP_MUTEX_BENCH_PROTO_RESULT  Ceiling;                      /* Mutex created by OSMutexCreateCeiling()            */
+} APP_MUTEX_BENCH_RESULT;
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  APP_MUTEX_BENCH_RESULT  App_Mutex_BenchResult;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  App_Mutex_BenchInit (void);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -98,7 +98,7 @@
 */
 
                                                                 /* Configure CPU timestamp features (see Note #1) :     */
-#define  CPU_CFG_TS_32_EN                       DEF_DISABLED
+#define  CPU_CFG_TS_32_EN                       DEF_ENABLED
 #define  CPU_CFG_TS_64_EN                       DEF_DISABLED
                                                                 /*   DEF_DISABLED  CPU timestamps DISABLED              */
                                                                 /*   DEF_ENABLED   CPU timestamps ENABLED               */
@@ -125,11 +125,24 @@
 *                   average the interrupts disabled time measurements overhead.
 *
 *                   See also 'cpu_core.c  CPU_IntDisMeasInit()  Note #3a'.
+*
+*               (c) Configure CPU_CFG_INT_DIS_MEAS_HIST_EN to also count every interrupts disabled time
+*                   in a log2 histogram :
+*
+*                   (a)  Enabled,       if CPU_CFG_INT_DIS_MEAS_HIST_EN      #define'd in 'cpu_cfg.h'
+*
+*                   (b) Disabled,       if CPU_CFG_INT_DIS_MEAS_HIST_EN  NOT #define'd in 'cpu_cfg.h'
+*
+*                   See also 'cpu_core.c  CPU_IntDisMeasStop()  Note #2'.
 *********************************************************************************************************
 */
 
-#if 0                                                           /* Configure CPU interrupts disabled time ...           */
+#if 1                                                           /* Configure CPU interrupts disabled time ...           */
 #define  CPU_CFG_INT_DIS_MEAS_EN                                /* ... measurements feature (see Note #1a).             */
+#endif
+
+#if 1                                                           /* Configure CPU interrupts disabled time ...           */
+#define  CPU_CFG_INT_DIS_MEAS_HIST_EN                           /* ... histogram feature (see Note #1c).                */
 #endif
 
                                                                 /* Configure number of interrupts disabled overhead ... */
@@ -77,13 +77,33 @@
 *                         MEMORY LIBRARY ASSEMBLY OPTIMIZATION CONFIGURATION
 *
 * Note(s) : (1) Configure LIB_MEM_CFG_OPTIMIZE_ASM_EN to enable/disable assembly-optimized memory function(s).
+*
+*               'lib_mem_a.asm' MUST be excluded from the build when DISABLED.
+*
+*           (2) Configure LIB_MEM_CFG_OPTIMIZE_WORD_EN to enable/disable the unrolled, word-wide C memory
+*               function(s).  MUST be DISABLED when LIB_MEM_CFG_OPTIMIZE_ASM_EN is ENABLED.
+*
+*           (3) Configure LIB_MEM_CFG_COPY_DMA_EN to enable/disable DMA-assisted copies of buffers of
+*               LIB_MEM_CFG_COPY_DMA_SIZE_MIN octets or more (see 'bsp_mem.c').
 *********************************************************************************************************
 */
 
                                                                 /* Assembly-optimized function(s).                      */
                                                                 /* Enable/disable assembly-optimized memory ...         */
                                                                 /* ... function(s). [see Note #1]                       */
-#define  LIB_MEM_CFG_OPTIMIZE_ASM_EN        DEF_ENABLED
+#define  LIB_MEM_CFG_OPTIMIZE_ASM_EN        DEF_DISABLED
+
+                                                                /* Word-optimized function(s).                          */
+                                                                /* Enable/disable word-optimized memory ...             */
+                                                                /* ... function(s). [see Note #2]                       */
+#define  LIB_MEM_CFG_OPTIMIZE_WORD_EN       DEF_ENABLED
+
+                                                                /* DMA-assisted copy.                                   */
+                                                                /* Enable/disable DMA-assisted copy. [see Note #3]      */
+#define  LIB_MEM_CFG_COPY_DMA_EN            DEF_ENABLED
+
+                                                                /* Minimum size of a DMA-assisted copy, in octets.      */
+#define  LIB_MEM_CFG_COPY_DMA_SIZE_MIN             1024u
 
 
 /*
@@ -128,6 +148,56 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  MEMORY ACCOUNTING CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_TRACK_EN to enable/disable the accounting of the memory segments,
+*               dynamic memory pools & owners (see 'lib_mem.c  Mem_TrackOutput()').
+*
+*           (2) Configure LIB_MEM_CFG_TRACK_SAMPLE_RATE with a power of 2 to account one dynamic memory
+*               pool block get out of N to its owner.
+*********************************************************************************************************
+*/
+
+                                                                /* Memory accounting.                                   */
+                                                                /* Enable/disable the accounting. [see Note #1]         */
+#define  LIB_MEM_CFG_TRACK_EN              DEF_ENABLED
+
+                                                                /* Maximum number of owners accounted individually.     */
+#define  LIB_MEM_CFG_TRACK_OWNER_NBR_MAX           16u
+
+                                                                /* Owner sampling rate of pool blocks. [see Note #2]    */
+#define  LIB_MEM_CFG_TRACK_SAMPLE_RATE             16u
+
+
+/*
+*********************************************************************************************************
+*                                  SLAB ALLOCATOR CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_SLAB_EN to enable/disable the size-class slab allocator built on
+*               the dynamic memory pools (see 'lib_mem.h  SLAB ALLOCATOR DATA TYPES').
+*
+*           (2) Configure LIB_MEM_CFG_SLAB_CACHE_EN to enable/disable the per-task slab caches.
+*********************************************************************************************************
+*/
+
+                                                                /* Slab allocator.                                      */
+                                                                /* Enable/disable the slab allocator. [see Note #1]     */
+#define  LIB_MEM_CFG_SLAB_EN               DEF_ENABLED
+
+                                                                /* Maximum number of size classes of a slab.            */
+#define  LIB_MEM_CFG_SLAB_CLASS_NBR_MAX             8u
+
+
+                                                                /* Per-task slab caches.                                */
+                                                                /* Enable/disable the slab caches. [see Note #2]        */
+#define  LIB_MEM_CFG_SLAB_CACHE_EN         DEF_ENABLED
+
+                                                                /* Number of blocks cached per class.                   */
+#define  LIB_MEM_CFG_SLAB_CACHE_DEPTH               4u
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -42,13 +42,23 @@
 #define OS_CFG_DBG_EN                   DEF_ENABLED        /* Enable (DEF_ENABLED) debug code/variables                             */
 #define OS_CFG_DYN_TICK_EN              DEF_DISABLED       /* Enable (DEF_ENABLED) the Dynamic Tick                                 */
 #define OS_CFG_INVALID_OS_CALLS_CHK_EN  DEF_ENABLED        /* Enable (DEF_ENABLED) checks for invalid kernel calls                  */
+#define OS_CFG_ISR_POST_DEFERRED_EN     DEF_ENABLED        /* Enable (DEF_ENABLED) deferred posts from ISRs via the ISR post task   */
+#define OS_CFG_LAT_HIST_EN              DEF_ENABLED        /* Enable (DEF_ENABLED) int. dis., sched. lock & ISR latency histograms  */
+#define OS_CFG_OBJ_REG_EN               DEF_ENABLED        /* Enable (DEF_ENABLED) the object registry: handles, lookup by name     */
+#define OS_CFG_OBJ_REG_SIZE             64U                /*     Number of objects registered (1 to 255)                           */
+#define OS_CFG_OBJ_REG_HASH_SIZE        128U               /*     Name hash table size, power of 2 > OS_CFG_OBJ_REG_SIZE            */
 #define OS_CFG_OBJ_TYPE_CHK_EN          DEF_ENABLED        /* Enable (DEF_ENABLED) object type checking                             */
-#define OS_CFG_TS_EN                    DEF_DISABLED       /* Enable (DEF_ENABLED) time stamping                                    */
+#define OS_CFG_PWR_EN                   DEF_ENABLED        /* Enable (DEF_ENABLED) idle task power states (see os_cfg_app.h)        */
+#define OS_CFG_TS_EN                    DEF_ENABLED        /* Enable (DEF_ENABLED) time stamping                                    */
 
 #define OS_CFG_PRIO_MAX                 32U                /* Defines the maximum number of task priorities (see OS_PRIO data type) */
 
-#define OS_CFG_SCHED_LOCK_TIME_MEAS_EN  DEF_DISABLED       /* Include (DEF_ENABLED) code to measure scheduler lock time             */
-#define OS_CFG_SCHED_ROUND_ROBIN_EN     DEF_DISABLED       /* Include (DEF_ENABLED) code for Round-Robin scheduling                 */
+#define OS_CFG_SCHED_LOCK_TIME_MEAS_EN  DEF_ENABLED        /* Include (DEF_ENABLED) code to measure scheduler lock time             */
+#define OS_CFG_SCHED_ROUND_ROBIN_EN     DEF_ENABLED        /* Include (DEF_ENABLED) code for Round-Robin scheduling                 */
+#define OS_CFG_SCHED_ROUND_ROBIN_US_EN  DEF_ENABLED        /*     Time slices in microseconds, measured with the cycle counter      */
+#define OS_CFG_SCHED_EDF_EN             DEF_ENABLED        /* Include (DEF_ENABLED) code for Earliest Deadline First scheduling     */
+#define OS_CFG_SCHED_EDF_PRIO           14U                /*     Priority level whose tasks are scheduled by deadline              */
+#define OS_CFG_SCHED_EDF_UTIL_MAX       100U               /*     Admission bound on the EDF class utilization, in percent          */
 
 #define OS_CFG_STK_SIZE_MIN             64U                /* Minimum allowable task stack size                                     */
 
@@ -58,22 +68,37 @@
 #define OS_CFG_FLAG_DEL_EN              DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSFlagDel()                        */
 #define OS_CFG_FLAG_MODE_CLR_EN         DEF_DISABLED       /*     Include (DEF_ENABLED) code for Wait on Clear EVENT FLAGS          */
 #define OS_CFG_FLAG_PEND_ABORT_EN       DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSFlagPendAbort()                  */
+#define OS_CFG_FLAG_IDX_EN              DEF_ENABLED        /*     Index waiters per bit, include code for OSFlagPendMulti()         */
 
 
                                                            /* ------------------------ MEMORY MANAGEMENT -------------------------  */
 #define OS_CFG_MEM_EN                   DEF_ENABLED        /* Enable (DEF_ENABLED) code generation for the MEMORY MANAGER           */
+#define OS_CFG_MEM_LOCK_FREE_EN         DEF_ENABLED        /*     Use lock-free OSMemGet()/OSMemPut() (LDREX/STREX)                 */
+#define OS_CFG_MEM_CANARY_EN            DEF_DISABLED       /*     Check a canary at the end of each memory block (debug)            */
+#define OS_CFG_MSG_BUF_EN               DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSMsgBufXXXX() message buffers     */
+#define OS_CFG_MSG_BUF_CLASS_MAX        4u                 /*     Maximum number of message buffer size classes                     */
 
 
                                                            /* ------------------- MUTUAL EXCLUSION SEMAPHORES --------------------  */
 #define OS_CFG_MUTEX_EN                 DEF_ENABLED        /* Enable (DEF_ENABLED) code generation for MUTEX                        */
 #define OS_CFG_MUTEX_DEL_EN             DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSMutexDel()                       */
 #define OS_CFG_MUTEX_PEND_ABORT_EN      DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSMutexPendAbort()                 */
+#define OS_CFG_MUTEX_CEILING_EN         DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSMutexCreateCeiling() (ICPP)      */
+#define OS_CFG_MUTEX_FAST_EN            DEF_ENABLED        /*     Take free mutexes w/o the kernel (LDREX/STREX owner swap)         */
+
+
+                                                           /* ----------------------- READER-WRITER LOCKS ------------------------  */
+#define OS_CFG_RWLOCK_EN                DEF_ENABLED        /* Enable (DEF_ENABLED) code generation for READER-WRITER LOCKS          */
+#define OS_CFG_RWLOCK_DEL_EN            DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSRWLockDel()                      */
+#define OS_CFG_RWLOCK_READ_MAX          4u                 /*     Read locks a task can hold at a time (1 to 255)                   */
 
 
                                                            /* -------------------------- MESSAGE QUEUES --------------------------  */
 #define OS_CFG_Q_EN                     DEF_ENABLED        /* Enable (DEF_ENABLED) code generation for QUEUES                       */
+#define OS_CFG_Q_BATCH_EN               DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSQPostN() and OSQPendN()          */
 #define OS_CFG_Q_DEL_EN                 DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSQDel()                           */
 #define OS_CFG_Q_FLUSH_EN               DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSQFlush()                         */
+#define OS_CFG_Q_MSG_RESERVE_EN         DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSQMsgReserve()                    */
 #define OS_CFG_Q_PEND_ABORT_EN          DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSQPendAbort()                     */
 
 
@@ -87,11 +112,21 @@
                                                            /* ----------------------------- MONITORS ------------------------------ */
 #define OS_CFG_MON_EN                   DEF_ENABLED        /* Enable (DEF_ENABLED) code generation for MONITORS                     */
 #define OS_CFG_MON_DEL_EN               DEF_DISABLED       /*     Include (DEF_ENABLED) code for OSMonDel()                         */
+#define OS_CFG_MON_KEY_EN               DEF_ENABLED        /*     Include (DEF_ENABLED) code for keyed conditions, OSMonOpKey()     */
+#define OS_CFG_MON_KEY_NBR              8u                 /*     Number of condition keys per monitor (1 to 32)                    */
+
+                                                           /* ----------------------------- PROFILER ------------------------------ */
+#define OS_CFG_PROF_EN                  DEF_ENABLED        /* Enable (DEF_ENABLED) periodic per-task profiling snapshots            */
+#define OS_CFG_PROF_TBL_SIZE            16u                /*     Maximum number of task records in a snapshot                      */
 
                                                            /* -------------------------- TASK MANAGEMENT -------------------------- */
 #define OS_CFG_STAT_TASK_EN             DEF_ENABLED        /* Enable (DEF_ENABLED) the statistics task                              */
 #define OS_CFG_STAT_TASK_STK_CHK_EN     DEF_ENABLED        /*     Check task stacks (DEF_ENABLED) from the statistic task           */
+#define OS_CFG_STAT_CYCLES_EN           DEF_ENABLED        /*     CPU usage (DEF_ENABLED) from task and ISR cycles, with EMAs       */
+#define OS_CFG_STAT_TASK_BATCH          16u                /*     Number of tasks updated per statistic task run                    */
+#define OS_CFG_STAT_ISR_TBL_SIZE        114u               /*     ISR entries: 16 exceptions + 98 IRQs of the STM32F746             */
 
+#define OS_CFG_TASK_BUDGET_EN           DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskBudgetSet() CPU budgets          */
 #define OS_CFG_TASK_CHANGE_PRIO_EN      DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskChangePrio()                     */
 #define OS_CFG_TASK_DEL_EN              DEF_DISABLED       /* Include (DEF_ENABLED) code for OSTaskDel()                            */
 #define OS_CFG_TASK_IDLE_EN             DEF_ENABLED        /* Include (DEF_ENABLED) the idle task                                   */
@@ -101,12 +136,16 @@
 #define OS_CFG_TASK_REG_TBL_SIZE        1u                 /* Number of task specific registers                                     */
 #define OS_CFG_TASK_STK_REDZONE_EN      DEF_DISABLED       /* Enable (DEF_ENABLED) stack redzone                                    */
 #define OS_CFG_TASK_STK_REDZONE_DEPTH   8u                 /*     Depth of the stack redzone                                        */
+#define OS_CFG_TASK_STK_SCAN_EN         DEF_ENABLED        /* Enable (DEF_ENABLED) stack high-water scan by the idle task           */
+#define OS_CFG_TASK_STK_SCAN_CHUNK      32u                /*     Stack elements scanned per idle task loop                         */
 #define OS_CFG_TASK_SEM_PEND_ABORT_EN   DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskSemPendAbort()                   */
 #define OS_CFG_TASK_SUSPEND_EN          DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskSuspend() and OSTaskResume()     */
 #define OS_CFG_TASK_TICK_EN             DEF_ENABLED        /* Include (DEF_ENABLED) the kernel tick task                            */
 
                                                            /* ------------------ TASK LOCAL STORAGE MANAGEMENT -------------------  */
-#define OS_CFG_TLS_TBL_SIZE             0u                 /* Include (DEF_ENABLED) code for Task Local Storage (TLS) registers     */
+#define OS_CFG_TLS_TBL_SIZE             2u                 /* Number of Task Local Storage (TLS) registers, 0 to disable            */
+#define OS_CFG_TLS_LIB_TASK_MAX         8u                 /*     Tasks with their own copy of the IAR DLib data (see os_tls.c)     */
+#define OS_CFG_TLS_LIB_SIZE             256u               /*     Size of a copy, in bytes                                          */
 
                                                            /* ------------------------- TIME MANAGEMENT --------------------------  */
 #define OS_CFG_TIME_DLY_HMSM_EN         DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTimeDlyHMSM()                        */
@@ -117,9 +156,14 @@
 #define OS_CFG_TMR_DEL_EN               DEF_DISABLED       /* Enable (DEF_ENABLED) code generation for OSTmrDel()                   */
 
                                                            /* ------------------------- TRACE RECORDER ---------------------------- */
-#define OS_CFG_TRACE_EN                 DEF_DISABLED       /* Enable (DEF_ENABLED) uC/OS-III Trace instrumentation                  */
+#define OS_CFG_TRACE_EN                 DEF_ENABLED        /* Enable (DEF_ENABLED) uC/OS-III Trace instrumentation                  */
 #define OS_CFG_TRACE_API_ENTER_EN       DEF_DISABLED       /* Enable (DEF_ENABLED) uC/OS-III Trace API enter instrumentation        */
 #define OS_CFG_TRACE_API_EXIT_EN        DEF_DISABLED       /* Enable (DEF_ENABLED) uC/OS-III Trace API exit  instrumentation        */
+#define OS_CFG_TRACE_RING_SIZE          1024u              /* Nbr of events kept by the ring buffer recorder (power of 2)           */
+
+                                                           /* --------------------------- ARMv7-M PORT ---------------------------- */
+#define OS_CPU_CFG_STK_GUARD_EN         DEF_ENABLED        /* Enable (DEF_ENABLED) the MPU guard at the bottom of the task stacks   */
+#define OS_CPU_CFG_STK_GUARD_SIZE       32u                /*     Size of the guard region, power of 2 >= 32 bytes                  */
 
 #endif
 
@@ -45,13 +45,27 @@
 
 #define  OS_CFG_MSG_POOL_SIZE                         32U       /* Maximum number of messages                           */
 
+#define  OS_CFG_PROF_RATE_HZ                           1U       /* Profiler snapshot rate (1 Hz to stat task rate)      */
+
 #define  OS_CFG_TASK_STK_LIMIT_PCT_EMPTY              10U       /* Stack limit position in percentage to empty          */
 
 
+                                                                /* -------------- DEFERRED ISR POST QUEUE ------------- */
+#define  OS_CFG_INT_Q_SIZE                            16U       /* Nbr of entries in the ISR post queue (power of 2)    */
+#define  OS_CFG_INT_Q_TASK_STK_SIZE                  128U       /* Stack size (number of CPU_STK elements)              */
+
+
                                                                 /* -------------------- IDLE TASK --------------------- */
 #define  OS_CFG_IDLE_TASK_STK_SIZE                   128U       /* Stack size (number of CPU_STK elements)              */
 
 
+                                                                /* ----------------- POWER MANAGEMENT ----------------- */
+#define  OS_CFG_PWR_SLEEP_LAT_US                       5U       /* SLEEP exit latency (us)                              */
+#define  OS_CFG_PWR_SLEEP_RESIDENCY_US              2000U       /* SLEEP target residency (us): 2 ticks without a tick  */
+#define  OS_CFG_PWR_STOP_LAT_US                      400U       /* STOP exit latency (us): wake up, HSE, PLL, overdrive */
+#define  OS_CFG_PWR_STOP_RESIDENCY_US               5000U       /* STOP target residency (us)                           */
+
+
                                                                 /* ------------------ STATISTIC TASK ------------------ */
 #define  OS_CFG_STAT_TASK_PRIO                         2U       /* Priority                                             */
 #define  OS_CFG_STAT_TASK_RATE_HZ                     10U       /* Rate of execution (1 to 10 Hz)                       */
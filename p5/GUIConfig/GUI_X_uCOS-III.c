@@ -42,6 +42,12 @@
 *
 *                     (b) Queues
 *                         (1) OS_CFG_Q_EN                 Enabled
+*
+*                 (3) With OS_CFG_MUTEX_CEILING_EN enabled, the GUI lock is a priority ceiling mutex
+*                     instead of a semaphore.  Its ceiling MUST be the priority of the highest priority
+*                     task that calls the GUI, the touch task by default.  OSMutexPend() rejects a task
+*                     above the ceiling with OS_ERR_MUTEX_CEILING, so the GUI task priority is checked
+*                     against the ceiling at compile time & GUI_X_Lock() asserts on any error.
 *********************************************************************************************************
 */
 
@@ -55,6 +61,9 @@
 
 #include  "GUI_Private.h"
 
+#include  <app_cfg.h>
+#include  "project.h"                                           /* my_assert().                                         */
+
 //#include  "stdio.h"
 
 
@@ -64,6 +73,14 @@
 *********************************************************************************************************
 */
 
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+#define  GUI_X_LOCK_CEILING_PRIO          APP_CFG_TOUCH_TASK_PRIO/* See this 'GUI_X_uCOS-III.c  Note #3'.               */
+
+#if (APP_CFG_TASK_GUI_PRIO < GUI_X_LOCK_CEILING_PRIO)           /* The GUI tasks MUST NOT be above the ceiling.         */
+#error  "APP_CFG.H, APP_CFG_TASK_GUI_PRIO MUST NOT be higher than the GUI lock ceiling, APP_CFG_TOUCH_TASK_PRIO"
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -93,7 +110,11 @@
 */
 
                                                                             /* --------------- SIGNALS ---------------- */
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+static  OS_MUTEX     GUI_DispLockObj;
+#else
 static  OS_SEM       GUI_DispSignalObj;
+#endif
 static  OS_SEM       GUI_KeySignalObj;
 
                                                                             /* ---------------- QUEUES ---------------- */
@@ -278,10 +299,17 @@ void  GUI_X_InitOS (void)
 
 
                                                                 /* ----------------- INIT GUI SIGNAL ----------------- */
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    OSMutexCreateCeiling(&GUI_DispLockObj,                      /* Create GUI lock ...                                 */
+                         "GUI Lock",
+                          GUI_X_LOCK_CEILING_PRIO,              /* ... with the ceiling of the GUI tasks.              */
+                         &os_err);
+#else
     OSSemCreate(&GUI_DispSignalObj,                             /* Create GUI initialization signal ...                */
                 "GUI Init Signal",
                  1u,                                            /* ... with a single signal by dflt.                   */
                 &os_err);
+#endif
 
     OSQCreate(&GUI_EventMsgObj,                                 /* Create GUI event msg q ...                          */
               "GUI Event Message",
@@ -307,7 +335,9 @@ void  GUI_X_InitOS (void)
 *
 *                   (a) GUI access MUST be acquired exclusively by only a single task at any one time.
 *
-*                   (b) Failure to acquire signal will prevent GUI task(s) from running.
+*                   (b) Failure to acquire signal will prevent GUI task(s) from running.  The caller
+*                       would enter the GUI without the lock, so any error is fatal (see this
+*                       'GUI_X_uCOS-III.c  Note #3').
 *********************************************************************************************************
 */
 
@@ -316,12 +346,20 @@ void  GUI_X_Lock (void)
     OS_ERR  os_err;
 
 
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    OSMutexPend(       &GUI_DispLockObj,                        /* Acquire exclusive GUI access (see Note #1a) ...      */
+                        0u,                                     /* ... without timeout.                                 */
+                        OS_OPT_PEND_BLOCKING,
+              (CPU_TS *)0,
+                       &os_err);
+#else
     OSSemPend(         &GUI_DispSignalObj,                      /* Acquire exclusive GUI access (see Note #1a) ...      */
                         0u,                                     /* ... without timeout.                                 */
                         OS_OPT_PEND_BLOCKING,
               (CPU_TS *)0,
                        &os_err);
-   (void)&os_err;                                               /* See Note #1b.                                        */
+#endif
+    my_assert(OS_ERR_NONE == os_err);                           /* See Note #1b.                                        */
 }
 
 
@@ -349,9 +387,15 @@ void  GUI_X_Unlock (void)
     OS_ERR  os_err;
 
 
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    OSMutexPost(&GUI_DispLockObj,                               /* Release exclusive GUI access.                        */
+                 OS_OPT_POST_NONE,
+                &os_err);
+#else
     OSSemPost(&GUI_DispSignalObj,                               /* Release exclusive GUI access.                        */
                OS_OPT_POST_1,
               &os_err);
+#endif
    (void)&os_err;                                               /* See Note #1a.                                        */
 }
 
@@ -27,7 +27,20 @@
 // are mutually exclusive (protected).
 // By making the mutex private, we ensure application code
 // must use the public API.
-static OS_MUTEX  s_gui_mutex;    	
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+// A reader-writer lock: a refresh only reads the display data,
+// so it no longer blocks other readers, and writers are served
+// before new refreshes. uC/GUI serializes the drawing (GUI_OS).
+static OS_RWLOCK s_gui_mutex;
+#define GUI_TEXT_LOCK_READ(p_err)   OSRWLockPend(&s_gui_mutex, 0, OS_OPT_PEND_BLOCKING | OS_OPT_PEND_RWLOCK_READ, 0, p_err)
+#define GUI_TEXT_LOCK_WRITE(p_err)  OSRWLockPend(&s_gui_mutex, 0, OS_OPT_PEND_BLOCKING | OS_OPT_PEND_RWLOCK_WRITE, 0, p_err)
+#define GUI_TEXT_UNLOCK(p_err)      OSRWLockPost(&s_gui_mutex, OS_OPT_POST_NONE, p_err)
+#else
+static OS_MUTEX  s_gui_mutex;
+#define GUI_TEXT_LOCK_READ(p_err)   OSMutexPend(&s_gui_mutex, 0, OS_OPT_PEND_BLOCKING, 0, p_err)
+#define GUI_TEXT_LOCK_WRITE(p_err)  OSMutexPend(&s_gui_mutex, 0, OS_OPT_PEND_BLOCKING, 0, p_err)
+#define GUI_TEXT_UNLOCK(p_err)      OSMutexPost(&s_gui_mutex, OS_OPT_POST_NONE, p_err)
+#endif
 
 // Single linear buffer to hold all lines of text
 static char gui_text_buffer[(GUI_TEXT_LINE_COUNT) * (GUI_TEXT_LINE_LEN_MAX)];
@@ -45,7 +58,11 @@ void GUIDEMO_API_init(void)
    OS_ERR err;
 
    // Create the mutex that protects the display from race conditions.
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+   OSRWLockCreate(&s_gui_mutex, "GUI Text Lock", &err);
+#else
    OSMutexCreate(&s_gui_mutex, "GUI Text Mutex", &err);
+#endif
    my_assert(OS_ERR_NONE == err);
 
    // Zero out display buffer
@@ -101,7 +118,7 @@ void GUIDEMO_SetColorBG(BG_COLOR newColorBG)
 {
   OS_ERR err;
   // Acquire the GUI mutex.
-  OSMutexPend(&s_gui_mutex, 0, OS_OPT_PEND_BLOCKING, 0, &err);
+  GUI_TEXT_LOCK_WRITE(&err);
   my_assert(OS_ERR_NONE == err);
 
   switch(newColorBG)
@@ -132,7 +149,7 @@ void GUIDEMO_SetColorBG(BG_COLOR newColorBG)
   }
 
   // Release the GUI mutex.
-  OSMutexPost(&s_gui_mutex, OS_OPT_POST_NONE, &err);
+  GUI_TEXT_UNLOCK(&err);
   my_assert(OS_ERR_NONE == err);
 
 }
@@ -156,7 +173,7 @@ void GUIDEMO_API_writeLine(uint32_t Line, char const * Text)
   char * last  = gui_text_buffer + (((Line + 1) * GUI_TEXT_LINE_LEN_MAX) - 1);
 
   // Acquire the GUI mutex.
-  OSMutexPend(&s_gui_mutex, 0, OS_OPT_PEND_BLOCKING, 0, &err);
+  GUI_TEXT_LOCK_WRITE(&err);
   my_assert(OS_ERR_NONE == err);
 
   // Copy text into display buffer.  Ensure we don't copy too much.
@@ -164,7 +181,7 @@ void GUIDEMO_API_writeLine(uint32_t Line, char const * Text)
   *last = 0;  // Force / ensure NULL termination
 
   // Release the GUI mutex.
-  OSMutexPost(&s_gui_mutex, OS_OPT_POST_NONE, &err);
+  GUI_TEXT_UNLOCK(&err);
   my_assert(OS_ERR_NONE == err);
 
 }
@@ -181,8 +198,8 @@ void GUIDEMO_API_refresh(void)
   const unsigned x_pos = 16;
   uint32_t  y_pos = y_delta;
 
-  // Acquire the GUI mutex.
-  OSMutexPend(&s_gui_mutex, 0, OS_OPT_PEND_BLOCKING, 0, &err);
+  // Acquire the GUI mutex (shared, the display data is only read).
+  GUI_TEXT_LOCK_READ(&err);
   my_assert(OS_ERR_NONE == err);
 
   // Draw the screen background
@@ -197,7 +214,7 @@ void GUIDEMO_API_refresh(void)
   }
 
   // Release the GUI mutex.
-  OSMutexPost(&s_gui_mutex, OS_OPT_POST_NONE, &err);
+  GUI_TEXT_UNLOCK(&err);
   my_assert(OS_ERR_NONE == err);
 
 }
@@ -815,6 +815,60 @@ CPU_TS_TMR  CPU_IntDisMeasMaxGet (void)
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                       CPU_IntDisMeasHistGet()
+*
+* Description : Get interrupts disabled time histogram.
+*
+* Argument(s) : p_tbl       Pointer to an array of CPU_INT_DIS_MEAS_HIST_NBR counters to receive the
+*                               histogram (see Note #2), or NULL pointer to only clear the histogram.
+*
+*               reset       Indicate whether to clear the histogram after it is read :
+*
+*                               DEF_YES     Clear histogram.
+*                               DEF_NO      Do NOT clear histogram.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) After initialization, 'CPU_IntDisMeasHistTbl[]' MUST ALWAYS be accessed
+*                   exclusively with interrupts disabled -- but NOT with critical sections.
+*
+*               (2) Counter 0 holds the number of interrupts disabled times of 0 counts, counter n holds
+*                   the number of times from 2^(n - 1) to 2^n - 1 counts & the last counter holds all
+*                   longer times.  Times are corrected by the measurement overhead.
+*
+*                   See also 'CPU_IntDisMeasStop()  Note #2'.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+void  CPU_IntDisMeasHistGet (CPU_INT32U   *p_tbl,
+                             CPU_BOOLEAN   reset)
+{
+    CPU_INT08U  i;
+    CPU_SR_ALLOC();
+
+
+    CPU_INT_DIS();
+    for (i = 0u; i < CPU_INT_DIS_MEAS_HIST_NBR; i++) {
+        if (p_tbl != (CPU_INT32U *)0) {
+            p_tbl[i] = CPU_IntDisMeasHistTbl[i];
+        }
+        if (reset == DEF_YES) {
+            CPU_IntDisMeasHistTbl[i] = 0u;
+        }
+    }
+    CPU_INT_EN();
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        CPU_IntDisMeasStart()
@@ -1015,6 +1069,10 @@ void  CPU_IntDisMeasStart (void)
 *                               overhead is performed asynchronously in appropriate API functions.
 *
 *                               See also 'CPU_IntDisMeasMaxCalc()  Note #1b'.
+*
+*               (2) When CPU_CFG_INT_DIS_MEAS_HIST_EN is #define'd, each interrupts disabled time is also
+*                   counted in the log2 bucket of 'CPU_IntDisMeasHistTbl[]' matching its number of
+*                   significant bits, after subtracting the measurement overhead.
 *********************************************************************************************************
 */
 
@@ -1022,6 +1080,9 @@ void  CPU_IntDisMeasStart (void)
 void  CPU_IntDisMeasStop (void)
 {
     CPU_TS_TMR  time_ints_disd_cnts;
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+    CPU_DATA    hist_ix;
+#endif
 
 
     CPU_IntDisNestCtr--;
@@ -1037,6 +1098,19 @@ void  CPU_IntDisMeasStop (void)
         if (CPU_IntDisMeasMax_cnts    < time_ints_disd_cnts) {
             CPU_IntDisMeasMax_cnts    = time_ints_disd_cnts;
         }
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+                                                                    /* Cnt time in its log2 bucket (see Note #2).       */
+        if (time_ints_disd_cnts > CPU_IntDisMeasOvrhd_cnts) {
+            time_ints_disd_cnts -= CPU_IntDisMeasOvrhd_cnts;
+        } else {
+            time_ints_disd_cnts  = 0u;
+        }
+        hist_ix = (CPU_DATA)(DEF_INT_CPU_NBR_BITS - CPU_CntLeadZeros((CPU_DATA)time_ints_disd_cnts));
+        if (hist_ix >= CPU_INT_DIS_MEAS_HIST_NBR) {
+            hist_ix  = CPU_INT_DIS_MEAS_HIST_NBR - 1u;
+        }
+        CPU_IntDisMeasHistTbl[hist_ix]++;
+#endif
     }
 }
 #endif
@@ -2289,6 +2363,11 @@ static  void  CPU_IntDisMeasInit (void)
                                                     /  CPU_CFG_INT_DIS_MEAS_OVRHD_NBR;
     CPU_IntDisMeasMaxCur_cnts =  0u;                            /* Reset max ints dis'd times.                          */
     CPU_IntDisMeasMax_cnts    =  0u;
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+    for (i = 0u; i < CPU_INT_DIS_MEAS_HIST_NBR; i++) {          /* Clr ints dis'd time histogram.                       */
+        CPU_IntDisMeasHistTbl[i] = 0u;
+    }
+#endif
     CPU_INT_EN();
 }
 #endif
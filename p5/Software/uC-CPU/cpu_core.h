@@ -182,6 +182,8 @@ extern  "C" {
 #define  CPU_TIME_MEAS_NBR_MIN                             1u
 #define  CPU_TIME_MEAS_NBR_MAX                           128u
 
+#define  CPU_INT_DIS_MEAS_HIST_NBR                        32u   /* Nbr of ints dis'd time histogram log2 buckets.       */
+
 
 /*
 *********************************************************************************************************
@@ -282,6 +284,9 @@ CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasStop_cnts;         /* ...  stop  ti
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasOvrhd_cnts;        /* ...        time meas ovrhd.                          */
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMaxCur_cnts;       /* ...     resetable max time dis'd.                    */
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMax_cnts;          /* ... non-resetable max time dis'd.                    */
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+CPU_CORE_EXT  CPU_INT32U       CPU_IntDisMeasHistTbl[CPU_INT_DIS_MEAS_HIST_NBR];    /* ... log2 histogram.          */
+#endif
 #endif
 
 
@@ -575,6 +580,11 @@ CPU_TS_TMR       CPU_IntDisMeasMaxCurGet  (void);
 
 CPU_TS_TMR       CPU_IntDisMeasMaxGet     (void);
 
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+void             CPU_IntDisMeasHistGet    (CPU_INT32U       *p_tbl,
+                                           CPU_BOOLEAN       reset);
+#endif
+
 
 void             CPU_IntDisMeasStart      (void);
 
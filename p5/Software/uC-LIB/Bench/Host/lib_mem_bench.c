@@ -0,0 +1,477 @@
+/*
+*********************************************************************************************************
+*                                                uC/LIB
+*                                        CUSTOM LIBRARY MODULES
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                              MEMORY SET/COPY/COMPARE BENCHMARK (HOST)
+*
+* Filename      : lib_mem_bench.c
+* Version       : V1.38.02
+*********************************************************************************************************
+* Note(s)       : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory,
+*                     build the word-optimized functions with:
+*
+*                         cc -std=gnu99 -O2 -no-pie -fno-tree-loop-distribute-patterns
+*                            -I../../../uCOS-III/Bench/Host -I../../../../AppCode
+*                            -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR -I../..
+*                            -o lib_mem_bench lib_mem_bench.c
+*
+*                     and the original functions by adding '-DBENCH_CFG_WORD_EN=DEF_DISABLED'.  The
+*                     assembly-optimized Mem_Copy() can NOT run on the host, LIB_MEM_CFG_OPTIMIZE_ASM_EN
+*                     is always disabled.  '-fno-tree-loop-distribute-patterns' keeps the compiler from
+*                     replacing the octet loops by calls to the C library, which the target compiler
+*                     does not do either.
+*
+*                 (2) Usage:
+*
+*                         lib_mem_bench [<MB_per_case>]
+*
+*                 (3) The checks run first and the program exits with EXIT_FAILURE if one of them fails :
+*
+*                     (a) Mem_Set(), Mem_Copy() & Mem_Cmp() give the same results as the C library for
+*                         every size up to BENCH_CHK_SIZE_MAX & every alignment of both buffers, & never
+*                         write outside of the destination buffer.
+*
+*                     (b) Mem_Copy() to a lower address within the same buffer gives the same result as
+*                         memmove() (see 'lib_mem.c  Mem_Copy()  Note #2b').
+*
+*                     (c) If LIB_MEM_CFG_COPY_DMA_EN is enabled, Mem_CopyDMA() is called for large copies
+*                         that do not overlap, & only for those.
+*
+*                 (4) Each case is timed over the same number of octets for every size, the table gives
+*                     the throughput in MB/s.  'dest+N'/'src+N' is the offset of the buffer from a 64-octet
+*                     boundary.  Mem_CopyDMA() declines the copies while timing so the CPU path is measured.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <stdint.h>
+#include  <string.h>
+#include  <time.h>
+
+#include  "lib_cfg.h"
+
+#undef   LIB_MEM_CFG_OPTIMIZE_ASM_EN                            /* See Note #1.                                         */
+#define  LIB_MEM_CFG_OPTIMIZE_ASM_EN        DEF_DISABLED
+
+#ifdef   BENCH_CFG_WORD_EN
+#undef   LIB_MEM_CFG_OPTIMIZE_WORD_EN
+#define  LIB_MEM_CFG_OPTIMIZE_WORD_EN       BENCH_CFG_WORD_EN
+#endif
+
+#include  "lib_mem.c"
+#include  "lib_ascii.c"                                        /* ASCII fncts used by lib_str.c.                        */
+#include  "lib_str.c"                                          /* Str_FmtNbr_Int32U() for the mem reports.              */
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_CHK_SIZE_MAX                        300u
+#define  BENCH_CHK_GUARD                            16u         /* Guard octets around the chk dest buf.                */
+#define  BENCH_ALIGN_NBR                             8u         /* Offsets chk'd for each buf.                          */
+#define  BENCH_BUF_SIZE                     (64u * 1024u + 128u)
+#define  BENCH_MB_PER_CASE_DFLT                     64u
+
+#define  BENCH_FNCT_SET                              0u
+#define  BENCH_FNCT_COPY                             1u
+#define  BENCH_FNCT_CMP                              2u
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  bench_align {                                  /* Offsets of dest & src from a 64-octet boundary.      */
+    CPU_INT32U  Dest;
+    CPU_INT32U  Src;
+} BENCH_ALIGN;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  const  CPU_SIZE_T   Bench_SizeTbl[]  = { 16u, 64u, 256u, 1024u, 4096u, 65536u };
+static  const  BENCH_ALIGN  Bench_AlignTbl[] = { { 0u, 0u }, { 1u, 1u }, { 0u, 1u }, { 3u, 0u }, { 2u, 7u } };
+
+static  CPU_INT08U          Bench_Buf1[BENCH_BUF_SIZE] __attribute__((aligned(64)));
+static  CPU_INT08U          Bench_Buf2[BENCH_BUF_SIZE] __attribute__((aligned(64)));
+static  CPU_INT08U          Bench_BufRef[BENCH_BUF_SIZE] __attribute__((aligned(64)));
+
+static  volatile  unsigned  int  Bench_PRIMASK;
+static  volatile  CPU_BOOLEAN    Bench_Sink;
+
+static  CPU_BOOLEAN         Bench_DMA_En = DEF_YES;             /* Mem_CopyDMA() accepts copies.                        */
+static  CPU_INT32U          Bench_DMA_CallCtr;
+
+
+/*
+*********************************************************************************************************
+*                                          CPU / PORT STUBS
+*********************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+CPU_DATA  CPU_CntLeadZeros (CPU_DATA  val)
+{
+    return ((val == 0u) ? DEF_INT_CPU_NBR_BITS : (CPU_DATA)__builtin_clz(val));
+}
+
+
+#if (LIB_MEM_CFG_COPY_DMA_EN == DEF_ENABLED)                    /* Mem_CopyDMA() is in bsp_mem.c on the target.         */
+CPU_BOOLEAN  Mem_CopyDMA (       void        *pdest,
+                          const  void        *psrc,
+                                 CPU_SIZE_T   size)
+{
+    if (Bench_DMA_En != DEF_YES) {
+        return (DEF_FAIL);
+    }
+    Bench_DMA_CallCtr++;
+    memcpy(pdest, psrc, size);
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  double  Bench_TimeGet (void)
+{
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec + (double)ts.tv_nsec * 1.0e-9);
+}
+
+
+static  void  Bench_Fail (const  char        *p_what,
+                                 CPU_SIZE_T   size,
+                                 CPU_INT32U   dest_off,
+                                 CPU_INT32U   src_off)
+{
+    fprintf(stderr, "lib_mem_bench: %s failed, size = %u, dest+%u, src+%u\n",
+            p_what, (unsigned)size, (unsigned)dest_off, (unsigned)src_off);
+    exit(EXIT_FAILURE);
+}
+
+
+static  void  Bench_Fill (CPU_INT08U  *p_buf,                   /* Non-repeating pattern, catches misplaced words.      */
+                          CPU_SIZE_T   size,
+                          CPU_INT32U   seed)
+{
+    CPU_SIZE_T  i;
+
+
+    for (i = 0u; i < size; i++) {
+        p_buf[i] = (CPU_INT08U)((i * 7u) + (i >> 8) + seed);
+    }
+}
+
+
+static  void  Bench_ChkSetCopy (void)                           /* See Note #3a.                                        */
+{
+    CPU_INT08U  *p_dest;
+    CPU_INT08U  *p_ref;
+    CPU_INT08U  *p_src;
+    CPU_SIZE_T   size;
+    CPU_INT32U   dest_off;
+    CPU_INT32U   src_off;
+    CPU_SIZE_T   len;
+
+
+    for (size = 0u; size <= BENCH_CHK_SIZE_MAX; size++) {
+        len = size + (2u * BENCH_CHK_GUARD) + BENCH_ALIGN_NBR;
+        for (dest_off = 0u; dest_off < BENCH_ALIGN_NBR; dest_off++) {
+            p_dest = &Bench_Buf1[BENCH_CHK_GUARD + dest_off];
+            p_ref  = &Bench_BufRef[BENCH_CHK_GUARD + dest_off];
+
+            Bench_Fill(Bench_Buf1,   len, 0x11u);
+            Bench_Fill(Bench_BufRef, len, 0x11u);
+            Mem_Set(p_dest, 0xA5u, size);
+            memset(p_ref,   0xA5,  size);
+            if (memcmp(Bench_Buf1, Bench_BufRef, len) != 0) {
+                Bench_Fail("Mem_Set()", size, dest_off, 0u);
+            }
+
+            for (src_off = 0u; src_off < BENCH_ALIGN_NBR; src_off++) {
+                p_src = &Bench_Buf2[BENCH_CHK_GUARD + src_off];
+                Bench_Fill(Bench_Buf2,   len, 0x5Au);
+                Bench_Fill(Bench_Buf1,   len, 0x11u);
+                Bench_Fill(Bench_BufRef, len, 0x11u);
+                Mem_Copy(p_dest, p_src, size);
+                memcpy(p_ref,    p_src, size);
+                if (memcmp(Bench_Buf1, Bench_BufRef, len) != 0) {
+                    Bench_Fail("Mem_Copy()", size, dest_off, src_off);
+                }
+            }
+        }
+    }
+}
+
+
+static  void  Bench_ChkCmp (void)                               /* See Note #3a.                                        */
+{
+    CPU_INT08U   *p1;
+    CPU_INT08U   *p2;
+    CPU_SIZE_T    size;
+    CPU_SIZE_T    i;
+    CPU_INT32U    off_1;
+    CPU_INT32U    off_2;
+    CPU_BOOLEAN   same;
+
+
+    for (size = 0u; size <= BENCH_CHK_SIZE_MAX; size += (size < 80u) ? 1u : 13u) {
+        for (off_1 = 0u; off_1 < BENCH_ALIGN_NBR; off_1++) {
+            for (off_2 = 0u; off_2 < BENCH_ALIGN_NBR; off_2++) {
+                p1 = &Bench_Buf1[off_1];
+                p2 = &Bench_Buf2[off_2];
+                Bench_Fill(p1, size, 0x33u);
+                Bench_Fill(p2, size, 0x33u);
+                same = Mem_Cmp(p1, p2, size);
+                if (same != DEF_YES) {
+                    Bench_Fail("Mem_Cmp() of equal bufs", size, off_1, off_2);
+                }
+                for (i = 0u; i < size; i++) {                   /* Each single octet diff MUST be found.        */
+                    p2[i] ^= 0x40u;
+                    same   = Mem_Cmp(p1, p2, size);
+                    p2[i] ^= 0x40u;
+                    if (same != DEF_NO) {
+                        Bench_Fail("Mem_Cmp() of different bufs", size, off_1, off_2);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+static  void  Bench_ChkOverlap (void)                           /* See Note #3b.                                        */
+{
+    CPU_SIZE_T  size;
+    CPU_INT32U  gap;
+    CPU_INT32U  off;
+
+
+    for (size = 0u; size <= BENCH_CHK_SIZE_MAX; size += 7u) {
+        for (gap = sizeof(CPU_ALIGN); gap < (2u * sizeof(CPU_ALIGN) + 3u); gap++) {
+            for (off = 0u; off < BENCH_ALIGN_NBR; off++) {
+                Bench_Fill(Bench_Buf1,   size + gap + off, 0x77u);
+                Bench_Fill(Bench_BufRef, size + gap + off, 0x77u);
+                Mem_Copy(&Bench_Buf1[off],   &Bench_Buf1[off + gap],   size);
+                memmove(&Bench_BufRef[off], &Bench_BufRef[off + gap], size);
+                if (memcmp(Bench_Buf1, Bench_BufRef, size + gap + off) != 0) {
+                    Bench_Fail("Mem_Copy() to lower overlapping addr", size, off, off + gap);
+                }
+            }
+        }
+    }
+}
+
+
+#if (LIB_MEM_CFG_COPY_DMA_EN == DEF_ENABLED)
+static  void  Bench_ChkDMA (void)                               /* See Note #3c.                                        */
+{
+    CPU_SIZE_T  size;
+
+
+    size              = LIB_MEM_CFG_COPY_DMA_SIZE_MIN;
+    Bench_DMA_CallCtr = 0u;
+    Mem_Copy(Bench_Buf1, Bench_Buf2, size - 1u);
+    if (Bench_DMA_CallCtr != 0u) {
+        Bench_Fail("Mem_CopyDMA() of small copy", size - 1u, 0u, 0u);
+    }
+    Mem_Copy(Bench_Buf1, Bench_Buf2, size);
+    if (Bench_DMA_CallCtr != 1u) {
+        Bench_Fail("Mem_CopyDMA() of large copy", size, 0u, 0u);
+    }
+    Mem_Move(&Bench_Buf1[0], &Bench_Buf1[8], size);             /* Overlapping, via Mem_Copy().                         */
+    Mem_Move(&Bench_Buf1[8], &Bench_Buf1[0], size);
+    if (Bench_DMA_CallCtr != 1u) {
+        Bench_Fail("Mem_CopyDMA() of overlapping copy", size, 0u, 8u);
+    }
+}
+#endif
+
+
+static  double  Bench_Run (CPU_INT32U    fnct,
+                           CPU_BOOLEAN   lib,
+                           CPU_SIZE_T    size,
+                           BENCH_ALIGN   align,
+                           CPU_INT32U    mb)
+{
+    CPU_INT08U  *p_dest;
+    CPU_INT08U  *p_src;
+    CPU_INT32U   nbr_iter;
+    CPU_INT32U   i;
+    double       t0;
+    double       t;
+
+
+    p_dest   = &Bench_Buf1[align.Dest];
+    p_src    = &Bench_Buf2[align.Src];
+    nbr_iter = (CPU_INT32U)(((CPU_INT64U)mb * 1024u * 1024u) / size);
+    memset(Bench_Buf1, 0x5A, sizeof(Bench_Buf1));
+    memset(Bench_Buf2, 0x5A, sizeof(Bench_Buf2));
+
+    t0 = Bench_TimeGet();
+    for (i = 0u; i < nbr_iter; i++) {
+        switch (fnct) {
+            case BENCH_FNCT_SET:
+                 if (lib == DEF_YES) {
+                     Mem_Set(p_dest, (CPU_INT08U)i, size);
+                 } else {
+                     memset(p_dest, (int)(CPU_INT08U)i, size);
+                 }
+                 break;
+
+            case BENCH_FNCT_COPY:
+                 if (lib == DEF_YES) {
+                     Mem_Copy(p_dest, p_src, size);
+                 } else {
+                     memcpy(p_dest, p_src, size);
+                 }
+                 break;
+
+            case BENCH_FNCT_CMP:                                /* Equal bufs, the whole size is cmp'd.                 */
+            default:
+                 if (lib == DEF_YES) {
+                     Bench_Sink = Mem_Cmp(p_dest, p_src, size);
+                 } else {
+                     Bench_Sink = (memcmp(p_dest, p_src, size) == 0) ? DEF_YES : DEF_NO;
+                 }
+                 break;
+        }
+        __asm__ volatile("" : : "r"(p_dest), "r"(p_src) : "memory");
+    }
+    t = Bench_TimeGet() - t0;
+
+    return (((double)nbr_iter * (double)size) / (t * 1.0e6));
+}
+
+
+/*
+*********************************************************************************************************
+*                                               main()
+*********************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    static  const  char  *fnct_name[] = { "Mem_Set", "Mem_Copy", "Mem_Cmp" };
+    static  const  char  *libc_name[] = { "memset",  "memcpy",   "memcmp"  };
+    CPU_INT32U            mb;
+    CPU_INT32U            fnct;
+    CPU_INT32U            ix_size;
+    CPU_INT32U            ix_align;
+    BENCH_ALIGN           align;
+    double                mb_s_lib;
+    double                mb_s_libc;
+
+
+    mb = BENCH_MB_PER_CASE_DFLT;
+    if (argc > 1) {
+        mb = (CPU_INT32U)strtoul(argv[1], DEF_NULL, 0);
+        if (mb < 1u) {
+            mb = 1u;
+        }
+    }
+
+    Bench_ChkSetCopy();
+    Bench_ChkCmp();
+    Bench_ChkOverlap();
+#if (LIB_MEM_CFG_COPY_DMA_EN == DEF_ENABLED)
+    Bench_ChkDMA();
+#endif
+    printf("All checks passed.\n\n");
+
+    Bench_DMA_En = DEF_NO;                                      /* See Note #4.                                         */
+    printf("LIB_MEM_CFG_OPTIMIZE_WORD_EN %s, %u MB per case, MB/s (lib / libc)\n\n",
+           (LIB_MEM_CFG_OPTIMIZE_WORD_EN == DEF_ENABLED) ? "enabled" : "disabled", (unsigned)mb);
+    printf("%-9s  %-15s", "function", "alignment");
+    for (ix_size = 0u; ix_size < (sizeof(Bench_SizeTbl) / sizeof(Bench_SizeTbl[0])); ix_size++) {
+        printf("  %15u", (unsigned)Bench_SizeTbl[ix_size]);
+    }
+    printf("\n");
+
+    for (fnct = BENCH_FNCT_SET; fnct <= BENCH_FNCT_CMP; fnct++) {
+        for (ix_align = 0u; ix_align < (sizeof(Bench_AlignTbl) / sizeof(Bench_AlignTbl[0])); ix_align++) {
+            align = Bench_AlignTbl[ix_align];
+            if ((fnct == BENCH_FNCT_SET) && (ix_align > 1u)) {  /* Only the dest alignment matters.                     */
+                break;
+            }
+            printf("%-9s  dest+%u, src+%u ", fnct_name[fnct], (unsigned)align.Dest, (unsigned)align.Src);
+            for (ix_size = 0u; ix_size < (sizeof(Bench_SizeTbl) / sizeof(Bench_SizeTbl[0])); ix_size++) {
+                mb_s_lib  = Bench_Run(fnct, DEF_YES, Bench_SizeTbl[ix_size], align, mb);
+                mb_s_libc = Bench_Run(fnct, DEF_NO,  Bench_SizeTbl[ix_size], align, mb);
+                printf("  %6.0f / %6.0f", mb_s_lib, mb_s_libc);
+            }
+            printf("\n");
+        }
+    }
+    printf("\n(%s: libc %s, %s: libc %s, %s: libc %s)\n",
+           fnct_name[0], libc_name[0], fnct_name[1], libc_name[1], fnct_name[2], libc_name[2]);
+
+    return (EXIT_SUCCESS);
+}
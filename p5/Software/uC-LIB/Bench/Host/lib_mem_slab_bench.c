@@ -0,0 +1,761 @@
+/*
+*********************************************************************************************************
+*                                                uC/LIB
+*                                        CUSTOM LIBRARY MODULES
+*
+*                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: http://www.micrium.com
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                  SLAB ALLOCATOR BENCHMARK (HOST)
+*
+* Filename      : lib_mem_slab_bench.c
+* Version       : V1.38.02
+*********************************************************************************************************
+* Note(s)       : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory,
+*                     build it with:
+*
+*                         cc -std=gnu99 -O2 -no-pie -I../../../uCOS-III/Bench/Host -I../../../../AppCode
+*                            -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR -I../..
+*                            -o lib_mem_slab_bench lib_mem_slab_bench.c
+*
+*                     LIB_MEM_CFG_SLAB_EN and LIB_MEM_CFG_SLAB_CACHE_EN must be enabled in lib_cfg.h.
+*                     The Cortex-M port defines CPU_ADDR on 32 bits, '-no-pie' keeps the segment below
+*                     4 GB so that lib_mem.c can address it.
+*
+*                 (2) Usage:
+*
+*                         lib_mem_slab_bench [<ops_per_run>]
+*
+*                 (3) The checks run first and the program exits with EXIT_FAILURE if one of them fails :
+*
+*                     (a) Each request is served by the smallest class that fits it, requests larger than
+*                         the largest class are rejected.
+*
+*                     (b) Foreign pointers and double frees are rejected.
+*
+*                     (c) Live blocks never overlap : each one is filled with its own pattern, checked when
+*                         it is freed.
+*
+*                     (d) After a warm-up, a random workload with a bounded live set does not take more
+*                         memory from the segment, and the class statistics match the live set.
+*
+*                 (4) The fragmentation report gives, for the random workload, the internal fragmentation
+*                     (bytes lost to the power-of-two rounding and the header) and the segment overhead
+*                     (bytes carved from the segment over the peak of live requested bytes).  It also
+*                     shows the main drawback of a slab : memory carved for one class is not available to
+*                     the others, measured by filling the segment with small blocks, freeing them all then
+*                     allocating large blocks.
+*
+*                 (5) The throughput of glibc malloc()/free(), Mem_SlabAlloc()/Mem_SlabFree() and of the
+*                     per-task cache is measured on the same operation sequences : a LIFO burst and a
+*                     random workload.  Critical sections are counted through the PRIMASK stand-in.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <stdint.h>
+#include  <string.h>
+#include  <time.h>
+
+#include  "lib_mem.c"
+#include  "lib_ascii.c"                                        /* ASCII fncts used by lib_str.c.                        */
+#include  "lib_str.c"                                          /* Str_FmtNbr_Int32U() for the mem reports.              */
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BENCH_SEG_SIZE                     (4u * 1024u * 1024u)
+#define  BENCH_BLK_SIZE_MIN                         16u
+#define  BENCH_BLK_SIZE_MAX                       1024u
+#define  BENCH_REQ_SIZE_MAX                 (BENCH_BLK_SIZE_MAX - LIB_MEM_SLAB_HDR_SIZE)
+
+#define  BENCH_LIVE_MAX                           1024u         /* Live set of the random workload.                     */
+#define  BENCH_BURST                                64u         /* Blks per LIFO burst.                                 */
+#define  BENCH_OPS_PER_RUN_DFLT               4000000u
+#define  BENCH_WARMUP_OPS                      200000u
+
+#if ((LIB_MEM_CFG_SLAB_EN       != DEF_ENABLED) || \
+     (LIB_MEM_CFG_SLAB_CACHE_EN != DEF_ENABLED))
+#error  "lib_mem_slab_bench.c: LIB_MEM_CFG_SLAB_EN and LIB_MEM_CFG_SLAB_CACHE_EN must be enabled in lib_cfg.h"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  enum  bench_alloc {
+    BENCH_ALLOC_MALLOC = 0,
+    BENCH_ALLOC_SLAB,
+    BENCH_ALLOC_CACHE
+} BENCH_ALLOC;
+
+typedef  struct  bench_op {                                     /* One op of a workload: free slot, then alloc into it. */
+    CPU_INT32U  Slot;
+    CPU_INT32U  Size;
+} BENCH_OP;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U              Bench_SegMem[BENCH_SEG_SIZE] __attribute__((aligned(16)));
+static  MEM_SEG                 Bench_Seg;
+static  MEM_SLAB                Bench_Slab;
+static  MEM_SLAB_CACHE          Bench_Cache;
+
+static  volatile  unsigned  int  Bench_PRIMASK;
+static  unsigned  long  long     Bench_IntDisCtr;               /* Number of critical sections entered.                 */
+
+static  void                    *Bench_LiveTbl[BENCH_LIVE_MAX];
+static  CPU_INT32U               Bench_LiveSizeTbl[BENCH_LIVE_MAX];
+static  BENCH_OP                *Bench_OpTbl;
+
+static  CPU_INT32U               Bench_RandState = 0x12345678u;
+
+
+/*
+*********************************************************************************************************
+*                                          CPU / PORT STUBS
+*********************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+    Bench_IntDisCtr++;
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+CPU_DATA  CPU_CntLeadZeros (CPU_DATA  val)
+{
+    return ((val == 0u) ? DEF_INT_CPU_NBR_BITS : (CPU_DATA)__builtin_clz(val));
+}
+
+
+#if (LIB_MEM_CFG_OPTIMIZE_ASM_EN == DEF_ENABLED)                /* Mem_Copy() is in lib_mem_a.asm on the target.        */
+void  Mem_Copy (       void        *pdest,
+                const  void        *psrc,
+                       CPU_SIZE_T   size)
+{
+    memcpy(pdest, psrc, size);
+}
+#endif
+
+
+#if (LIB_MEM_CFG_COPY_DMA_EN == DEF_ENABLED)                    /* Mem_CopyDMA() is in bsp_mem.c on the target.         */
+CPU_BOOLEAN  Mem_CopyDMA (       void        *pdest,
+                          const  void        *psrc,
+                                 CPU_SIZE_T   size)
+{
+    (void)pdest;
+    (void)psrc;
+    (void)size;
+
+    return (DEF_FAIL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  double  Bench_TimeGet (void)
+{
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec + (double)ts.tv_nsec * 1.0e-9);
+}
+
+
+static  void  Bench_Fail (const  char     *p_what,
+                                 LIB_ERR   err)
+{
+    fprintf(stderr, "lib_mem_slab_bench: %s failed, err = %u\n", p_what, (unsigned)err);
+    exit(EXIT_FAILURE);
+}
+
+
+static  CPU_INT32U  Bench_Rand (void)                           /* xorshift32.                                          */
+{
+    Bench_RandState ^= Bench_RandState << 13;
+    Bench_RandState ^= Bench_RandState >> 17;
+    Bench_RandState ^= Bench_RandState <<  5;
+    return (Bench_RandState);
+}
+
+
+static  CPU_INT32U  Bench_RandSize (void)                       /* 70% 1-64, 25% 65-256, 5% 257-max bytes.              */
+{
+    CPU_INT32U  pct;
+
+
+    pct = Bench_Rand() % 100u;
+    if (pct < 70u) {
+        return (1u   + (Bench_Rand() % 64u));
+    } else if (pct < 95u) {
+        return (65u  + (Bench_Rand() % 192u));
+    } else {
+        return (257u + (Bench_Rand() % (BENCH_REQ_SIZE_MAX - 256u)));
+    }
+}
+
+
+static  CPU_SIZE_T  Bench_SegUsedGet (void)
+{
+    return ((CPU_SIZE_T)(Bench_Seg.AddrNext - Bench_Seg.AddrBase));
+}
+
+
+static  void  Bench_SlabCreate (void)
+{
+    LIB_ERR  err;
+
+
+    Mem_SegCreate("Bench Seg",
+                  &Bench_Seg,
+                  (CPU_ADDR)(uintptr_t)&Bench_SegMem[0],
+                  BENCH_SEG_SIZE,
+                  LIB_MEM_PADDING_ALIGN_NONE,
+                  &err);
+    if (err != LIB_MEM_ERR_NONE) {
+        Bench_Fail("Mem_SegCreate()", err);
+    }
+
+    Mem_SlabCreate("Bench Slab",
+                   &Bench_Slab,
+                   &Bench_Seg,
+                   BENCH_BLK_SIZE_MIN,
+                   BENCH_BLK_SIZE_MAX,
+                   LIB_MEM_BLK_QTY_UNLIMITED,
+                   &err);
+    if (err != LIB_MEM_ERR_NONE) {
+        Bench_Fail("Mem_SlabCreate()", err);
+    }
+
+    Mem_SlabCacheInit(&Bench_Cache, &Bench_Slab, &err);
+    if (err != LIB_MEM_ERR_NONE) {
+        Bench_Fail("Mem_SlabCacheInit()", err);
+    }
+}
+
+
+static  void  Bench_SlabReset (void)                            /* Give the whole segment back.                         */
+{
+    LIB_ERR  err;
+
+
+    Bench_Seg.AddrNext = Bench_Seg.AddrBase;
+    Mem_SlabCreate("Bench Slab",
+                   &Bench_Slab,
+                   &Bench_Seg,
+                   BENCH_BLK_SIZE_MIN,
+                   BENCH_BLK_SIZE_MAX,
+                   LIB_MEM_BLK_QTY_UNLIMITED,
+                   &err);
+    if (err != LIB_MEM_ERR_NONE) {
+        Bench_Fail("Mem_SlabCreate()", err);
+    }
+    Mem_SlabCacheInit(&Bench_Cache, &Bench_Slab, &err);
+}
+
+
+static  void  *Bench_Alloc (BENCH_ALLOC   alloc,
+                            CPU_INT32U    size)
+{
+    void     *p_mem;
+    LIB_ERR   err;
+
+
+    switch (alloc) {
+        case BENCH_ALLOC_MALLOC:
+             return (malloc(size));
+
+        case BENCH_ALLOC_SLAB:
+             p_mem = Mem_SlabAlloc(&Bench_Slab, size, &err);
+             break;
+
+        case BENCH_ALLOC_CACHE:
+        default:
+             p_mem = Mem_SlabCacheAlloc(&Bench_Cache, size, &err);
+             break;
+    }
+    if (err != LIB_MEM_ERR_NONE) {
+        Bench_Fail("Alloc", err);
+    }
+    return (p_mem);
+}
+
+
+static  void  Bench_Free (BENCH_ALLOC   alloc,
+                          void         *p_mem)
+{
+    LIB_ERR  err;
+
+
+    switch (alloc) {
+        case BENCH_ALLOC_MALLOC:
+             free(p_mem);
+             return;
+
+        case BENCH_ALLOC_SLAB:
+             Mem_SlabFree(&Bench_Slab, p_mem, &err);
+             break;
+
+        case BENCH_ALLOC_CACHE:
+        default:
+             Mem_SlabCacheFree(&Bench_Cache, p_mem, &err);
+             break;
+    }
+    if (err != LIB_MEM_ERR_NONE) {
+        Bench_Fail("Free", err);
+    }
+}
+
+
+static  void  Bench_OpTblFill (unsigned  long  nbr_ops)
+{
+    unsigned  long  i;
+
+
+    for (i = 0u; i < nbr_ops; i++) {
+        Bench_OpTbl[i].Slot = Bench_Rand() % BENCH_LIVE_MAX;
+        Bench_OpTbl[i].Size = Bench_RandSize();
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                               CHECKS
+*
+* Note(s) : (1) See Note #3 at the top of this file.
+*********************************************************************************************************
+*/
+
+static  void  Bench_ChkClasses (void)                           /* See Note #3a.                                        */
+{
+    CPU_INT32U   size;
+    CPU_INT32U   ix;
+    CPU_INT32U   blk_size;
+    void        *p_mem;
+    LIB_ERR      err;
+
+
+    for (size = 0u; size <= BENCH_REQ_SIZE_MAX; size++) {
+        p_mem = Mem_SlabAlloc(&Bench_Slab, size, &err);
+        if (err != LIB_MEM_ERR_NONE) {
+            Bench_Fail("Class check alloc", err);
+        }
+        ix       = ((CPU_INT32U *)p_mem)[-1] & LIB_MEM_SLAB_HDR_IX_MSK;
+        blk_size = Bench_Slab.ClassTbl[ix].Pool.BlkSize;
+        if ((blk_size < (size + LIB_MEM_SLAB_HDR_SIZE)) ||
+            ((ix > 0u) && ((blk_size / 2u) >= (size + LIB_MEM_SLAB_HDR_SIZE)))) {
+            Bench_Fail("Class check", LIB_MEM_ERR_NONE);
+        }
+        Mem_SlabFree(&Bench_Slab, p_mem, &err);
+        if (err != LIB_MEM_ERR_NONE) {
+            Bench_Fail("Class check free", err);
+        }
+    }
+
+    (void)Mem_SlabAlloc(&Bench_Slab, BENCH_REQ_SIZE_MAX + 1u, &err);
+    if (err != LIB_MEM_ERR_INVALID_MEM_SIZE) {
+        Bench_Fail("Oversize check", err);
+    }
+    (void)Mem_SlabAlloc(&Bench_Slab, (CPU_SIZE_T)-1, &err);
+    if (err != LIB_MEM_ERR_INVALID_MEM_SIZE) {
+        Bench_Fail("Size overflow check", err);
+    }
+}
+
+
+static  void  Bench_ChkFree (void)                              /* See Note #3b.                                        */
+{
+    CPU_INT32U   foreign[4];
+    void        *p_mem;
+    LIB_ERR      err;
+
+
+    Mem_Clr(foreign, sizeof(foreign));
+    Mem_SlabFree(&Bench_Slab, &foreign[1], &err);
+    if (err != LIB_MEM_ERR_INVALID_BLK_ADDR) {
+        Bench_Fail("Foreign ptr check", err);
+    }
+
+    p_mem = Mem_SlabAlloc(&Bench_Slab, 40u, &err);
+    Mem_SlabFree(&Bench_Slab, p_mem, &err);
+    Mem_SlabFree(&Bench_Slab, p_mem, &err);
+    if (err != LIB_MEM_ERR_INVALID_BLK_ADDR) {
+        Bench_Fail("Double free check", err);
+    }
+
+    p_mem = Mem_SlabCacheAlloc(&Bench_Cache, 40u, &err);
+    Mem_SlabCacheFree(&Bench_Cache, p_mem, &err);
+    Mem_SlabCacheFree(&Bench_Cache, p_mem, &err);
+    if (err != LIB_MEM_ERR_INVALID_BLK_ADDR) {
+        Bench_Fail("Cache double free check", err);
+    }
+}
+
+
+static  void  Bench_Churn (BENCH_ALLOC      alloc,
+                           unsigned  long   nbr_ops,
+                           CPU_BOOLEAN      chk)
+{
+    unsigned  long   i;
+    CPU_INT32U       slot;
+    CPU_INT32U       size;
+    CPU_INT08U      *p_data;
+    CPU_INT32U       j;
+
+
+    for (i = 0u; i < nbr_ops; i++) {
+        slot = Bench_OpTbl[i].Slot;
+        size = Bench_OpTbl[i].Size;
+        if (Bench_LiveTbl[slot] != DEF_NULL) {
+            if (chk == DEF_YES) {                               /* See Note #3c.                                        */
+                p_data = (CPU_INT08U *)Bench_LiveTbl[slot];
+                for (j = 0u; j < Bench_LiveSizeTbl[slot]; j++) {
+                    if (p_data[j] != (CPU_INT08U)slot) {
+                        Bench_Fail("Overlap check", LIB_MEM_ERR_NONE);
+                    }
+                }
+            }
+            Bench_Free(alloc, Bench_LiveTbl[slot]);
+        }
+        Bench_LiveTbl[slot]     = Bench_Alloc(alloc, size);
+        Bench_LiveSizeTbl[slot] = size;
+        if (chk == DEF_YES) {
+            memset(Bench_LiveTbl[slot], (int)(CPU_INT08U)slot, size);
+        }
+    }
+}
+
+
+static  void  Bench_FreeAll (BENCH_ALLOC  alloc)
+{
+    CPU_INT32U  slot;
+
+
+    for (slot = 0u; slot < BENCH_LIVE_MAX; slot++) {
+        if (Bench_LiveTbl[slot] != DEF_NULL) {
+            Bench_Free(alloc, Bench_LiveTbl[slot]);
+            Bench_LiveTbl[slot] = DEF_NULL;
+        }
+    }
+}
+
+
+static  void  Bench_ChkStats (CPU_SIZE_T  nbr_live)             /* Class stats must match the live set (Note #3d).      */
+{
+    CPU_SIZE_T  nbr_used;
+    CPU_INT08U  ix;
+    CPU_INT08U  cached;
+
+
+    nbr_used = 0u;
+    cached   = 0u;
+    for (ix = 0u; ix < Bench_Slab.ClassNbr; ix++) {
+        nbr_used += Bench_Slab.ClassTbl[ix].NbrUsed;
+        cached   += Bench_Cache.FreeCnt[ix];
+        if (Bench_Slab.ClassTbl[ix].NbrUsed > Bench_Slab.ClassTbl[ix].NbrUsedMax) {
+            Bench_Fail("Peak check", LIB_MEM_ERR_NONE);
+        }
+    }
+    if (nbr_used != (nbr_live + cached)) {
+        Bench_Fail("Usage check", LIB_MEM_ERR_NONE);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        FRAGMENTATION REPORT
+*
+* Note(s) : (1) See Note #4 at the top of this file.
+*********************************************************************************************************
+*/
+
+static  void  Bench_Frag (unsigned  long  nbr_ops)
+{
+    CPU_SIZE_T      seg_used_warm;
+    CPU_SIZE_T      seg_used;
+    CPU_SIZE_T      nbr_live;
+    CPU_SIZE_T      nbr_small;
+    CPU_SIZE_T      nbr_large;
+    double          req_bytes;
+    double          blk_bytes;
+    double          live_req_max;
+    unsigned  long  i;
+    CPU_INT32U      slot;
+    CPU_INT32U      ix;
+    void           *p_mem;
+    LIB_ERR         err;
+
+
+    Bench_SlabReset();
+    Bench_Churn(BENCH_ALLOC_SLAB, BENCH_WARMUP_OPS, DEF_YES);
+    seg_used_warm = Bench_SegUsedGet();
+
+    req_bytes    = 0.0;
+    blk_bytes    = 0.0;
+    live_req_max = 0.0;
+    for (i = 0u; i < nbr_ops; i += BENCH_LIVE_MAX) {            /* Sample the live set every BENCH_LIVE_MAX ops.        */
+        double  live_req;
+
+
+        Bench_Churn(BENCH_ALLOC_SLAB, DEF_MIN(BENCH_LIVE_MAX, nbr_ops - i), DEF_YES);
+        live_req = 0.0;
+        for (slot = 0u; slot < BENCH_LIVE_MAX; slot++) {
+            if (Bench_LiveTbl[slot] != DEF_NULL) {
+                ix         = ((CPU_INT32U *)Bench_LiveTbl[slot])[-1] & LIB_MEM_SLAB_HDR_IX_MSK;
+                live_req  += Bench_LiveSizeTbl[slot];
+                req_bytes += Bench_LiveSizeTbl[slot];
+                blk_bytes += Bench_Slab.ClassTbl[ix].Pool.BlkSize;
+            }
+        }
+        if (live_req_max < live_req) {
+            live_req_max = live_req;
+        }
+    }
+    seg_used = Bench_SegUsedGet();
+
+    nbr_live = 0u;
+    for (slot = 0u; slot < BENCH_LIVE_MAX; slot++) {
+        if (Bench_LiveTbl[slot] != DEF_NULL) {
+            nbr_live++;
+        }
+    }
+    Bench_ChkStats(nbr_live);
+    Bench_FreeAll(BENCH_ALLOC_SLAB);
+    Bench_ChkStats(0u);
+
+    printf("Random workload (%u live blocks, %lu ops):\n", (unsigned)BENCH_LIVE_MAX, nbr_ops);
+    printf("  internal fragmentation   %6.1f %%\n", 100.0 * (1.0 - (req_bytes / blk_bytes)));
+    printf("  segment used             %8u bytes after warm-up, %8u bytes at the end\n",
+           (unsigned)seg_used_warm,
+           (unsigned)seg_used);
+    printf("  segment overhead         %6.2fx peak live requested bytes\n", (double)seg_used / live_req_max);
+    if ((double)seg_used > ((double)seg_used_warm * 1.05)) {    /* No growth once warm (see Note #3d).                  */
+        Bench_Fail("Segment growth check", LIB_MEM_ERR_NONE);
+    }
+
+    Bench_SlabReset();                                          /* Fill seg with small blks, free them, alloc large.    */
+    nbr_small = 0u;
+    for (;;) {
+        p_mem = Mem_SlabAlloc(&Bench_Slab, 24u, &err);
+        if (err != LIB_MEM_ERR_NONE) {
+            break;
+        }
+        nbr_small++;
+    }
+    for (ix = 0u; ix < Bench_Slab.ClassNbr; ix++) {             /* Free all through the class free lists.               */
+        MEM_SLAB_CLASS  *p_class;
+        CPU_INT08U      *p_blk;
+
+
+        p_class = &Bench_Slab.ClassTbl[ix];
+        for (p_blk = (CPU_INT08U *)(uintptr_t)Bench_Seg.AddrBase;
+             p_blk + p_class->Pool.BlkSize <= (CPU_INT08U *)(uintptr_t)Bench_Seg.AddrNext;
+             p_blk += p_class->Pool.BlkSize) {
+            if (p_class->NbrUsed == 0u) {
+                break;
+            }
+            Mem_SlabFree(&Bench_Slab, p_blk + LIB_MEM_SLAB_HDR_SIZE, &err);
+            if (err != LIB_MEM_ERR_NONE) {
+                Bench_Fail("Phase change free", err);
+            }
+        }
+    }
+    nbr_large = 0u;
+    for (;;) {
+        p_mem = Mem_SlabAlloc(&Bench_Slab, 500u, &err);
+        if (err != LIB_MEM_ERR_NONE) {
+            break;
+        }
+        nbr_large++;
+    }
+    printf("Phase change (24-byte then 500-byte requests):\n");
+    printf("  %u small blocks carved, all freed, then %u large blocks fit in the %u free bytes\n",
+           (unsigned)nbr_small,
+           (unsigned)nbr_large,
+           (unsigned)(nbr_small * Bench_Slab.ClassTbl[1].Pool.BlkSize));
+    (void)p_mem;
+}
+
+
+/*
+*********************************************************************************************************
+*                                             THROUGHPUT
+*
+* Note(s) : (1) See Note #5 at the top of this file.
+*********************************************************************************************************
+*/
+
+static  double  Bench_RunRandom (BENCH_ALLOC      alloc,
+                                 unsigned  long   nbr_ops,
+                                 double          *p_int_dis)
+{
+    unsigned  long  long  int_dis_start;
+    double                t_start;
+    double                t_elapsed;
+
+
+    Bench_Churn(alloc, BENCH_WARMUP_OPS, DEF_NO);
+    int_dis_start = Bench_IntDisCtr;
+    t_start       = Bench_TimeGet();
+    Bench_Churn(alloc, nbr_ops, DEF_NO);
+    t_elapsed     = Bench_TimeGet() - t_start;
+    Bench_FreeAll(alloc);
+
+   *p_int_dis = (double)(Bench_IntDisCtr - int_dis_start) / (double)nbr_ops;
+    return ((t_elapsed * 1.0e9) / (double)nbr_ops);
+}
+
+
+static  double  Bench_RunBurst (BENCH_ALLOC      alloc,
+                                unsigned  long   nbr_ops,
+                                double          *p_int_dis)
+{
+    unsigned  long  long  int_dis_start;
+    unsigned  long        run;
+    CPU_INT32U            i;
+    double                t_start;
+    double                t_elapsed;
+
+
+    int_dis_start = Bench_IntDisCtr;
+    t_start       = Bench_TimeGet();
+    for (run = 0u; run < (nbr_ops / BENCH_BURST); run++) {
+        for (i = 0u; i < BENCH_BURST; i++) {
+            Bench_LiveTbl[i] = Bench_Alloc(alloc, Bench_OpTbl[i].Size);
+        }
+        for (i = BENCH_BURST; i > 0u; i--) {
+            Bench_Free(alloc, Bench_LiveTbl[i - 1u]);
+        }
+    }
+    t_elapsed = Bench_TimeGet() - t_start;
+    for (i = 0u; i < BENCH_BURST; i++) {
+        Bench_LiveTbl[i] = DEF_NULL;
+    }
+
+   *p_int_dis = (double)(Bench_IntDisCtr - int_dis_start) / (double)nbr_ops;
+    return ((t_elapsed * 1.0e9) / (double)nbr_ops);
+}
+
+
+/*
+*********************************************************************************************************
+*                                                main()
+*********************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    static  const  char  *alloc_name[] = { "malloc/free", "Mem_Slab", "Mem_SlabCache" };
+    unsigned  long        nbr_ops;
+    double                ns;
+    double                int_dis;
+    LIB_ERR               err;
+    int                   alloc;
+
+
+    nbr_ops = BENCH_OPS_PER_RUN_DFLT;
+    if (argc > 1) {
+        nbr_ops = strtoul(argv[1], DEF_NULL, 0);
+        if (nbr_ops < BENCH_LIVE_MAX) {
+            nbr_ops = BENCH_LIVE_MAX;
+        }
+    }
+    if ((uintptr_t)&Bench_SegMem[BENCH_SEG_SIZE - 1u] > (uintptr_t)DEF_INT_32U_MAX_VAL) {
+        fprintf(stderr, "lib_mem_slab_bench: segment above 4 GB, build with -no-pie (see Note #1)\n");
+        return (EXIT_FAILURE);
+    }
+    Bench_OpTbl = (BENCH_OP *)malloc(sizeof(BENCH_OP) * DEF_MAX(nbr_ops, BENCH_WARMUP_OPS));
+    if (Bench_OpTbl == DEF_NULL) {
+        return (EXIT_FAILURE);
+    }
+    Bench_OpTblFill(DEF_MAX(nbr_ops, BENCH_WARMUP_OPS));
+
+    Mem_Init();
+    Bench_SlabCreate();
+    Bench_ChkClasses();
+    Bench_ChkFree();
+    Mem_SlabCacheFlush(&Bench_Cache, &err);
+    if (err != LIB_MEM_ERR_NONE) {
+        Bench_Fail("Mem_SlabCacheFlush()", err);
+    }
+    Bench_ChkStats(0u);
+    Bench_Frag(nbr_ops);
+    printf("All checks passed.\n\n");
+
+    printf("%-14s  %16s  %16s  %16s  %16s\n",
+           "allocator", "burst ns/op", "burst crit/op", "random ns/op", "random crit/op");
+    for (alloc = BENCH_ALLOC_MALLOC; alloc <= BENCH_ALLOC_CACHE; alloc++) {
+        Bench_SlabReset();
+        ns = Bench_RunBurst((BENCH_ALLOC)alloc, nbr_ops, &int_dis);
+        printf("%-14s  %16.1f  %16.2f", alloc_name[alloc], ns, int_dis);
+        ns = Bench_RunRandom((BENCH_ALLOC)alloc, nbr_ops, &int_dis);
+        printf("  %16.1f  %16.2f\n", ns, int_dis);
+    }
+    printf("\nMem_SlabCache: %u hits, %u misses\n", (unsigned)Bench_Cache.HitCtr, (unsigned)Bench_Cache.MissCtr);
+
+    free(Bench_OpTbl);
+    return (EXIT_SUCCESS);
+}
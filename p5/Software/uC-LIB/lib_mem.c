@@ -72,6 +72,11 @@
 *********************************************************************************************************
 */
 
+#define  MEM_BLK_NBR_WORDS                      8u              /* Nbr of CPU_ALIGN words per unrolled blk.             */
+#define  MEM_BLK_SIZE                          (MEM_BLK_NBR_WORDS * sizeof(CPU_ALIGN))
+
+#define  MEM_TRACK_FMT_VER                      1u              /* Mem_TrackOutput() fmt version.                       */
+
 
 /*
 *********************************************************************************************************
@@ -111,6 +116,22 @@ MEM_SEG      Mem_SegHeap;                                       /* Heap mem seg.
 
 MEM_SEG     *Mem_SegHeadPtr;                                    /* Ptr to head of seg list.                             */
 
+#if ((LIB_MEM_CFG_SLAB_EN     == DEF_ENABLED) && \
+     (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED))
+MEM_SLAB    *Mem_SlabHeadPtr;                                   /* Ptr to head of slab list.                            */
+#endif
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+MEM_DYN_POOL          *Mem_DynPoolHeadPtr;                      /* Ptr to head of dyn pool list.                        */
+MEM_TRACK_OWNER_FNCT   Mem_TrackOwnerFnct;                      /* Fnct returning the current owner name.               */
+                                                                /* Tbl of owners.                                       */
+MEM_TRACK_OWNER        Mem_TrackOwnerTbl[LIB_MEM_CFG_TRACK_OWNER_NBR_MAX];
+MEM_TRACK_OWNER        Mem_TrackOwnerOther;                     /* Owners that do NOT fit in the tbl.                   */
+#if (LIB_MEM_CFG_TRACK_SAMPLE_RATE > 1u)
+CPU_INT32U             Mem_TrackSampleCtr;                      /* Nbr of blk gets, for sampling.                       */
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -168,6 +189,23 @@ static  CPU_BOOLEAN   Mem_PoolBlkIsValidAddr   (       MEM_POOL      *p_pool,
                                                        void          *p_mem);
 #endif
 
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+static  CPU_INT08U    Mem_SlabClassIxGet       (       MEM_SLAB      *p_slab,
+                                                       CPU_SIZE_T     size);
+#endif
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+static  MEM_TRACK_OWNER  *Mem_TrackOwnerGetCritical(void);
+
+static  void          Mem_TrackBlkGetCritical  (       MEM_DYN_POOL  *p_pool);
+
+static  void          Mem_TrackOutputNbr       (       void         (*out_fnct) (CPU_CHAR *),
+                                                       CPU_INT32U     nbr);
+
+static  void          Mem_TrackOutputName      (       void         (*out_fnct) (CPU_CHAR *),
+                                                const  CPU_CHAR      *p_name);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -212,6 +250,17 @@ void  Mem_Init (void)
                                                                 /* ------------------ INIT SEG LIST ------------------- */
     Mem_SegHeadPtr = DEF_NULL;
 
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)                       /* ------------------ INIT TRACKING ------------------- */
+    Mem_DynPoolHeadPtr = DEF_NULL;
+    Mem_TrackOwnerFnct = DEF_NULL;
+    Mem_Clr(&Mem_TrackOwnerTbl[0u],   sizeof(Mem_TrackOwnerTbl));
+    Mem_Clr(&Mem_TrackOwnerOther,     sizeof(Mem_TrackOwnerOther));
+    Mem_TrackOwnerOther.NamePtr = (const CPU_CHAR *)"Other";
+#if (LIB_MEM_CFG_TRACK_SAMPLE_RATE > 1u)
+    Mem_TrackSampleCtr = 0u;
+#endif
+#endif
+
 #if (LIB_MEM_CFG_HEAP_SIZE > 0u)
     {
         LIB_ERR   err;
@@ -299,6 +348,10 @@ void  Mem_Clr (void        *pmem,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (4) If LIB_MEM_CFG_OPTIMIZE_WORD_EN is enabled, the aligned fill is unrolled by blocks of
+*                   MEM_BLK_NBR_WORDS words so that the loop overhead is paid once per block & the compiler
+*                   can merge the stores into multiple-store instructions (e.g. STM/STRD).
 *********************************************************************************************************
 */
 
@@ -345,6 +398,20 @@ void  Mem_Set (void        *pmem,
     }
 
     pmem_align = (CPU_ALIGN *)pmem_08;                          /* See Note #2.                                         */
+#if (LIB_MEM_CFG_OPTIMIZE_WORD_EN == DEF_ENABLED)
+    while (size_rem >= MEM_BLK_SIZE) {                          /* Fill mem buf by blks of words (see Note #4).         */
+        pmem_align[0] = data_align;
+        pmem_align[1] = data_align;
+        pmem_align[2] = data_align;
+        pmem_align[3] = data_align;
+        pmem_align[4] = data_align;
+        pmem_align[5] = data_align;
+        pmem_align[6] = data_align;
+        pmem_align[7] = data_align;
+        pmem_align   += MEM_BLK_NBR_WORDS;
+        size_rem     -= MEM_BLK_SIZE;
+    }
+#endif
     while (size_rem >= sizeof(CPU_ALIGN)) {                     /* While mem buf aligned on CPU_ALIGN word boundaries,  */
        *pmem_align++ = data_align;                              /* ... fill mem buf with    CPU_ALIGN-sized data.       */
         size_rem    -= sizeof(CPU_ALIGN);
@@ -406,6 +473,25 @@ void  Mem_Set (void        *pmem,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (5) If LIB_MEM_CFG_COPY_DMA_EN is enabled, copies of LIB_MEM_CFG_COPY_DMA_SIZE_MIN octets
+*                   or more between buffers that do NOT overlap are first handed to the BSP's
+*                   Mem_CopyDMA().  If it declines the copy, the copy is performed by the CPU.
+*
+*               (6) If LIB_MEM_CFG_OPTIMIZE_WORD_EN is enabled :
+*
+*                   (a) The aligned copy is unrolled by blocks of MEM_BLK_NBR_WORDS words so that the
+*                       compiler can merge the accesses into multiple-load/store instructions (e.g.
+*                       LDM/STM or LDRD/STRD).
+*
+*                   (b) Buffers with different alignment offsets are copied with aligned words : the
+*                       destination is aligned with leading octets, then each destination word is
+*                       merged from two aligned source words with shifts.
+*
+*                       The first aligned source word MAY include up to (sizeof(CPU_ALIGN) - 1) octets
+*                       below the source buffer.  These octets are in the same CPU word as the first
+*                       source octet & so can NOT be in another memory region; they are discarded.
+*                       No octet above the source buffer is ever read.
 *********************************************************************************************************
 */
 
@@ -424,6 +510,15 @@ void  Mem_Copy (       void        *pdest,
            CPU_DATA      mem_align_mod_dest;
            CPU_DATA      mem_align_mod_src;
            CPU_BOOLEAN   mem_aligned;
+#if (LIB_MEM_CFG_OPTIMIZE_WORD_EN == DEF_ENABLED)
+           CPU_ALIGN     data_lo;
+           CPU_ALIGN     data_hi;
+           CPU_DATA      shift_lo;
+           CPU_DATA      shift_hi;
+#endif
+#if (LIB_MEM_CFG_COPY_DMA_EN == DEF_ENABLED)
+           CPU_BOOLEAN   mem_dma_ok;
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -439,6 +534,19 @@ void  Mem_Copy (       void        *pdest,
 #endif
 
 
+#if (LIB_MEM_CFG_COPY_DMA_EN == DEF_ENABLED)
+    if (size >= LIB_MEM_CFG_COPY_DMA_SIZE_MIN) {                /* If large copy ...                                   */
+        mem_dma_ok = DEF_FAIL;
+        if ((((CPU_ADDR)psrc  + size) <= (CPU_ADDR)pdest) ||    /* ... & mem bufs do NOT overlap, ...                   */
+            (((CPU_ADDR)pdest + size) <= (CPU_ADDR)psrc )) {
+            mem_dma_ok = Mem_CopyDMA(pdest, psrc, size);        /* ... try DMA copy (see Note #5).                      */
+        }
+        if (mem_dma_ok == DEF_OK) {
+            return;
+        }
+    }
+#endif
+
     size_rem           =  size;
 
     pmem_08_dest       = (      CPU_INT08U *)pdest;
@@ -468,6 +576,21 @@ void  Mem_Copy (       void        *pdest,
 
             pmem_align_dest = (      CPU_ALIGN *)pmem_08_dest;  /* See Note #3.                                         */
             pmem_align_src  = (const CPU_ALIGN *)pmem_08_src;
+#if (LIB_MEM_CFG_OPTIMIZE_WORD_EN == DEF_ENABLED)
+            while (size_rem >= MEM_BLK_SIZE) {                  /* Copy mem bufs by blks of words (see Note #6a).       */
+                pmem_align_dest[0] = pmem_align_src[0];
+                pmem_align_dest[1] = pmem_align_src[1];
+                pmem_align_dest[2] = pmem_align_src[2];
+                pmem_align_dest[3] = pmem_align_src[3];
+                pmem_align_dest[4] = pmem_align_src[4];
+                pmem_align_dest[5] = pmem_align_src[5];
+                pmem_align_dest[6] = pmem_align_src[6];
+                pmem_align_dest[7] = pmem_align_src[7];
+                pmem_align_dest   += MEM_BLK_NBR_WORDS;
+                pmem_align_src    += MEM_BLK_NBR_WORDS;
+                size_rem          -= MEM_BLK_SIZE;
+            }
+#endif
             while (size_rem      >=  sizeof(CPU_ALIGN)) {       /* While mem bufs aligned on CPU_ALIGN word boundaries, */
                *pmem_align_dest++ = *pmem_align_src++;          /* ... copy psrc to pdest with CPU_ALIGN-sized words.   */
                 size_rem         -=  sizeof(CPU_ALIGN);
@@ -475,6 +598,36 @@ void  Mem_Copy (       void        *pdest,
 
             pmem_08_dest = (      CPU_INT08U *)pmem_align_dest;
             pmem_08_src  = (const CPU_INT08U *)pmem_align_src;
+#if (LIB_MEM_CFG_OPTIMIZE_WORD_EN == DEF_ENABLED)
+        } else if (size_rem >= (2u * sizeof(CPU_ALIGN))) {      /* Else copy unaligned mem bufs ...                     */
+                                                                /* ... with leading octets until dest aligned ...       */
+            while (((CPU_ADDR)pmem_08_dest % sizeof(CPU_ALIGN)) != 0u) {
+               *pmem_08_dest++ = *pmem_08_src++;
+                size_rem      -=  sizeof(CPU_INT08U);
+            }
+
+            mem_align_mod_src = (CPU_DATA)((CPU_ADDR)pmem_08_src % sizeof(CPU_ALIGN));
+            shift_lo          =  mem_align_mod_src * DEF_OCTET_NBR_BITS;
+            shift_hi          = (sizeof(CPU_ALIGN) * DEF_OCTET_NBR_BITS) - shift_lo;
+
+            pmem_align_dest   = (      CPU_ALIGN *)pmem_08_dest;
+                                                                /* See Note #6b.                                        */
+            pmem_align_src    = (const CPU_ALIGN *)(pmem_08_src - mem_align_mod_src);
+            data_lo           = *pmem_align_src++;
+            while (size_rem >= (2u * sizeof(CPU_ALIGN))) {      /* ... & merge aligned src words into dest words.       */
+                data_hi = *pmem_align_src++;
+#if (CPU_CFG_ENDIAN_TYPE == CPU_ENDIAN_TYPE_LITTLE)
+               *pmem_align_dest++ = (data_lo >> shift_lo) | (data_hi << shift_hi);
+#else
+               *pmem_align_dest++ = (data_lo << shift_lo) | (data_hi >> shift_hi);
+#endif
+                data_lo   = data_hi;
+                size_rem -= sizeof(CPU_ALIGN);
+            }
+
+            pmem_08_dest = (      CPU_INT08U *)pmem_align_dest;
+            pmem_08_src  = (const CPU_INT08U *)pmem_align_src - sizeof(CPU_ALIGN) + mem_align_mod_src;
+#endif
         }
     }
 
@@ -642,6 +795,9 @@ void  Mem_Move (       void        *pdest,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (5) If LIB_MEM_CFG_OPTIMIZE_WORD_EN is enabled, the aligned compare is unrolled by blocks
+*                   of MEM_BLK_NBR_WORDS words & tests the differences of a whole block at once.
 *********************************************************************************************************
 */
 
@@ -659,6 +815,9 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
            CPU_DATA      mem_align_mod_2;
            CPU_BOOLEAN   mem_aligned;
            CPU_BOOLEAN   mem_cmp;
+#if (LIB_MEM_CFG_OPTIMIZE_WORD_EN == DEF_ENABLED)
+           CPU_ALIGN     mem_diff;
+#endif
 
 
     if (size < 1) {                                             /* See Note #1.                                         */
@@ -704,6 +863,25 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
             p1_mem_align = (CPU_ALIGN *)p1_mem_08;              /* See Note #3.                                         */
             p2_mem_align = (CPU_ALIGN *)p2_mem_08;
 
+#if (LIB_MEM_CFG_OPTIMIZE_WORD_EN == DEF_ENABLED)
+            while ((mem_cmp  == DEF_YES) &&                     /* Cmp mem bufs by blks of words (see Note #5).         */
+                   (size_rem >= MEM_BLK_SIZE)) {
+                p1_mem_align -= MEM_BLK_NBR_WORDS;
+                p2_mem_align -= MEM_BLK_NBR_WORDS;
+                mem_diff      = (p1_mem_align[0] ^ p2_mem_align[0]) |
+                                (p1_mem_align[1] ^ p2_mem_align[1]) |
+                                (p1_mem_align[2] ^ p2_mem_align[2]) |
+                                (p1_mem_align[3] ^ p2_mem_align[3]) |
+                                (p1_mem_align[4] ^ p2_mem_align[4]) |
+                                (p1_mem_align[5] ^ p2_mem_align[5]) |
+                                (p1_mem_align[6] ^ p2_mem_align[6]) |
+                                (p1_mem_align[7] ^ p2_mem_align[7]);
+                if (mem_diff != 0u) {                           /* If ANY data octet(s) NOT identical, cmp fails.       */
+                     mem_cmp = DEF_NO;
+                }
+                size_rem -= MEM_BLK_SIZE;
+            }
+#endif
             while ((mem_cmp  == DEF_YES) &&                     /* Cmp mem bufs while identical & ...                   */
                    (size_rem >= sizeof(CPU_ALIGN))) {           /* ... mem bufs aligned on CPU_ALIGN word boundaries.   */
                 p1_mem_align--;
@@ -2000,6 +2178,9 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
     if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
         CPU_CRITICAL_ENTER();
         if (p_pool->BlkAllocCnt >= p_pool->BlkQtyMax) {
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+            p_pool->FailCtr++;
+#endif
             CPU_CRITICAL_EXIT();
 
            *p_err = LIB_MEM_ERR_POOL_EMPTY;
@@ -2015,6 +2196,9 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
     if (p_pool->BlkFreePtr != DEF_NULL) {
         p_blk              = p_pool->BlkFreePtr;
         p_pool->BlkFreePtr = *((void **)p_blk);
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+        Mem_TrackBlkGetCritical(p_pool);
+#endif
         CPU_CRITICAL_EXIT();
 
        *p_err = LIB_MEM_ERR_NONE;
@@ -2037,9 +2221,20 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
                                  DEF_NULL,
                                  p_err);
     if (*p_err != LIB_MEM_ERR_NONE) {
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+        CPU_CRITICAL_ENTER();
+        p_pool->FailCtr++;
+        CPU_CRITICAL_EXIT();
+#endif
         return (DEF_NULL);
     }
 
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+    CPU_CRITICAL_ENTER();
+    Mem_TrackBlkGetCritical(p_pool);
+    CPU_CRITICAL_EXIT();
+#endif
+
     return (p_blk);
 }
 
@@ -2107,6 +2302,12 @@ void  Mem_DynPoolBlkFree (MEM_DYN_POOL  *p_pool,
     CPU_CRITICAL_ENTER();
    *((void **)p_blk)   = p_pool->BlkFreePtr;
     p_pool->BlkFreePtr = p_blk;
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+    if (p_pool->NbrUsed > 0u) {
+        p_pool->NbrUsed--;
+    }
+    p_pool->FreeCtr++;
+#endif
     CPU_CRITICAL_EXIT();
 
    *p_err = LIB_MEM_ERR_NONE;
@@ -2173,39 +2374,65 @@ CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
 
 /*
 *********************************************************************************************************
-*                                           Mem_OutputUsage()
+*                                           Mem_SlabCreate()
 *
-* Description : Outputs memory usage report through 'out_fnct'.
+* Description : Creates a slab allocator with power-of-two size classes.
 *
-* Argument(s) : out_fnct        Pointer to output function.
+* Argument(s) : p_name          Pointer to slab name.
 *
-*               print_details   DEF_YES, if the size of each allocation should be printed.
-*                               DEF_NO,  otherwise.
+*               p_slab          Pointer to slab data.
+*
+*               p_seg           Pointer to segment from which to allocate memory. Will be allocated from
+*                               general-purpose heap if null.
+*
+*               blk_size_min    Block size of the smallest class, in bytes. MUST be a power of 2.
+*
+*               blk_size_max    Block size of the largest  class, in bytes. MUST be a power of 2.
+*
+*               blk_qty_max     Maximum number of blocks of each class. Set to LIB_MEM_BLK_QTY_UNLIMITED if
+*                               no limit.
 *
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *
 *                                   LIB_MEM_ERR_NONE                Operation was successful.
-*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*                                   LIB_MEM_ERR_NULL_PTR            Slab data pointer NULL.
+*                                   LIB_MEM_ERR_INVALID_BLK_SIZE    Invalid block sizes (see Note #1).
+*                                   LIB_MEM_ERR_INVALID_BLK_NBR     Too many classes    (see Note #2).
 *
-*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
+*                                   -----------------------RETURNED BY Mem_DynPoolCreate()-----------------------
 *                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
-*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
 *
 * Return(s)   : None.
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) 'blk_size_min' must hold the block header and a pointer, since the pointer to the next
+*                   free block is stored in the block itself (only when free/unused). 'blk_size_max' must
+*                   be greater than or equal to 'blk_size_min'.
+*
+*               (2) There is one class per power of two from 'blk_size_min' to 'blk_size_max', that is at
+*                   most LIB_MEM_CFG_SLAB_CLASS_NBR_MAX classes.
+*
+*               (3) No memory is taken from the segment here, the blocks are carved on demand.
 *********************************************************************************************************
 */
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
-                      LIB_ERR   *p_err)
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+void  Mem_SlabCreate (const  CPU_CHAR    *p_name,
+                             MEM_SLAB    *p_slab,
+                             MEM_SEG     *p_seg,
+                             CPU_SIZE_T   blk_size_min,
+                             CPU_SIZE_T   blk_size_max,
+                             CPU_SIZE_T   blk_qty_max,
+                             LIB_ERR     *p_err)
 {
-    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX];
-    MEM_SEG   *p_seg;
+    MEM_SLAB_CLASS  *p_class;
+    CPU_DATA         shift_min;
+    CPU_DATA         shift_max;
+    CPU_INT08U       ix;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
     CPU_SR_ALLOC();
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -2213,79 +2440,58 @@ void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
         CPU_SW_EXCEPTION(;);
     }
 
-    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+    if (p_slab == DEF_NULL) {                                   /* Chk for NULL slab data ptr.                          */
        *p_err = LIB_MEM_ERR_NULL_PTR;
         return;
     }
 #endif
+                                                                /* Chk for inv blk sizes (see Note #1).                 */
+    if ((MATH_IS_PWR2(blk_size_min) != DEF_YES)                                  ||
+        (MATH_IS_PWR2(blk_size_max) != DEF_YES)                                  ||
+        (blk_size_min < DEF_MAX(2u * LIB_MEM_SLAB_HDR_SIZE, sizeof(void *))) ||
+        (blk_size_max < blk_size_min)) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_SIZE;
+        return;
+    }
 
-    out_fnct((CPU_CHAR *)"---------------- Memory allocation info ----------------\r\n");
-    out_fnct((CPU_CHAR *)"| Type    | Size       | Free size  | Name\r\n");
-    out_fnct((CPU_CHAR *)"|---------|------------|------------|-------------------\r\n");
-
-    CPU_CRITICAL_ENTER();
-    p_seg = Mem_SegHeadPtr;
-    while (p_seg != DEF_NULL) {
-        CPU_SIZE_T       rem_size;
-        MEM_SEG_INFO     seg_info;
-        MEM_ALLOC_INFO  *p_alloc;
-
+    shift_min = (DEF_INT_CPU_NBR_BITS - 1u) - CPU_CntLeadZeros((CPU_DATA)blk_size_min);
+    shift_max = (DEF_INT_CPU_NBR_BITS - 1u) - CPU_CntLeadZeros((CPU_DATA)blk_size_max);
+    if ((shift_max - shift_min) >= LIB_MEM_CFG_SLAB_CLASS_NBR_MAX) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_NBR;                    /* See Note #2.                                         */
+        return;
+    }
 
-        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
+    for (ix = 0u; ix <= (CPU_INT08U)(shift_max - shift_min); ix++) {
+        p_class = &p_slab->ClassTbl[ix];
+        Mem_DynPoolCreate(p_name,                               /* See Note #3.                                         */
+                         &p_class->Pool,
+                          p_seg,
+                          blk_size_min << ix,
+                          sizeof(CPU_ALIGN),
+                          0u,
+                          blk_qty_max,
+                          p_err);
         if (*p_err != LIB_MEM_ERR_NONE) {
             return;
         }
 
-        out_fnct((CPU_CHAR *)"| Section | ");
-
-        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
-
-        out_fnct(str);
-        out_fnct((CPU_CHAR *)" | ");
-
-        (void)Str_FmtNbr_Int32U(rem_size,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
-
-        out_fnct(str);
-        out_fnct((CPU_CHAR *)" | ");
-        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
-        out_fnct((CPU_CHAR *)"\r\n");
-
-        p_alloc = p_seg->AllocInfoHeadPtr;
-        while (p_alloc != DEF_NULL) {
-            out_fnct((CPU_CHAR *)"| -> Obj  | ");
-
-            (void)Str_FmtNbr_Int32U(p_alloc->Size,
-                                    10u,
-                                    DEF_NBR_BASE_DEC,
-                                    ' ',
-                                    DEF_NO,
-                                    DEF_YES,
-                                   &str[0u]);
-
-            out_fnct(str);
-            out_fnct((CPU_CHAR *)" |            | ");
+        p_class->NbrUsed      = 0u;
+        p_class->NbrUsedMax   = 0u;
+        p_class->AllocCtr     = 0u;
+        p_class->AllocFailCtr = 0u;
+    }
 
-            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
-            out_fnct((CPU_CHAR *)"\r\n");
+    p_slab->ClassNbr      = (CPU_INT08U)(shift_max - shift_min + 1u);
+    p_slab->ClassShiftMin = (CPU_INT08U) shift_min;
 
-            p_alloc = p_alloc->NextPtr;
-        }
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_slab->NamePtr = p_name;
 
-        p_seg = p_seg->NextPtr;
-    }
+    CPU_CRITICAL_ENTER();
+    p_slab->NextPtr = Mem_SlabHeadPtr;
+    Mem_SlabHeadPtr = p_slab;
     CPU_CRITICAL_EXIT();
+#endif
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -2294,109 +2500,1017 @@ void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
-*********************************************************************************************************
-*/
-
-/*
-*********************************************************************************************************
-*                                       Mem_SegCreateCritical()
+*                                           Mem_SlabAlloc()
 *
-* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+* Description : Allocates memory from the smallest slab class that fits the requested size.
 *
-* Argument(s) : p_name          Pointer to segment name.
+* Argument(s) : p_slab  Pointer to slab data.
 *
-*               p_seg           Pointer to segment data. Must be allocated by caller.
-*               -----           Argument validated by caller.
+*               size    Number of bytes requested.
 *
-*               seg_base_addr   Segment's first byte address.
+*               p_err   Pointer to variable that will receive the return error code from this function :
 *
-*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
-*                               from this memory segment. MUST be a power of 2.
-*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
-*               -------------   Argument validated by caller.
+*                           LIB_MEM_ERR_NONE                    Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR                Slab data pointer NULL.
+*                           LIB_MEM_ERR_INVALID_MEM_SIZE        Size too large for the largest class.
 *
-*               size            Total size of segment, in bytes.
-*               ----            Argument validated by caller.
+*                           ---------------------RETURNED BY Mem_DynPoolBlkGet()----------------------
+*                           LIB_MEM_ERR_POOL_EMPTY              Class is empty.
+*                           LIB_MEM_ERR_SEG_OVF                 Allocation would overflow memory segment.
 *
-* Return(s)   : Pointer to segment data, if successful.
+* Return(s)   : Pointer to memory, if successful.
 *
 *               DEF_NULL, otherwise.
 *
-* Caller(s)   : Mem_PoolCreate(),
-*               Mem_SegCreate().
+* Caller(s)   : Application,
+*               Mem_SlabCacheAlloc().
 *
-* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+* Note(s)     : (1) The returned memory is aligned on LIB_MEM_SLAB_HDR_SIZE bytes and the class block
+*                   size includes the header : a request of exactly a power of two bytes is served by the
+*                   next class.
 *********************************************************************************************************
 */
 
-static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
-                                           MEM_SEG     *p_seg,
-                                           CPU_ADDR     seg_base_addr,
-                                           CPU_SIZE_T   padding_align,
-                                           CPU_SIZE_T   size)
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+void  *Mem_SlabAlloc (MEM_SLAB    *p_slab,
+                      CPU_SIZE_T   size,
+                      LIB_ERR     *p_err)
 {
-    p_seg->AddrBase         =  seg_base_addr;
-    p_seg->AddrEnd          = (seg_base_addr + (size - 1u));
-    p_seg->AddrNext         =  seg_base_addr;
-    p_seg->NextPtr          =  Mem_SegHeadPtr;
-    p_seg->PaddingAlign     =  padding_align;
+    MEM_SLAB_CLASS  *p_class;
+    CPU_INT32U      *p_hdr;
+    CPU_INT08U       ix;
+    CPU_SR_ALLOC();
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-    p_seg->NamePtr          = p_name;
-    p_seg->AllocInfoHeadPtr = DEF_NULL;
-#else
-    (void)p_name;
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_slab == DEF_NULL) {                                   /* Chk for NULL slab data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
 #endif
 
-    Mem_SegHeadPtr = p_seg;
+    ix = Mem_SlabClassIxGet(p_slab, size);
+    if (ix >= p_slab->ClassNbr) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+    p_class = &p_slab->ClassTbl[ix];
+
+    p_hdr = (CPU_INT32U *)Mem_DynPoolBlkGet(&p_class->Pool, p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        CPU_CRITICAL_ENTER();
+        p_class->AllocFailCtr++;
+        CPU_CRITICAL_EXIT();
+        return (DEF_NULL);
+    }
+
+   *p_hdr = LIB_MEM_SLAB_HDR_MAGIC | ix;
+
+    CPU_CRITICAL_ENTER();
+    p_class->NbrUsed++;
+    if (p_class->NbrUsedMax < p_class->NbrUsed) {
+        p_class->NbrUsedMax = p_class->NbrUsed;
+    }
+    p_class->AllocCtr++;
+    CPU_CRITICAL_EXIT();
+
+    return ((void *)(p_hdr + 1u));
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                      Mem_SegOverlapChkCritical()
+*                                            Mem_SlabFree()
 *
-* Description : Checks if existing memory segment exists or overlaps with specified memory area.
+* Description : Returns memory to its slab class.
 *
-* Argument(s) : seg_base_addr   Address of first byte of memory area.
+* Argument(s) : p_slab  Pointer to slab data.
 *
-*               size            Size of memory area, in bytes.
+*               p_mem   Pointer returned by Mem_SlabAlloc() or Mem_SlabCacheAlloc().
 *
-*               p_err       Pointer to variable that will receive the return error code from this function :
+*               p_err   Pointer to variable that will receive the return error code from this function :
 *
-*                               LIB_MEM_ERR_INVALID_SEG_OVERLAP     Segment overlaps another existing segment.
-*                               LIB_MEM_ERR_INVALID_SEG_EXISTS      Segment already exists.
+*                           LIB_MEM_ERR_NONE                Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR            'p_slab' or 'p_mem' pointer passed is NULL.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR    'p_mem' was not allocated from a slab or was
+*                                                               already freed (see Note #1).
 *
-* Return(s)   : Pointer to memory segment that overlaps.
+*                           --------------------RETURNED BY Mem_DynPoolBlkFree()---------------------
+*                           LIB_MEM_ERR_POOL_FULL           Class is full.
 *
-*               DEF_NULL, otherwise.
+* Return(s)   : none.
 *
-* Caller(s)   : Mem_PoolCreate(),
-*               Mem_SegCreate().
+* Caller(s)   : Application,
+*                   Mem_SlabCacheFree().
 *
-* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+* Note(s)     : (1) The header of a freed block is replaced by the free list link, see 'lib_mem.h  SLAB
+*                   ALLOCATOR DATA TYPES  Note #2'.
 *********************************************************************************************************
 */
 
-#if  (LIB_MEM_CFG_HEAP_SIZE      >  0u)
-static  MEM_SEG  *Mem_SegOverlapChkCritical (CPU_ADDR     seg_base_addr,
-                                             CPU_SIZE_T   size,
-                                             LIB_ERR     *p_err)
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+void  Mem_SlabFree (MEM_SLAB  *p_slab,
+                    void      *p_mem,
+                    LIB_ERR   *p_err)
 {
-    MEM_SEG   *p_seg_chk;
-    CPU_ADDR   seg_new_end;
-    CPU_ADDR   seg_chk_start;
-    CPU_ADDR   seg_chk_end;
-
+    MEM_SLAB_CLASS  *p_class;
+    CPU_INT32U      *p_hdr;
+    CPU_INT32U       hdr;
+    CPU_INT08U       ix;
+    CPU_SR_ALLOC();
 
-    seg_new_end = seg_base_addr + (size - 1u);
-    p_seg_chk   = Mem_SegHeadPtr;
 
-    while (p_seg_chk != DEF_NULL) {
-        seg_chk_start = (CPU_ADDR)p_seg_chk->AddrBase;
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_slab == DEF_NULL) ||
+        (p_mem  == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    p_hdr = (CPU_INT32U *)p_mem - 1u;
+    hdr   = *p_hdr;
+    ix    = (CPU_INT08U)(hdr & LIB_MEM_SLAB_HDR_IX_MSK);
+    if (((hdr & ~LIB_MEM_SLAB_HDR_IX_MSK) != LIB_MEM_SLAB_HDR_MAGIC) ||
+         (ix >= p_slab->ClassNbr)) {                            /* See Note #1.                                         */
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
+        return;
+    }
+    p_class = &p_slab->ClassTbl[ix];
+
+    Mem_DynPoolBlkFree(&p_class->Pool, (void *)p_hdr, p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_class->NbrUsed--;
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SlabCacheInit()
+*
+* Description : Initializes an empty per-task cache in front of a slab.
+*
+* Argument(s) : p_cache     Pointer to cache data.
+*
+*               p_slab      Pointer to slab backing the cache.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE            Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR        'p_cache' or 'p_slab' pointer passed is NULL.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The cache belongs to a single task, see 'lib_mem.h  SLAB ALLOCATOR DATA TYPES  Note #4'.
+*                   It can be allocated on the task's stack or attached to its TCB.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_SLAB_EN       == DEF_ENABLED) && \
+     (LIB_MEM_CFG_SLAB_CACHE_EN == DEF_ENABLED))
+void  Mem_SlabCacheInit (MEM_SLAB_CACHE  *p_cache,
+                         MEM_SLAB        *p_slab,
+                         LIB_ERR         *p_err)
+{
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_cache == DEF_NULL) ||
+        (p_slab  == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    Mem_Clr((void *)p_cache, sizeof(MEM_SLAB_CACHE));
+    p_cache->SlabPtr = p_slab;
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SlabCacheAlloc()
+*
+* Description : Allocates memory from a per-task cache, falling back to its slab when the cache is empty.
+*
+* Argument(s) : p_cache     Pointer to cache data.
+*
+*               size        Number of bytes requested.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            Cache data pointer NULL.
+*                               LIB_MEM_ERR_INVALID_MEM_SIZE    Size too large for the largest class.
+*
+*                               -------------------RETURNED BY Mem_SlabAlloc()--------------------
+*                               LIB_MEM_ERR_POOL_EMPTY          Class is empty.
+*                               LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : Pointer to memory, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) A cache hit takes no critical section.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_SLAB_EN       == DEF_ENABLED) && \
+     (LIB_MEM_CFG_SLAB_CACHE_EN == DEF_ENABLED))
+void  *Mem_SlabCacheAlloc (MEM_SLAB_CACHE  *p_cache,
+                           CPU_SIZE_T       size,
+                           LIB_ERR         *p_err)
+{
+    CPU_INT32U  *p_hdr;
+    CPU_INT08U   ix;
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_cache == DEF_NULL) {                                  /* Chk for NULL cache data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+#endif
+
+    ix = Mem_SlabClassIxGet(p_cache->SlabPtr, size);
+    if (ix >= p_cache->SlabPtr->ClassNbr) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+
+    p_hdr = (CPU_INT32U *)p_cache->FreeTbl[ix];
+    if (p_hdr == DEF_NULL) {                                    /* Cache empty, alloc from slab.                        */
+        p_cache->MissCtr++;
+        return (Mem_SlabAlloc(p_cache->SlabPtr, size, p_err));
+    }
+                                                                /* See Note #1.                                         */
+    p_cache->FreeTbl[ix] = *((void **)p_hdr);
+    p_cache->FreeCnt[ix]--;
+    p_cache->HitCtr++;
+
+   *p_hdr = LIB_MEM_SLAB_HDR_MAGIC | ix;
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return ((void *)(p_hdr + 1u));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SlabCacheFree()
+*
+* Description : Returns memory to a per-task cache, or to its slab when the cache of the class is full.
+*
+* Argument(s) : p_cache     Pointer to cache data.
+*
+*               p_mem       Pointer returned by Mem_SlabAlloc() or Mem_SlabCacheAlloc().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            'p_cache' or 'p_mem' pointer passed is NULL.
+*                               LIB_MEM_ERR_INVALID_BLK_ADDR    'p_mem' was not allocated from a slab or was
+*                                                                   already freed.
+*
+*                               --------------------RETURNED BY Mem_SlabFree()--------------------
+*                               LIB_MEM_ERR_POOL_FULL           Class is full.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The memory can come from another task's cache, as long as both caches share the slab.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_SLAB_EN       == DEF_ENABLED) && \
+     (LIB_MEM_CFG_SLAB_CACHE_EN == DEF_ENABLED))
+void  Mem_SlabCacheFree (MEM_SLAB_CACHE  *p_cache,
+                         void            *p_mem,
+                         LIB_ERR         *p_err)
+{
+    CPU_INT32U  *p_hdr;
+    CPU_INT32U   hdr;
+    CPU_INT08U   ix;
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_cache == DEF_NULL) ||
+        (p_mem   == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    p_hdr = (CPU_INT32U *)p_mem - 1u;
+    hdr   = *p_hdr;
+    ix    = (CPU_INT08U)(hdr & LIB_MEM_SLAB_HDR_IX_MSK);
+    if (((hdr & ~LIB_MEM_SLAB_HDR_IX_MSK) != LIB_MEM_SLAB_HDR_MAGIC) ||
+         (ix >= p_cache->SlabPtr->ClassNbr)) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
+        return;
+    }
+
+    if (p_cache->FreeCnt[ix] >= LIB_MEM_CFG_SLAB_CACHE_DEPTH) { /* Cache full, free to slab.                            */
+        Mem_SlabFree(p_cache->SlabPtr, p_mem, p_err);
+        return;
+    }
+
+   *((void **)p_hdr)     = p_cache->FreeTbl[ix];
+    p_cache->FreeTbl[ix] = (void *)p_hdr;
+    p_cache->FreeCnt[ix]++;
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SlabCacheFlush()
+*
+* Description : Returns all the blocks of a per-task cache to its slab.
+*
+* Argument(s) : p_cache     Pointer to cache data.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE            Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR        Cache data pointer NULL.
+*
+*                               ---------------RETURNED BY Mem_DynPoolBlkFree()----------------
+*                               LIB_MEM_ERR_POOL_FULL       Class is full.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) MUST be called before the task that owns the cache is deleted, otherwise the cached
+*                   blocks are lost.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_SLAB_EN       == DEF_ENABLED) && \
+     (LIB_MEM_CFG_SLAB_CACHE_EN == DEF_ENABLED))
+void  Mem_SlabCacheFlush (MEM_SLAB_CACHE  *p_cache,
+                          LIB_ERR         *p_err)
+{
+    MEM_SLAB_CLASS  *p_class;
+    void            *p_blk;
+    CPU_INT08U       ix;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_cache == DEF_NULL) {                                  /* Chk for NULL cache data ptr.                         */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+   *p_err = LIB_MEM_ERR_NONE;
+    for (ix = 0u; ix < p_cache->SlabPtr->ClassNbr; ix++) {
+        p_class = &p_cache->SlabPtr->ClassTbl[ix];
+        while (p_cache->FreeTbl[ix] != DEF_NULL) {
+            p_blk                = p_cache->FreeTbl[ix];
+            p_cache->FreeTbl[ix] = *((void **)p_blk);
+            p_cache->FreeCnt[ix]--;
+
+            Mem_DynPoolBlkFree(&p_class->Pool, p_blk, p_err);
+            if (*p_err != LIB_MEM_ERR_NONE) {
+                return;
+            }
+
+            CPU_CRITICAL_ENTER();
+            p_class->NbrUsed--;
+            CPU_CRITICAL_EXIT();
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_OutputUsage()
+*
+* Description : Outputs memory usage report through 'out_fnct'.
+*
+* Argument(s) : out_fnct        Pointer to output function.
+*
+*               print_details   DEF_YES, if the size of each allocation should be printed.
+*                               DEF_NO,  otherwise.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE                Operation was successful.
+*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*
+*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
+*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
+                      LIB_ERR   *p_err)
+{
+    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX];
+    MEM_SEG   *p_seg;
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+    MEM_SLAB  *p_slab;
+#endif
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    out_fnct((CPU_CHAR *)"---------------- Memory allocation info ----------------\r\n");
+    out_fnct((CPU_CHAR *)"| Type    | Size       | Free size  | Name\r\n");
+    out_fnct((CPU_CHAR *)"|---------|------------|------------|-------------------\r\n");
+
+    CPU_CRITICAL_ENTER();
+    p_seg = Mem_SegHeadPtr;
+    while (p_seg != DEF_NULL) {
+        CPU_SIZE_T       rem_size;
+        MEM_SEG_INFO     seg_info;
+        MEM_ALLOC_INFO  *p_alloc;
+
+
+        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return;
+        }
+
+        out_fnct((CPU_CHAR *)"| Section | ");
+
+        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+
+        (void)Str_FmtNbr_Int32U(rem_size,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct((CPU_CHAR *)"\r\n");
+
+        p_alloc = p_seg->AllocInfoHeadPtr;
+        while (p_alloc != DEF_NULL) {
+            out_fnct((CPU_CHAR *)"| -> Obj  | ");
+
+            (void)Str_FmtNbr_Int32U(p_alloc->Size,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)" |            | ");
+
+            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
+            out_fnct((CPU_CHAR *)"\r\n");
+
+            p_alloc = p_alloc->NextPtr;
+        }
+
+        p_seg = p_seg->NextPtr;
+    }
+
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+    p_slab = Mem_SlabHeadPtr;
+    while (p_slab != DEF_NULL) {                                /* Output each slab class, see Note #1.                 */
+        MEM_SLAB_CLASS  *p_class;
+        CPU_SIZE_T       blk_size;
+        CPU_INT08U       ix;
+
+
+        out_fnct((CPU_CHAR *)"| Slab    |            |            | ");
+        out_fnct((p_slab->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_slab->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct((CPU_CHAR *)"\r\n");
+
+        for (ix = 0u; ix < p_slab->ClassNbr; ix++) {
+            p_class  = &p_slab->ClassTbl[ix];
+            blk_size =  p_class->Pool.BlkSize;
+
+            out_fnct((CPU_CHAR *)"| -> Cls  | ");
+
+            (void)Str_FmtNbr_Int32U(blk_size * p_class->NbrUsedMax,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)" | ");
+
+            (void)Str_FmtNbr_Int32U(blk_size * (p_class->NbrUsedMax - p_class->NbrUsed),
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)" | ");
+
+            (void)Str_FmtNbr_Int32U(blk_size,
+                                    DEF_INT_32U_NBR_DIG_MAX,
+                                    DEF_NBR_BASE_DEC,
+                                    '\0',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)"-byte blks, used ");
+
+            (void)Str_FmtNbr_Int32U(p_class->NbrUsed,
+                                    DEF_INT_32U_NBR_DIG_MAX,
+                                    DEF_NBR_BASE_DEC,
+                                    '\0',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)", allocs ");
+
+            (void)Str_FmtNbr_Int32U(p_class->AllocCtr,
+                                    DEF_INT_32U_NBR_DIG_MAX,
+                                    DEF_NBR_BASE_DEC,
+                                    '\0',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)", fails ");
+
+            (void)Str_FmtNbr_Int32U(p_class->AllocFailCtr,
+                                    DEF_INT_32U_NBR_DIG_MAX,
+                                    DEF_NBR_BASE_DEC,
+                                    '\0',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct((CPU_CHAR *)"\r\n");
+        }
+
+        p_slab = p_slab->NextPtr;
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_TrackOwnerFnctSet()
+*
+* Description : Sets the function that names the owner of the memory allocated from now on.
+*
+* Argument(s) : fnct    Pointer to the function returning the name of the current owner, see Note #1.
+*
+*                       DEF_NULL, to stop accounting allocations to owners.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The function is called with interrupts disabled on every accounted allocation.  It
+*                   MUST be short, MUST NOT call any memory function and MUST return a pointer to a name
+*                   that stays valid until the next Mem_TrackOutput(), such as the current task's name.
+*                   It may return DEF_NULL when the owner is not known; the allocation is then accounted
+*                   to the "Other" owner.
+*
+*               (2) Owners are told apart by the address of their name, not by comparing the strings.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+void  Mem_TrackOwnerFnctSet (MEM_TRACK_OWNER_FNCT  fnct)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    Mem_TrackOwnerFnct = fnct;
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_TrackMark()
+*
+* Description : Marks the number of blocks used in each dynamic memory pool.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Mem_TrackOutput() reports, for each pool, the blocks used since the last mark.  A
+*                   count that keeps growing across identical phases of the application, such as the
+*                   handling of a request or a connection, points to a leak.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+void  Mem_TrackMark (void)
+{
+    MEM_DYN_POOL  *p_pool;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_pool = Mem_DynPoolHeadPtr;
+    CPU_CRITICAL_EXIT();
+
+    while (p_pool != DEF_NULL) {                                /* See Note #1.                                         */
+        CPU_CRITICAL_ENTER();
+        p_pool->NbrUsedMark = p_pool->NbrUsed;
+        p_pool              = p_pool->NextPtr;
+        CPU_CRITICAL_EXIT();
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_TrackOutput()
+*
+* Description : Outputs a memory accounting report through 'out_fnct'.
+*
+* Argument(s) : out_fnct    Pointer to output function.
+*
+*               ts          Timestamp of the report, in any unit the application chooses.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE                Operation was successful.
+*                               LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*
+*                               ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
+*                               LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
+*                               LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The report is made of comma-separated records, one per line, meant to be parsed by
+*                   a host tool :
+*
+*                       MEMTRACK,<fmt ver>,<ts>,<sample rate>
+*                       SEG,<name>,<total size>,<used size>,<rem size>
+*                       ALLOC,<seg name>,<name>,<size>
+*                       POOL,<name>,<blk size>,<used>,<used max>,<used since mark>,<gets>,<frees>,<fails>
+*                       OWNER,<name>,<seg size>,<blk gets>,<blk size>
+*                       END
+*
+*                   (a) ALLOC records are only output when LIB_MEM_CFG_DBG_INFO_EN is enabled.
+*
+*                   (b) 'used since mark' is signed, see Mem_TrackMark().
+*
+*                   (c) The counters only ever increase and wrap around.  The tool computes rates from
+*                       two reports and their timestamps.
+*
+*                   (d) Block gets of owners are sampled, see 'lib_mem.h  MEMORY ACCOUNTING
+*                       CONFIGURATION  Note #3'.  They are estimates, unlike the pool counters.
+*
+*                   (e) Names MUST NOT contain commas.
+*
+*               (2) Each record is read in its own critical section, which is NOT held while calling
+*                   'out_fnct'.  Records of a report may thus be a few allocations apart.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+void  Mem_TrackOutput (void        (*out_fnct) (CPU_CHAR *),
+                       CPU_INT32U    ts,
+                       LIB_ERR      *p_err)
+{
+    MEM_SEG          *p_seg;
+    MEM_DYN_POOL     *p_pool;
+    MEM_TRACK_OWNER   owner;
+    CPU_INT32U        ix;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    out_fnct((CPU_CHAR *)"MEMTRACK");                           /* ---------------------- HEADER ---------------------- */
+    Mem_TrackOutputNbr(out_fnct, MEM_TRACK_FMT_VER);
+    Mem_TrackOutputNbr(out_fnct, ts);
+    Mem_TrackOutputNbr(out_fnct, LIB_MEM_CFG_TRACK_SAMPLE_RATE);
+    out_fnct((CPU_CHAR *)"\r\n");
+
+    CPU_CRITICAL_ENTER();                                       /* ----------------------- SEGS ----------------------- */
+    p_seg = Mem_SegHeadPtr;
+    CPU_CRITICAL_EXIT();
+
+    while (p_seg != DEF_NULL) {                                 /* Segs are never removed from the list.                */
+        CPU_SIZE_T     rem_size;
+        MEM_SEG_INFO   seg_info;
+
+
+        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return;
+        }
+
+        out_fnct((CPU_CHAR *)"SEG");
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+        Mem_TrackOutputName(out_fnct, p_seg->NamePtr);
+#else
+        Mem_TrackOutputName(out_fnct, DEF_NULL);
+#endif
+        Mem_TrackOutputNbr(out_fnct, seg_info.TotalSize);
+        Mem_TrackOutputNbr(out_fnct, seg_info.UsedSize);
+        Mem_TrackOutputNbr(out_fnct, rem_size);
+        out_fnct((CPU_CHAR *)"\r\n");
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+        {
+            MEM_ALLOC_INFO  *p_alloc;
+
+
+            CPU_CRITICAL_ENTER();
+            p_alloc = p_seg->AllocInfoHeadPtr;
+            CPU_CRITICAL_EXIT();
+            while (p_alloc != DEF_NULL) {                       /* Alloc info is never removed from the list.           */
+                out_fnct((CPU_CHAR *)"ALLOC");
+                Mem_TrackOutputName(out_fnct, p_seg->NamePtr);
+                Mem_TrackOutputName(out_fnct, p_alloc->NamePtr);
+                Mem_TrackOutputNbr(out_fnct, p_alloc->Size);
+                out_fnct((CPU_CHAR *)"\r\n");
+
+                CPU_CRITICAL_ENTER();
+                p_alloc = p_alloc->NextPtr;
+                CPU_CRITICAL_EXIT();
+            }
+        }
+#endif
+
+        CPU_CRITICAL_ENTER();
+        p_seg = p_seg->NextPtr;
+        CPU_CRITICAL_EXIT();
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* ----------------------- POOLS ---------------------- */
+    p_pool = Mem_DynPoolHeadPtr;
+    CPU_CRITICAL_EXIT();
+
+    while (p_pool != DEF_NULL) {
+        MEM_DYN_POOL  pool;
+
+
+        CPU_CRITICAL_ENTER();                                   /* Snapshot the pool, see Note #2.                      */
+        pool   = *p_pool;
+        p_pool =  p_pool->NextPtr;
+        CPU_CRITICAL_EXIT();
+
+        out_fnct((CPU_CHAR *)"POOL");
+        Mem_TrackOutputName(out_fnct, pool.NamePtr);
+        Mem_TrackOutputNbr(out_fnct, pool.BlkSize);
+        Mem_TrackOutputNbr(out_fnct, pool.NbrUsed);
+        Mem_TrackOutputNbr(out_fnct, pool.NbrUsedMax);
+        if (pool.NbrUsed >= pool.NbrUsedMark) {                 /* See Note #1b.                                        */
+            Mem_TrackOutputNbr(out_fnct, pool.NbrUsed - pool.NbrUsedMark);
+        } else {
+            out_fnct((CPU_CHAR *)",-");
+            Mem_TrackOutputNbr(out_fnct, pool.NbrUsedMark - pool.NbrUsed);
+        }
+        Mem_TrackOutputNbr(out_fnct, pool.GetCtr);
+        Mem_TrackOutputNbr(out_fnct, pool.FreeCtr);
+        Mem_TrackOutputNbr(out_fnct, pool.FailCtr);
+        out_fnct((CPU_CHAR *)"\r\n");
+    }
+
+    for (ix = 0u; ix <= LIB_MEM_CFG_TRACK_OWNER_NBR_MAX; ix++) {/* ---------------------- OWNERS ---------------------- */
+        CPU_CRITICAL_ENTER();
+        if (ix < LIB_MEM_CFG_TRACK_OWNER_NBR_MAX) {
+            owner = Mem_TrackOwnerTbl[ix];
+        } else {
+            owner = Mem_TrackOwnerOther;                        /* Other owner last.                                    */
+        }
+        CPU_CRITICAL_EXIT();
+
+        if ((owner.SegSize   == 0u) &&                          /* Skip empty entries and an unused Other owner.        */
+            (owner.BlkGetCtr == 0u)) {
+            continue;
+        }
+
+        out_fnct((CPU_CHAR *)"OWNER");
+        Mem_TrackOutputName(out_fnct, owner.NamePtr);
+        Mem_TrackOutputNbr(out_fnct, owner.SegSize);
+        Mem_TrackOutputNbr(out_fnct, owner.BlkGetCtr);
+        Mem_TrackOutputNbr(out_fnct, owner.BlkGetSize);
+        out_fnct((CPU_CHAR *)"\r\n");
+    }
+
+    out_fnct((CPU_CHAR *)"END\r\n");
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       Mem_SegCreateCritical()
+*
+* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+*
+* Argument(s) : p_name          Pointer to segment name.
+*
+*               p_seg           Pointer to segment data. Must be allocated by caller.
+*               -----           Argument validated by caller.
+*
+*               seg_base_addr   Segment's first byte address.
+*
+*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
+*                               from this memory segment. MUST be a power of 2.
+*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
+*               -------------   Argument validated by caller.
+*
+*               size            Total size of segment, in bytes.
+*               ----            Argument validated by caller.
+*
+* Return(s)   : Pointer to segment data, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_PoolCreate(),
+*               Mem_SegCreate().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
+                                           MEM_SEG     *p_seg,
+                                           CPU_ADDR     seg_base_addr,
+                                           CPU_SIZE_T   padding_align,
+                                           CPU_SIZE_T   size)
+{
+    p_seg->AddrBase         =  seg_base_addr;
+    p_seg->AddrEnd          = (seg_base_addr + (size - 1u));
+    p_seg->AddrNext         =  seg_base_addr;
+    p_seg->NextPtr          =  Mem_SegHeadPtr;
+    p_seg->PaddingAlign     =  padding_align;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_seg->NamePtr          = p_name;
+    p_seg->AllocInfoHeadPtr = DEF_NULL;
+#else
+    (void)p_name;
+#endif
+
+    Mem_SegHeadPtr = p_seg;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      Mem_SegOverlapChkCritical()
+*
+* Description : Checks if existing memory segment exists or overlaps with specified memory area.
+*
+* Argument(s) : seg_base_addr   Address of first byte of memory area.
+*
+*               size            Size of memory area, in bytes.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_INVALID_SEG_OVERLAP     Segment overlaps another existing segment.
+*                               LIB_MEM_ERR_INVALID_SEG_EXISTS      Segment already exists.
+*
+* Return(s)   : Pointer to memory segment that overlaps.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_PoolCreate(),
+*               Mem_SegCreate().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+#if  (LIB_MEM_CFG_HEAP_SIZE      >  0u)
+static  MEM_SEG  *Mem_SegOverlapChkCritical (CPU_ADDR     seg_base_addr,
+                                             CPU_SIZE_T   size,
+                                             LIB_ERR     *p_err)
+{
+    MEM_SEG   *p_seg_chk;
+    CPU_ADDR   seg_new_end;
+    CPU_ADDR   seg_chk_start;
+    CPU_ADDR   seg_chk_end;
+
+
+    seg_new_end = seg_base_addr + (size - 1u);
+    p_seg_chk   = Mem_SegHeadPtr;
+
+    while (p_seg_chk != DEF_NULL) {
+        seg_chk_start = (CPU_ADDR)p_seg_chk->AddrBase;
         seg_chk_end   = (CPU_ADDR)p_seg_chk->AddrEnd;
 
         if ((seg_base_addr == seg_chk_start) && (seg_new_end == seg_chk_end)) {
@@ -2473,7 +3587,10 @@ static  void  *Mem_SegAllocInternal (const  CPU_CHAR    *p_name,
                                             CPU_SIZE_T  *p_bytes_reqd,
                                             LIB_ERR     *p_err)
 {
-    void  *p_blk;
+    void             *p_blk;
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+    MEM_TRACK_OWNER  *p_owner;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -2517,6 +3634,13 @@ static  void  *Mem_SegAllocInternal (const  CPU_CHAR    *p_name,
 #else
     (void)p_name;
 #endif
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)                       /* Account alloc to current owner.                      */
+    p_owner = Mem_TrackOwnerGetCritical();
+    if (p_owner != DEF_NULL) {
+        p_owner->SegSize += size;
+    }
+#endif
     CPU_CRITICAL_EXIT();
 
     return (p_blk);
@@ -2723,9 +3847,13 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
                                                 CPU_SIZE_T     blk_qty_max,
                                                 LIB_ERR       *p_err)
 {
-    CPU_INT08U  *p_blks          = DEF_NULL;
-    CPU_SIZE_T   blk_size_align;
-    CPU_SIZE_T   blk_align_worst = DEF_MAX(blk_align, blk_padding_align);
+    CPU_INT08U    *p_blks          = DEF_NULL;
+    CPU_SIZE_T     blk_size_align;
+    CPU_SIZE_T     blk_align_worst = DEF_MAX(blk_align, blk_padding_align);
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+    MEM_DYN_POOL  *p_pool_list;
+    CPU_SR_ALLOC();
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -2799,10 +3927,32 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
     p_pool->BlkQtyMax       =   blk_qty_max;
     p_pool->BlkAllocCnt     =   0u;
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+#if ((LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED) || \
+     (LIB_MEM_CFG_TRACK_EN    == DEF_ENABLED))
     p_pool->NamePtr = p_name;
 #endif
 
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+    p_pool->NbrUsed     = 0u;
+    p_pool->NbrUsedMax  = 0u;
+    p_pool->NbrUsedMark = 0u;
+    p_pool->GetCtr      = 0u;
+    p_pool->FreeCtr     = 0u;
+    p_pool->FailCtr     = 0u;
+
+    CPU_CRITICAL_ENTER();
+    p_pool_list = Mem_DynPoolHeadPtr;
+    while ((p_pool_list != DEF_NULL) &&                         /* Add pool to list, unless re-created.                 */
+           (p_pool_list != p_pool)) {
+        p_pool_list = p_pool_list->NextPtr;
+    }
+    if (p_pool_list == DEF_NULL) {
+        p_pool->NextPtr    = Mem_DynPoolHeadPtr;
+        Mem_DynPoolHeadPtr = p_pool;
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+
    *p_err = LIB_MEM_ERR_NONE;
 }
 
@@ -2850,3 +4000,226 @@ static  CPU_BOOLEAN  Mem_PoolBlkIsValidAddr (MEM_POOL  *p_pool,
     }
 }
 #endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SlabClassIxGet()
+*
+* Description : Gets the index of the smallest slab class that fits a request.
+*
+* Argument(s) : p_slab  Pointer to slab data.
+*               ------  Argument validated by caller.
+*
+*               size    Number of bytes requested.
+*
+* Return(s)   : Index of the class, if the request fits in the largest class.
+*
+*               'p_slab->ClassNbr', otherwise.
+*
+* Caller(s)   : Mem_SlabAlloc(),
+*               Mem_SlabCacheAlloc().
+*
+* Note(s)     : (1) The class block holds the request and the block header.  Its size is the power of two
+*                   above or equal to that total, found in constant time with CPU_CntLeadZeros().
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+static  CPU_INT08U  Mem_SlabClassIxGet (MEM_SLAB    *p_slab,
+                                        CPU_SIZE_T   size)
+{
+    CPU_SIZE_T  blk_size;
+    CPU_DATA    shift;
+
+
+    blk_size = size + LIB_MEM_SLAB_HDR_SIZE;                    /* See Note #1.                                         */
+    if (blk_size < size) {                                      /* Chk for ovf.                                         */
+        return (p_slab->ClassNbr);
+    }
+
+    if (blk_size <= ((CPU_SIZE_T)1u << p_slab->ClassShiftMin)) {
+        return (0u);
+    }
+                                                                /* Ceil of log2(blk_size).                              */
+    shift = DEF_INT_CPU_NBR_BITS - CPU_CntLeadZeros((CPU_DATA)(blk_size - 1u));
+    if ((shift - p_slab->ClassShiftMin) >= p_slab->ClassNbr) {
+        return (p_slab->ClassNbr);
+    }
+
+    return ((CPU_INT08U)(shift - p_slab->ClassShiftMin));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     Mem_TrackOwnerGetCritical()
+*
+* Description : Gets the accounting data of the current owner.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Pointer to the owner's accounting data, if an owner function is set.
+*
+*               DEF_NULL,                               otherwise.
+*
+* Caller(s)   : Mem_SegAllocInternal(),
+*               Mem_TrackBlkGetCritical().
+*
+* Note(s)     : (1) MUST be called in a critical section.
+*
+*               (2) A new owner takes the first empty entry of the table.  When the table is full, the
+*                   owner is accounted to the "Other" owner.  Entries are never freed so that the totals
+*                   of an owner survive its deletion.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+static  MEM_TRACK_OWNER  *Mem_TrackOwnerGetCritical (void)
+{
+    const  CPU_CHAR         *p_name;
+           MEM_TRACK_OWNER  *p_owner;
+           CPU_INT32U        ix;
+
+
+    if (Mem_TrackOwnerFnct == DEF_NULL) {
+        return (DEF_NULL);
+    }
+
+    p_name = Mem_TrackOwnerFnct();
+    if (p_name == DEF_NULL) {
+        return (&Mem_TrackOwnerOther);
+    }
+
+    for (ix = 0u; ix < LIB_MEM_CFG_TRACK_OWNER_NBR_MAX; ix++) { /* See Note #2.                                         */
+        p_owner = &Mem_TrackOwnerTbl[ix];
+        if (p_owner->NamePtr == p_name) {
+            return (p_owner);
+        }
+        if (p_owner->NamePtr == DEF_NULL) {
+            p_owner->NamePtr = p_name;
+            return (p_owner);
+        }
+    }
+
+    return (&Mem_TrackOwnerOther);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      Mem_TrackBlkGetCritical()
+*
+* Description : Accounts a block get from a dynamic memory pool.
+*
+* Argument(s) : p_pool  Pointer to the dynamic memory pool data.
+*               ------  Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_DynPoolBlkGet().
+*
+* Note(s)     : (1) MUST be called in a critical section.
+*
+*               (2) Only one get in LIB_MEM_CFG_TRACK_SAMPLE_RATE is accounted to its owner, with the
+*                   weight of LIB_MEM_CFG_TRACK_SAMPLE_RATE gets.  The pool counters are exact.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+static  void  Mem_TrackBlkGetCritical (MEM_DYN_POOL  *p_pool)
+{
+    MEM_TRACK_OWNER  *p_owner;
+
+
+    p_pool->NbrUsed++;
+    if (p_pool->NbrUsedMax < p_pool->NbrUsed) {
+        p_pool->NbrUsedMax = p_pool->NbrUsed;
+    }
+    p_pool->GetCtr++;
+
+#if (LIB_MEM_CFG_TRACK_SAMPLE_RATE > 1u)                        /* See Note #2.                                         */
+    Mem_TrackSampleCtr++;
+    if ((Mem_TrackSampleCtr & (LIB_MEM_CFG_TRACK_SAMPLE_RATE - 1u)) != 0u) {
+        return;
+    }
+#endif
+
+    p_owner = Mem_TrackOwnerGetCritical();
+    if (p_owner != DEF_NULL) {
+        p_owner->BlkGetCtr  += LIB_MEM_CFG_TRACK_SAMPLE_RATE;
+        p_owner->BlkGetSize += LIB_MEM_CFG_TRACK_SAMPLE_RATE * p_pool->BlkSize;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_TrackOutputNbr()
+*
+* Description : Outputs a comma followed by a number.
+*
+* Argument(s) : out_fnct    Pointer to output function.
+*               --------    Argument validated by caller.
+*
+*               nbr         Number to output.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_TrackOutput().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+static  void  Mem_TrackOutputNbr (void        (*out_fnct) (CPU_CHAR *),
+                                  CPU_INT32U    nbr)
+{
+    CPU_CHAR  str[DEF_INT_32U_NBR_DIG_MAX + 1u];
+
+
+    (void)Str_FmtNbr_Int32U(nbr,
+                            DEF_INT_32U_NBR_DIG_MAX,
+                            DEF_NBR_BASE_DEC,
+                            '\0',
+                            DEF_NO,
+                            DEF_YES,
+                           &str[0u]);
+
+    out_fnct((CPU_CHAR *)",");
+    out_fnct(str);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_TrackOutputName()
+*
+* Description : Outputs a comma followed by a name.
+*
+* Argument(s) : out_fnct    Pointer to output function.
+*               --------    Argument validated by caller.
+*
+*               p_name      Pointer to the name, DEF_NULL if it is not known.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_TrackOutput().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+static  void  Mem_TrackOutputName (void            (*out_fnct) (CPU_CHAR *),
+                                   const  CPU_CHAR   *p_name)
+{
+    out_fnct((CPU_CHAR *)",");
+    out_fnct((p_name != DEF_NULL) ? (CPU_CHAR *)p_name : (CPU_CHAR *)"Unknown");
+}
+#endif
@@ -137,6 +137,11 @@
 
 #define  LIB_MEM_BLK_QTY_UNLIMITED                        0u
 
+                                                                /* ------------------- SLAB DEFINES ------------------- */
+#define  LIB_MEM_SLAB_HDR_MAGIC                  0x5AB00000u    /* Hdr of alloc'd slab blk: magic | class ix.           */
+#define  LIB_MEM_SLAB_HDR_IX_MSK                 0x000000FFu
+#define  LIB_MEM_SLAB_HDR_SIZE                   sizeof(CPU_INT32U)
+
 
 /*
 *********************************************************************************************************
@@ -184,6 +189,45 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                           MEMORY LIBRARY WORD OPTIMIZATION CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_OPTIMIZE_WORD_EN to enable/disable the unrolled, word-wide C
+*               versions of Mem_Set(), Mem_Copy() & Mem_Cmp() (see 'lib_mem.c  Mem_Copy()  Note #6').
+*
+*               Since the word-optimized Mem_Copy() replaces the assembly-optimized one, both MUST NOT
+*               be enabled at the same time.
+*
+*           (2) (a) Configure LIB_MEM_CFG_COPY_DMA_EN to enable/disable DMA-assisted Mem_Copy() of large
+*                   buffers.  The copy itself is performed by Mem_CopyDMA(), which MUST be provided by
+*                   the product's BSP.
+*
+*               (b) Configure LIB_MEM_CFG_COPY_DMA_SIZE_MIN with the minimum size, in octets, of the
+*                   copies handed to Mem_CopyDMA().  Smaller copies cost less with the CPU than the set
+*                   up of a DMA transfer.
+*********************************************************************************************************
+*/
+
+                                                                /* Cfg word-optimized function(s) [see Note #1] :       */
+#ifndef  LIB_MEM_CFG_OPTIMIZE_WORD_EN
+#define  LIB_MEM_CFG_OPTIMIZE_WORD_EN   DEF_DISABLED
+                                                                /* DEF_DISABLED     Word-optimized fnct(s) DISABLED     */
+                                                                /* DEF_ENABLED      Word-optimized fnct(s) ENABLED      */
+#endif
+
+                                                                /* Cfg DMA-assisted copy         [see Note #2a] :       */
+#ifndef  LIB_MEM_CFG_COPY_DMA_EN
+#define  LIB_MEM_CFG_COPY_DMA_EN        DEF_DISABLED
+                                                                /* DEF_DISABLED     DMA-assisted copy DISABLED          */
+                                                                /* DEF_ENABLED      DMA-assisted copy ENABLED           */
+#endif
+
+#ifndef  LIB_MEM_CFG_COPY_DMA_SIZE_MIN
+#define  LIB_MEM_CFG_COPY_DMA_SIZE_MIN         1024u            /* See Note #2b.                                        */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                          MEMORY ALLOCATION DEBUG INFORMATION CONFIGURATION
@@ -212,6 +256,65 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  MEMORY ACCOUNTING CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_TRACK_EN to enable/disable the memory accounting of dynamic memory
+*               pools & owners (see 'lib_mem.c  Mem_TrackOutput()').
+*
+*           (2) Configure LIB_MEM_CFG_TRACK_OWNER_NBR_MAX with the maximum number of owners accounted
+*               individually.  Allocations of further owners are accounted under "Other".
+*
+*           (3) Configure LIB_MEM_CFG_TRACK_SAMPLE_RATE with the sampling rate of the dynamic memory pool
+*               blocks accounted to their owner : 1 accounts every block, N (a power of 2) accounts one
+*               block out of N with a weight of N.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_CFG_TRACK_EN
+#define  LIB_MEM_CFG_TRACK_EN            DEF_DISABLED
+#endif
+
+#ifndef  LIB_MEM_CFG_TRACK_OWNER_NBR_MAX
+#define  LIB_MEM_CFG_TRACK_OWNER_NBR_MAX          16u
+#endif
+
+#ifndef  LIB_MEM_CFG_TRACK_SAMPLE_RATE
+#define  LIB_MEM_CFG_TRACK_SAMPLE_RATE             1u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  SLAB ALLOCATOR CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_SLAB_EN to enable/disable the size-class slab allocator.
+*
+*           (2) Configure LIB_MEM_CFG_SLAB_CLASS_NBR_MAX with the maximum number of size classes of a slab.
+*
+*           (3) Configure LIB_MEM_CFG_SLAB_CACHE_EN to enable/disable the per-task slab caches and
+*               LIB_MEM_CFG_SLAB_CACHE_DEPTH with the number of blocks a cache keeps for each class.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_CFG_SLAB_EN
+#define  LIB_MEM_CFG_SLAB_EN             DEF_DISABLED
+#endif
+
+#ifndef  LIB_MEM_CFG_SLAB_CLASS_NBR_MAX
+#define  LIB_MEM_CFG_SLAB_CLASS_NBR_MAX            8u
+#endif
+
+#ifndef  LIB_MEM_CFG_SLAB_CACHE_EN
+#define  LIB_MEM_CFG_SLAB_CACHE_EN       DEF_DISABLED
+#endif
+
+#ifndef  LIB_MEM_CFG_SLAB_CACHE_DEPTH
+#define  LIB_MEM_CFG_SLAB_CACHE_DEPTH              4u
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             DATA TYPES
@@ -352,6 +455,9 @@ typedef  struct  mem_pool {
 *                    |          |      |          |       |          |   |          |
 *                    \----------/      \----------/       \----------/   \----------/
 *
+*           (3) With LIB_MEM_CFG_TRACK_EN, pools are linked together & count their blocks in use, their
+*               peak & their gets & frees.  The counters are updated in the critical sections that already
+*               protect the free list.
 *********************************************************************************************************
 */
 
@@ -365,12 +471,113 @@ typedef  struct  mem_dyn_pool {                                 /* -------------
            CPU_SIZE_T   BlkQtyMax;                              /* Max qty of blk in dyn mem pool. 0 = unlimited.       */
            CPU_SIZE_T   BlkAllocCnt;                            /* Cnt of alloc blk.                                    */
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+#if ((LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED) || \
+     (LIB_MEM_CFG_TRACK_EN    == DEF_ENABLED))
     const  CPU_CHAR    *NamePtr;                                /* Ptr to mem pool name.                                */
 #endif
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)                       /* See Note #3.                                         */
+    struct mem_dyn_pool *NextPtr;                               /* Ptr to next pool, for Mem_TrackOutput().             */
+           CPU_SIZE_T   NbrUsed;                                /* Nbr of blks in use.                                  */
+           CPU_SIZE_T   NbrUsedMax;                             /* Peak nbr of blks in use.                             */
+           CPU_SIZE_T   NbrUsedMark;                            /* Nbr of blks in use at last Mem_TrackMark().          */
+           CPU_INT32U   GetCtr;                                 /* Nbr of successful blk gets.                          */
+           CPU_INT32U   FreeCtr;                                /* Nbr of blk frees.                                    */
+           CPU_INT32U   FailCtr;                                /* Nbr of failed     blk gets.                          */
+#endif
 } MEM_DYN_POOL;
 
 
+/*
+*********************************************************************************************************
+*                                   MEMORY ACCOUNTING DATA TYPES
+*
+* Note(s) : (1) An owner is identified by the name returned by the function set with
+*               Mem_TrackOwnerFnctSet() when the allocation is made, e.g. the name of the current task.
+*               Names are compared by address, they MUST remain accessible at all times.
+*
+*           (2) 'SegSize' is exact.  'BlkGetCtr' & 'BlkGetSize' are estimates when the blocks are sampled
+*               (see 'MEMORY ACCOUNTING CONFIGURATION  Note #3').
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+                                                                /* Returns the name of the current owner.               */
+typedef  const  CPU_CHAR  *(*MEM_TRACK_OWNER_FNCT)(void);
+
+typedef  struct  mem_track_owner {                              /* -------------------- MEM OWNER --------------------- */
+    const  CPU_CHAR    *NamePtr;                                /* Ptr to owner name (see Note #1).                     */
+           CPU_SIZE_T   SegSize;                                /* Nbr of octets alloc'd from segs.                     */
+           CPU_INT32U   BlkGetCtr;                              /* Nbr of dyn pool blks got (see Note #2).              */
+           CPU_INT32U   BlkGetSize;                             /* Nbr of octets in dyn pool blks got (see Note #2).    */
+} MEM_TRACK_OWNER;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      SLAB ALLOCATOR DATA TYPES
+*
+* Note(s) : (1) A slab is a set of dynamic memory pools, one per power-of-two size class, that share a
+*               memory segment.  The blocks of a class are carved from the segment the first time they
+*               are needed and are kept on the free list of the class once freed.
+*
+*           (2) Each block starts with a header that holds LIB_MEM_SLAB_HDR_MAGIC and the index of its
+*               class so that Mem_SlabFree() finds the class in constant time.  The header is overwritten
+*               by the free list link once the block is freed, which lets a double free be detected.
+*
+*                            |<-------------------- Class blk size --------------------->|
+*                            /-----------------------------------------------------------\
+*                            |  Hdr  |  Data returned to the caller                      |
+*                            \-----------------------------------------------------------/
+*                                    ^
+*                                    | Ptr returned by Mem_SlabAlloc()
+*
+*           (3) 'NbrUsed' counts the blocks held by the application and by the slab caches.  Since a
+*               class only grows when its free list is empty, 'NbrUsedMax' is also the number of blocks
+*               carved from the segment by the class.
+*
+*           (4) A slab cache is a small per-task front end : it MUST only be used by the task that owns it,
+*               so that it can be accessed without critical sections.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+typedef  struct  mem_slab_class {                               /* -------------------- SLAB CLASS -------------------- */
+    MEM_DYN_POOL   Pool;                                        /* Dyn mem pool of the class blks.                      */
+    CPU_SIZE_T     NbrUsed;                                     /* Nbr of blks in use (see Note #3).                    */
+    CPU_SIZE_T     NbrUsedMax;                                  /* Peak nbr of blks in use (see Note #3).               */
+    CPU_INT32U     AllocCtr;                                    /* Nbr of successful allocs.                            */
+    CPU_INT32U     AllocFailCtr;                                /* Nbr of failed     allocs.                            */
+} MEM_SLAB_CLASS;
+
+
+typedef  struct  mem_slab  MEM_SLAB;
+
+struct  mem_slab {                                              /* ----------------------- SLAB ----------------------- */
+           MEM_SLAB_CLASS   ClassTbl[LIB_MEM_CFG_SLAB_CLASS_NBR_MAX];
+           CPU_INT08U       ClassNbr;                           /* Nbr of classes.                                      */
+           CPU_INT08U       ClassShiftMin;                      /* Log2 of the smallest class blk size.                 */
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    const  CPU_CHAR        *NamePtr;                            /* Ptr to slab name.                                    */
+           MEM_SLAB        *NextPtr;                            /* Ptr to next slab, for Mem_OutputUsage().             */
+#endif
+};
+
+
+#if (LIB_MEM_CFG_SLAB_CACHE_EN == DEF_ENABLED)
+typedef  struct  mem_slab_cache {                               /* -------------------- SLAB CACHE -------------------- */
+    MEM_SLAB      *SlabPtr;                                     /* Slab backing the cache.                              */
+    void          *FreeTbl[LIB_MEM_CFG_SLAB_CLASS_NBR_MAX];     /* Ptr to first cached blk of each class.               */
+    CPU_INT08U     FreeCnt[LIB_MEM_CFG_SLAB_CLASS_NBR_MAX];     /* Nbr of cached blks of each class.                    */
+    CPU_INT32U     HitCtr;                                      /* Nbr of allocs served by the cache.                   */
+    CPU_INT32U     MissCtr;                                     /* Nbr of allocs passed to the slab.                    */
+} MEM_SLAB_CACHE;
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -1274,6 +1481,16 @@ void               Mem_OutputUsage          (       void             (*out_fnct)
                                                     LIB_ERR           *p_err);
 #endif
 
+#if (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+void               Mem_TrackOwnerFnctSet    (       MEM_TRACK_OWNER_FNCT  fnct);
+
+void               Mem_TrackMark            (       void);
+
+void               Mem_TrackOutput          (       void             (*out_fnct) (CPU_CHAR *),
+                                                    CPU_INT32U         ts,
+                                                    LIB_ERR           *p_err);
+#endif
+
                                                                 /* -------- STATIC MEM POOL FNCTS (DEPRECATED) -------- */
 void               Mem_PoolCreate           (       MEM_POOL          *p_pool,
                                                     void              *p_mem_base,
@@ -1327,6 +1544,94 @@ void               Mem_DynPoolBlkFree       (       MEM_DYN_POOL      *p_pool,
 CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
                                                     LIB_ERR           *p_err);
 
+                                                                /* -------------------- SLAB FNCTS -------------------- */
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+void               Mem_SlabCreate           (const  CPU_CHAR          *p_name,
+                                                    MEM_SLAB          *p_slab,
+                                                    MEM_SEG           *p_seg,
+                                                    CPU_SIZE_T         blk_size_min,
+                                                    CPU_SIZE_T         blk_size_max,
+                                                    CPU_SIZE_T         blk_qty_max,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_SlabAlloc            (       MEM_SLAB          *p_slab,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_SlabFree             (       MEM_SLAB          *p_slab,
+                                                    void              *p_mem,
+                                                    LIB_ERR           *p_err);
+
+#if (LIB_MEM_CFG_SLAB_CACHE_EN == DEF_ENABLED)
+void               Mem_SlabCacheInit        (       MEM_SLAB_CACHE    *p_cache,
+                                                    MEM_SLAB          *p_slab,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_SlabCacheAlloc       (       MEM_SLAB_CACHE    *p_cache,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_SlabCacheFree        (       MEM_SLAB_CACHE    *p_cache,
+                                                    void              *p_mem,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_SlabCacheFlush       (       MEM_SLAB_CACHE    *p_cache,
+                                                    LIB_ERR           *p_err);
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*                                      DEFINED IN PRODUCT'S BSP
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            Mem_CopyDMA()
+*
+* Description : Copy data octets from one memory buffer to another memory buffer with a DMA controller.
+*
+* Argument(s) : pdest       Pointer to destination memory buffer.
+*
+*               psrc        Pointer to source      memory buffer.
+*
+*               size        Number of octets to copy.
+*
+* Return(s)   : DEF_OK,   if ALL octets copied.
+*
+*               DEF_FAIL, otherwise (see Note #2).
+*
+* Caller(s)   : Mem_Copy().
+*
+*               This function is an INTERNAL memory library function & MUST be implemented by application/
+*               BSP function(s) [see Note #1] but MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) Mem_CopyDMA() is an application/BSP function that MUST be defined by the developer if
+*                   LIB_MEM_CFG_COPY_DMA_EN is enabled (see 'lib_mem.h  MEMORY LIBRARY WORD OPTIMIZATION
+*                   CONFIGURATION  Note #2').
+*
+*               (2) Mem_CopyDMA() MAY decline any copy it can NOT perform (e.g. called from an ISR or with
+*                   interrupts disabled, DMA channel busy, unsupported alignment or memory region) by
+*                   returning DEF_FAIL; Mem_Copy() then copies the buffers with the CPU.  The contents of the
+*                   destination buffer are then irrelevant.  Mem_CopyDMA() MUST NOT block indefinitely: if
+*                   the transfer does NOT complete in time, it MUST stop it & return DEF_FAIL.
+*
+*               (3) Mem_Copy() only calls Mem_CopyDMA() for buffers that do NOT overlap.
+*
+*               (4) If the data cache is enabled, Mem_CopyDMA() MUST clean the source buffer & invalidate
+*                   the destination buffer.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_COPY_DMA_EN == DEF_ENABLED)
+CPU_BOOLEAN        Mem_CopyDMA              (       void              *pdest,
+                                             const  void              *psrc,
+                                                    CPU_SIZE_T         size);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1361,6 +1666,32 @@ CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
 #endif
 
 
+#if    ((LIB_MEM_CFG_OPTIMIZE_WORD_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_OPTIMIZE_WORD_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_OPTIMIZE_WORD_EN illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  DEF_DISABLED]           "
+#error  "                             [     ||  DEF_ENABLED ]           "
+
+#elif  ((LIB_MEM_CFG_OPTIMIZE_WORD_EN == DEF_ENABLED) && \
+        (LIB_MEM_CFG_OPTIMIZE_ASM_EN  == DEF_ENABLED))
+#error  "LIB_MEM_CFG_OPTIMIZE_WORD_EN illegally #define'd in 'lib_cfg.h'                              "
+#error  "                             [MUST be  DEF_DISABLED when LIB_MEM_CFG_OPTIMIZE_ASM_EN enabled]"
+#endif
+
+
+#if    ((LIB_MEM_CFG_COPY_DMA_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_COPY_DMA_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_COPY_DMA_EN      illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  DEF_DISABLED]           "
+#error  "                             [     ||  DEF_ENABLED ]           "
+
+#elif  ((LIB_MEM_CFG_COPY_DMA_EN     == DEF_ENABLED) && \
+        (LIB_MEM_CFG_OPTIMIZE_ASM_EN == DEF_ENABLED))
+#error  "LIB_MEM_CFG_COPY_DMA_EN      illegally #define'd in 'lib_cfg.h'                              "
+#error  "                             [MUST be  DEF_DISABLED when LIB_MEM_CFG_OPTIMIZE_ASM_EN enabled]"
+#endif
+
+
 #ifndef  LIB_MEM_CFG_HEAP_SIZE
 #error  "LIB_MEM_CFG_HEAP_SIZE              not #define'd in 'lib_cfg.h'"
 #error  "                                   [MUST be  >= 0]             "
@@ -1388,6 +1719,56 @@ CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
 #endif
 
 
+#if    ((LIB_MEM_CFG_SLAB_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_SLAB_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_SLAB_EN     illegally defined in 'lib_cfg.h'"
+#error  "                        [MUST be  DEF_DISABLED]         "
+#error  "                        [     ||  DEF_ENABLED ]         "
+
+#elif   (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+#if    ((LIB_MEM_CFG_SLAB_CLASS_NBR_MAX < 1u) || \
+        (LIB_MEM_CFG_SLAB_CLASS_NBR_MAX > (LIB_MEM_SLAB_HDR_IX_MSK + 1u)))
+#error  "LIB_MEM_CFG_SLAB_CLASS_NBR_MAX illegally defined in 'lib_cfg.h'"
+#error  "                               [MUST be  >= 1    ]             "
+#error  "                               [     &&  <= 256  ]             "
+#endif
+
+#if    ((LIB_MEM_CFG_SLAB_CACHE_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_SLAB_CACHE_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_SLAB_CACHE_EN illegally defined in 'lib_cfg.h'"
+#error  "                          [MUST be  DEF_DISABLED]         "
+#error  "                          [     ||  DEF_ENABLED ]         "
+
+#elif  ((LIB_MEM_CFG_SLAB_CACHE_EN    == DEF_ENABLED) && \
+       ((LIB_MEM_CFG_SLAB_CACHE_DEPTH <  1u)          || \
+        (LIB_MEM_CFG_SLAB_CACHE_DEPTH >  255u)))
+#error  "LIB_MEM_CFG_SLAB_CACHE_DEPTH illegally defined in 'lib_cfg.h'"
+#error  "                             [MUST be  >= 1    ]             "
+#error  "                             [     &&  <= 255  ]             "
+#endif
+#endif
+
+
+#if    ((LIB_MEM_CFG_TRACK_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_TRACK_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_TRACK_EN    illegally defined in 'lib_cfg.h'"
+#error  "                        [MUST be  DEF_DISABLED]         "
+#error  "                        [     ||  DEF_ENABLED ]         "
+
+#elif   (LIB_MEM_CFG_TRACK_EN == DEF_ENABLED)
+#if     (LIB_MEM_CFG_TRACK_OWNER_NBR_MAX < 1u)
+#error  "LIB_MEM_CFG_TRACK_OWNER_NBR_MAX illegally defined in 'lib_cfg.h'"
+#error  "                                [MUST be  >= 1]                 "
+#endif
+
+#if    ((LIB_MEM_CFG_TRACK_SAMPLE_RATE <  1u) || \
+       ((LIB_MEM_CFG_TRACK_SAMPLE_RATE & (LIB_MEM_CFG_TRACK_SAMPLE_RATE - 1u)) != 0u))
+#error  "LIB_MEM_CFG_TRACK_SAMPLE_RATE illegally defined in 'lib_cfg.h'"
+#error  "                              [MUST be  a power of 2 >= 1]    "
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    LIBRARY CONFIGURATION ERRORS
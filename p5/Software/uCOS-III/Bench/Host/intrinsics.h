@@ -0,0 +1,45 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                          HOST STAND-IN FOR THE IAR INTRINSICS
+*
+* File    : INTRINSICS.H
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file lets the host benchmarks compile the kernel sources with the Cortex-M port headers.  It is
+*               found before the compiler's own headers because the benchmarks are built with '-I.'.
+*
+*           (2) PRIMASK is modeled by a variable so that critical sections keep their load/store pattern and can be
+*               counted.  The functions are implemented by the benchmark.
+**************************************************************************************************************************
+*/
+
+#ifndef  BENCH_HOST_INTRINSICS_H
+#define  BENCH_HOST_INTRINSICS_H
+
+
+unsigned  int  __get_PRIMASK       (void);
+
+void           __set_PRIMASK       (unsigned  int  primask);
+
+void           __disable_interrupt (void);
+
+unsigned  int  __get_IPSR          (void);
+
+#define  __enable_interrupt()          __set_PRIMASK(0u)
+
+#define  __CLZ(x)                      ((x) == 0u ? 32u : (unsigned int)__builtin_clz(x))
+
+#define  __DSB()                       __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define  __ISB()                       __atomic_signal_fence(__ATOMIC_SEQ_CST)
+#define  __WFI()
+
+#define  __no_init
+#define  __root
+
+#endif
@@ -0,0 +1,550 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                    EARLIEST DEADLINE FIRST SCHEDULING SIMULATION (HOST)
+*
+* File    : OS_EDF_SIM.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory, build it with:
+*
+*                   cc -std=gnu99 -O2 -I. -I../../../../AppCode -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR
+*                      -I../../../uC-LIB -I../../Source -I../../Ports/ARM-Cortex-M/ARMv7-M/IAR -I../../Trace/RingBuf
+*                      -o os_edf_sim os_edf_sim.c
+*
+*           (2) Usage:
+*
+*                   os_edf_sim [<nbr_random_sets>]
+*
+*               The simulation is deterministic, tick by tick, with every task at OS_CFG_SCHED_EDF_PRIO.  Each task set
+*               is admitted with OSTaskEdfSet(), the tasks admitted are run by the EDF class and, for comparison, by
+*               fixed priorities assigned by period (rate monotonic).  For each set are reported: the tasks admitted,
+*               the jobs completed and, for both schedulers, the deadlines missed.
+*
+*               A few hand written sets are run first, then the given number of sets generated with a fixed seed:
+*               2 to 6 tasks, deadlines equal to the periods and a total utilization between 60% and 105%.
+*
+*               The simulation exits with a failure if a set admitted misses a deadline under EDF: with deadlines
+*               equal to the periods, the admission test is exact.
+*
+*           (3) os_edf.c is compiled in this file, unmodified, with the application configuration.  The rest of the
+*               kernel is replaced by the stubs below: the ready list of the EDF level is linked by the kernel code,
+*               OS_TickListInsertDly() only records that a task waits for its release and the tick loop of this file
+*               readies it, like OS_TickTask().  The task at the head of the ready list runs for one tick.
+**************************************************************************************************************************
+*/
+
+#define  OS_GLOBALS
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+
+#include  "os_edf.c"
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#define  SIM_TASK_MAX                            8u
+#define  SIM_RANDOM_SETS_DFLT                  200u
+#define  SIM_HYPERPERIOD                       400u                 /* LCM of the periods of the random sets            */
+#define  SIM_TICKS                    (2u * SIM_HYPERPERIOD)
+
+#if (OS_CFG_SCHED_EDF_EN != DEF_ENABLED)
+#error  "os_edf_sim.c: OS_CFG_SCHED_EDF_EN must be enabled in os_cfg.h"
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                     DATA TYPES
+**************************************************************************************************************************
+*/
+
+typedef  struct  sim_task {                                     /* Task of a set                                        */
+    OS_TICK      WCET;
+    OS_TICK      Period;
+    OS_TICK      Deadline;                                      /* 0 for the period                                     */
+} SIM_TASK;
+
+typedef  struct  sim_res {                                      /* Result of a set                                      */
+    CPU_INT32U   TaskQty;                                       /* Tasks admitted                                       */
+    CPU_INT32U   UtilPct;                                       /* Utilization admitted, percent                        */
+    CPU_INT32U   JobCtr;
+    CPU_INT32U   EdfMissCtr;
+    OS_TICK      EdfLatenessMax;
+    CPU_INT32U   RMMissCtr;
+} SIM_RES;
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  volatile  unsigned  int   Bench_PRIMASK;
+
+static  OS_TCB                    Sim_TCBTbl[SIM_TASK_MAX];
+static  CPU_BOOLEAN               Sim_AdmitTbl[SIM_TASK_MAX];
+static  OS_TICK                   Sim_RemainTbl[SIM_TASK_MAX];  /* Execution left in the current job                    */
+
+static  CPU_INT32U                Sim_Seed;
+
+
+/*
+**************************************************************************************************************************
+*                                                   CPU / PORT STUBS
+**************************************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    static  CPU_TS_TMR  ts;
+
+
+    return (ts++);
+}
+
+
+CPU_DATA  CPU_CntLeadZeros (CPU_DATA  val)
+{
+    if (val == 0u) {
+        return (DEF_INT_CPU_NBR_BITS);
+    }
+    return ((CPU_DATA)__builtin_clz(val));
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                    KERNEL STUBS
+*
+* Note(s) : (1) See Note #3 at the top of this file.
+**************************************************************************************************************************
+*/
+
+void  OSSched (void)
+{
+}
+
+
+void  OS_PrioInsert (OS_PRIO  prio)
+{
+    (void)prio;
+}
+
+
+void  OS_PrioRemove (OS_PRIO  prio)
+{
+    (void)prio;
+}
+
+
+void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
+{
+    OS_EdfRdyListInsert(p_tcb);                                 /* All the tasks are at the EDF level                   */
+}
+
+
+void  OS_RdyListRemove (OS_TCB  *p_tcb)
+{
+    OS_RDY_LIST  *p_rdy_list;
+
+
+    p_rdy_list = &OSRdyList[p_tcb->Prio];
+    if (p_tcb->PrevPtr == DEF_NULL) {
+        p_rdy_list->HeadPtr = p_tcb->NextPtr;
+    } else {
+        p_tcb->PrevPtr->NextPtr = p_tcb->NextPtr;
+    }
+    if (p_tcb->NextPtr == DEF_NULL) {
+        p_rdy_list->TailPtr = p_tcb->PrevPtr;
+    } else {
+        p_tcb->NextPtr->PrevPtr = p_tcb->PrevPtr;
+    }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_rdy_list->NbrEntries--;
+#endif
+    p_tcb->PrevPtr = DEF_NULL;
+    p_tcb->NextPtr = DEF_NULL;
+}
+
+
+void  OS_TickListInsertDly (OS_TCB   *p_tcb,
+                            OS_TICK   time,
+                            OS_OPT    opt,
+                            OS_ERR   *p_err)
+{
+    (void)opt;
+    if ((OS_TICK)(time - OSTickCtr) - 1u >= OS_TICK_TH_INIT) {  /* Release already due?                                 */
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+        return;
+    }
+    p_tcb->TaskState = OS_TASK_STATE_DLY;                       /* Sim_Run() readies it at 'EdfRelease'                 */
+   *p_err            = OS_ERR_NONE;
+}
+
+
+#if (OS_CFG_TRACE_EN == DEF_ENABLED)
+void  OS_TraceRingRec (CPU_INT16U  id,
+                       CPU_INT16U  arg,
+                       CPU_INT32U  obj)
+{
+    (void)id;
+    (void)arg;
+    (void)obj;
+}
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL FUNCTIONS
+**************************************************************************************************************************
+*/
+
+static  CPU_INT32U  Sim_Rand (CPU_INT32U  range)
+{
+    Sim_Seed = (Sim_Seed * 1103515245u) + 12345u;               /* Fixed seed LCG: the sets are the same on every run   */
+    return ((Sim_Seed >> 8u) % range);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                   RUN UNDER EDF
+*
+* Description : Admits the tasks of 'p_set' in the EDF class and runs them for SIM_TICKS ticks.
+*
+* Note(s)     : (1) A job not completed at the end of the simulation whose deadline has passed is counted as missed.
+**************************************************************************************************************************
+*/
+
+static  void  Sim_RunEdf (const  SIM_TASK  *p_set,
+                          CPU_INT32U        nbr_tasks,
+                          SIM_RES          *p_res)
+{
+    CPU_INT32U   i;
+    OS_TICK      tick;
+    OS_TCB      *p_tcb;
+    OS_ERR       err;
+
+
+    memset(&Sim_TCBTbl[0], 0, sizeof(Sim_TCBTbl));
+    memset(p_res,          0, sizeof(*p_res));
+    OSRdyList[OS_CFG_SCHED_EDF_PRIO].HeadPtr = DEF_NULL;
+    OSRdyList[OS_CFG_SCHED_EDF_PRIO].TailPtr = DEF_NULL;
+    OSEdfUtil    = 0u;
+    OSEdfTaskQty = 0u;
+    OSTickCtr    = 0u;
+
+    for (i = 0u; i < nbr_tasks; i++) {                          /* Create the tasks, ready, then admit them             */
+        p_tcb            = &Sim_TCBTbl[i];
+        p_tcb->Prio      =  OS_CFG_SCHED_EDF_PRIO;
+        p_tcb->TaskState =  OS_TASK_STATE_RDY;
+        OS_RdyListInsertTail(p_tcb);
+        OSTaskEdfSet(p_tcb, p_set[i].Period, p_set[i].Deadline, p_set[i].WCET, &err);
+        Sim_AdmitTbl[i]  = (err == OS_ERR_NONE) ? DEF_YES : DEF_NO;
+        if (Sim_AdmitTbl[i] == DEF_NO) {
+            OS_RdyListRemove(p_tcb);                            /* Rejected: not run                                    */
+            p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
+        } else {
+            p_res->TaskQty++;
+        }
+        Sim_RemainTbl[i] = p_set[i].WCET;
+    }
+    p_res->UtilPct = (CPU_INT32U)(((CPU_INT64U)OSEdfUtil * 100u + OS_EDF_UTIL_ONE / 2u) / OS_EDF_UTIL_ONE);
+
+    for (tick = 0u; tick < SIM_TICKS; tick++) {
+        OSTickCtr = tick;
+        for (i = 0u; i < nbr_tasks; i++) {                      /* Release the jobs due, like OS_TickTask()             */
+            p_tcb = &Sim_TCBTbl[i];
+            if ((p_tcb->TaskState  == OS_TASK_STATE_DLY) &&
+                (p_tcb->EdfRelease == tick)) {
+                p_tcb->TaskState = OS_TASK_STATE_RDY;
+                OS_RdyListInsertTail(p_tcb);
+            }
+        }
+
+        p_tcb = OSRdyList[OS_CFG_SCHED_EDF_PRIO].HeadPtr;       /* What OSSched() would run                             */
+        if (p_tcb == DEF_NULL) {
+            continue;
+        }
+        i = (CPU_INT32U)(p_tcb - &Sim_TCBTbl[0]);
+        Sim_RemainTbl[i]--;
+        if (Sim_RemainTbl[i] == 0u) {                           /* Job completed at the end of this tick                */
+            OSTickCtr   = tick + 1u;
+            OSTCBCurPtr = p_tcb;
+            OSTaskEdfWait(&err);
+            if (err != OS_ERR_NONE) {
+                fprintf(stderr, "os_edf_sim: OSTaskEdfWait() failed, err = %u\n", (unsigned)err);
+                exit(EXIT_FAILURE);
+            }
+            Sim_RemainTbl[i] = p_set[i].WCET;
+        }
+    }
+
+    for (i = 0u; i < nbr_tasks; i++) {
+        p_tcb = &Sim_TCBTbl[i];
+        if (Sim_AdmitTbl[i] == DEF_NO) {
+            continue;
+        }
+        p_res->JobCtr     += p_tcb->EdfJobCtr;
+        p_res->EdfMissCtr += p_tcb->EdfMissCtr;
+        if ((p_tcb->TaskState == OS_TASK_STATE_RDY) &&          /* See Note #1                                          */
+            (p_tcb->EdfDeadline < SIM_TICKS)) {
+            p_res->EdfMissCtr++;
+        }
+        if (p_tcb->EdfLatenessMax > p_res->EdfLatenessMax) {
+            p_res->EdfLatenessMax = p_tcb->EdfLatenessMax;
+        }
+    }
+}
+
+
+/*
+**************************************************************************************************************************
+*                                           RUN UNDER RATE MONOTONIC PRIORITIES
+*
+* Description : Runs the tasks admitted by Sim_RunEdf() with fixed priorities, the shorter the period the higher the
+*               priority, and counts the deadlines missed the same way.
+**************************************************************************************************************************
+*/
+
+static  void  Sim_RunRM (const  SIM_TASK  *p_set,
+                         CPU_INT32U        nbr_tasks,
+                         SIM_RES          *p_res)
+{
+    OS_TICK      release_tbl[SIM_TASK_MAX];
+    OS_TICK      remain_tbl[SIM_TASK_MAX];
+    OS_TICK      deadline;
+    OS_TICK      tick;
+    CPU_INT32U   i;
+    CPU_INT32U   run;
+
+
+    for (i = 0u; i < nbr_tasks; i++) {
+        release_tbl[i] = 0u;
+        remain_tbl[i]  = p_set[i].WCET;
+    }
+
+    for (tick = 0u; tick < SIM_TICKS; tick++) {
+        run = SIM_TASK_MAX;
+        for (i = 0u; i < nbr_tasks; i++) {                      /* Highest priority job released                        */
+            if ((Sim_AdmitTbl[i]  == DEF_YES) &&
+                (release_tbl[i]   <= tick)    &&
+                ((run == SIM_TASK_MAX) || (p_set[i].Period < p_set[run].Period))) {
+                run = i;
+            }
+        }
+        if (run == SIM_TASK_MAX) {
+            continue;
+        }
+        remain_tbl[run]--;
+        if (remain_tbl[run] == 0u) {
+            deadline = release_tbl[run] + ((p_set[run].Deadline == 0u) ? p_set[run].Period : p_set[run].Deadline);
+            if (tick + 1u > deadline) {
+                p_res->RMMissCtr++;
+            }
+            release_tbl[run] += p_set[run].Period;
+            remain_tbl[run]   = p_set[run].WCET;
+        }
+    }
+
+    for (i = 0u; i < nbr_tasks; i++) {                          /* See Note #1 of Sim_RunEdf()                          */
+        deadline = release_tbl[i] + ((p_set[i].Deadline == 0u) ? p_set[i].Period : p_set[i].Deadline);
+        if ((Sim_AdmitTbl[i] == DEF_YES) &&
+            (release_tbl[i]  <  SIM_TICKS) &&
+            (deadline        <  SIM_TICKS)) {
+            p_res->RMMissCtr++;
+        }
+    }
+}
+
+
+/*
+**************************************************************************************************************************
+*                                              GENERATE A RANDOM TASK SET
+*
+* Description : Draws 2 to 6 tasks with periods dividing SIM_HYPERPERIOD and a total utilization of about 60% to 105%,
+*               shared at random between the tasks.
+**************************************************************************************************************************
+*/
+
+static  CPU_INT32U  Sim_SetGen (SIM_TASK  *p_set)
+{
+    static  const  OS_TICK  period_tbl[] = { 4u, 5u, 8u, 10u, 16u, 20u, 25u, 40u, 50u, 80u, 100u };
+    CPU_INT32U   nbr_tasks;
+    CPU_INT32U   util_pml;                                      /* Utilization left to share, per mille                 */
+    CPU_INT32U   share;
+    CPU_INT32U   i;
+
+
+    nbr_tasks = 2u + Sim_Rand(5u);
+    util_pml  = 600u + Sim_Rand(451u);
+    for (i = 0u; i < nbr_tasks; i++) {
+        if (i == nbr_tasks - 1u) {
+            share = util_pml;
+        } else {
+            share = (util_pml * (1u + Sim_Rand(2u * 100u / nbr_tasks))) / 100u;
+            if (share > util_pml) {
+                share = util_pml;
+            }
+        }
+        util_pml          -= share;
+        p_set[i].Period    = period_tbl[Sim_Rand(sizeof(period_tbl) / sizeof(period_tbl[0]))];
+        p_set[i].Deadline  = 0u;
+        p_set[i].WCET      = (p_set[i].Period * share + 500u) / 1000u;
+        if (p_set[i].WCET == 0u) {
+            p_set[i].WCET = 1u;
+        }
+        if (p_set[i].WCET > p_set[i].Period) {
+            p_set[i].WCET = p_set[i].Period;
+        }
+    }
+    return (nbr_tasks);
+}
+
+
+static  void  Sim_SetPrint (const  char      *p_name,
+                            const  SIM_TASK  *p_set,
+                            CPU_INT32U        nbr_tasks,
+                            const  SIM_RES   *p_res)
+{
+    CPU_INT32U  i;
+
+
+    printf("%-12s", p_name);
+    for (i = 0u; i < nbr_tasks; i++) {
+        printf(" %c%u/%u", (Sim_AdmitTbl[i] == DEF_YES) ? ' ' : '!', (unsigned)p_set[i].WCET, (unsigned)p_set[i].Period);
+        if (p_set[i].Deadline != 0u) {
+            printf("/D%u", (unsigned)p_set[i].Deadline);
+        }
+    }
+    printf("\n%12s admitted %u/%u  util %3u%%  jobs %5u  EDF missed %3u (late max %u)  RM missed %3u\n",
+           "",
+           (unsigned)p_res->TaskQty, (unsigned)nbr_tasks,
+           (unsigned)p_res->UtilPct,
+           (unsigned)p_res->JobCtr,
+           (unsigned)p_res->EdfMissCtr, (unsigned)p_res->EdfLatenessMax,
+           (unsigned)p_res->RMMissCtr);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                        MAIN
+**************************************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    static  const  SIM_TASK  set_a[] = { { 1u,  4u, 0u }, { 2u,  6u, 0u }, { 3u,  8u, 0u } };
+    static  const  SIM_TASK  set_b[] = { { 2u,  5u, 0u }, { 4u,  7u, 0u } };
+    static  const  SIM_TASK  set_c[] = { { 1u,  4u, 3u }, { 2u,  8u, 5u }, { 2u, 10u, 0u } };
+    static  const  SIM_TASK  set_d[] = { { 3u,  4u, 0u }, { 2u,  5u, 0u }, { 1u, 10u, 0u } };
+    SIM_TASK     set[SIM_TASK_MAX];
+    SIM_RES      res;
+    CPU_INT32U   nbr_sets;
+    CPU_INT32U   nbr_tasks;
+    CPU_INT32U   n;
+    CPU_INT32U   admitted;
+    CPU_INT32U   rejected;
+    CPU_INT32U   edf_miss;
+    CPU_INT32U   rm_miss;
+    CPU_BOOLEAN  fail;
+
+
+    nbr_sets = SIM_RANDOM_SETS_DFLT;
+    if (argc > 1) {
+        nbr_sets = (CPU_INT32U)strtoul(argv[1], DEF_NULL, 0);
+    }
+
+    OSRunning             = OS_STATE_OS_RUNNING;
+    OSIntNestingCtr       = 0u;
+    OSSchedLockNestingCtr = 0u;
+    fail                  = DEF_NO;
+
+    printf("EDF class at priority %u, admission bound %u%%, %u ticks per set (C/T[/D], '!' rejected)\n\n",
+           (unsigned)OS_CFG_SCHED_EDF_PRIO, (unsigned)OS_CFG_SCHED_EDF_UTIL_MAX, (unsigned)SIM_TICKS);
+
+    Sim_RunEdf(set_a, 3u, &res); Sim_RunRM(set_a, 3u, &res); Sim_SetPrint("U=96%",     set_a, 3u, &res);
+    fail |= (res.EdfMissCtr > 0u);
+    Sim_RunEdf(set_b, 2u, &res); Sim_RunRM(set_b, 2u, &res); Sim_SetPrint("U=97%",     set_b, 2u, &res);
+    fail |= (res.EdfMissCtr > 0u);
+    Sim_RunEdf(set_c, 3u, &res); Sim_RunRM(set_c, 3u, &res); Sim_SetPrint("D<T",       set_c, 3u, &res);
+    fail |= (res.EdfMissCtr > 0u);
+    Sim_RunEdf(set_d, 3u, &res); Sim_RunRM(set_d, 3u, &res); Sim_SetPrint("Overload",  set_d, 3u, &res);
+    fail |= (res.EdfMissCtr > 0u);
+
+    Sim_Seed = 1u;
+    admitted = 0u;
+    rejected = 0u;
+    edf_miss = 0u;
+    rm_miss  = 0u;
+    for (n = 0u; n < nbr_sets; n++) {
+        nbr_tasks = Sim_SetGen(&set[0]);
+        Sim_RunEdf(set, nbr_tasks, &res);
+        if (res.TaskQty < nbr_tasks) {                          /* Only compare the sets admitted entirely              */
+            rejected++;
+            continue;
+        }
+        Sim_RunRM(set, nbr_tasks, &res);
+        admitted++;
+        if (res.EdfMissCtr > 0u) {
+            edf_miss++;
+            Sim_SetPrint("FAIL", set, nbr_tasks, &res);
+        }
+        if (res.RMMissCtr > 0u) {
+            rm_miss++;
+        }
+    }
+    printf("\n%u random sets: %u admitted entirely, %u with a task rejected\n",
+           (unsigned)nbr_sets, (unsigned)admitted, (unsigned)rejected);
+    printf("Sets admitted missing a deadline: EDF %u, rate monotonic %u\n", (unsigned)edf_miss, (unsigned)rm_miss);
+
+    if ((fail == DEF_YES) || (edf_miss > 0u)) {
+        printf("FAILED: a set admitted missed a deadline under EDF\n");
+        return (EXIT_FAILURE);
+    }
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,469 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                      EVENT FLAG POST LATENCY BENCHMARK (HOST)
+*
+* File    : OS_FLAG_BENCH.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory, build it with:
+*
+*                   cc -std=gnu99 -O2 -I. -I../../../../AppCode -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR
+*                      -I../../../uC-LIB -I../../Source -I../../Ports/ARM-Cortex-M/ARMv7-M/IAR -I../../Trace/RingBuf
+*                      -o os_flag_bench os_flag_bench.c
+*
+*               OS_CFG_FLAG_IDX_EN in os_cfg.h selects the implementation measured : build once with it enabled (waiters
+*               indexed per bit) and once with it disabled (every post walks the pend list) to compare them.
+*
+*           (2) Usage:
+*
+*                   os_flag_bench [<posts_per_run>]
+*
+*               For 1 to 256 tasks waiting on an event flag group, two post latencies are measured:
+*
+*                   miss    OSFlagPost() setting then clearing a bit no task waits for
+*                   wake    OSFlagPost() setting the bit ONE task waits for, readying it.  The time includes the task
+*                           pending again with OSFlagPend() and the bit being cleared with OSFlagPost().
+*
+*               The other tasks wait for ALL of two bits, ANY of two bits or a single bit, none of them posted.
+*
+*           (3) os_flag.c is compiled in this file, unmodified, with the application configuration.  The rest of the
+*               kernel is replaced by the stubs below: OS_Pend() only links the task in the pend list of the group (in
+*               LIFO order, the priority order of the real pend list does not change the post cost) and the scheduler
+*               is not run.  OSFlagPend() therefore returns as soon as the task is linked, leaving it waiting.
+**************************************************************************************************************************
+*/
+
+#define  OS_GLOBALS
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+#include  <time.h>
+
+#include  "os_flag.c"
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#define  BENCH_WAITERS_MAX                     256u
+#define  BENCH_POSTS_PER_RUN_DFLT          2000000u
+
+#define  BENCH_FLAG_WAKE                   ((OS_FLAGS)1u << 0u)     /* Bit the woken task waits for                     */
+#define  BENCH_FLAG_MISS                   ((OS_FLAGS)1u << 31u)    /* Bit no task waits for                            */
+#define  BENCH_FLAG_IDLE_BITS                   30u                 /* Bits 1..30 are waited for but never posted       */
+
+#if (OS_CFG_FLAG_EN != DEF_ENABLED)
+#error  "os_flag_bench.c: OS_CFG_FLAG_EN must be enabled in os_cfg.h"
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  volatile  unsigned  int   Bench_PRIMASK;
+static  unsigned  long  long      Bench_RdyCtr;                 /* Number of tasks readied                              */
+
+static  OS_FLAG_GRP               Bench_Grp;
+static  OS_TCB                    Bench_TCBTbl[BENCH_WAITERS_MAX];
+
+
+/*
+**************************************************************************************************************************
+*                                                   CPU / PORT STUBS
+**************************************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    static  CPU_TS_TMR  ts;
+
+
+    return (ts++);
+}
+
+
+CPU_DATA  CPU_CntLeadZeros (CPU_DATA  val)
+{
+    if (val == 0u) {
+        return (DEF_INT_CPU_NBR_BITS);
+    }
+    return ((CPU_DATA)__builtin_clz(val));
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                    KERNEL STUBS
+*
+* Note(s) : (1) See Note #3 at the top of this file.  The stubs that must never be reached abort the benchmark.
+**************************************************************************************************************************
+*/
+
+void  OSSched (void)
+{
+}
+
+
+void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
+{
+    p_pend_list->HeadPtr = DEF_NULL;
+    p_pend_list->TailPtr = DEF_NULL;
+}
+
+
+void  OS_Pend (OS_PEND_OBJ  *p_obj,
+               OS_STATE      pending_on,
+               OS_TICK       timeout)
+{
+    OS_PEND_LIST  *p_pend_list;
+
+
+    (void)timeout;
+    OSTCBCurPtr->PendOn      = pending_on;
+    OSTCBCurPtr->PendStatus  = OS_STATUS_PEND_OK;
+    OSTCBCurPtr->TaskState   = OS_TASK_STATE_PEND;
+    OSTCBCurPtr->PendObjPtr  = p_obj;
+    OSTCBCurPtr->PendPrevPtr = DEF_NULL;
+    OSTCBCurPtr->PendNextPtr = DEF_NULL;
+    if (p_obj != DEF_NULL) {                                    /* Link at the head of the pend list                    */
+        p_pend_list              = &p_obj->PendList;
+        OSTCBCurPtr->PendNextPtr =  p_pend_list->HeadPtr;
+        if (p_pend_list->HeadPtr != DEF_NULL) {
+            p_pend_list->HeadPtr->PendPrevPtr = OSTCBCurPtr;
+        } else {
+            p_pend_list->TailPtr = OSTCBCurPtr;
+        }
+        p_pend_list->HeadPtr     =  OSTCBCurPtr;
+    }
+}
+
+
+void  OS_PendListRemove (OS_TCB  *p_tcb)
+{
+    OS_PEND_LIST  *p_pend_list;
+
+
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    if (p_tcb->FlagPendDataTblPtr != DEF_NULL) {
+        OS_FlagWaitRemove(p_tcb);
+    }
+#endif
+    if (p_tcb->PendObjPtr != DEF_NULL) {
+        p_pend_list = &p_tcb->PendObjPtr->PendList;
+        if (p_tcb->PendPrevPtr == DEF_NULL) {
+            p_pend_list->HeadPtr = p_tcb->PendNextPtr;
+        } else {
+            p_tcb->PendPrevPtr->PendNextPtr = p_tcb->PendNextPtr;
+        }
+        if (p_tcb->PendNextPtr == DEF_NULL) {
+            p_pend_list->TailPtr = p_tcb->PendPrevPtr;
+        } else {
+            p_tcb->PendNextPtr->PendPrevPtr = p_tcb->PendPrevPtr;
+        }
+        p_tcb->PendPrevPtr = DEF_NULL;
+        p_tcb->PendNextPtr = DEF_NULL;
+        p_tcb->PendObjPtr  = DEF_NULL;
+    }
+}
+
+
+void  OS_PendAbort (OS_TCB     *p_tcb,
+                    CPU_TS      ts,
+                    OS_STATUS   reason)
+{
+    (void)p_tcb;
+    (void)ts;
+    (void)reason;
+    abort();
+}
+
+
+void  OS_RdyListInsert (OS_TCB  *p_tcb)
+{
+    (void)p_tcb;
+    Bench_RdyCtr++;
+}
+
+
+void  OS_TickListRemove (OS_TCB  *p_tcb)
+{
+    (void)p_tcb;
+    abort();                                                    /* The tasks wait without a timeout                     */
+}
+
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+void  OS_IntQPost (OS_OBJ_TYPE   type,
+                   void         *p_obj,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_FLAGS      flags,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
+{
+    (void)type;
+    (void)p_obj;
+    (void)p_void;
+    (void)msg_size;
+    (void)flags;
+    (void)opt;
+    (void)p_err;
+    abort();
+}
+#endif
+
+
+#if (OS_CFG_TRACE_EN == DEF_ENABLED)
+void  OS_TraceRingRec (CPU_INT16U  id,
+                       CPU_INT16U  arg,
+                       CPU_INT32U  obj)
+{
+    (void)id;
+    (void)arg;
+    (void)obj;
+}
+#endif
+
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+OS_OBJ_HANDLE  OS_ObjRegAdd (void         *p_obj,
+                             OS_OBJ_TYPE   type,
+                             CPU_CHAR     *p_name,
+                             CPU_INT32U    hash)
+{
+    (void)p_obj;
+    (void)type;
+    (void)p_name;
+    (void)hash;
+    return (OS_OBJ_HANDLE_NONE);
+}
+
+
+CPU_INT32U  OS_ObjRegHash (CPU_CHAR  *p_name)
+{
+    (void)p_name;
+    return (0u);
+}
+
+
+void  OS_ObjRegRemove (OS_OBJ_HANDLE  handle)
+{
+    (void)handle;
+}
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL FUNCTIONS
+**************************************************************************************************************************
+*/
+
+static  double  Bench_TimeGet (void)
+{
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec + (double)ts.tv_nsec * 1.0e-9);
+}
+
+
+static  void  Bench_Fail (const  char  *p_what,
+                          OS_ERR        err)
+{
+    fprintf(stderr, "os_flag_bench: %s failed, err = %u\n", p_what, (unsigned)err);
+    exit(EXIT_FAILURE);
+}
+
+
+static  void  Bench_Wait (OS_TCB    *p_tcb,
+                          OS_FLAGS   flags,
+                          OS_OPT     opt)
+{
+    OS_ERR  err;
+
+
+    OSTCBCurPtr = p_tcb;                                        /* Pend as this task, see Note #3 at the top            */
+    (void)OSFlagPend(&Bench_Grp, flags, 0u, opt, DEF_NULL, &err);
+    if (err != OS_ERR_NONE) {
+        Bench_Fail("OSFlagPend()", err);
+    }
+}
+
+
+/*
+**************************************************************************************************************************
+*                                              SET UP THE WAITING TASKS
+*
+* Description : Creates the event flag group with 'nbr_waiters' tasks waiting on it.  Task #0 waits for BENCH_FLAG_WAKE,
+*               the others cycle through the three kinds of waits described in Note #2 at the top of this file.
+**************************************************************************************************************************
+*/
+
+static  void  Bench_Setup (CPU_INT32U  nbr_waiters)
+{
+    CPU_INT32U  i;
+    OS_FLAGS    bit_a;
+    OS_FLAGS    bit_b;
+    OS_ERR      err;
+
+
+    memset(&Bench_TCBTbl[0], 0, sizeof(Bench_TCBTbl));
+    OSFlagCreate(&Bench_Grp, (CPU_CHAR *)"Bench Flags", 0u, &err);
+    if (err != OS_ERR_NONE) {
+        Bench_Fail("OSFlagCreate()", err);
+    }
+    for (i = 0u; i < nbr_waiters; i++) {
+        Bench_TCBTbl[i].Prio = (OS_PRIO)(i % (OS_CFG_PRIO_MAX - 2u)) + 1u;
+    }
+
+    for (i = 1u; i < nbr_waiters; i++) {
+        bit_a = (OS_FLAGS)1u << (1u + ( i        % BENCH_FLAG_IDLE_BITS));
+        bit_b = (OS_FLAGS)1u << (1u + ((i + 7u)  % BENCH_FLAG_IDLE_BITS));
+        switch (i % 3u) {
+            case 0u:
+                 Bench_Wait(&Bench_TCBTbl[i], bit_a | bit_b, OS_OPT_PEND_FLAG_SET_ALL);
+                 break;
+
+            case 1u:
+                 Bench_Wait(&Bench_TCBTbl[i], bit_a | bit_b, OS_OPT_PEND_FLAG_SET_ANY);
+                 break;
+
+            default:
+                 Bench_Wait(&Bench_TCBTbl[i], bit_a,         OS_OPT_PEND_FLAG_SET_ANY);
+                 break;
+        }
+    }
+    Bench_Wait(&Bench_TCBTbl[0], BENCH_FLAG_WAKE, OS_OPT_PEND_FLAG_SET_ANY);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                RUN ONE WAITER COUNT
+*
+* Description : Measures the 'miss' and 'wake' latencies described in Note #2 at the top of this file.
+*
+* Returns     : none, the latencies are returned in nanoseconds in 'p_miss_ns' and 'p_wake_ns'.
+**************************************************************************************************************************
+*/
+
+static  void  Bench_Run (CPU_INT32U     nbr_waiters,
+                         unsigned long  nbr_posts,
+                         double        *p_miss_ns,
+                         double        *p_wake_ns)
+{
+    unsigned  long       run;
+    unsigned  long  long rdy_start;
+    OS_ERR               err;
+    double               t_start;
+
+
+    Bench_Setup(nbr_waiters);
+
+    t_start = Bench_TimeGet();
+    for (run = 0u; run < nbr_posts; run += 2u) {
+        (void)OSFlagPost(&Bench_Grp, BENCH_FLAG_MISS, OS_OPT_POST_FLAG_SET, &err);
+        (void)OSFlagPost(&Bench_Grp, BENCH_FLAG_MISS, OS_OPT_POST_FLAG_CLR, &err);
+    }
+   *p_miss_ns = (Bench_TimeGet() - t_start) * 1.0e9 / (double)nbr_posts;
+
+    rdy_start = Bench_RdyCtr;
+    t_start   = Bench_TimeGet();
+    for (run = 0u; run < nbr_posts; run++) {
+        (void)OSFlagPost(&Bench_Grp, BENCH_FLAG_WAKE, OS_OPT_POST_FLAG_SET, &err);
+        (void)OSFlagPost(&Bench_Grp, BENCH_FLAG_WAKE, OS_OPT_POST_FLAG_CLR, &err);
+        Bench_Wait(&Bench_TCBTbl[0], BENCH_FLAG_WAKE, OS_OPT_PEND_FLAG_SET_ANY);
+    }
+   *p_wake_ns = (Bench_TimeGet() - t_start) * 1.0e9 / (double)nbr_posts;
+
+    if (Bench_RdyCtr - rdy_start != nbr_posts) {                /* Each 'wake' post readies exactly one task            */
+        Bench_Fail("ready count check", OS_ERR_NONE);
+    }
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                        MAIN
+**************************************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    unsigned  long  posts_per_run;
+    CPU_INT32U      nbr_waiters;
+    double          miss_ns;
+    double          wake_ns;
+
+
+    posts_per_run = BENCH_POSTS_PER_RUN_DFLT;
+    if (argc > 1) {
+        posts_per_run = strtoul(argv[1], DEF_NULL, 0);
+        if (posts_per_run < 2u) {
+            posts_per_run = 2u;
+        }
+    }
+
+    OSRunning             = OS_STATE_OS_RUNNING;
+    OSIntNestingCtr       = 0u;
+    OSSchedLockNestingCtr = 0u;
+
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    printf("OSFlagPost() latency, waiters indexed per bit (OS_CFG_FLAG_IDX_EN enabled)\n");
+#else
+    printf("OSFlagPost() latency, pend list walked (OS_CFG_FLAG_IDX_EN disabled)\n");
+#endif
+    printf("%8s  %12s  %12s\n", "waiters", "miss ns", "wake ns");
+    for (nbr_waiters = 1u; nbr_waiters <= BENCH_WAITERS_MAX; nbr_waiters *= 2u) {
+        Bench_Run(nbr_waiters, posts_per_run, &miss_ns, &wake_ns);
+        printf("%8u  %12.1f  %12.1f\n",
+               (unsigned)nbr_waiters,
+               miss_ns,
+               wake_ns);
+    }
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,512 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                        MPU STACK GUARD FAULT PATH SIMULATION (HOST)
+*
+* File    : OS_GUARD_SIM.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory, build it with:
+*
+*                   cc -std=gnu99 -O2 -I. -I../../../../AppCode -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR
+*                      -I../../../uC-LIB -I../../Source -I../../Ports/ARM-Cortex-M/ARMv7-M/IAR -I../../Trace/RingBuf
+*                      -o os_guard_sim os_guard_sim.c
+*
+*           (2) Usage:
+*
+*                   os_guard_sim
+*
+*               Two tasks, one with a stack aligned on the guard size and one without, are switched in and out while
+*               they use their stacks.  The program checks that:
+*
+*                   (a) OSInitHook() enables the MPU with the background map and the MemManage fault.
+*                   (b) Each switch moves the guard to the bottom of the stack of the task switched in, in two accesses
+*                       to the MPU registers.
+*                   (c) A task may use its stack down to the guard and read the guard.
+*                   (d) The first write into the guard is blocked and reported for the running task, the guard is then
+*                       disabled and CPU_SW_Exception() called.
+*                   (e) A context the exception entry cannot push on the task stack (MSTKERR) is reported the same way.
+*                   (f) Any other MemManage fault is not reported as a stack overflow.
+*
+*               Last, the overflow of (d) is repeated with the guard disabled: the memory below the stack is silently
+*               overwritten.  The program returns EXIT_FAILURE when a check fails.
+*
+*           (3) os_cpu_c.c is compiled in this file, unmodified, with the application configuration.  The MPU and fault
+*               status registers of cpu.h are replaced by variables and the MPU is modeled for the guard region: the
+*               writes of the tasks to their stacks go through Sim_StkWr(), which raises the MemManage fault the way
+*               the core does.  The stacks are mapped below 4 GB so their addresses fit a CPU_ADDR (Linux x86-64).
+**************************************************************************************************************************
+*/
+
+#define  _GNU_SOURCE
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+#include  <stdint.h>
+#include  <sys/mman.h>
+
+#include  "cpu.h"
+
+
+/*
+**************************************************************************************************************************
+*                                                  SIMULATED REGISTERS
+*
+* Note(s) : (1) Every access to a register goes through Sim_RegAccess(), which counts them.
+**************************************************************************************************************************
+*/
+
+typedef  struct  sim_regs {
+    CPU_INT32U    MPU_Ctrl;
+    CPU_INT32U    MPU_RegNbr;
+    CPU_INT32U    MPU_RegBase;
+    CPU_INT32U    MPU_RegAttr;
+    CPU_INT32U    NVIC_SHCSR;
+    CPU_INT32U    NVIC_CFSR;
+    CPU_INT32U    NVIC_MMFAR;
+} SIM_REGS;
+
+static  SIM_REGS    Sim_Regs;
+static  CPU_INT32U  Sim_RegAccessCtr;
+
+
+static  volatile  CPU_INT32U  *Sim_RegAccess (CPU_INT32U  *p_reg)
+{
+    Sim_RegAccessCtr++;
+    return (p_reg);
+}
+
+#undef   CPU_REG_MPU_CTRL
+#undef   CPU_REG_MPU_REG_NBR
+#undef   CPU_REG_MPU_REG_BASE
+#undef   CPU_REG_MPU_REG_ATTR
+#undef   CPU_REG_NVIC_SHCSR
+#undef   CPU_REG_NVIC_CFSR
+#undef   CPU_REG_NVIC_MMFAR
+#define  CPU_REG_MPU_CTRL                (*Sim_RegAccess(&Sim_Regs.MPU_Ctrl))
+#define  CPU_REG_MPU_REG_NBR             (*Sim_RegAccess(&Sim_Regs.MPU_RegNbr))
+#define  CPU_REG_MPU_REG_BASE            (*Sim_RegAccess(&Sim_Regs.MPU_RegBase))
+#define  CPU_REG_MPU_REG_ATTR            (*Sim_RegAccess(&Sim_Regs.MPU_RegAttr))
+#define  CPU_REG_NVIC_SHCSR              (*Sim_RegAccess(&Sim_Regs.NVIC_SHCSR))
+#define  CPU_REG_NVIC_CFSR               (*Sim_RegAccess(&Sim_Regs.NVIC_CFSR))
+#define  CPU_REG_NVIC_MMFAR              (*Sim_RegAccess(&Sim_Regs.NVIC_MMFAR))
+
+
+#define  OS_GLOBALS
+
+#include  "os_cpu_c.c"
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_STK_GUARD_EN != DEF_ENABLED)
+#error  "os_guard_sim.c: OS_CPU_CFG_STK_GUARD_EN must be enabled in os_cfg.h"
+#endif
+
+#define  SIM_MEM_SIZE                         4096u
+#define  SIM_REGION_QTY                          8u
+
+#define  SIM_BELOW_A_OFFSET                  0x000u                 /* Memory below stack A, e.g. another task's TCB    */
+#define  SIM_STK_A_OFFSET                    0x040u                 /* Stack A, aligned on the guard size               */
+#define  SIM_STK_A_SIZE                         64u                 /*     ... in CPU_STK elements                      */
+#define  SIM_BELOW_B_OFFSET                  0x140u
+#define  SIM_STK_B_OFFSET                    0x188u                 /* Stack B, 8-byte aligned only                     */
+#define  SIM_STK_B_SIZE                         62u
+
+#define  SIM_FILL                      0xA5A5A5A5u                  /* Content of the memory below the stacks           */
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  volatile  unsigned  int   Bench_PRIMASK;
+
+static  CPU_INT08U               *Sim_MemPtr;                   /* Simulated RAM, below 4 GB                            */
+static  OS_TCB                    Sim_TaskA_TCB;
+static  OS_TCB                    Sim_TaskB_TCB;
+
+static  CPU_INT32U                Sim_RegionBase[SIM_REGION_QTY];
+static  CPU_INT32U                Sim_RegionAttr[SIM_REGION_QTY];
+
+static  CPU_INT32U                Sim_SwExceptionCtr;           /* Calls to CPU_SW_Exception()                          */
+static  CPU_INT32U                Sim_CFSR_Cleared;             /* Status bits the handler wrote back                   */
+
+static  CPU_STK                   Sim_ISRStk[64];
+CPU_STK     * const  OSCfg_ISRStkBasePtr = &Sim_ISRStk[0];
+CPU_STK_SIZE  const  OSCfg_ISRStkSize    = 64u;
+OS_RATE_HZ    const  OSCfg_TickRate_Hz   = 1000u;
+
+
+/*
+**************************************************************************************************************************
+*                                                   CPU / PORT STUBS
+**************************************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+CPU_TS_TMR  CPU_IntDisMeasMaxCurReset (void)
+{
+    return (0u);
+}
+
+
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    return (0u);
+}
+
+
+void  CPU_SW_Exception (void)                                   /* Deadlocks on the target, counted here                */
+{
+    Sim_SwExceptionCtr++;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                    KERNEL STUBS
+**************************************************************************************************************************
+*/
+
+void  OSIntEnter    (void)                     { }
+void  OSIntExit     (void)                     { }
+void  OSTimeTick    (void)                     { }
+void  OS_LatHistAdd (CPU_INT08U id, CPU_TS ts) { (void)id; (void)ts; }
+void  OS_TaskReturn (void)                     { }
+
+#if (OS_CFG_TRACE_EN == DEF_ENABLED)
+void  OS_TraceRingRec (CPU_INT16U  id,
+                       CPU_INT16U  arg,
+                       CPU_INT32U  obj)
+{
+    (void)id;
+    (void)arg;
+    (void)obj;
+}
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                     MPU MODEL
+**************************************************************************************************************************
+*/
+
+static  CPU_ADDR  Sim_Addr (CPU_INT32U  offset)                 /* Address of the simulated RAM at an offset            */
+{
+    return ((CPU_ADDR)(uintptr_t)(Sim_MemPtr + offset));
+}
+
+
+static  void  Sim_MPU_Commit (void)                             /* Apply the region registers written by the port       */
+{
+    CPU_INT32U  nbr;
+
+
+    if ((Sim_Regs.MPU_RegBase & CPU_REG_MPU_RBAR_VALID) != 0u) {
+        Sim_Regs.MPU_RegNbr   = Sim_Regs.MPU_RegBase & 0x0Fu;   /* The VALID bit selects the region                     */
+        Sim_Regs.MPU_RegBase &= ~(CPU_REG_MPU_RBAR_VALID | 0x0Fu);
+        Sim_RegionBase[Sim_Regs.MPU_RegNbr] = Sim_Regs.MPU_RegBase;
+    }
+    nbr                 = Sim_Regs.MPU_RegNbr % SIM_REGION_QTY;
+    Sim_RegionAttr[nbr] = Sim_Regs.MPU_RegAttr;
+}
+
+
+static  CPU_INT32U  Sim_RegionSize (CPU_INT32U  attr)
+{
+    return (1u << (((attr >> 1u) & 0x1Fu) + 1u));
+}
+
+
+static  CPU_BOOLEAN  Sim_WrAllowed (CPU_ADDR  addr)             /* Privileged write through the regions, see Note #3    */
+{
+    CPU_INT32U  nbr;
+    CPU_INT32U  attr;
+    CPU_INT32U  ap;
+
+
+    for (nbr = SIM_REGION_QTY; nbr > 0u; nbr--) {               /* The highest numbered region takes precedence         */
+        attr = Sim_RegionAttr[nbr - 1u];
+        if ((attr & CPU_REG_MPU_RASR_ENABLE) == 0u) {
+            continue;
+        }
+        if ((addr <  Sim_RegionBase[nbr - 1u]) ||
+            (addr >= Sim_RegionBase[nbr - 1u] + Sim_RegionSize(attr))) {
+            continue;
+        }
+        ap = (attr >> 24u) & 0x07u;
+        return (((ap == 1u) || (ap == 2u) || (ap == 3u)) ? DEF_YES : DEF_NO);
+    }
+    return (DEF_YES);                                           /* Background map                                       */
+}
+
+
+static  void  Sim_MemManageFault (CPU_INT32U  status,
+                                  CPU_ADDR    addr)
+{
+    Sim_Regs.NVIC_CFSR  = status;
+    Sim_Regs.NVIC_MMFAR = addr;
+    OS_CPU_MemManageHandler();
+    Sim_CFSR_Cleared    = Sim_Regs.NVIC_CFSR;                   /* Write one to clear on the core                       */
+    Sim_Regs.NVIC_CFSR  = 0u;
+    Sim_MPU_Commit();
+}
+
+
+static  CPU_BOOLEAN  Sim_StkWr (CPU_ADDR    addr,               /* A data write of the running task                     */
+                                CPU_INT32U  val)
+{
+    if (Sim_WrAllowed(addr) == DEF_NO) {
+        Sim_MemManageFault(CPU_REG_NVIC_CFSR_MMARVALID | CPU_REG_NVIC_CFSR_DACCVIOL, addr);
+        return (DEF_FAIL);
+    }
+    *(CPU_INT32U *)(uintptr_t)addr = val;
+    return (DEF_OK);
+}
+
+
+static  CPU_BOOLEAN  Sim_ExcEntry (CPU_ADDR  sp)                /* Exception entry: 8 words pushed on the task stack    */
+{
+    CPU_INT32U  i;
+
+
+    for (i = 1u; i <= 8u; i++) {
+        if (Sim_WrAllowed(sp - (i * 4u)) == DEF_NO) {
+            Sim_MemManageFault(CPU_REG_NVIC_CFSR_MSTKERR, 0u);  /* MMFAR is not valid on a stacking error               */
+            return (DEF_FAIL);
+        }
+    }
+    return (DEF_OK);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL FUNCTIONS
+**************************************************************************************************************************
+*/
+
+static  void  Sim_Switch (OS_TCB  *p_tcb)                       /* What OS_CPU_PendSVHandler() does around the hook     */
+{
+    OSTCBHighRdyPtr  = p_tcb;
+    Sim_RegAccessCtr = 0u;
+    OSTaskSwHook();
+    Sim_MPU_Commit();
+    OSTCBCurPtr      = p_tcb;
+}
+
+
+static  CPU_BOOLEAN  Sim_Chk (CPU_BOOLEAN   cond,
+                              const  char  *p_desc)
+{
+    printf("  %-68s %s\n", p_desc, (cond == DEF_YES) ? "ok" : "FAIL");
+    return ((cond == DEF_YES) ? DEF_OK : DEF_FAIL);
+}
+
+
+static  CPU_BOOLEAN  Sim_BelowIntact (CPU_INT32U  offset,
+                                      CPU_INT32U  size)
+{
+    CPU_INT32U  i;
+
+
+    for (i = 0u; i < size; i += 4u) {
+        if (*(CPU_INT32U *)(void *)(Sim_MemPtr + offset + i) != SIM_FILL) {
+            return (DEF_NO);
+        }
+    }
+    return (DEF_YES);
+}
+
+
+static  CPU_ADDR  Sim_GuardOf (OS_TCB  *p_tcb)                  /* Guard expected for a stack                           */
+{
+    return (OS_CPU_STK_GUARD_ADDR(p_tcb->StkBasePtr));
+}
+
+
+static  void  Sim_FaultReset (void)
+{
+    OS_CPU_StkGuardHitTCBPtr = DEF_NULL;
+    Sim_SwExceptionCtr       = 0u;
+    Sim_CFSR_Cleared         = 0u;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                        MAIN
+**************************************************************************************************************************
+*/
+
+int  main (void)
+{
+    CPU_BOOLEAN  ok;
+    CPU_BOOLEAN  cond;
+    CPU_ADDR     guard;
+    CPU_ADDR     sp;
+    CPU_ADDR     top;
+    CPU_INT32U   attr;
+    CPU_INT32U   faults;
+
+
+    Sim_MemPtr = (CPU_INT08U *)mmap(DEF_NULL, SIM_MEM_SIZE, PROT_READ | PROT_WRITE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+    if (Sim_MemPtr == (CPU_INT08U *)MAP_FAILED) {
+        perror("mmap");
+        return (EXIT_FAILURE);
+    }
+    memset(Sim_MemPtr, 0xA5, SIM_MEM_SIZE);
+    memset(Sim_MemPtr + SIM_STK_A_OFFSET, 0, SIM_STK_A_SIZE * sizeof(CPU_STK));
+    memset(Sim_MemPtr + SIM_STK_B_OFFSET, 0, SIM_STK_B_SIZE * sizeof(CPU_STK));
+
+    Sim_TaskA_TCB.StkBasePtr = (CPU_STK *)(void *)(Sim_MemPtr + SIM_STK_A_OFFSET);
+    Sim_TaskA_TCB.StkSize    = SIM_STK_A_SIZE;
+    Sim_TaskB_TCB.StkBasePtr = (CPU_STK *)(void *)(Sim_MemPtr + SIM_STK_B_OFFSET);
+    Sim_TaskB_TCB.StkSize    = SIM_STK_B_SIZE;
+    OSTCBCurPtr              = &Sim_TaskA_TCB;
+    ok                       = DEF_OK;
+
+    printf("Guard of %u bytes in MPU region %u\n\n", (unsigned)OS_CPU_CFG_STK_GUARD_SIZE, (unsigned)OS_CPU_CFG_STK_GUARD_REGION);
+
+                                                                /* ------------------ (a) INITIALIZATION -------------- */
+    printf("(a) OSInitHook()\n");
+    OSInitHook();
+    Sim_MPU_Commit();
+    ok &= Sim_Chk(((Sim_Regs.MPU_Ctrl & (CPU_REG_MPU_CTRL_ENABLE | CPU_REG_MPU_CTRL_PRIVDEFENA)) ==
+                                        (CPU_REG_MPU_CTRL_ENABLE | CPU_REG_MPU_CTRL_PRIVDEFENA)) ? DEF_YES : DEF_NO,
+                  "MPU enabled with the background map");
+    ok &= Sim_Chk(((Sim_Regs.NVIC_SHCSR & CPU_REG_NVIC_SHCSR_MEMFAULTENA) != 0u) ? DEF_YES : DEF_NO,
+                  "MemManage fault enabled");
+    ok &= Sim_Chk(((Sim_RegionAttr[OS_CPU_CFG_STK_GUARD_REGION] & CPU_REG_MPU_RASR_ENABLE) == 0u) ? DEF_YES : DEF_NO,
+                  "Guard region disabled until the first switch");
+
+                                                                /* ------------------ (b) SWITCHES -------------------- */
+    printf("(b) Context switches\n");
+    Sim_Switch(&Sim_TaskB_TCB);
+    attr  = Sim_RegionAttr[OS_CPU_CFG_STK_GUARD_REGION];
+    guard = Sim_GuardOf(&Sim_TaskB_TCB);
+    printf("  Stack B at +0x%03X, guard at +0x%03X (%u bytes of the stack lost)\n",
+           (unsigned)SIM_STK_B_OFFSET,
+           (unsigned)(guard - Sim_Addr(0u)),
+           (unsigned)(guard - Sim_Addr(SIM_STK_B_OFFSET) + OS_CPU_CFG_STK_GUARD_SIZE));
+    ok &= Sim_Chk((Sim_RegionBase[OS_CPU_CFG_STK_GUARD_REGION] == guard) ? DEF_YES : DEF_NO,
+                  "Switch to B: guard on the first aligned block of stack B");
+    ok &= Sim_Chk(((Sim_RegionSize(attr) == OS_CPU_CFG_STK_GUARD_SIZE) &&
+                   ((attr & CPU_REG_MPU_RASR_ENABLE) != 0u) &&
+                   ((attr & CPU_REG_MPU_RASR_XN)     != 0u) &&
+                   ((attr & 0x07000000u) == CPU_REG_MPU_RASR_AP_RO)) ? DEF_YES : DEF_NO,
+                  "Guard enabled, read-only, no execute, of the configured size");
+    printf("  MPU register accesses per switch: %u\n", (unsigned)Sim_RegAccessCtr);
+    ok &= Sim_Chk((Sim_RegAccessCtr == 2u) ? DEF_YES : DEF_NO,
+                  "Two stores per switch");
+    Sim_Switch(&Sim_TaskA_TCB);
+    ok &= Sim_Chk((Sim_RegionBase[OS_CPU_CFG_STK_GUARD_REGION] == Sim_Addr(SIM_STK_A_OFFSET)) ? DEF_YES : DEF_NO,
+                  "Switch to A: guard on the bottom of stack A (aligned)");
+
+                                                                /* ------------------ (c) NORMAL USE ------------------ */
+    printf("(c) Task A uses its stack down to the guard\n");
+    Sim_FaultReset();
+    guard  = Sim_GuardOf(&Sim_TaskA_TCB);
+    top    = Sim_Addr(SIM_STK_A_OFFSET + (SIM_STK_A_SIZE * sizeof(CPU_STK)));
+    faults = 0u;
+    for (sp = top; sp > guard + OS_CPU_CFG_STK_GUARD_SIZE; sp -= 4u) {
+        if (Sim_StkWr(sp - 4u, sp) != DEF_OK) {
+            faults++;
+        }
+    }
+    ok &= Sim_Chk((faults == 0u) ? DEF_YES : DEF_NO, "No fault above the guard");
+    ok &= Sim_Chk((*(CPU_INT32U *)(uintptr_t)guard == 0u) ? DEF_YES : DEF_NO,
+                  "Guard readable (OSTaskStkChk(), stack scan)");
+
+                                                                /* ------------------ (d) OVERFLOW -------------------- */
+    printf("(d) Task A pushes one more word\n");
+    cond = (Sim_StkWr(sp - 4u, sp) == DEF_FAIL) ? DEF_YES : DEF_NO;
+    ok  &= Sim_Chk(cond, "Write into the guard faults");
+    ok  &= Sim_Chk((*(CPU_INT32U *)(uintptr_t)(sp - 4u) == 0u) ? DEF_YES : DEF_NO, "The write is blocked");
+    ok  &= Sim_Chk((OS_CPU_StkGuardHitTCBPtr == &Sim_TaskA_TCB) ? DEF_YES : DEF_NO, "Overflow reported for task A");
+    ok  &= Sim_Chk(((Sim_RegionAttr[OS_CPU_CFG_STK_GUARD_REGION] & CPU_REG_MPU_RASR_ENABLE) == 0u) ? DEF_YES : DEF_NO,
+                   "Guard disabled to inspect the stack");
+    ok  &= Sim_Chk(((Sim_SwExceptionCtr == 1u) &&
+                    (Sim_CFSR_Cleared   == (CPU_REG_NVIC_CFSR_MMARVALID | CPU_REG_NVIC_CFSR_DACCVIOL))) ? DEF_YES : DEF_NO,
+                   "Status cleared, CPU_SW_Exception() called");
+    ok  &= Sim_Chk(Sim_BelowIntact(SIM_BELOW_A_OFFSET, SIM_STK_A_OFFSET - SIM_BELOW_A_OFFSET),
+                   "Memory below stack A intact");
+
+                                                                /* ------------------ (e) STACKING ERROR -------------- */
+    printf("(e) Interrupt while task B is 16 bytes above its guard\n");
+    Sim_Switch(&Sim_TaskB_TCB);
+    Sim_FaultReset();
+    guard = Sim_GuardOf(&Sim_TaskB_TCB);
+    cond  = (Sim_ExcEntry(guard + OS_CPU_CFG_STK_GUARD_SIZE + 16u) == DEF_FAIL) ? DEF_YES : DEF_NO;
+    ok   &= Sim_Chk(cond, "Exception entry faults (MSTKERR)");
+    ok   &= Sim_Chk((OS_CPU_StkGuardHitTCBPtr == &Sim_TaskB_TCB) ? DEF_YES : DEF_NO, "Overflow reported for task B");
+    ok   &= Sim_Chk(Sim_BelowIntact(SIM_BELOW_B_OFFSET, SIM_STK_B_OFFSET - SIM_BELOW_B_OFFSET),
+                    "Memory below stack B intact");
+
+                                                                /* ------------------ (f) OTHER FAULT ----------------- */
+    printf("(f) MemManage fault outside the guard\n");
+    Sim_Switch(&Sim_TaskB_TCB);
+    Sim_FaultReset();
+    Sim_MemManageFault(CPU_REG_NVIC_CFSR_MMARVALID | CPU_REG_NVIC_CFSR_DACCVIOL, Sim_Addr(SIM_MEM_SIZE - 4u));
+    ok &= Sim_Chk((OS_CPU_StkGuardHitTCBPtr == DEF_NULL) ? DEF_YES : DEF_NO, "Not reported as a stack overflow");
+    ok &= Sim_Chk((Sim_SwExceptionCtr == 1u) ? DEF_YES : DEF_NO, "CPU_SW_Exception() called");
+
+                                                                /* ------------------ WITHOUT THE GUARD --------------- */
+    printf("Without the guard: task A overflows by %u bytes\n", (unsigned)(2u * OS_CPU_CFG_STK_GUARD_SIZE));
+    Sim_Switch(&Sim_TaskA_TCB);
+    Sim_Regs.MPU_RegNbr  = OS_CPU_CFG_STK_GUARD_REGION;
+    Sim_Regs.MPU_RegAttr = 0u;
+    Sim_MPU_Commit();
+    Sim_FaultReset();
+    for (sp = top; sp > Sim_Addr(SIM_STK_A_OFFSET) - (2u * OS_CPU_CFG_STK_GUARD_SIZE); sp -= 4u) {
+        (void)Sim_StkWr(sp - 4u, sp);
+    }
+    cond = ((Sim_BelowIntact(SIM_BELOW_A_OFFSET, SIM_STK_A_OFFSET - SIM_BELOW_A_OFFSET) == DEF_NO) &&
+            (Sim_SwExceptionCtr == 0u)) ? DEF_YES : DEF_NO;
+    ok  &= Sim_Chk(cond, "Memory below stack A overwritten, nothing reported");
+
+    printf("\n%s\n", (ok == DEF_OK) ? "PASS" : "FAIL");
+    return ((ok == DEF_OK) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,564 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                        MONITOR OPERATION COST BENCHMARK (HOST)
+*
+* File    : OS_MON_BENCH.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory, build it with:
+*
+*                   cc -std=gnu99 -O2 -I. -I../../../../AppCode -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR
+*                      -I../../../uC-LIB -I../../Source -I../../Ports/ARM-Cortex-M/ARMv7-M/IAR -I../../Trace/RingBuf
+*                      -o os_mon_bench os_mon_bench.c
+*
+*           (2) Usage:
+*
+*                   os_mon_bench [<ops_per_run>]
+*
+*               For 1 to 256 tasks waiting on a monitor, spread evenly over its OS_CFG_MON_KEY_NBR condition keys, the
+*               cost of a monitor operation is measured:
+*
+*                   miss      An operation changing the condition of key #0 without satisfying any waiting task, with
+*                             OSMonOp() (every waiting task is evaluated) and with OSMonOpKey() (only the tasks waiting
+*                             under key #0 are evaluated).  The number of evaluations per operation is reported.
+*                   signal    OSMonOpKey() with OS_OPT_POST_1 satisfying all the tasks waiting under key #0 : one task
+*                             is readied.  The time includes the task waiting again with OSMonOpKey().
+*                   bcast     The same with OS_OPT_POST_ALL : all the tasks waiting under key #0 are readied.  The time
+*                             includes all of them waiting again.
+*
+*           (3) os_mon.c is compiled in this file, unmodified, with the application configuration.  The rest of the
+*               kernel is replaced by the stubs below: OS_Pend() only links the task in the pend list of the monitor
+*               (in LIFO order, the priority order of the real pend list does not change the evaluation cost), OS_Post()
+*               only unlinks it and the scheduler is not run.  OSMonOpKey() therefore returns as soon as the task is
+*               linked, leaving it waiting.
+**************************************************************************************************************************
+*/
+
+#define  OS_GLOBALS
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+#include  <time.h>
+
+#include  "os_mon.c"
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#define  BENCH_WAITERS_MAX                     256u
+#define  BENCH_OPS_PER_RUN_DFLT             200000u
+
+#define  BENCH_KEY                              0u                  /* Condition changed by the operations              */
+
+#if (OS_CFG_MON_KEY_EN != DEF_ENABLED)
+#error  "os_mon_bench.c: OS_CFG_MON_KEY_EN must be enabled in os_cfg.h"
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  volatile  unsigned  int   Bench_PRIMASK;
+static  unsigned  long  long      Bench_RdyCtr;                 /* Number of tasks readied                              */
+static  unsigned  long  long      Bench_EvalCtr;                /* Number of waiting tasks evaluated                    */
+
+static  OS_MON                    Bench_Mon;
+static  OS_TCB                    Bench_TCBTbl[BENCH_WAITERS_MAX];
+static  OS_TCB                    Bench_TCBOp;                  /* Task performing the operations                       */
+static  CPU_BOOLEAN               Bench_Allow;                  /* Condition of key #0 satisfies its waiting tasks      */
+
+
+/*
+**************************************************************************************************************************
+*                                                   CPU / PORT STUBS
+**************************************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    static  CPU_TS_TMR  ts;
+
+
+    return (ts++);
+}
+
+
+CPU_DATA  CPU_CntLeadZeros (CPU_DATA  val)
+{
+    if (val == 0u) {
+        return (DEF_INT_CPU_NBR_BITS);
+    }
+    return ((CPU_DATA)__builtin_clz(val));
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                    KERNEL STUBS
+*
+* Note(s) : (1) See Note #3 at the top of this file.  The stubs that must never be reached abort the benchmark.
+**************************************************************************************************************************
+*/
+
+void  OSSched (void)
+{
+}
+
+
+void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
+{
+    p_pend_list->HeadPtr = DEF_NULL;
+    p_pend_list->TailPtr = DEF_NULL;
+}
+
+
+void  OS_Pend (OS_PEND_OBJ  *p_obj,
+               OS_STATE      pending_on,
+               OS_TICK       timeout)
+{
+    OS_PEND_LIST  *p_pend_list;
+
+
+    (void)timeout;
+    OSTCBCurPtr->PendOn      = pending_on;
+    OSTCBCurPtr->PendStatus  = OS_STATUS_PEND_OK;
+    OSTCBCurPtr->TaskState   = OS_TASK_STATE_PEND;
+    OSTCBCurPtr->PendObjPtr  = p_obj;
+    OSTCBCurPtr->PendPrevPtr = DEF_NULL;
+    OSTCBCurPtr->PendNextPtr = DEF_NULL;
+    if (p_obj != DEF_NULL) {                                    /* Link at the head of the pend list                    */
+        p_pend_list              = &p_obj->PendList;
+        OSTCBCurPtr->PendNextPtr =  p_pend_list->HeadPtr;
+        if (p_pend_list->HeadPtr != DEF_NULL) {
+            p_pend_list->HeadPtr->PendPrevPtr = OSTCBCurPtr;
+        } else {
+            p_pend_list->TailPtr = OSTCBCurPtr;
+        }
+        p_pend_list->HeadPtr     =  OSTCBCurPtr;
+    }
+}
+
+
+void  OS_PendListRemove (OS_TCB  *p_tcb)
+{
+    OS_PEND_LIST  *p_pend_list;
+
+
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+    if (p_tcb->MonData.p_key_mon != DEF_NULL) {
+        OS_MonKeyRemove(p_tcb);
+    }
+#endif
+    if (p_tcb->PendObjPtr != DEF_NULL) {
+        p_pend_list = &p_tcb->PendObjPtr->PendList;
+        if (p_tcb->PendPrevPtr == DEF_NULL) {
+            p_pend_list->HeadPtr = p_tcb->PendNextPtr;
+        } else {
+            p_tcb->PendPrevPtr->PendNextPtr = p_tcb->PendNextPtr;
+        }
+        if (p_tcb->PendNextPtr == DEF_NULL) {
+            p_pend_list->TailPtr = p_tcb->PendPrevPtr;
+        } else {
+            p_tcb->PendNextPtr->PendPrevPtr = p_tcb->PendPrevPtr;
+        }
+        p_tcb->PendPrevPtr = DEF_NULL;
+        p_tcb->PendNextPtr = DEF_NULL;
+        p_tcb->PendObjPtr  = DEF_NULL;
+    }
+}
+
+
+void  OS_Post (OS_PEND_OBJ  *p_obj,
+               OS_TCB       *p_tcb,
+               void         *p_void,
+               OS_MSG_SIZE   msg_size,
+               CPU_TS        ts)
+{
+    (void)p_obj;
+    (void)p_void;
+    (void)msg_size;
+    (void)ts;
+    OS_PendListRemove(p_tcb);
+    p_tcb->TaskState  = OS_TASK_STATE_RDY;
+    p_tcb->PendStatus = OS_STATUS_PEND_OK;
+    p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;
+    Bench_RdyCtr++;
+}
+
+
+void  OS_PendAbort (OS_TCB     *p_tcb,
+                    CPU_TS      ts,
+                    OS_STATUS   reason)
+{
+    (void)p_tcb;
+    (void)ts;
+    (void)reason;
+    abort();
+}
+
+
+void  OS_TickListRemove (OS_TCB  *p_tcb)
+{
+    (void)p_tcb;
+    abort();                                                    /* The tasks wait without a timeout                     */
+}
+
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+void  OS_IntQPost (OS_OBJ_TYPE   type,
+                   void         *p_obj,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_FLAGS      flags,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
+{
+    (void)type;
+    (void)p_obj;
+    (void)p_void;
+    (void)msg_size;
+    (void)flags;
+    (void)opt;
+    (void)p_err;
+    abort();
+}
+#endif
+
+
+#if (OS_CFG_TRACE_EN == DEF_ENABLED)
+void  OS_TraceRingRec (CPU_INT16U  id,
+                       CPU_INT16U  arg,
+                       CPU_INT32U  obj)
+{
+    (void)id;
+    (void)arg;
+    (void)obj;
+}
+#endif
+
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+OS_OBJ_HANDLE  OS_ObjRegAdd (void         *p_obj,
+                             OS_OBJ_TYPE   type,
+                             CPU_CHAR     *p_name,
+                             CPU_INT32U    hash)
+{
+    (void)p_obj;
+    (void)type;
+    (void)p_name;
+    (void)hash;
+    return (OS_OBJ_HANDLE_NONE);
+}
+
+
+CPU_INT32U  OS_ObjRegHash (CPU_CHAR  *p_name)
+{
+    (void)p_name;
+    return (0u);
+}
+
+
+void  OS_ObjRegRemove (OS_OBJ_HANDLE  handle)
+{
+    (void)handle;
+}
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL FUNCTIONS
+**************************************************************************************************************************
+*/
+
+static  double  Bench_TimeGet (void)
+{
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec + (double)ts.tv_nsec * 1.0e-9);
+}
+
+
+static  void  Bench_Fail (const  char  *p_what,
+                          OS_ERR        err)
+{
+    fprintf(stderr, "os_mon_bench: %s failed, err = %u\n", p_what, (unsigned)err);
+    exit(EXIT_FAILURE);
+}
+
+
+static  OS_MON_RES  Bench_OnEnterWait (OS_MON  *p_mon,
+                                       void    *p_data)
+{
+    (void)p_mon;
+    (void)p_data;
+    return (OS_MON_RES_BLOCK | OS_MON_RES_STOP_EVAL);
+}
+
+
+static  OS_MON_RES  Bench_OnEnterOp (OS_MON  *p_mon,
+                                     void    *p_data)
+{
+    (void)p_mon;
+    Bench_Allow = *(CPU_BOOLEAN *)p_data;                       /* Change the condition of key #0                       */
+    return (OS_MON_RES_ALLOW);
+}
+
+
+static  OS_MON_RES  Bench_OnEval (OS_MON  *p_mon,
+                                  void    *p_eval_data,
+                                  void    *p_scan_data)
+{
+    (void)p_mon;
+    (void)p_scan_data;
+    Bench_EvalCtr++;
+    if ((*(OS_MON_KEY *)p_eval_data == BENCH_KEY) &&
+        (Bench_Allow                == DEF_YES)) {
+        return (OS_MON_RES_ALLOW);
+    }
+    return (OS_MON_RES_BLOCK);
+}
+
+
+static  void  Bench_Wait (OS_TCB  *p_tcb)
+{
+    OS_ERR  err;
+
+
+    OSTCBCurPtr = p_tcb;                                        /* Wait as this task, see Note #3 at the top            */
+    OSMonOpKey(&Bench_Mon,
+               0u,
+               &p_tcb->MonData.key,                             /* Evaluation data: the key waited for                  */
+               Bench_OnEnterWait,
+               Bench_OnEval,
+               p_tcb->MonData.key,
+               0u,
+               OS_OPT_POST_1,
+               &err);
+    if (err != OS_ERR_NONE) {
+        Bench_Fail("OSMonOpKey()", err);
+    }
+}
+
+
+/*
+**************************************************************************************************************************
+*                                              SET UP THE WAITING TASKS
+*
+* Description : Creates the monitor with 'nbr_waiters' tasks waiting on it.  Task #i waits under key i modulo
+*               OS_CFG_MON_KEY_NBR.
+*
+* Note(s)     : (1) The key a task waits under is kept in 'MonData.key' before the task waits, Bench_Wait() reads it.
+**************************************************************************************************************************
+*/
+
+static  void  Bench_Setup (CPU_INT32U  nbr_waiters)
+{
+    CPU_INT32U  i;
+    OS_ERR      err;
+
+
+    memset(&Bench_TCBTbl[0], 0, sizeof(Bench_TCBTbl));
+    memset(&Bench_TCBOp,     0, sizeof(Bench_TCBOp));
+    OSMonCreate(&Bench_Mon, (CPU_CHAR *)"Bench Monitor", DEF_NULL, &err);
+    if (err != OS_ERR_NONE) {
+        Bench_Fail("OSMonCreate()", err);
+    }
+    Bench_Allow = DEF_NO;
+    for (i = 0u; i < nbr_waiters; i++) {
+        Bench_TCBTbl[i].Prio        = (OS_PRIO)(i % (OS_CFG_PRIO_MAX - 2u)) + 1u;
+        Bench_TCBTbl[i].MonData.key = (OS_MON_KEY)(i % OS_CFG_MON_KEY_NBR);
+        Bench_Wait(&Bench_TCBTbl[i]);
+    }
+    Bench_TCBOp.Prio = OS_CFG_PRIO_MAX - 1u;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                           PERFORM ONE OPERATION, WAIT AGAIN
+*
+* Description : Performs an operation setting the condition of key #0 to 'allow', then lets the tasks readied by it wait
+*               again.
+*
+* Returns     : none.
+**************************************************************************************************************************
+*/
+
+static  void  Bench_Op (CPU_BOOLEAN  keyed,
+                        CPU_BOOLEAN  allow,
+                        OS_OPT       opt,
+                        CPU_INT32U   nbr_waiters)
+{
+    CPU_INT32U  i;
+    OS_ERR      err;
+
+
+    OSTCBCurPtr = &Bench_TCBOp;
+    if (keyed == DEF_YES) {
+        OSMonOpKey(&Bench_Mon, 0u, &allow, Bench_OnEnterOp, DEF_NULL, BENCH_KEY, DEF_BIT(BENCH_KEY), opt, &err);
+    } else {
+        OSMonOp(&Bench_Mon, 0u, &allow, Bench_OnEnterOp, DEF_NULL, opt, &err);
+    }
+    if (err != OS_ERR_NONE) {
+        Bench_Fail("monitor operation", err);
+    }
+    if (allow == DEF_YES) {
+        Bench_Allow = DEF_NO;
+        for (i = BENCH_KEY; i < nbr_waiters; i += OS_CFG_MON_KEY_NBR) {
+            if (Bench_TCBTbl[i].TaskState == OS_TASK_STATE_RDY) {
+                Bench_Wait(&Bench_TCBTbl[i]);
+            }
+        }
+    }
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                RUN ONE WAITER COUNT
+*
+* Description : Measures the operations described in Note #2 at the top of this file.
+*
+* Returns     : none, the costs are returned in nanoseconds per operation in 'p_ns_tbl[]' and the evaluations per
+*               operation in 'p_evals_tbl[]', in the order: OSMonOp() miss, OSMonOpKey() miss, signal, broadcast.
+**************************************************************************************************************************
+*/
+
+static  void  Bench_Run (CPU_INT32U     nbr_waiters,
+                         unsigned long  nbr_ops,
+                         double        *p_ns_tbl,
+                         double        *p_evals_tbl)
+{
+    static  const  CPU_BOOLEAN  keyed_tbl[4] = { DEF_NO,         DEF_YES,        DEF_YES,        DEF_YES         };
+    static  const  CPU_BOOLEAN  allow_tbl[4] = { DEF_NO,         DEF_NO,         DEF_YES,        DEF_YES         };
+    static  const  OS_OPT       opt_tbl[4]   = { OS_OPT_POST_1,  OS_OPT_POST_1,  OS_OPT_POST_1,  OS_OPT_POST_ALL };
+    unsigned  long       run;
+    unsigned  long  long rdy_start;
+    unsigned  long  long eval_start;
+    CPU_INT32U           nbr_key;
+    CPU_INT08U           i;
+    double               t_start;
+
+
+    Bench_Setup(nbr_waiters);
+    nbr_key = (nbr_waiters + OS_CFG_MON_KEY_NBR - 1u - BENCH_KEY) / OS_CFG_MON_KEY_NBR;
+
+    for (i = 0u; i < 4u; i++) {
+        rdy_start  = Bench_RdyCtr;
+        eval_start = Bench_EvalCtr;
+        t_start    = Bench_TimeGet();
+        for (run = 0u; run < nbr_ops; run++) {
+            Bench_Op(keyed_tbl[i], allow_tbl[i], opt_tbl[i], nbr_waiters);
+        }
+        p_ns_tbl[i]    = (Bench_TimeGet() - t_start) * 1.0e9 / (double)nbr_ops;
+        p_evals_tbl[i] = (double)(Bench_EvalCtr - eval_start) / (double)nbr_ops;
+
+        switch (i) {                                            /* Check the number of tasks readied per operation      */
+            case 2u:
+                 if (Bench_RdyCtr - rdy_start != nbr_ops) {
+                     Bench_Fail("signal ready count check", OS_ERR_NONE);
+                 }
+                 break;
+
+            case 3u:
+                 if (Bench_RdyCtr - rdy_start != nbr_ops * nbr_key) {
+                     Bench_Fail("broadcast ready count check", OS_ERR_NONE);
+                 }
+                 break;
+
+            default:
+                 if (Bench_RdyCtr - rdy_start != 0u) {
+                     Bench_Fail("miss ready count check", OS_ERR_NONE);
+                 }
+                 break;
+        }
+    }
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                        MAIN
+**************************************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    unsigned  long  ops_per_run;
+    CPU_INT32U      nbr_waiters;
+    double          ns_tbl[4];
+    double          evals_tbl[4];
+
+
+    ops_per_run = BENCH_OPS_PER_RUN_DFLT;
+    if (argc > 1) {
+        ops_per_run = strtoul(argv[1], DEF_NULL, 0);
+        if (ops_per_run < 1u) {
+            ops_per_run = 1u;
+        }
+    }
+
+    OSRunning             = OS_STATE_OS_RUNNING;
+    OSIntNestingCtr       = 0u;
+    OSSchedLockNestingCtr = 0u;
+
+    printf("Monitor operation cost, %u condition keys (OS_CFG_MON_KEY_NBR)\n", (unsigned)OS_CFG_MON_KEY_NBR);
+    printf("%8s  %10s %7s  %10s %7s  %10s %7s  %10s %7s\n",
+           "waiters", "op miss ns", "evals", "key miss", "evals", "signal ns", "evals", "bcast ns", "evals");
+    for (nbr_waiters = 1u; nbr_waiters <= BENCH_WAITERS_MAX; nbr_waiters *= 2u) {
+        Bench_Run(nbr_waiters, ops_per_run, &ns_tbl[0], &evals_tbl[0]);
+        printf("%8u  %10.1f %7.1f  %10.1f %7.1f  %10.1f %7.1f  %10.1f %7.1f\n",
+               (unsigned)nbr_waiters,
+               ns_tbl[0], evals_tbl[0],
+               ns_tbl[1], evals_tbl[1],
+               ns_tbl[2], evals_tbl[2],
+               ns_tbl[3], evals_tbl[3]);
+    }
+    return (EXIT_SUCCESS);
+}
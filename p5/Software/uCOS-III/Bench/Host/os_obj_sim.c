@@ -0,0 +1,447 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                     KERNEL OBJECT REGISTRY SIMULATION (HOST)
+*
+* File    : OS_OBJ_SIM.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory, build it with:
+*
+*                   cc -std=gnu99 -O2 -I. -I../../../../AppCode -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR
+*                      -I../../../uC-LIB -I../../Source -I../../Ports/ARM-Cortex-M/ARMv7-M/IAR -I../../Trace/RingBuf
+*                      -o os_obj_sim os_obj_sim.c
+*
+*           (2) Usage:
+*
+*                   os_obj_sim [seed]
+*
+*               SIM_OP_QTY random creations and deletions of objects of random types, named after SIM_NAME_QTY names
+*               (some unnamed), fill and empty the registry in turn, every SIM_PHASE_LEN operations.  After each
+*               operation, the program checks the registry against a model of the live objects:
+*
+*                   (a) The handle of each live object gives the object back, with its type, and a wrong type is
+*                       rejected with OS_ERR_OBJ_TYPE.
+*                   (b) The handles of the deleted objects are rejected as stale, as long as their slot has not been
+*                       reused 255 times.
+*                   (c) Each name is found if and only if a live object has it, and the object found has it.
+*                   (d) Each named object is reachable from its home position in the hash table, the free list holds
+*                       the free slots and OSObjRegQty the number of live objects.
+*                   (e) Creating an object in a full registry gives no handle and counts an overflow.
+*
+*               The number of positions probed by OSObjFind() is reported.  The program returns EXIT_FAILURE when a
+*               check fails.
+*
+*           (3) os_obj.c is compiled in this file, unmodified, with the application configuration.
+**************************************************************************************************************************
+*/
+
+#define  OS_GLOBALS
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+
+#include  "os_obj.c"
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#if (OS_CFG_OBJ_REG_EN != DEF_ENABLED)
+#error  "os_obj_sim.c: OS_CFG_OBJ_REG_EN must be enabled in os_cfg.h"
+#endif
+
+#define  SIM_OBJ_QTY                          (OS_CFG_OBJ_REG_SIZE + 8u)   /* More objects than slots, see (e)         */
+#define  SIM_NAME_QTY                          48u              /* Fewer names than objects: names are shared           */
+#define  SIM_NAME_LEN                          16u
+#define  SIM_OP_QTY                        200000u
+#define  SIM_PHASE_LEN                        500u              /* Operations mostly creating, then mostly deleting     */
+#define  SIM_STALE_QTY                        256u              /* Deleted handles kept for (b)                         */
+#define  SIM_TYPE_QTY                           4u
+
+
+/*
+**************************************************************************************************************************
+*                                                     DATA TYPES
+**************************************************************************************************************************
+*/
+
+typedef  struct  sim_obj {
+    CPU_BOOLEAN     Live;
+    OS_OBJ_HANDLE   Handle;
+    OS_OBJ_TYPE     Type;
+    CPU_CHAR       *NamePtr;
+} SIM_OBJ;
+
+
+typedef  struct  sim_stale {
+    OS_OBJ_HANDLE   Handle;
+    CPU_INT32U      ReuseCtr;                                   /* Slot reuses at deletion                              */
+} SIM_STALE;
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  volatile  unsigned  int   Bench_PRIMASK;
+
+static  const  OS_OBJ_TYPE        Sim_TypeTbl[SIM_TYPE_QTY] = {
+    OS_OBJ_TYPE_SEM,
+    OS_OBJ_TYPE_MUTEX,
+    OS_OBJ_TYPE_Q,
+    OS_OBJ_TYPE_TASK
+};
+
+static  CPU_INT32U                Sim_Rand;
+static  SIM_OBJ                   Sim_ObjTbl[SIM_OBJ_QTY];
+static  CPU_CHAR                  Sim_NameTbl[SIM_NAME_QTY][SIM_NAME_LEN];
+static  CPU_INT32U                Sim_LiveQty;
+static  CPU_INT32U                Sim_ReuseTbl[OS_CFG_OBJ_REG_SIZE];     /* Registrations per slot                     */
+static  SIM_STALE                 Sim_StaleTbl[SIM_STALE_QTY];
+static  CPU_INT32U                Sim_StaleQty;
+static  CPU_INT32U                Sim_OvfExpected;
+
+static  CPU_INT32U                Sim_ProbeMax;
+static  CPU_INT64U                Sim_ProbeTotal;
+static  CPU_INT32U                Sim_FindQty;
+
+static  CPU_INT32U                Sim_FailQty;
+
+
+/*
+**************************************************************************************************************************
+*                                                   CPU / PORT STUBS
+**************************************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                  SIMULATED OBJECTS
+**************************************************************************************************************************
+*/
+
+static  CPU_INT32U  Sim_RandGet (CPU_INT32U  max)               /* Uniform in [0, max], xorshift32                      */
+{
+    Sim_Rand ^= Sim_Rand << 13;
+    Sim_Rand ^= Sim_Rand >> 17;
+    Sim_Rand ^= Sim_Rand <<  5;
+    return (Sim_Rand % (max + 1u));
+}
+
+
+static  void  Sim_Fail (const  char  *p_what,
+                        CPU_INT32U    op)
+{
+    if (Sim_FailQty < 10u) {
+        printf("  operation %u: %s\n", (unsigned)op, p_what);
+    }
+    Sim_FailQty++;
+}
+
+
+static  void  Sim_Create (SIM_OBJ     *p_obj,                   /* What the xxxCreate() functions do                    */
+                          CPU_INT32U   op)
+{
+    CPU_INT32U  name;
+
+
+    name           = Sim_RandGet(SIM_NAME_QTY);                 /* SIM_NAME_QTY: no name                                */
+    p_obj->Type    = Sim_TypeTbl[Sim_RandGet(SIM_TYPE_QTY - 1u)];
+    p_obj->NamePtr = (name < SIM_NAME_QTY) ? &Sim_NameTbl[name][0] : DEF_NULL;
+    p_obj->Handle  = OS_ObjRegAdd((void *)p_obj, p_obj->Type, p_obj->NamePtr, OS_ObjRegHash(p_obj->NamePtr));
+
+    if (Sim_LiveQty >= OS_CFG_OBJ_REG_SIZE) {                   /* ---------------------- (e) ------------------------ */
+        Sim_OvfExpected++;
+        if (p_obj->Handle != OS_OBJ_HANDLE_NONE) {
+            Sim_Fail("handle given out by a full registry", op);
+        }
+        if (OSObjRegOvfCtr != Sim_OvfExpected) {
+            Sim_Fail("overflow not counted", op);
+        }
+        p_obj->Live = DEF_NO;
+        return;
+    }
+    if (p_obj->Handle == OS_OBJ_HANDLE_NONE) {
+        Sim_Fail("no handle with free slots", op);
+        p_obj->Live = DEF_NO;
+        return;
+    }
+    Sim_ReuseTbl[p_obj->Handle & OS_OBJ_HANDLE_IX_MASK]++;
+    p_obj->Live = DEF_YES;
+    Sim_LiveQty++;
+}
+
+
+static  void  Sim_Del (SIM_OBJ  *p_obj)                         /* What the xxxDel() functions do                       */
+{
+    SIM_STALE  *p_stale;
+
+
+    OS_ObjRegRemove(p_obj->Handle);
+    p_stale           = &Sim_StaleTbl[Sim_StaleQty % SIM_STALE_QTY];
+    p_stale->Handle   = p_obj->Handle;
+    p_stale->ReuseCtr = Sim_ReuseTbl[p_obj->Handle & OS_OBJ_HANDLE_IX_MASK];
+    Sim_StaleQty++;
+    p_obj->Live       = DEF_NO;
+    Sim_LiveQty--;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                       CHECKS
+**************************************************************************************************************************
+*/
+
+static  void  Sim_ChkHandles (CPU_INT32U  op)                   /* Checks (a) and (b)                                   */
+{
+    SIM_OBJ      *p_obj;
+    SIM_STALE    *p_stale;
+    OS_OBJ_TYPE   type_other;
+    OS_ERR        err;
+    CPU_INT32U    i;
+    CPU_INT32U    qty;
+
+
+    for (i = 0u; i < SIM_OBJ_QTY; i++) {
+        p_obj = &Sim_ObjTbl[i];
+        if (p_obj->Live != DEF_YES) {
+            continue;
+        }
+        if ((OSObjGet(p_obj->Handle, p_obj->Type,      &err) != (void *)p_obj) || (err != OS_ERR_NONE) ||
+            (OSObjGet(p_obj->Handle, OS_OBJ_TYPE_NONE, &err) != (void *)p_obj) || (err != OS_ERR_NONE)) {
+            Sim_Fail("live handle rejected", op);
+        }
+        type_other = (p_obj->Type == OS_OBJ_TYPE_SEM) ? OS_OBJ_TYPE_Q : OS_OBJ_TYPE_SEM;
+        if ((OSObjGet(p_obj->Handle, type_other, &err) != DEF_NULL) || (err != OS_ERR_OBJ_TYPE)) {
+            Sim_Fail("wrong type accepted", op);
+        }
+    }
+
+    qty = (Sim_StaleQty < SIM_STALE_QTY) ? Sim_StaleQty : SIM_STALE_QTY;
+    for (i = 0u; i < qty; i++) {
+        p_stale = &Sim_StaleTbl[i];
+        if ((Sim_ReuseTbl[p_stale->Handle & OS_OBJ_HANDLE_IX_MASK] - p_stale->ReuseCtr) >= 255u) {
+            continue;                                           /* The generation may have wrapped around               */
+        }
+        if ((OSObjGet(p_stale->Handle, OS_OBJ_TYPE_NONE, &err) != DEF_NULL) || (err != OS_ERR_OBJ_HANDLE_STALE)) {
+            Sim_Fail("stale handle accepted", op);
+        }
+    }
+}
+
+
+static  void  Sim_ChkNames (CPU_INT32U  op)                     /* Check (c)                                            */
+{
+    OS_OBJ_HANDLE   handle;
+    SIM_OBJ        *p_obj;
+    OS_ERR          err;
+    CPU_BOOLEAN     live;
+    CPU_INT32U      name;
+    CPU_INT32U      probe;
+    CPU_INT32U      i;
+
+
+    for (name = 0u; name < SIM_NAME_QTY; name++) {
+        live = DEF_NO;
+        for (i = 0u; i < SIM_OBJ_QTY; i++) {
+            if ((Sim_ObjTbl[i].Live    == DEF_YES) &&
+                (Sim_ObjTbl[i].NamePtr == &Sim_NameTbl[name][0])) {
+                live = DEF_YES;
+            }
+        }
+
+        handle = OSObjFind(&Sim_NameTbl[name][0], OS_OBJ_TYPE_NONE, &err);
+        if (live == DEF_YES) {
+            p_obj = (SIM_OBJ *)OSObjGet(handle, OS_OBJ_TYPE_NONE, &err);
+            if ((p_obj == DEF_NULL) || (p_obj->NamePtr != &Sim_NameTbl[name][0])) {
+                Sim_Fail("name not found or wrong object", op);
+            }
+        } else if ((handle != OS_OBJ_HANDLE_NONE) || (err != OS_ERR_OBJ_NOT_FOUND)) {
+            Sim_Fail("deleted name found", op);
+        }
+                                                                /* Positions probed, as in OSObjFind()                  */
+        probe = 1u;
+        i     = OS_ObjRegHash(&Sim_NameTbl[name][0]) & OS_OBJ_REG_HASH_MASK;
+        while ((OSObjRegHashTbl[i] != 0u) &&
+               ((OSObjRegTbl[OSObjRegHashTbl[i] - 1u].NamePtr != &Sim_NameTbl[name][0]))) {
+            i = (i + 1u) & OS_OBJ_REG_HASH_MASK;
+            probe++;
+        }
+        Sim_ProbeTotal += probe;
+        Sim_FindQty++;
+        if (Sim_ProbeMax < probe) {
+            Sim_ProbeMax = probe;
+        }
+    }
+}
+
+
+static  void  Sim_ChkTbl (CPU_INT32U  op)                       /* Check (d)                                            */
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    CPU_INT32U         named;
+    CPU_INT32U         used;
+    CPU_INT32U         free_qty;
+    CPU_INT32U         i;
+    CPU_INT32U         ix;
+    CPU_INT08U         slot;
+
+
+    named = 0u;
+    for (i = 0u; i < OS_CFG_OBJ_REG_SIZE; i++) {
+        p_entry = &OSObjRegTbl[i];
+        if ((p_entry->ObjPtr == DEF_NULL) || (p_entry->NamePtr == DEF_NULL)) {
+            continue;
+        }
+        named++;
+        ix = p_entry->Hash & OS_OBJ_REG_HASH_MASK;              /* Reachable from the home position                     */
+        while (OSObjRegHashTbl[ix] != (i + 1u)) {
+            if (OSObjRegHashTbl[ix] == 0u) {
+                Sim_Fail("named object not reachable", op);
+                break;
+            }
+            ix = (ix + 1u) & OS_OBJ_REG_HASH_MASK;
+        }
+        if (p_entry->HashIx != ix) {
+            Sim_Fail("HashIx out of date", op);
+        }
+    }
+    used = 0u;
+    for (i = 0u; i < OS_CFG_OBJ_REG_HASH_SIZE; i++) {
+        if (OSObjRegHashTbl[i] != 0u) {
+            used++;
+        }
+    }
+    free_qty = 0u;
+    for (slot = OSObjRegFreeHeadIx; slot != OS_OBJ_REG_IX_NONE; slot = OSObjRegTbl[slot].NextFreeIx) {
+        if ((OSObjRegTbl[slot].ObjPtr != DEF_NULL) || (free_qty > OS_CFG_OBJ_REG_SIZE)) {
+            Sim_Fail("free list corrupted", op);
+            break;
+        }
+        free_qty++;
+    }
+    if ((used         != named) ||
+        (OSObjRegQty  != Sim_LiveQty) ||
+        (free_qty     != (OS_CFG_OBJ_REG_SIZE - Sim_LiveQty))) {
+        Sim_Fail("hash table, quantity or free list out of step", op);
+    }
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                        MAIN
+**************************************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    SIM_OBJ     *p_obj;
+    CPU_BOOLEAN  create;
+    CPU_INT32U   op;
+    CPU_INT32U   i;
+    CPU_INT32U   live_max;
+    CPU_INT32U   full_qty;
+
+
+    Sim_Rand = (argc > 1) ? (CPU_INT32U)strtoul(argv[1], DEF_NULL, 0) : 0x2545F491u;
+    if (Sim_Rand == 0u) {
+        Sim_Rand = 1u;
+    }
+    for (i = 0u; i < SIM_NAME_QTY; i++) {
+        snprintf(&Sim_NameTbl[i][0], SIM_NAME_LEN, "Obj %u", (unsigned)i);
+    }
+    OS_ObjRegInit();
+
+    printf("%u slots, hash table of %u, %u objects, %u names, %u operations\n\n",
+           (unsigned)OS_CFG_OBJ_REG_SIZE, (unsigned)OS_CFG_OBJ_REG_HASH_SIZE, (unsigned)SIM_OBJ_QTY,
+           (unsigned)SIM_NAME_QTY, (unsigned)SIM_OP_QTY);
+
+    live_max = 0u;
+    full_qty = 0u;
+    for (op = 0u; op < SIM_OP_QTY; op++) {
+        if (((op / SIM_PHASE_LEN) % 2u) == 0u) {                /* 9 creations out of 10, then 9 deletions out of 10    */
+            create = (Sim_RandGet(9u) != 0u) ? DEF_YES : DEF_NO;
+        } else {
+            create = (Sim_RandGet(9u) == 0u) ? DEF_YES : DEF_NO;
+        }
+        if (Sim_LiveQty == 0u) {
+            create = DEF_YES;
+        }
+        i = Sim_RandGet(SIM_OBJ_QTY - 1u);                      /* Next object in the state needed                      */
+        while (Sim_ObjTbl[i].Live == create) {
+            i = (i + 1u) % SIM_OBJ_QTY;
+        }
+        p_obj = &Sim_ObjTbl[i];
+        if (create == DEF_YES) {
+            Sim_Create(p_obj, op);
+        } else {
+            Sim_Del(p_obj);
+        }
+        if (live_max < Sim_LiveQty) {
+            live_max = Sim_LiveQty;
+        }
+        if (Sim_LiveQty == OS_CFG_OBJ_REG_SIZE) {
+            full_qty++;
+        }
+
+        Sim_ChkHandles(op);
+        Sim_ChkNames(op);
+        Sim_ChkTbl(op);
+    }
+
+    printf("  live objects max %u, operations with the registry full %u, overflows %u\n",
+           (unsigned)live_max, (unsigned)full_qty, (unsigned)OSObjRegOvfCtr);
+    printf("  handles deleted %u\n", (unsigned)Sim_StaleQty);
+    printf("  positions probed per name lookup: average %.2f, max %u\n",
+           (double)Sim_ProbeTotal / (double)Sim_FindQty, (unsigned)Sim_ProbeMax);
+    if (Sim_OvfExpected == 0u) {
+        printf("  the registry was never full\n");
+        Sim_FailQty++;
+    }
+
+    printf("\n%s\n", (Sim_FailQty == 0u) ? "PASS" : "FAIL");
+    return ((Sim_FailQty == 0u) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,549 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                   IDLE POWER MANAGEMENT SIMULATION (HOST)
+*
+* File    : OS_PWR_SIM.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory, build it with:
+*
+*                   cc -std=gnu99 -O2 -I. -I../../../../AppCode -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR
+*                      -I../../../uC-LIB -I../../Source -I../../Ports/ARM-Cortex-M/ARMv7-M/IAR -I../../Trace/RingBuf
+*                      -o os_pwr_sim os_pwr_sim.c
+*
+*           (2) Usage:
+*
+*                   os_pwr_sim [seed]
+*
+*               The CPU is idle for SIM_DURATION_US microseconds, in which:
+*
+*                   a task in the delay list      is made ready every 1 to SIM_DLY_MAX tick(s)
+*                   a task in the timeout list    is made ready every 1 to SIM_TIMEOUT_MAX tick(s)
+*                   a periodic timer              expires every SIM_TMR_PERIOD timer task period(s)
+*                   a peripheral interrupt        is raised every 0 to 2 * SIM_IRQ_MEAN_US microseconds
+*
+*               The same run is repeated with the exit latency unconstrained, limited to the SLEEP latency and
+*               set to 0 (WFI only).  The program checks that:
+*
+*                   (a) Each tick period elapsed is announced exactly once, by the tick ISR or by the idle task.
+*                   (b) Each task is made ready and each timer expires on its tick, no later than the exit latency
+*                       of the state the CPU was in.
+*                   (c) Each interrupt is serviced within the exit latency allowed.
+*                   (d) The states whose exit latency is not allowed are never entered.
+*                   (e) The energy used decreases as deeper states are allowed.
+*                   (f) The time spent in the states is given to the statistics, the timestamp timer being stopped.
+*
+*               The program returns EXIT_FAILURE when a check fails.
+*
+*           (3) os_pwr.c is compiled in this file, unmodified, with the application configuration.  The tick task and
+*               the timer task are modeled by the signals they receive, BSP_OS_PwrEnter() by the time and energy of
+*               each state:
+*
+*                   WFI      SIM_PWR_WFI, the tick ISR wakes the CPU up each tick period for SIM_TICK_ISR_US
+*                   SLEEP    SIM_PWR_SLEEP, the same core state without the tick (see 'bsp_os.c')
+*                   STOP     SIM_PWR_STOP
+*
+*               The exit latency of SLEEP and STOP is spent at SIM_PWR_RUN, and the wake up timer is programmed to
+*               end it on the tick.
+**************************************************************************************************************************
+*/
+
+#define  OS_GLOBALS
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+
+#include  "os_pwr.c"
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#if (OS_CFG_PWR_EN != DEF_ENABLED)
+#error  "os_pwr_sim.c: OS_CFG_PWR_EN must be enabled in os_cfg.h"
+#endif
+#if (OS_CFG_TMR_EN != DEF_ENABLED)
+#error  "os_pwr_sim.c: OS_CFG_TMR_EN must be enabled in os_cfg.h"
+#endif
+
+#define  SIM_TICK_US                          (1000000u / OS_CFG_TICK_RATE_HZ)
+#define  SIM_DURATION_US                   60000000u            /* 1 minute                                             */
+#define  SIM_WAKE_MAX_US                    1875000u            /* LPTIM1 range in 'bsp_os.c'                           */
+
+#define  SIM_DLY_MAX                           40u
+#define  SIM_TIMEOUT_MAX                      150u
+#define  SIM_TMR_PERIOD                         7u
+#define  SIM_IRQ_MEAN_US                    25000u
+
+#define  SIM_PWR_RUN                          100u              /* Power of each state, mW                              */
+#define  SIM_PWR_WFI                           40u
+#define  SIM_PWR_SLEEP                         40u
+#define  SIM_PWR_STOP                           1u
+#define  SIM_TICK_ISR_US                        3u              /* Tick ISR, wake up included                           */
+#define  SIM_TICK_TASK_US                       5u              /* Tick task, once per tick in all the states           */
+
+#define  SIM_RUN_NBR                            3u
+
+
+/*
+**************************************************************************************************************************
+*                                                     DATA TYPES
+**************************************************************************************************************************
+*/
+
+typedef  struct  sim_result {
+    const  char  *Name;
+    CPU_INT32U    LatMax;                                       /* Constraint passed to OSPwrLatMaxSet()                */
+    double        Energy;                                       /* mJ                                                   */
+    CPU_INT64U    EventLateMax;
+    CPU_INT64U    IrqLatMax;
+    OS_PWR_STAT   Stat[OS_PWR_STATE_NBR];
+} SIM_RESULT;
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  volatile  unsigned  int   Bench_PRIMASK;
+
+static  CPU_INT32U                Sim_Seed;
+static  CPU_INT32U                Sim_RandTask;                 /* Same events in all the runs                          */
+static  CPU_INT32U                Sim_RandIrq;
+
+static  CPU_INT64U                Sim_Now;                      /* Simulated time, microseconds                         */
+static  CPU_INT64U                Sim_TickNext;                 /* Next tick ISR, while the tick runs                   */
+static  CPU_INT64U                Sim_TickNbr;                  /* Tick task signals                                    */
+static  CPU_INT64U                Sim_TickHookNbr;
+static  CPU_INT64U                Sim_IrqNext;
+static  CPU_INT32U                Sim_LatCur;                   /* Exit latency of the last state entered               */
+static  double                    Sim_Energy;                   /* mW * us                                              */
+static  CPU_INT64U                Sim_SleepUs;                  /* Time given to OS_StatSleepAdd()                      */
+
+static  OS_TCB                    Sim_DlyTCB;
+static  OS_TCB                    Sim_TimeoutTCB;
+static  OS_TMR                    Sim_Tmr;
+static  CPU_INT64U                Sim_DlyDue;                   /* Tick on which each event is due                      */
+static  CPU_INT64U                Sim_TimeoutDue;
+static  CPU_INT64U                Sim_TmrDue;
+static  CPU_INT32U                Sim_EventNbr;
+
+static  SIM_RESULT               *Sim_ResultCur;
+static  CPU_BOOLEAN               Sim_Fail;
+
+
+/*
+**************************************************************************************************************************
+*                                                   CPU / PORT STUBS
+**************************************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+CPU_TS_TMR  CPU_TS_TmrRd (void)                                 /* Stopped in all the states, see check (f)             */
+{
+    return (0u);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                    KERNEL STUBS
+**************************************************************************************************************************
+*/
+
+OS_RATE_HZ     const  OSCfg_TickRate_Hz = OS_CFG_TICK_RATE_HZ;
+
+static  void  Sim_TickTask (void);
+static  void  Sim_TmrTask  (void);
+
+
+OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
+                           OS_OPT   opt,
+                           OS_ERR  *p_err)
+{
+    (void)opt;
+    if (p_tcb == &OSTickTaskTCB) {
+        Sim_TickTask();
+    } else if (p_tcb == &OSTmrTaskTCB) {
+        Sim_TmrTask();
+    }
+   *p_err = OS_ERR_NONE;
+    return (0u);
+}
+
+
+void  OSSched (void)
+{
+}
+
+
+void  OSTimeTickHook (void)
+{
+    Sim_TickHookNbr++;
+}
+
+
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+void  OS_StatSleepAdd (CPU_TS      ts_counted,
+                       CPU_INT32U  slept_us)
+{
+    (void)ts_counted;
+    Sim_SleepUs += slept_us;
+}
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                  SIMULATED SYSTEM
+**************************************************************************************************************************
+*/
+
+static  CPU_INT32U  Sim_RandGet (CPU_INT32U  *p_rand,            /* Uniform in [0, max], xorshift32                     */
+                                 CPU_INT32U   max)
+{
+   *p_rand ^= *p_rand << 13;
+   *p_rand ^= *p_rand >> 17;
+   *p_rand ^= *p_rand <<  5;
+    return (*p_rand % (max + 1u));
+}
+
+
+static  void  Sim_EventChk (const  char  *p_what,               /* Check (b)                                            */
+                            CPU_INT64U    due)
+{
+    CPU_INT64U  late;
+
+
+    Sim_EventNbr++;
+    if ((Sim_TickNbr != due) ||
+        (Sim_Now     <  due * SIM_TICK_US)) {
+        printf("  %s due on tick %llu, on tick %llu at %llu us\n",
+               p_what, (unsigned long long)due, (unsigned long long)Sim_TickNbr, (unsigned long long)Sim_Now);
+        Sim_Fail = DEF_YES;
+        return;
+    }
+    late = Sim_Now - (due * SIM_TICK_US);
+    if (Sim_ResultCur->EventLateMax < late) {
+        Sim_ResultCur->EventLateMax = late;
+    }
+    if (late > Sim_LatCur) {
+        printf("  %s %llu us late, exit latency %u us\n", p_what, (unsigned long long)late, (unsigned)Sim_LatCur);
+        Sim_Fail = DEF_YES;
+    }
+}
+
+
+static  void  Sim_TaskTick (OS_TCB      *p_tcb,                 /* Tick task: one task in each tick list                */
+                            CPU_INT64U  *p_due,
+                            CPU_INT32U   max,
+                            const char  *p_what)
+{
+    p_tcb->TickRemain--;
+    if (p_tcb->TickRemain == 0u) {
+        Sim_EventChk(p_what, *p_due);
+        p_tcb->TickRemain = 1u + Sim_RandGet(&Sim_RandTask, max - 1u);
+       *p_due             = Sim_TickNbr + p_tcb->TickRemain;
+    }
+}
+
+
+static  void  Sim_TickTask (void)
+{
+    Sim_TickNbr++;
+    Sim_Energy += (double)SIM_PWR_RUN * SIM_TICK_TASK_US;
+    Sim_TaskTick(&Sim_DlyTCB,     &Sim_DlyDue,     SIM_DLY_MAX,     "delay");
+    Sim_TaskTick(&Sim_TimeoutTCB, &Sim_TimeoutDue, SIM_TIMEOUT_MAX, "timeout");
+}
+
+
+static  void  Sim_TmrTask (void)
+{
+    Sim_Tmr.Remain--;
+    if (Sim_Tmr.Remain == 0u) {
+        Sim_EventChk("timer", Sim_TmrDue);
+        Sim_Tmr.Remain = Sim_Tmr.Period;
+        Sim_TmrDue     = Sim_TickNbr + ((CPU_INT64U)Sim_Tmr.Period * OSTmrUpdateCnt);
+    }
+}
+
+
+static  void  Sim_TickISR (void)                                /* What OSTimeTick() does                               */
+{
+    OS_ERR  err;
+
+
+    Sim_Energy += (double)SIM_PWR_RUN * SIM_TICK_ISR_US;
+    OSTimeTickHook();
+    (void)OSTaskSemPost(&OSTickTaskTCB, OS_OPT_POST_NONE, &err);
+    OSTmrUpdateCtr--;
+    if (OSTmrUpdateCtr == 0u) {
+        OSTmrUpdateCtr = OSTmrUpdateCnt;
+        (void)OSTaskSemPost(&OSTmrTaskTCB, OS_OPT_POST_NONE, &err);
+    }
+}
+
+
+CPU_INT32U  BSP_OS_PwrEnter (CPU_INT08U   state,            /* See Note #3                                          */
+                             OS_TICK      ticks,
+                             OS_TICK     *p_ticks_slept)
+{
+    CPU_INT64U  start;
+    CPU_INT64U  wake;
+    CPU_INT64U  due;
+    CPU_INT32U  pwr;
+
+
+    start = Sim_Now;
+    if (Sim_IrqNext <= start) {                                 /* A pending interrupt ends WFI at once                 */
+        Sim_LatCur = 0u;
+        return (0u);
+    }
+    if (state == OS_PWR_STATE_WFI) {
+        wake        = (Sim_TickNext < Sim_IrqNext) ? Sim_TickNext : Sim_IrqNext;
+        Sim_Energy += (double)SIM_PWR_WFI * (double)(wake - start);
+        Sim_Now     = wake;
+        Sim_LatCur  = 0u;
+        return ((CPU_INT32U)(Sim_Now - start));
+    }
+
+    if (state == OS_PWR_STATE_STOP) {
+        pwr        = SIM_PWR_STOP;
+        Sim_LatCur = OS_CFG_PWR_STOP_LAT_US;
+    } else {
+        pwr        = SIM_PWR_SLEEP;
+        Sim_LatCur = OS_CFG_PWR_SLEEP_LAT_US;
+    }
+    due  = ((start / SIM_TICK_US) + (CPU_INT64U)ticks) * SIM_TICK_US;
+    wake = (due > start + Sim_LatCur) ? (due - Sim_LatCur) : start;
+    if (wake > start + SIM_WAKE_MAX_US) {
+        wake = start + SIM_WAKE_MAX_US;
+    }
+    if (wake > Sim_IrqNext) {
+        wake = Sim_IrqNext;
+    }
+    Sim_Energy    += ((double)pwr * (double)(wake - start)) + ((double)SIM_PWR_RUN * Sim_LatCur);
+    Sim_Now        = wake + Sim_LatCur;
+    Sim_TickNext   = ((Sim_Now / SIM_TICK_US) + 1u) * SIM_TICK_US;  /* SysTick restarted in phase                     */
+   *p_ticks_slept  = (OS_TICK)((Sim_Now / SIM_TICK_US) - (start / SIM_TICK_US));
+    return ((CPU_INT32U)(Sim_Now - start));
+}
+
+
+static  void  Sim_IrqService (void)                             /* Check (c)                                            */
+{
+    CPU_INT64U  lat;
+
+
+    lat = Sim_Now - Sim_IrqNext;
+    if (Sim_ResultCur->IrqLatMax < lat) {
+        Sim_ResultCur->IrqLatMax = lat;
+    }
+    if ((lat > Sim_LatCur) ||
+        (lat > Sim_ResultCur->LatMax)) {
+        printf("  interrupt serviced %llu us late, exit latency %u us, %u us allowed\n",
+               (unsigned long long)lat, (unsigned)Sim_LatCur, (unsigned)Sim_ResultCur->LatMax);
+        Sim_Fail = DEF_YES;
+    }
+    Sim_IrqNext += Sim_RandGet(&Sim_RandIrq, 2u * SIM_IRQ_MEAN_US);
+}
+
+
+static  void  Sim_Init (void)
+{
+    Sim_RandTask    = Sim_Seed;
+    Sim_RandIrq     = Sim_Seed ^ 0x5A5A5A5Au;
+    Sim_Now         = 0u;
+    Sim_TickNext    = SIM_TICK_US;
+    Sim_TickNbr     = 0u;
+    Sim_TickHookNbr = 0u;
+    Sim_IrqNext     = Sim_RandGet(&Sim_RandIrq, 2u * SIM_IRQ_MEAN_US);
+    Sim_LatCur      = 0u;
+    Sim_Energy      = 0.0;
+    Sim_SleepUs     = 0u;
+    Sim_EventNbr    = 0u;
+
+    OS_PwrInit();
+    OSTmrUpdateCnt  = OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ;   /* What OS_TmrInit() does                   */
+    OSTmrUpdateCtr  = OSTmrUpdateCnt;
+
+    memset(&Sim_DlyTCB,     0, sizeof(OS_TCB));
+    memset(&Sim_TimeoutTCB, 0, sizeof(OS_TCB));
+    memset(&Sim_Tmr,        0, sizeof(OS_TMR));
+    Sim_DlyTCB.TickRemain       = 1u + Sim_RandGet(&Sim_RandTask, SIM_DLY_MAX     - 1u);
+    Sim_TimeoutTCB.TickRemain   = 1u + Sim_RandGet(&Sim_RandTask, SIM_TIMEOUT_MAX - 1u);
+    Sim_DlyDue                  = Sim_DlyTCB.TickRemain;
+    Sim_TimeoutDue              = Sim_TimeoutTCB.TickRemain;
+    OSTickListDly.TCB_Ptr       = &Sim_DlyTCB;
+    OSTickListTimeout.TCB_Ptr   = &Sim_TimeoutTCB;
+
+    Sim_Tmr.Period              = SIM_TMR_PERIOD;
+    Sim_Tmr.Remain              = SIM_TMR_PERIOD;
+    Sim_Tmr.Opt                 = OS_OPT_TMR_PERIODIC;
+    Sim_TmrDue                  = OSTmrUpdateCtr + ((CPU_INT64U)(SIM_TMR_PERIOD - 1u) * OSTmrUpdateCnt);
+    OSTmrListPtr                = &Sim_Tmr;
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    OSBudgetListPtr             = DEF_NULL;
+#endif
+}
+
+
+static  void  Sim_Run (SIM_RESULT  *p_result)
+{
+    OS_ERR      err;
+    CPU_INT08U  state;
+
+
+    Sim_ResultCur = p_result;
+    Sim_Init();
+    OSPwrLatMaxSet(p_result->LatMax, &err);
+
+    while (Sim_Now < SIM_DURATION_US) {                         /* The idle task loop                                   */
+        OS_PwrIdle();
+        if (Sim_Now >= Sim_TickNext) {
+            Sim_TickISR();
+            Sim_TickNext += SIM_TICK_US;
+        }
+        while (Sim_Now >= Sim_IrqNext) {
+            Sim_IrqService();
+        }
+    }
+
+    p_result->Energy = Sim_Energy / 1000000.0;
+    for (state = 0u; state < OS_PWR_STATE_NBR; state++) {
+        OSPwrStatGet(state, &p_result->Stat[state], &err);
+    }
+                                                                /* ---------------------- (a) ------------------------ */
+    if ((Sim_TickNbr     != (Sim_Now / SIM_TICK_US)) ||
+        (Sim_TickHookNbr !=  Sim_TickNbr)) {
+        printf("  %s: %llu ticks announced, %llu hooks, %llu tick periods\n", p_result->Name,
+               (unsigned long long)Sim_TickNbr, (unsigned long long)Sim_TickHookNbr,
+               (unsigned long long)(Sim_Now / SIM_TICK_US));
+        Sim_Fail = DEF_YES;
+    }
+    if ((p_result->Stat[0].ResidencyTotal + p_result->Stat[1].ResidencyTotal + p_result->Stat[2].ResidencyTotal) !=
+         Sim_Now) {
+        printf("  %s: residencies do not add up to the time simulated\n", p_result->Name);
+        Sim_Fail = DEF_YES;
+    }
+                                                                /* ---------------------- (d) ------------------------ */
+    if (((p_result->LatMax < OS_CFG_PWR_STOP_LAT_US)  && (p_result->Stat[OS_PWR_STATE_STOP].EntryCtr  != 0u)) ||
+        ((p_result->LatMax < OS_CFG_PWR_SLEEP_LAT_US) && (p_result->Stat[OS_PWR_STATE_SLEEP].EntryCtr != 0u))) {
+        printf("  %s: a state with a larger exit latency was entered\n", p_result->Name);
+        Sim_Fail = DEF_YES;
+    }
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+                                                                /* ---------------------- (f) ------------------------ */
+    if (Sim_SleepUs != Sim_Now) {
+        printf("  %s: %llu us slept given to the statistics, %llu us simulated\n", p_result->Name,
+               (unsigned long long)Sim_SleepUs, (unsigned long long)Sim_Now);
+        Sim_Fail = DEF_YES;
+    }
+#endif
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                        MAIN
+**************************************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    static  const  char        *state_name[OS_PWR_STATE_NBR] = { "WFI", "SLEEP", "STOP" };
+    static  const  char        *run_name[SIM_RUN_NBR]        = { "unconstrained", "SLEEP latency", "WFI only" };
+    static  const  CPU_INT32U   run_lat_max[SIM_RUN_NBR]     = { OS_PWR_LAT_MAX_NONE, OS_CFG_PWR_SLEEP_LAT_US, 0u };
+    static         SIM_RESULT   result[SIM_RUN_NBR];           /* Zeroed, name and constraint set below                */
+    SIM_RESULT   *p_result;
+    CPU_INT64U    total;
+    CPU_INT32U    i;
+    CPU_INT08U    state;
+
+
+    Sim_Seed = (argc > 1) ? (CPU_INT32U)strtoul(argv[1], DEF_NULL, 0) : 0x2545F491u;
+    if (Sim_Seed == 0u) {
+        Sim_Seed = 1u;
+    }
+    Sim_Fail = DEF_NO;
+
+    printf("%u s idle, tick %u us, timer every %u ticks, seed 0x%08X\n",
+           (unsigned)(SIM_DURATION_US / 1000000u), (unsigned)SIM_TICK_US,
+           (unsigned)(SIM_TMR_PERIOD * (OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ)), (unsigned)Sim_Seed);
+    printf("SLEEP: latency %u us, residency %u us   STOP: latency %u us, residency %u us\n\n",
+           (unsigned)OS_CFG_PWR_SLEEP_LAT_US, (unsigned)OS_CFG_PWR_SLEEP_RESIDENCY_US,
+           (unsigned)OS_CFG_PWR_STOP_LAT_US,  (unsigned)OS_CFG_PWR_STOP_RESIDENCY_US);
+
+    for (i = 0u; i < SIM_RUN_NBR; i++) {
+        p_result         = &result[i];
+        p_result->Name   =  run_name[i];
+        p_result->LatMax =  run_lat_max[i];
+        Sim_Run(p_result);
+
+        total = 0u;
+        for (state = 0u; state < OS_PWR_STATE_NBR; state++) {
+            total += p_result->Stat[state].ResidencyTotal;
+        }
+        printf("%-14s  %8.1f mJ  %6.2f mW  events %u, late max %llu us, interrupts late max %llu us\n",
+               p_result->Name, p_result->Energy, p_result->Energy * 1000000.0 / (double)SIM_DURATION_US,
+               (unsigned)Sim_EventNbr,
+               (unsigned long long)p_result->EventLateMax, (unsigned long long)p_result->IrqLatMax);
+        for (state = 0u; state < OS_PWR_STATE_NBR; state++) {
+            printf("    %-6s %6.2f%%  entries %7u  early %7u  max %7u us\n",
+                   state_name[state],
+                   (total == 0u) ? 0.0 : (100.0 * (double)p_result->Stat[state].ResidencyTotal / (double)total),
+                   (unsigned)p_result->Stat[state].EntryCtr,
+                   (unsigned)p_result->Stat[state].EarlyWakeCtr,
+                   (unsigned)p_result->Stat[state].ResidencyMax);
+        }
+    }
+                                                                /* ---------------------- (e) ------------------------ */
+    if ((result[0].Energy >= result[1].Energy) ||
+        (result[1].Energy >= result[2].Energy)) {
+        printf("Energy does not decrease with deeper states\n");
+        Sim_Fail = DEF_YES;
+    }
+
+    printf("\n%s\n", (Sim_Fail == DEF_YES) ? "FAIL" : "PASS");
+    return ((Sim_Fail == DEF_YES) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -0,0 +1,422 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                      MESSAGE QUEUE BURST BENCHMARK (HOST)
+*
+* File    : OS_Q_BENCH.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory, build it with:
+*
+*                   cc -std=gnu99 -O2 -I. -I../../../../AppCode -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR
+*                      -I../../../uC-LIB -I../../Source -I../../Ports/ARM-Cortex-M/ARMv7-M/IAR -I../../Trace/RingBuf
+*                      -o os_q_bench os_q_bench.c
+*
+*               OS_CFG_Q_BATCH_EN must be enabled in os_cfg.h.
+*
+*           (2) Usage:
+*
+*                   os_q_bench [<msgs_per_run>]
+*
+*               For burst sizes of 1 to 64 messages, a burst is posted to a queue then received, first one message at a
+*               time with OSQPost()/OSQPend() then with OSQPostN()/OSQPendN().  The throughput is reported in messages
+*               per second along with the number of critical sections per message.
+*
+*           (3) os_q.c and os_msg.c are compiled in this file, unmodified, with the application configuration.  The rest
+*               of the kernel is replaced by the stubs below: no task is waiting on the queue so OS_Pend(), OS_Post()
+*               and the scheduler are never reached.  With a waiting task, OSQPost() also runs the scheduler for every
+*               message whereas OSQPostN() runs it once per burst, that saving only shows on the target.
+**************************************************************************************************************************
+*/
+
+#define  OS_GLOBALS
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <time.h>
+
+#include  "os_msg.c"
+#include  "os_q.c"
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#define  BENCH_BURST_MAX                        64u
+#define  BENCH_MSGS_PER_RUN_DFLT           4000000u
+
+#if (OS_CFG_Q_BATCH_EN != DEF_ENABLED)
+#error  "os_q_bench.c: OS_CFG_Q_BATCH_EN must be enabled in os_cfg.h"
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  volatile  unsigned  int   Bench_PRIMASK;
+static  unsigned  long  long      Bench_IntDisCtr;              /* Number of critical sections entered                  */
+static  unsigned  long  long      Bench_SchedCtr;               /* Number of calls to OSSched()                         */
+
+static  OS_MSG                    Bench_MsgPool[BENCH_BURST_MAX];
+static  OS_Q                      Bench_Q;
+
+static  void                     *Bench_TxTbl[BENCH_BURST_MAX];
+static  void                     *Bench_RxTbl[BENCH_BURST_MAX];
+static  OS_MSG_SIZE               Bench_TxSizeTbl[BENCH_BURST_MAX];
+static  OS_MSG_SIZE               Bench_RxSizeTbl[BENCH_BURST_MAX];
+
+
+/*
+**************************************************************************************************************************
+*                                           APPLICATION CONFIGURATION STUBS
+**************************************************************************************************************************
+*/
+
+OS_MSG_SIZE    const  OSCfg_MsgPoolSize    = (OS_MSG_SIZE)BENCH_BURST_MAX;
+OS_MSG       * const  OSCfg_MsgPoolBasePtr = &Bench_MsgPool[0];
+
+
+/*
+**************************************************************************************************************************
+*                                                   CPU / PORT STUBS
+**************************************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+    Bench_IntDisCtr++;
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    static  CPU_TS_TMR  ts;
+
+
+    return (ts++);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                    KERNEL STUBS
+*
+* Note(s) : (1) The stubs that must never be reached abort the benchmark, see Note #3 at the top of this file.
+**************************************************************************************************************************
+*/
+
+void  OSSched (void)
+{
+    Bench_SchedCtr++;
+}
+
+
+void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
+{
+    p_pend_list->HeadPtr = DEF_NULL;
+    p_pend_list->TailPtr = DEF_NULL;
+}
+
+
+void  OS_Pend (OS_PEND_OBJ  *p_obj,
+               OS_STATE      pending_on,
+               OS_TICK       timeout)
+{
+    (void)p_obj;
+    (void)pending_on;
+    (void)timeout;
+    abort();
+}
+
+
+void  OS_PendAbort (OS_TCB     *p_tcb,
+                    CPU_TS      ts,
+                    OS_STATUS   reason)
+{
+    (void)p_tcb;
+    (void)ts;
+    (void)reason;
+    abort();
+}
+
+
+void  OS_Post (OS_PEND_OBJ  *p_obj,
+               OS_TCB       *p_tcb,
+               void         *p_void,
+               OS_MSG_SIZE   msg_size,
+               CPU_TS        ts)
+{
+    (void)p_obj;
+    (void)p_tcb;
+    (void)p_void;
+    (void)msg_size;
+    (void)ts;
+    abort();
+}
+
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+void  OS_IntQPost (OS_OBJ_TYPE   type,
+                   void         *p_obj,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_FLAGS      flags,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
+{
+    (void)type;
+    (void)p_obj;
+    (void)p_void;
+    (void)msg_size;
+    (void)flags;
+    (void)opt;
+    (void)p_err;
+    abort();
+}
+#endif
+
+
+#if (OS_CFG_MSG_BUF_EN == DEF_ENABLED)
+void  *OSMemGet (OS_MEM  *p_mem,
+                 OS_ERR  *p_err)
+{
+    (void)p_mem;
+   *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+    return (DEF_NULL);
+}
+
+
+void  OSMemPut (OS_MEM  *p_mem,
+                void    *p_blk,
+                OS_ERR  *p_err)
+{
+    (void)p_mem;
+    (void)p_blk;
+   *p_err = OS_ERR_MEM_FULL;
+}
+#endif
+
+
+#if (OS_CFG_TRACE_EN == DEF_ENABLED)
+void  OS_TraceRingRec (CPU_INT16U  id,
+                       CPU_INT16U  arg,
+                       CPU_INT32U  obj)
+{
+    (void)id;
+    (void)arg;
+    (void)obj;
+}
+#endif
+
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+OS_OBJ_HANDLE  OS_ObjRegAdd (void         *p_obj,
+                             OS_OBJ_TYPE   type,
+                             CPU_CHAR     *p_name,
+                             CPU_INT32U    hash)
+{
+    (void)p_obj;
+    (void)type;
+    (void)p_name;
+    (void)hash;
+    return (OS_OBJ_HANDLE_NONE);
+}
+
+
+CPU_INT32U  OS_ObjRegHash (CPU_CHAR  *p_name)
+{
+    (void)p_name;
+    return (0u);
+}
+
+
+void  OS_ObjRegRemove (OS_OBJ_HANDLE  handle)
+{
+    (void)handle;
+}
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL FUNCTIONS
+**************************************************************************************************************************
+*/
+
+static  double  Bench_TimeGet (void)
+{
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec + (double)ts.tv_nsec * 1.0e-9);
+}
+
+
+static  void  Bench_Fail (const  char  *p_what,
+                          OS_ERR        err)
+{
+    fprintf(stderr, "os_q_bench: %s failed, err = %u\n", p_what, (unsigned)err);
+    exit(EXIT_FAILURE);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                 RUN ONE BURST SIZE
+*
+* Description : Posts and receives 'nbr_bursts' bursts of 'burst' messages, one message per call or one burst per call.
+*
+* Returns     : Messages per second, the number of critical sections per message is returned in 'p_int_dis'.
+**************************************************************************************************************************
+*/
+
+static  double  Bench_Run (OS_MSG_QTY     burst,
+                           unsigned long  nbr_bursts,
+                           CPU_BOOLEAN    batched,
+                           double        *p_int_dis)
+{
+    unsigned  long       run;
+    unsigned  long  long int_dis_start;
+    OS_MSG_QTY           i;
+    OS_MSG_QTY           nbr;
+    OS_MSG_SIZE          msg_size;
+    OS_ERR               err;
+    double               t_start;
+    double               t_elapsed;
+
+
+    int_dis_start = Bench_IntDisCtr;
+    t_start       = Bench_TimeGet();
+    for (run = 0u; run < nbr_bursts; run++) {
+        if (batched == DEF_YES) {
+            nbr = OSQPostN(&Bench_Q, Bench_TxTbl, Bench_TxSizeTbl, burst, OS_OPT_POST_FIFO, &err);
+            if ((err != OS_ERR_NONE) || (nbr != burst)) {
+                Bench_Fail("OSQPostN()", err);
+            }
+            nbr = OSQPendN(&Bench_Q, Bench_RxTbl, Bench_RxSizeTbl, burst, 0u, OS_OPT_PEND_NON_BLOCKING, DEF_NULL, &err);
+            if ((err != OS_ERR_NONE) || (nbr != burst)) {
+                Bench_Fail("OSQPendN()", err);
+            }
+        } else {
+            for (i = 0u; i < burst; i++) {
+                OSQPost(&Bench_Q, Bench_TxTbl[i], Bench_TxSizeTbl[i], OS_OPT_POST_FIFO, &err);
+                if (err != OS_ERR_NONE) {
+                    Bench_Fail("OSQPost()", err);
+                }
+            }
+            for (i = 0u; i < burst; i++) {
+                Bench_RxTbl[i] = OSQPend(&Bench_Q, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, DEF_NULL, &err);
+                if (err != OS_ERR_NONE) {
+                    Bench_Fail("OSQPend()", err);
+                }
+                Bench_RxSizeTbl[i] = msg_size;
+            }
+        }
+        if (Bench_RxTbl[burst - 1u] != Bench_TxTbl[burst - 1u]) {
+            Bench_Fail("FIFO order check", OS_ERR_NONE);
+        }
+    }
+    t_elapsed  = Bench_TimeGet() - t_start;
+
+   *p_int_dis = (double)(Bench_IntDisCtr - int_dis_start) / ((double)burst * (double)nbr_bursts);
+    return (((double)burst * (double)nbr_bursts) / t_elapsed);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                        MAIN
+**************************************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    unsigned  long  msgs_per_run;
+    unsigned  long  nbr_bursts;
+    OS_MSG_QTY      burst;
+    OS_MSG_QTY      i;
+    OS_ERR          err;
+    double          rate_single;
+    double          rate_batched;
+    double          int_dis_single;
+    double          int_dis_batched;
+
+
+    msgs_per_run = BENCH_MSGS_PER_RUN_DFLT;
+    if (argc > 1) {
+        msgs_per_run = strtoul(argv[1], DEF_NULL, 0);
+        if (msgs_per_run < BENCH_BURST_MAX) {
+            msgs_per_run = BENCH_BURST_MAX;
+        }
+    }
+
+    OSRunning       = OS_STATE_OS_RUNNING;
+    OSIntNestingCtr = 0u;
+    OS_MsgPoolInit(&err);
+    if (err != OS_ERR_NONE) {
+        Bench_Fail("OS_MsgPoolInit()", err);
+    }
+    OSQCreate(&Bench_Q, (CPU_CHAR *)"Bench Q", (OS_MSG_QTY)BENCH_BURST_MAX, &err);
+    if (err != OS_ERR_NONE) {
+        Bench_Fail("OSQCreate()", err);
+    }
+    for (i = 0u; i < BENCH_BURST_MAX; i++) {
+        Bench_TxTbl[i]     = (void *)&Bench_TxTbl[i];
+        Bench_TxSizeTbl[i] = (OS_MSG_SIZE)sizeof(void *);
+    }
+
+    printf("%6s  %14s  %14s  %8s  %15s  %15s\n",
+           "burst", "single msg/s", "batched msg/s", "speedup", "single crit/msg", "batch crit/msg");
+    for (burst = 1u; burst <= BENCH_BURST_MAX; burst *= 2u) {
+        nbr_bursts   = msgs_per_run / burst;
+        rate_single  = Bench_Run(burst, nbr_bursts, DEF_NO,  &int_dis_single);
+        rate_batched = Bench_Run(burst, nbr_bursts, DEF_YES, &int_dis_batched);
+        printf("%6u  %14.0f  %14.0f  %7.2fx  %15.3f  %15.3f\n",
+               (unsigned)burst,
+               rate_single,
+               rate_batched,
+               rate_batched / rate_single,
+               int_dis_single,
+               int_dis_batched);
+    }
+    if (Bench_SchedCtr != 0u) {                                 /* No task waits on the queue: no scheduling expected   */
+        Bench_Fail("OSSched() count check", OS_ERR_NONE);
+    }
+    return (EXIT_SUCCESS);
+}
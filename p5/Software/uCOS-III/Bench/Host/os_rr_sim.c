@@ -0,0 +1,497 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                       ROUND-ROBIN TIME SLICING FAIRNESS SIMULATION (HOST)
+*
+* File    : OS_RR_SIM.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory, build it with:
+*
+*                   cc -std=gnu99 -O2 -I. -I../../../../AppCode -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR
+*                      -I../../../uC-LIB -I../../Source -I../../Ports/ARM-Cortex-M/ARMv7-M/IAR -I../../Trace/RingBuf
+*                      -o os_rr_sim os_rr_sim.c
+*
+*           (2) Usage:
+*
+*                   os_rr_sim [<seconds_per_run>]
+*
+*               Four CPU bound workers share a priority with round-robin time slicing while a higher priority task
+*               preempts them.  The simulation is deterministic, microsecond by microsecond, with a 1 kHz tick and a
+*               1 MHz time stamp timer.  Each scenario is run twice:
+*
+*                   tick      The time slice of the running worker is charged one tick at each tick, the accounting of
+*                             OS_CFG_SCHED_ROUND_ROBIN_US_EN disabled.
+*                   cycles    The time slice is charged the time stamps the worker ran, from the context switches, the
+*                             accounting of OS_CFG_SCHED_ROUND_ROBIN_US_EN enabled.
+*
+*               For each worker are reported its share of the CPU left by the higher priority task, the number of
+*               slices it ran to the end and the CPU time it got per slice (min / mean / max, in microseconds).  The
+*               spread is the largest share divided by the smallest.  With the 'tick' accounting a worker preempted
+*               just before a tick is charged the whole tick: its slices come up short.  With the 'cycles' accounting
+*               every slice gets at least the time slice, the program returns EXIT_FAILURE when one does not.  Slices
+*               still end at a tick: the time a worker ran past the end of its slice is reported as well.
+*
+*           (3) os_core.c is compiled in this file, unmodified, with the application configuration (the time slices
+*               are in microseconds).  OSSched(), OSIntExit(), the ready list and OS_SchedRoundRobin() are the kernel's.
+*               OSCtxSw() and OSIntCtxSw() are replaced by a switch doing what OSTaskSwHook() does with the cycle
+*               counter.  The 'tick' accounting feeds the same kernel code with one tick's worth of cycles per tick.
+**************************************************************************************************************************
+*/
+
+#define  OS_GLOBALS
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+
+#include  "os_core.c"
+#include  "os_prio.c"
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#define  SIM_WORKER_QTY                          4u
+#define  SIM_WORKER_PRIO                        20u
+#define  SIM_HIGH_PRIO                          10u
+#define  SIM_TICK_US                          1000u                 /* 1 kHz tick                                       */
+#define  SIM_TS_FREQ_HZ                    1000000u                 /* 1 time stamp per microsecond                     */
+#define  SIM_SECONDS_DFLT                       10u
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN != DEF_ENABLED)
+#error  "os_rr_sim.c: OS_CFG_SCHED_ROUND_ROBIN_EN and OS_CFG_SCHED_ROUND_ROBIN_US_EN must be enabled in os_cfg.h"
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                     DATA TYPES
+**************************************************************************************************************************
+*/
+
+typedef  struct  sim_scn {                                      /* Scenario                                             */
+    const  char  *NamePtr;
+    OS_TICK       TimeQuanta;                                   /* Time slice of the workers, microseconds              */
+    CPU_INT32U    HighPeriod;                                   /* Higher priority task: 0 for random releases          */
+    CPU_INT32U    HighPhase;                                    /*     ... released this long after a tick              */
+    CPU_INT32U    HighRunMin;                                   /*     ... runs between min and max microseconds        */
+    CPU_INT32U    HighRunMax;
+} SIM_SCN;
+
+typedef  struct  sim_worker {                                   /* Statistics of a worker                               */
+    CPU_INT32U    Run;                                          /* Microseconds run                                     */
+    CPU_INT32U    SliceRun;                                     /* Microseconds run in the current slice                */
+    CPU_INT32U    SliceQty;
+    CPU_INT32U    SliceMin;
+    CPU_INT32U    SliceMax;
+    CPU_INT64U    SliceSum;
+} SIM_WORKER;
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  volatile  unsigned  int   Bench_PRIMASK;
+
+static  OS_TCB                    Sim_WorkerTCB[SIM_WORKER_QTY];
+static  SIM_WORKER                Sim_WorkerTbl[SIM_WORKER_QTY];
+static  OS_TCB                    Sim_HighTCB;
+
+static  CPU_INT32U                Sim_Now;                      /* Simulated time, microseconds                         */
+static  CPU_BOOLEAN               Sim_CyclesEn;                 /* Charge the slices from the context switches          */
+static  CPU_INT32U                Sim_Seed;
+
+
+/*
+**************************************************************************************************************************
+*                                                   CPU / PORT STUBS
+**************************************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    return ((CPU_TS_TMR)Sim_Now);
+}
+
+
+CPU_TS_TMR_FREQ  CPU_TS_TmrFreqGet (CPU_ERR  *p_err)
+{
+   *p_err = CPU_ERR_NONE;
+    return (SIM_TS_FREQ_HZ);
+}
+
+
+CPU_DATA  CPU_CntLeadZeros (CPU_DATA  val)
+{
+    if (val == 0u) {
+        return (DEF_INT_CPU_NBR_BITS);
+    }
+    return ((CPU_DATA)__builtin_clz(val));
+}
+
+
+static  void  Sim_TaskSw (void)                                 /* What OSTaskSwHook() does with the cycle counter      */
+{
+    CPU_TS  ts;
+
+
+    ts = OS_TS_GET();
+    if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+        OSTCBCurPtr->CyclesDelta  = ts - OSTCBCurPtr->CyclesStart;
+        if (Sim_CyclesEn == DEF_YES) {
+            OSTCBCurPtr->TimeQuantaCyclesUsed += OSTCBCurPtr->CyclesDelta;
+        }
+    }
+    OSTCBHighRdyPtr->CyclesStart = ts;
+    OSTCBCurPtr                  = OSTCBHighRdyPtr;
+    OSPrioCur                    = OSPrioHighRdy;
+}
+
+
+void  OSCtxSw (void)
+{
+    Sim_TaskSw();
+}
+
+
+void  OSIntCtxSw (void)
+{
+    Sim_TaskSw();
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                    KERNEL STUBS
+*
+* Note(s) : (1) Only the ready list and the scheduler of os_core.c are used, OSInit() is not called.
+**************************************************************************************************************************
+*/
+
+CPU_STK     * const  OSCfg_IdleTaskStkBasePtr = DEF_NULL;
+CPU_STK_SIZE  const  OSCfg_IdleTaskStkLimit   = 0u;
+CPU_STK_SIZE  const  OSCfg_IdleTaskStkSize    = 0u;
+CPU_STK     * const  OSCfg_ISRStkBasePtr      = DEF_NULL;
+CPU_STK_SIZE  const  OSCfg_ISRStkSize         = 0u;
+
+void  OSCfg_Init        (void)                 { }
+void  OSIdleTaskHook    (void)                 { }
+void  OSInitHook        (void)                 { }
+void  OSStartHighRdy    (void)                 { }
+void  OS_Dbg_Init       (void)                 { }
+void  OS_EdfRdyListInsert (OS_TCB  *p_tcb)     { (void)p_tcb; }
+void  OS_FlagWaitRemove (OS_TCB  *p_tcb)       { (void)p_tcb; }
+void  OS_MonKeyRemove   (OS_TCB  *p_tcb)       { (void)p_tcb; }
+void  OS_TickListInsert (OS_TICK_LIST *p_list, OS_TCB *p_tcb, OS_TICK time) { (void)p_list; (void)p_tcb; (void)time; }
+void  OS_TickListRemove (OS_TCB  *p_tcb)       { (void)p_tcb; }
+void  OS_LatHistAdd     (CPU_INT08U id, CPU_TS ts) { (void)id; (void)ts; }
+void  OS_LatInit        (void)                 { }
+void  OS_MemInit        (OS_ERR  *p_err)       { (void)p_err; }
+void  OS_MsgPoolInit    (OS_ERR  *p_err)       { (void)p_err; }
+void  OS_ObjRegInit     (void)                 { }
+void  OS_ProfInit       (void)                 { }
+void  OS_PwrIdle        (void)                 { }
+void  OS_PwrInit        (void)                 { }
+void  OS_StatTaskInit   (OS_ERR  *p_err)       { (void)p_err; }
+void  OS_StatIntEnter   (void)                 { }
+void  OS_StatIntExit    (void)                 { }
+void  OS_TaskInit       (OS_ERR  *p_err)       { (void)p_err; }
+void  OS_TaskStkScan    (void)                 { }
+void  OS_TLS_Init       (OS_ERR  *p_err)       { (void)p_err; }
+void  OS_TLS_TaskSw     (void)                 { }
+void  OS_TickTaskInit   (OS_ERR  *p_err)       { (void)p_err; }
+void  OS_TmrInit        (OS_ERR  *p_err)       { (void)p_err; }
+void  OS_IntQTaskInit   (OS_ERR  *p_err)       { (void)p_err; }
+
+void  OSTaskCreate (OS_TCB *p_tcb, CPU_CHAR *p_name, OS_TASK_PTR p_task, void *p_arg, OS_PRIO prio, CPU_STK *p_stk_base,
+                    CPU_STK_SIZE stk_limit, CPU_STK_SIZE stk_size, OS_MSG_QTY q_size, OS_TICK time_quanta, void *p_ext,
+                    OS_OPT opt, OS_ERR *p_err)
+{
+    (void)p_tcb; (void)p_name; (void)p_task; (void)p_arg; (void)prio; (void)p_stk_base; (void)stk_limit;
+    (void)stk_size; (void)q_size; (void)time_quanta; (void)p_ext; (void)opt;
+   *p_err = OS_ERR_NONE;
+}
+
+#if (OS_CFG_TRACE_EN == DEF_ENABLED)
+void  OS_TraceRingRec (CPU_INT16U  id,
+                       CPU_INT16U  arg,
+                       CPU_INT32U  obj)
+{
+    (void)id;
+    (void)arg;
+    (void)obj;
+}
+
+void  OS_TraceRingISR_Enter (void)
+{
+}
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL FUNCTIONS
+**************************************************************************************************************************
+*/
+
+static  CPU_INT32U  Sim_Rand (void)
+{
+    Sim_Seed = (Sim_Seed * 1103515245u) + 12345u;
+    return ((Sim_Seed >> 8) & 0x00FFFFFFu);
+}
+
+
+static  void  Sim_TaskAdd (OS_TCB   *p_tcb,
+                           OS_PRIO   prio,
+                           OS_TICK   time_quanta)
+{
+    memset(p_tcb, 0, sizeof(*p_tcb));
+    p_tcb->Prio       = prio;
+    p_tcb->BasePrio   = prio;
+    p_tcb->TimeQuanta = time_quanta;
+    p_tcb->TaskState  = OS_TASK_STATE_RDY;
+    OS_PrioInsert(prio);
+    OS_RdyListInsertTail(p_tcb);                                /* Loads the time slice                                 */
+}
+
+
+static  void  Sim_SliceEnd (OS_TCB  *p_tcb)                     /* Record the CPU a worker got in a slice               */
+{
+    SIM_WORKER  *p_worker;
+
+
+    p_worker = &Sim_WorkerTbl[p_tcb - &Sim_WorkerTCB[0]];
+    if (p_worker->SliceRun < p_worker->SliceMin) {
+        p_worker->SliceMin = p_worker->SliceRun;
+    }
+    if (p_worker->SliceRun > p_worker->SliceMax) {
+        p_worker->SliceMax = p_worker->SliceRun;
+    }
+    p_worker->SliceSum += p_worker->SliceRun;
+    p_worker->SliceQty++;
+    p_worker->SliceRun  = 0u;
+}
+
+
+static  CPU_BOOLEAN  Sim_Run (const  SIM_SCN  *p_scn,
+                              CPU_BOOLEAN      cycles_en,
+                              CPU_INT32U       seconds)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT32U   end;
+    CPU_INT32U   high_remain;
+    CPU_INT32U   high_next;
+    CPU_INT32U   i;
+    CPU_INT32U   run_total;
+    CPU_INT32U   share_min;
+    CPU_INT32U   share_max;
+    CPU_INT32U   slice_mean;
+    OS_CTR       end_ctr;
+    CPU_BOOLEAN  ok;
+    CPU_SR_ALLOC();
+
+
+    OS_PrioInit();
+    OS_RdyListInit();
+    memset(&Sim_WorkerTbl[0], 0, sizeof(Sim_WorkerTbl));
+    Sim_Now                         = 0u;
+    Sim_Seed                        = 1u;
+    Sim_CyclesEn                    = cycles_en;
+    OSSchedRoundRobinEn             = DEF_TRUE;
+    OSSchedRoundRobinDfltTimeQuanta = p_scn->TimeQuanta;
+    for (i = 0u; i < SIM_WORKER_QTY; i++) {
+        Sim_TaskAdd(&Sim_WorkerTCB[i], SIM_WORKER_PRIO, p_scn->TimeQuanta);
+        Sim_WorkerTbl[i].SliceMin = DEF_INT_32U_MAX_VAL;
+    }
+    memset(&Sim_HighTCB, 0, sizeof(Sim_HighTCB));
+    Sim_HighTCB.Prio     = SIM_HIGH_PRIO;
+    Sim_HighTCB.BasePrio = SIM_HIGH_PRIO;
+    Sim_HighTCB.TaskState = OS_TASK_STATE_PEND;                 /* Waits for its first release                          */
+
+    OSTCBCurPtr     = &Sim_WorkerTCB[0];
+    OSPrioCur       = SIM_WORKER_PRIO;
+    OSTCBHighRdyPtr = OSTCBCurPtr;
+    OSRunning       = OS_STATE_OS_RUNNING;
+    high_remain     = 0u;
+    high_next       = (p_scn->HighPeriod > 0u) ? p_scn->HighPhase : (Sim_Rand() % (4u * SIM_TICK_US));
+
+    end = seconds * 1000000u;
+    for (Sim_Now = 0u; Sim_Now < end; Sim_Now++) {
+        if ((OSTCBCurPtr == &Sim_HighTCB) &&                    /* Higher priority task done: wait for the next release */
+            (high_remain == 0u)) {
+            CPU_CRITICAL_ENTER();
+            Sim_HighTCB.TaskState = OS_TASK_STATE_PEND;
+            OS_RdyListRemove(&Sim_HighTCB);
+            CPU_CRITICAL_EXIT();
+            OSSched();
+        }
+
+        if ((Sim_Now % SIM_TICK_US) == 0u) {                    /* Tick ISR, as OSTimeTick()                            */
+            p_tcb = OSTCBCurPtr;
+            if (cycles_en == DEF_NO) {                          /* Charge the whole tick to the task interrupted        */
+                p_tcb->TimeQuantaCyclesUsed += SIM_TICK_US;
+                p_tcb->CyclesStart           = OS_TS_GET();
+            }
+            end_ctr = p_tcb->TimeQuantaEndCtr;
+            OSIntNestingCtr = 1u;
+            OS_SchedRoundRobin(&OSRdyList[OSPrioCur]);
+            if ((p_tcb->Prio == SIM_WORKER_PRIO) &&
+                (p_tcb->TimeQuantaEndCtr != end_ctr)) {
+                Sim_SliceEnd(p_tcb);
+            }
+            OSIntExit();
+        }
+
+        if (Sim_Now == high_next) {                             /* Release the higher priority task from an ISR         */
+            high_remain = p_scn->HighRunMin + (Sim_Rand() % (p_scn->HighRunMax - p_scn->HighRunMin + 1u));
+            if (p_scn->HighPeriod > 0u) {
+                high_next += p_scn->HighPeriod;
+            } else {
+                high_next += high_remain + (Sim_Rand() % (4u * SIM_TICK_US));
+            }
+            if (Sim_HighTCB.TaskState != OS_TASK_STATE_RDY) {
+                Sim_HighTCB.TaskState = OS_TASK_STATE_RDY;
+                CPU_CRITICAL_ENTER();
+                OS_RdyListInsert(&Sim_HighTCB);
+                CPU_CRITICAL_EXIT();
+                OSIntNestingCtr = 1u;
+                OSIntExit();
+            }
+        }
+
+        p_tcb = OSTCBCurPtr;                                    /* Run the current task for a microsecond               */
+        if (p_tcb == &Sim_HighTCB) {
+            high_remain--;
+        } else {
+            Sim_WorkerTbl[p_tcb - &Sim_WorkerTCB[0]].Run++;
+            Sim_WorkerTbl[p_tcb - &Sim_WorkerTCB[0]].SliceRun++;
+        }
+    }
+
+    ok        = DEF_OK;
+    run_total = 0u;
+    share_min = DEF_INT_32U_MAX_VAL;
+    share_max = 0u;
+    for (i = 0u; i < SIM_WORKER_QTY; i++) {
+        run_total += Sim_WorkerTbl[i].Run;
+        if (Sim_WorkerTbl[i].Run < share_min) {
+            share_min = Sim_WorkerTbl[i].Run;
+        }
+        if (Sim_WorkerTbl[i].Run > share_max) {
+            share_max = Sim_WorkerTbl[i].Run;
+        }
+        if ((cycles_en                 == DEF_YES) &&           /* Each slice must get the whole time slice             */
+            (Sim_WorkerTbl[i].SliceMin <  p_scn->TimeQuanta)) {
+            ok = DEF_FAIL;
+        }
+    }
+    printf("  %-7s", (cycles_en == DEF_YES) ? "cycles" : "tick");
+    for (i = 0u; i < SIM_WORKER_QTY; i++) {
+        slice_mean = 0u;
+        if (Sim_WorkerTbl[i].SliceQty > 0u) {
+            slice_mean = (CPU_INT32U)(Sim_WorkerTbl[i].SliceSum / Sim_WorkerTbl[i].SliceQty);
+        }
+        printf("  W%u %5.2f%% %4u sl %4u/%4u/%4u",
+               (unsigned)i,
+               100.0 * Sim_WorkerTbl[i].Run / run_total,
+               (unsigned)Sim_WorkerTbl[i].SliceQty,
+               (unsigned)((Sim_WorkerTbl[i].SliceQty > 0u) ? Sim_WorkerTbl[i].SliceMin : 0u),
+               (unsigned)slice_mean,
+               (unsigned)Sim_WorkerTbl[i].SliceMax);
+    }
+    printf("  spread %.3f\n", (double)share_max / (double)share_min);
+    if (cycles_en == DEF_YES) {
+        printf("  %-7s  ran past the end of a slice at most:", "");
+        for (i = 0u; i < SIM_WORKER_QTY; i++) {
+            printf(" W%u %u us", (unsigned)i, (unsigned)Sim_WorkerTCB[i].TimeQuantaCyclesOverMax);
+        }
+        printf("\n");
+    }
+    return (ok);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                        MAIN
+**************************************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    static  const  SIM_SCN  scn_tbl[] = {
+        { "Periodic interference every 4 ticks (1.5 ms), 2 ms slices",   2000u, 4000u, 200u, 1500u, 1500u },
+        { "Random interference (0.1 .. 0.9 ms), 2 ms slices",             2000u,    0u,   0u,  100u,  900u },
+        { "Random interference (0.1 .. 0.9 ms), 5 ms slices",             5000u,    0u,   0u,  100u,  900u },
+    };
+    CPU_INT32U   seconds;
+    CPU_INT32U   i;
+    CPU_BOOLEAN  ok;
+
+
+    ok      = DEF_OK;
+    seconds = SIM_SECONDS_DFLT;
+    if (argc > 1) {
+        seconds = (CPU_INT32U)strtoul(argv[1], DEF_NULL, 0);
+    }
+
+    OSIntNestingCtr       = 0u;
+    OSSchedLockNestingCtr = 0u;
+
+    printf("%u workers at priority %u, %u s per run\n",
+           (unsigned)SIM_WORKER_QTY,
+           (unsigned)SIM_WORKER_PRIO,
+           (unsigned)seconds);
+    printf("Per worker: CPU share, slices run to the end, us per slice min/mean/max\n\n");
+    for (i = 0u; i < (sizeof(scn_tbl) / sizeof(scn_tbl[0])); i++) {
+        printf("%s\n", scn_tbl[i].NamePtr);
+        (void)Sim_Run(&scn_tbl[i], DEF_NO,  seconds);
+        if (Sim_Run(&scn_tbl[i], DEF_YES, seconds) != DEF_OK) {
+            printf("  FAIL: a slice got less than the time slice\n");
+            ok = DEF_FAIL;
+        }
+        printf("\n");
+    }
+    return ((ok == DEF_OK) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
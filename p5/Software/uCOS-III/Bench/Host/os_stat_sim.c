@@ -0,0 +1,436 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                     CYCLE BASED CPU USAGE SIMULATION (HOST)
+*
+* File    : OS_STAT_SIM.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory, build it with:
+*
+*                   cc -std=gnu99 -O2 -I. -I../../../../AppCode -I../../../uC-CPU -I../../../uC-CPU/ARM-Cortex-M4/IAR
+*                      -I../../../uC-LIB -I../../Source -I../../Ports/ARM-Cortex-M/ARMv7-M/IAR -I../../Trace/RingBuf
+*                      -o os_stat_sim os_stat_sim.c
+*
+*           (2) Usage:
+*
+*                   os_stat_sim
+*
+*               SIM_TASK_QTY tasks, the last two doing real work, and the idle task share the CPU with a fixed
+*               pattern repeated every statistic task period (SIM_PERIOD_TICKS):
+*
+*                   Task A     30%, interrupted by IRQ 4 (exception 20) for 7%, itself interrupted by IRQ 5 for 2%
+*                   Task B     10%
+*                   Idle task  53%
+*
+*               From the third period on, the idle task spends SIM_SLEEP_US of its time in a low power state in
+*               which the timestamp counter stops after SIM_SLEEP_COUNTED cycles, as OS_PwrIdle() reports it.  The
+*               statistic task runs at the end of each period.  The program checks that:
+*
+*                   (a) The overall CPU usage is 47%, the ISRs 7%, IRQ 4 5% and IRQ 5 2%: the ISR cycles are not
+*                       charged to task A.
+*                   (b) A run updates OS_CFG_STAT_TASK_BATCH tasks, the next run resumes after the last one and each
+*                       task is updated over the time since its previous update.
+*                   (c) The moving averages follow EMA += (usage - EMA) * ticks / tau, computed in floating point.
+*                   (d) The time slept is charged to the idle task: the usages are the same as without sleeping.
+*
+*               The timestamp counter starts close to its wrap around.  The program returns EXIT_FAILURE when a check
+*               fails.
+*
+*           (3) os_stat.c is compiled in this file, unmodified, with the application configuration.  The context
+*               switches only charge the cycles to the tasks, like OSTaskSwHook(), and the ISRs call the functions
+*               called by OSIntEnter() and OSIntExit().
+**************************************************************************************************************************
+*/
+
+#define  OS_GLOBALS
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+
+#include  "os_stat.c"
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_CYCLES_EN != DEF_ENABLED)
+#error  "os_stat_sim.c: OS_CFG_STAT_CYCLES_EN must be enabled in os_cfg.h"
+#endif
+
+#define  SIM_TASK_QTY                          20u              /* Including the idle task, more than one batch         */
+#define  SIM_CYCLES_PER_TICK                 1000u
+#define  SIM_PERIOD_TICKS                     (OS_CFG_TICK_RATE_HZ / OS_CFG_STAT_TASK_RATE_HZ)
+#define  SIM_PERIOD_CYCLES                    (SIM_PERIOD_TICKS * SIM_CYCLES_PER_TICK)
+#define  SIM_PERIOD_QTY                        60u
+#define  SIM_TS_FREQ_HZ                       (SIM_CYCLES_PER_TICK * OS_CFG_TICK_RATE_HZ)
+#define  SIM_SLEEP_US                       40000u              /* See Note #2                                          */
+#define  SIM_SLEEP_COUNTED                    500u
+#define  SIM_TS_START                 0xFFFF0000u               /* See Note #2                                          */
+
+#define  SIM_IRQ_A                             20u              /* IRQ 4                                                */
+#define  SIM_IRQ_B                             21u              /* IRQ 5                                                */
+
+#define  SIM_EMA_TOL                            2u              /* 0.02%                                                */
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  volatile  unsigned  int   Bench_PRIMASK;
+
+static  OS_TCB                    Sim_TCBTbl[SIM_TASK_QTY - 1u];
+static  OS_TCB                   *Sim_TaskA;
+static  OS_TCB                   *Sim_TaskB;
+
+static  CPU_INT32U                Sim_Now;                      /* Simulated timestamp counter                          */
+static  unsigned  int             Sim_IPSRTbl[OS_STAT_INT_NEST_MAX + 1u];
+
+static  CPU_BOOLEAN               Sim_Fail;
+
+
+/*
+**************************************************************************************************************************
+*                                                   CPU / PORT STUBS
+**************************************************************************************************************************
+*/
+
+unsigned  int  __get_PRIMASK (void)
+{
+    return (Bench_PRIMASK);
+}
+
+
+void  __set_PRIMASK (unsigned  int  primask)
+{
+    Bench_PRIMASK = primask;
+}
+
+
+void  __disable_interrupt (void)
+{
+    Bench_PRIMASK = 1u;
+}
+
+
+unsigned  int  __get_IPSR (void)
+{
+    return (Sim_IPSRTbl[OSIntNestingCtr]);
+}
+
+
+void  CPU_IntDisMeasStart (void)
+{
+}
+
+
+void  CPU_IntDisMeasStop (void)
+{
+}
+
+
+CPU_TS_TMR  CPU_IntDisMeasMaxGet (void)
+{
+    return (0u);
+}
+
+
+void  CPU_StatReset (void)
+{
+}
+
+
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    return ((CPU_TS_TMR)Sim_Now);
+}
+
+
+CPU_TS_TMR_FREQ  CPU_TS_TmrFreqGet (CPU_ERR  *p_err)
+{
+   *p_err = CPU_ERR_NONE;
+    return (SIM_TS_FREQ_HZ);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                    KERNEL STUBS
+**************************************************************************************************************************
+*/
+
+OS_RATE_HZ     const  OSCfg_TickRate_Hz        = OS_CFG_TICK_RATE_HZ;
+OS_RATE_HZ     const  OSCfg_StatTaskRate_Hz    = OS_CFG_STAT_TASK_RATE_HZ;
+OS_PRIO        const  OSCfg_StatTaskPrio       = OS_CFG_STAT_TASK_PRIO;
+CPU_STK      * const  OSCfg_StatTaskStkBasePtr = DEF_NULL;  /* OS_StatTaskInit() is not called                     */
+CPU_STK_SIZE   const  OSCfg_StatTaskStkSize    = 0u;
+CPU_STK_SIZE   const  OSCfg_StkSizeMin         = 0u;
+
+void  OSStatTaskHook (void)                                     { }
+void  OS_ProfUpdate  (void)                                     { }
+void  OSTimeDly      (OS_TICK dly, OS_OPT opt, OS_ERR *p_err)  { (void)dly; (void)opt; *p_err = OS_ERR_NONE; }
+void  OSTaskStkChk   (OS_TCB *p_tcb, CPU_STK_SIZE *p_free, CPU_STK_SIZE *p_used, OS_ERR *p_err)
+{
+    (void)p_tcb;
+   *p_free = 0u;
+   *p_used = 0u;
+   *p_err  = OS_ERR_NONE;
+}
+void  OSTaskCreate   (OS_TCB *p_tcb, CPU_CHAR *p_name, OS_TASK_PTR p_task, void *p_arg, OS_PRIO prio, CPU_STK *p_stk_base,
+                      CPU_STK_SIZE stk_limit, CPU_STK_SIZE stk_size, OS_MSG_QTY q_size, OS_TICK time_quanta,
+                      void *p_ext, OS_OPT opt, OS_ERR *p_err)
+{
+    (void)p_tcb; (void)p_name; (void)p_task; (void)p_arg; (void)prio; (void)p_stk_base; (void)stk_limit;
+    (void)stk_size; (void)q_size; (void)time_quanta; (void)p_ext; (void)opt;
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                  SIMULATED KERNEL
+**************************************************************************************************************************
+*/
+
+static  void  Sim_Run (OS_TCB      *p_tcb,                      /* Switch to a task, like OSTaskSwHook(), and run it    */
+                       CPU_INT32U   cycles)
+{
+    CPU_TS  ts;
+
+
+    ts = OS_TS_GET();
+    if (OSTCBCurPtr != p_tcb) {
+        OSTCBCurPtr->CyclesTotal += (OS_CYCLES)(ts - OSTCBCurPtr->CyclesStart);
+        p_tcb->CyclesStart        = ts;
+        OSTCBCurPtr               = p_tcb;
+    }
+    Sim_Now += cycles;
+}
+
+
+static  void  Sim_IntEnter (unsigned  int  nbr)                 /* What OSIntEnter() does                               */
+{
+    OSIntNestingCtr++;
+    Sim_IPSRTbl[OSIntNestingCtr] = nbr;
+    OS_StatIntEnter();
+}
+
+
+static  void  Sim_IntExit (void)                                /* What OSIntExit() does                                */
+{
+    OS_StatIntExit();
+    OSIntNestingCtr--;
+}
+
+
+static  void  Sim_Sleep (CPU_INT32U  us)                        /* What OS_PwrIdle() does, the counter stops            */
+{
+    Sim_Now += SIM_SLEEP_COUNTED;
+    OS_StatSleepAdd(SIM_SLEEP_COUNTED, us);
+}
+
+
+static  void  Sim_Period (CPU_BOOLEAN  sleep)                   /* See Note #2                                          */
+{
+    Sim_Run(Sim_TaskA, 10000u);
+    Sim_IntEnter(SIM_IRQ_A);
+    Sim_Now += 3000u;
+    Sim_IntEnter(SIM_IRQ_B);
+    Sim_Now += 2000u;
+    Sim_IntExit();
+    Sim_Now += 2000u;
+    Sim_IntExit();
+    Sim_Now += 20000u;
+
+    Sim_Run(Sim_TaskB,       10000u);
+    if (sleep == DEF_YES) {
+        Sim_Run(&OSIdleTaskTCB,  SIM_PERIOD_CYCLES - 47000u - (SIM_SLEEP_US * (SIM_TS_FREQ_HZ / 1000000u)));
+        Sim_Sleep(SIM_SLEEP_US);
+    } else {
+        Sim_Run(&OSIdleTaskTCB,  SIM_PERIOD_CYCLES - 47000u);
+    }
+
+    OSTickCtr += SIM_PERIOD_TICKS;
+    Sim_Run(&OSStatTaskTCB,  0u);                               /* The idle task is switched out                        */
+    OS_StatCPUUsageUpdate();
+    OS_StatTaskUpdate();
+}
+
+
+static  void  Sim_Init (void)
+{
+    OS_TCB      *p_tcb;
+    OS_TCB      *p_tcb_prev;
+    CPU_INT32U   i;
+
+
+    Sim_Now          = SIM_TS_START;
+    OSRunning        = OS_STATE_OS_RUNNING;
+    OSIntNestingCtr  = 0u;
+    OSTickCtr        = 0u;
+    OSTaskDbgListPtr = DEF_NULL;
+    OSStatTaskTCBPtr = DEF_NULL;
+    OSTCBCurPtr      = &OSIdleTaskTCB;
+
+    p_tcb_prev = DEF_NULL;
+    for (i = 0u; i < SIM_TASK_QTY; i++) {                       /* Idle task last in the list                           */
+        p_tcb = (i < (SIM_TASK_QTY - 1u)) ? &Sim_TCBTbl[i] : &OSIdleTaskTCB;
+        memset(p_tcb, 0, sizeof(OS_TCB));
+        p_tcb->CyclesStart = Sim_Now;
+        p_tcb->StatTS      = Sim_Now;
+        p_tcb->StatTickCtr = OSTickCtr;
+        p_tcb->DbgPrevPtr  = p_tcb_prev;
+        if (p_tcb_prev == DEF_NULL) {
+            OSTaskDbgListPtr       = p_tcb;
+        } else {
+            p_tcb_prev->DbgNextPtr = p_tcb;
+        }
+        p_tcb_prev = p_tcb;
+    }
+    Sim_TaskA = &Sim_TCBTbl[SIM_TASK_QTY - 3u];
+    Sim_TaskB = &Sim_TCBTbl[SIM_TASK_QTY - 2u];
+    memset(&OSStatTaskTCB, 0, sizeof(OS_TCB));
+
+    OSStatTS             = Sim_Now;                             /* What OS_StatTask() does before its loop              */
+    OSStatTickCtr        = OSTickCtr;
+    OSStatIdleCyclesPrev = OSIdleTaskTCB.CyclesTotal;
+    OSStatIntCyclesPrev  = OSStatIntCyclesTotal;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                       CHECKS
+**************************************************************************************************************************
+*/
+
+static  void  Sim_Chk (const  char        *p_what,
+                       CPU_INT32U          val,
+                       CPU_INT32U          expected,
+                       CPU_INT32U          tol)
+{
+    CPU_BOOLEAN  ok;
+
+
+    ok = ((val + tol >= expected) && (val <= expected + tol)) ? DEF_YES : DEF_NO;
+    printf("  %-44s %6u.%02u%%  expected %3u.%02u%%  %s\n",
+           p_what,
+           (unsigned)(val      / 100u), (unsigned)(val      % 100u),
+           (unsigned)(expected / 100u), (unsigned)(expected % 100u),
+           (ok == DEF_YES) ? "ok" : "FAIL");
+    if (ok != DEF_YES) {
+        Sim_Fail = DEF_YES;
+    }
+}
+
+
+static  CPU_INT32U  Sim_UpdatedQty (void)                       /* Tasks updated by the last statistic task run         */
+{
+    OS_TCB      *p_tcb;
+    CPU_INT32U   nbr;
+
+
+    nbr = 0u;
+    for (p_tcb = OSTaskDbgListPtr; p_tcb != DEF_NULL; p_tcb = p_tcb->DbgNextPtr) {
+        if (p_tcb->StatTS == OSStatTS) {
+            nbr++;
+        }
+    }
+    return (nbr);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                        MAIN
+**************************************************************************************************************************
+*/
+
+int  main (void)
+{
+    static  const  char  *ema_name[OS_STAT_EMA_NBR] = { "1 s", "10 s", "60 s" };
+    double        model[OS_STAT_EMA_NBR];
+    double        k;
+    char          str[64];
+    CPU_INT32U    n;
+    CPU_INT32U    i;
+
+
+    Sim_Init();
+    Sim_Fail = DEF_NO;
+    for (i = 0u; i < OS_STAT_EMA_NBR; i++) {
+        model[i] = 0.0;
+    }
+
+    printf("%u tasks, batches of %u, %u ticks per period, timestamps from 0x%08X\n\n",
+           (unsigned)SIM_TASK_QTY, (unsigned)OS_CFG_STAT_TASK_BATCH, (unsigned)SIM_PERIOD_TICKS, (unsigned)SIM_TS_START);
+
+    for (n = 1u; n <= SIM_PERIOD_QTY; n++) {
+        Sim_Period((n >= 3u) ? DEF_YES : DEF_NO);
+        for (i = 0u; i < OS_STAT_EMA_NBR; i++) {
+            k         = (double)SIM_PERIOD_TICKS / ((double)OS_StatEMA_TauTbl[i] * (double)OS_CFG_TICK_RATE_HZ);
+            model[i] += (4700.0 - model[i]) * ((k < 1.0) ? k : 1.0);
+        }
+
+        if (n == 1u) {                                          /* ------------ (a) AND FIRST BATCH (b) --------------- */
+            printf("Period 1\n");
+            Sim_Chk("overall",                 OSStatTaskCPUUsage,                 4700u, 0u);
+            Sim_Chk("ISRs",                    OSStatIntCPUUsage,                   700u, 0u);
+            Sim_Chk("IRQ 4",                   OSStatISRTbl[SIM_IRQ_A].CPUUsage,    500u, 0u);
+            Sim_Chk("IRQ 5",                   OSStatISRTbl[SIM_IRQ_B].CPUUsage,    200u, 0u);
+            Sim_Chk("task A, not updated yet", Sim_TaskA->CPUUsage,                   0u, 0u);
+            Sim_Chk("task 0",                  Sim_TCBTbl[0].CPUUsage,                0u, 0u);
+            printf("  tasks updated %u, IRQ 4 entries %u\n",
+                   (unsigned)Sim_UpdatedQty(), (unsigned)OSStatISRTbl[SIM_IRQ_A].Ctr);
+            if ((Sim_UpdatedQty()              != OS_CFG_STAT_TASK_BATCH) ||
+                (OSStatISRTbl[SIM_IRQ_A].Ctr   != 1u)) {
+                Sim_Fail = DEF_YES;
+            }
+        } else if (n == 2u) {                                   /* ---------------- SECOND BATCH (b) ---------------- */
+            printf("Period 2\n");
+            Sim_Chk("task A, over 2 periods",  Sim_TaskA->CPUUsage,            3000u, 0u);
+            Sim_Chk("task B, over 2 periods",  Sim_TaskB->CPUUsage,            1000u, 0u);
+            Sim_Chk("idle task",               OSIdleTaskTCB.CPUUsage,         5300u, 0u);
+            printf("  tasks updated %u, next batch from the head: %s\n",
+                   (unsigned)Sim_UpdatedQty(), (OSStatTaskTCBPtr == DEF_NULL) ? "yes" : "no");
+            if ((Sim_UpdatedQty()  != (SIM_TASK_QTY - OS_CFG_STAT_TASK_BATCH)) ||
+                (OSStatTaskTCBPtr  != DEF_NULL)) {
+                Sim_Fail = DEF_YES;
+            }
+        } else if (n == 3u) {                                   /* ------------------ SLEEPING (d) ------------------- */
+            printf("Period 3, idle task sleeping\n");
+            Sim_Chk("overall",                 OSStatTaskCPUUsage,             4700u, 0u);
+            Sim_Chk("ISRs",                    OSStatIntCPUUsage,               700u, 0u);
+        } else if (n == 4u) {
+            printf("Period 4, idle task sleeping\n");
+            Sim_Chk("task A, over 2 periods",  Sim_TaskA->CPUUsage,            3000u, 0u);
+            Sim_Chk("idle task",               OSIdleTaskTCB.CPUUsage,         5300u, 0u);
+        }
+    }
+                                                                /* -------------------- EMAS (c) --------------------- */
+    printf("Moving averages after %u periods\n", (unsigned)SIM_PERIOD_QTY);
+    for (i = 0u; i < OS_STAT_EMA_NBR; i++) {
+        snprintf(str, sizeof(str), "overall, %s", ema_name[i]);
+        Sim_Chk(str, OS_STAT_EMA_TO_USAGE(OSStatTaskCPUUsageEMA[i]), (CPU_INT32U)(model[i] + 0.5), SIM_EMA_TOL);
+    }
+    for (i = 0u; i < OS_STAT_EMA_NBR; i++) {
+        snprintf(str, sizeof(str), "IRQ 4, %s", ema_name[i]);
+        Sim_Chk(str, OS_STAT_EMA_TO_USAGE(OSStatISRTbl[SIM_IRQ_A].CPUUsageEMA[i]),
+                (CPU_INT32U)(model[i] * 500.0 / 4700.0 + 0.5), SIM_EMA_TOL);
+    }
+
+    printf("\n%s\n", (Sim_Fail == DEF_YES) ? "FAIL" : "PASS");
+    return ((Sim_Fail == DEF_YES) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
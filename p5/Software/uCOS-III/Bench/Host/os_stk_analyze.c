@@ -0,0 +1,587 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                          TASK STACK USAGE ANALYZER (HOST)
+*
+* File    : OS_STK_ANALYZE.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  From this directory, build it with:
+*
+*                   cc -std=gnu99 -O2 -o os_stk_analyze os_stk_analyze.c
+*
+*           (2) Usage:
+*
+*                   os_stk_analyze [-v] [-r <redzone_depth>] <tasks_file> <file.ci> ...
+*
+*               The '.ci' files are the call graphs GCC writes with -fcallgraph-info=su, one per translation unit.
+*               Build the application sources with the target options and the optimization level of the release, e.g.:
+*
+*                   arm-none-eabi-gcc -mcpu=cortex-m7 -mthumb -mfpu=fpv5-sp-d16 -mfloat-abi=hard -O2
+*                                     -fcallgraph-info=su -c <file.c>
+*
+*               Each function of the graph is charged its own frame, each task entry the deepest path through the
+*               functions it calls, plus the frame the port saves on the task stack when the task is switched out:
+*
+*                   integer task   17 words: R4-R11 and EXC_RETURN, R0-R3, R12, LR, PC and xPSR        68 bytes
+*                   FP task        51 words: the above, S16-S31, S0-S15, FPSCR and the reserved word   204 bytes
+*
+*               plus the redzone of the stack when OS_CFG_TASK_STK_REDZONE_EN is enabled (-r, in stack elements).
+*               Interrupts run on the main stack and are not charged to the tasks.
+*
+*           (3) The tasks file lists, one per line ('#' starts a comment):
+*
+*                   task   <entry> <stack_bytes> [fp]       A task, its entry function and its stack size
+*                   used   <entry> <bytes>                  The high-water mark measured on the target for the task
+*                   stack  <function> <bytes>               The frame of a function the compiler did not see (assembly,
+*                                                           libraries)
+*                   calls  <function> <callee>              A call through a function pointer made by <function>
+*
+*               A 'calls' line replaces the indirect call placeholder of <function>.  Static functions are named
+*               '<file>:<function>' as in the '.ci' files.  The high-water marks are the 'StkUsedMax' the idle task
+*               keeps in the TCB of each task (OS_CFG_TASK_STK_SCAN_EN), in elements of 4 bytes, or the 'StkUsed' of
+*               the profiler records (OS_CFG_PROF_EN), in bytes.
+*
+*           (4) For each task are reported the static bound, the stack size, the high-water mark, the margin left by
+*               the bound and the smallest stack, in CPU_STK elements, that holds both the bound and the high-water
+*               mark.  A bound is only an upper bound when the path is fully known, the flags say why it is not:
+*
+*                   R   recursion, the recursive calls are counted once
+*                   I   a call through a function pointer not resolved by a 'calls' line
+*                   D   a frame of dynamic size (alloca() or variable length arrays)
+*                   U   a function without a frame, neither in the '.ci' files nor in a 'stack' line
+*
+*               The program returns EXIT_FAILURE when a stack is smaller than its bound or than its high-water mark.
+**************************************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#define  STK_FNCT_MAX                        8192u
+#define  STK_EDGE_MAX                       32768u
+#define  STK_TASK_MAX                          64u
+#define  STK_HASH_SIZE                      16384u                 /* Power of 2, larger than STK_FNCT_MAX             */
+#define  STK_NAME_LEN                         128u
+#define  STK_LINE_LEN                        1024u
+
+#define  STK_ELEM_SIZE                          4u                 /* sizeof(CPU_STK)                                  */
+#define  STK_FRAME_INT                         68u                 /* See Note #2.                                     */
+#define  STK_FRAME_FP                         204u
+
+#define  STK_INDIRECT                "__indirect_call"
+
+#define  STK_FLAG_RECURSION                  0x01u
+#define  STK_FLAG_INDIRECT                   0x02u
+#define  STK_FLAG_DYNAMIC                    0x04u
+#define  STK_FLAG_UNKNOWN                    0x08u
+
+#define  STK_STATE_NEW                          0u                 /* Depth of the function not computed yet           */
+#define  STK_STATE_OPEN                         1u                 /*     ... being computed, on the current path      */
+#define  STK_STATE_DONE                         2u
+
+
+/*
+**************************************************************************************************************************
+*                                                     DATA TYPES
+**************************************************************************************************************************
+*/
+
+typedef  struct  stk_fnct {
+    char            Name[STK_NAME_LEN];
+    unsigned  long  Frame;                                      /* Own frame, bytes                                     */
+    unsigned  int   Known;                                      /* The frame comes from a '.ci' file or a 'stack' line  */
+    unsigned  int   Flags;                                      /* STK_FLAG_xxx of the function itself                  */
+    unsigned  int   Resolved;                                   /* Indirect calls resolved by 'calls' lines             */
+    long            EdgeHead;                                   /* First call made by the function, -1 for none         */
+    unsigned  int   State;
+    unsigned  long  Depth;                                      /* Deepest path from the function, bytes                */
+    unsigned  int   DepthFlags;                                 /*     ... and the flags of that path                   */
+    long            DepthNext;                                  /*     ... and the callee it goes through               */
+} STK_FNCT;
+
+typedef  struct  stk_edge {
+    long            Callee;
+    long            Next;
+} STK_EDGE;
+
+typedef  struct  stk_task {
+    long            Fnct;
+    unsigned  long  Size;                                       /* Stack size, bytes                                    */
+    unsigned  long  Used;                                       /* High-water mark measured on the target, bytes        */
+    unsigned  int   FP;
+} STK_TASK;
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  STK_FNCT        Stk_FnctTbl[STK_FNCT_MAX];
+static  unsigned  long  Stk_FnctQty;
+static  STK_EDGE        Stk_EdgeTbl[STK_EDGE_MAX];
+static  unsigned  long  Stk_EdgeQty;
+static  long            Stk_HashTbl[STK_HASH_SIZE];             /* Index in Stk_FnctTbl[] + 1, 0 for an empty slot      */
+static  STK_TASK        Stk_TaskTbl[STK_TASK_MAX];
+static  unsigned  long  Stk_TaskQty;
+
+
+/*
+**************************************************************************************************************************
+*                                                 FUNCTION TABLE
+**************************************************************************************************************************
+*/
+
+static  unsigned  long  Stk_Hash (const  char  *p_name)
+{
+    unsigned  long  hash;
+
+
+    hash = 5381u;
+    while (*p_name != '\0') {
+        hash = (hash * 33u) ^ (unsigned char)*p_name;
+        p_name++;
+    }
+    return (hash & (STK_HASH_SIZE - 1u));
+}
+
+
+static  long  Stk_FnctGet (const  char  *p_name)                /* Find a function, add it when not found               */
+{
+    unsigned  long   ix;
+    long             fnct;
+    STK_FNCT        *p_fnct;
+
+
+    ix = Stk_Hash(p_name);
+    while (Stk_HashTbl[ix] != 0) {
+        fnct = Stk_HashTbl[ix] - 1;
+        if (strcmp(Stk_FnctTbl[fnct].Name, p_name) == 0) {
+            return (fnct);
+        }
+        ix = (ix + 1u) & (STK_HASH_SIZE - 1u);
+    }
+
+    if (Stk_FnctQty >= STK_FNCT_MAX) {
+        fprintf(stderr, "os_stk_analyze: more than %u functions\n", STK_FNCT_MAX);
+        exit(EXIT_FAILURE);
+    }
+    fnct   = (long)Stk_FnctQty++;
+    p_fnct = &Stk_FnctTbl[fnct];
+    memset(p_fnct, 0, sizeof(*p_fnct));
+    strncpy(p_fnct->Name, p_name, STK_NAME_LEN - 1u);
+    p_fnct->EdgeHead  = -1;
+    p_fnct->DepthNext = -1;
+    Stk_HashTbl[ix]   = fnct + 1;
+    return (fnct);
+}
+
+
+static  void  Stk_EdgeAdd (long  caller,
+                           long  callee)
+{
+    long  edge;
+
+
+    for (edge = Stk_FnctTbl[caller].EdgeHead; edge >= 0; edge = Stk_EdgeTbl[edge].Next) {
+        if (Stk_EdgeTbl[edge].Callee == callee) {               /* One edge per callee, whatever the number of calls    */
+            return;
+        }
+    }
+    if (Stk_EdgeQty >= STK_EDGE_MAX) {
+        fprintf(stderr, "os_stk_analyze: more than %u calls\n", STK_EDGE_MAX);
+        exit(EXIT_FAILURE);
+    }
+    edge                         = (long)Stk_EdgeQty++;
+    Stk_EdgeTbl[edge].Callee     = callee;
+    Stk_EdgeTbl[edge].Next       = Stk_FnctTbl[caller].EdgeHead;
+    Stk_FnctTbl[caller].EdgeHead = edge;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                 CALL GRAPH PARSING
+*
+* Note(s) : (1) GCC writes one node per line, the label of a function it compiled ends with its frame:
+*
+*                   node: { title: "f" label: "f\nfile.c:3:5\n176 bytes (static)" }
+*                   edge: { sourcename: "f" targetname: "g" label: "file.c:4:12" }
+*
+*               The qualifier is 'static', 'dynamic' or 'dynamic,bounded'.  A bounded dynamic frame is already counted
+*               at its bound.  The functions the file only calls are nodes without a frame.
+**************************************************************************************************************************
+*/
+
+static  int  Stk_FieldGet (const  char  *p_line,               /* Copy the quoted value of a field of a node or edge   */
+                           const  char  *p_field,
+                           char         *p_val,
+                           size_t        len)
+{
+    const  char  *p_str;
+    size_t        ix;
+
+
+    p_str = strstr(p_line, p_field);
+    if (p_str == NULL) {
+        return (0);
+    }
+    p_str = strchr(p_str + strlen(p_field), '"');
+    if (p_str == NULL) {
+        return (0);
+    }
+    p_str++;
+    for (ix = 0u; (p_str[ix] != '"') && (p_str[ix] != '\0'); ix++) {
+        if (ix >= len - 1u) {
+            return (0);
+        }
+        p_val[ix] = p_str[ix];
+    }
+    p_val[ix] = '\0';
+    return (1);
+}
+
+
+static  void  Stk_CiLoad (const  char  *p_path)
+{
+    FILE           *p_file;
+    char            line[STK_LINE_LEN];
+    char            name[STK_NAME_LEN];
+    char            callee[STK_NAME_LEN];
+    char            label[STK_LINE_LEN];
+    const  char    *p_bytes;
+    const  char    *p_start;
+    unsigned  long  frame;
+    long            fnct;
+
+
+    p_file = fopen(p_path, "r");
+    if (p_file == NULL) {
+        perror(p_path);
+        exit(EXIT_FAILURE);
+    }
+
+    while (fgets(line, sizeof(line), p_file) != NULL) {
+        if (strncmp(line, "node:", 5u) == 0) {
+            if ((Stk_FieldGet(line, "title:", name,  sizeof(name))  == 0) ||
+                (Stk_FieldGet(line, "label:", label, sizeof(label)) == 0)) {
+                continue;
+            }
+            if (strcmp(name, STK_INDIRECT) == 0) {
+                continue;
+            }
+            fnct    = Stk_FnctGet(name);
+            p_bytes = strstr(label, " bytes (");
+            if (p_bytes == NULL) {                              /* Called only, the frame is in another file            */
+                continue;
+            }
+            p_start = p_bytes;
+            while ((p_start > label) && (p_start[-1] >= '0') && (p_start[-1] <= '9')) {
+                p_start--;
+            }
+            frame = strtoul(p_start, NULL, 10);
+            Stk_FnctTbl[fnct].Frame = frame;
+            Stk_FnctTbl[fnct].Known = 1u;
+            if ((strncmp(p_bytes, " bytes (dynamic", 15u) == 0) &&
+                (strstr(p_bytes, "bounded")               == NULL)) {
+                Stk_FnctTbl[fnct].Flags |= STK_FLAG_DYNAMIC;
+            }
+
+        } else if (strncmp(line, "edge:", 5u) == 0) {
+            if ((Stk_FieldGet(line, "sourcename:", name,   sizeof(name))   == 0) ||
+                (Stk_FieldGet(line, "targetname:", callee, sizeof(callee)) == 0)) {
+                continue;
+            }
+            fnct = Stk_FnctGet(name);
+            if (strcmp(callee, STK_INDIRECT) == 0) {
+                Stk_FnctTbl[fnct].Flags |= STK_FLAG_INDIRECT;
+            } else {
+                Stk_EdgeAdd(fnct, Stk_FnctGet(callee));
+            }
+        }
+    }
+    fclose(p_file);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                 TASKS FILE PARSING
+**************************************************************************************************************************
+*/
+
+static  void  Stk_TasksLoad (const  char  *p_path)
+{
+    FILE           *p_file;
+    char            line[STK_LINE_LEN];
+    char            kw[16];
+    char            arg1[STK_NAME_LEN];
+    char            arg2[STK_NAME_LEN];
+    char            arg3[16];
+    char           *p_comment;
+    int             nbr;
+    unsigned  long  line_nbr;
+    unsigned  long  ix;
+    long            fnct;
+    STK_TASK       *p_task;
+
+
+    p_file = fopen(p_path, "r");
+    if (p_file == NULL) {
+        perror(p_path);
+        exit(EXIT_FAILURE);
+    }
+
+    line_nbr = 0u;
+    while (fgets(line, sizeof(line), p_file) != NULL) {
+        line_nbr++;
+        p_comment = strchr(line, '#');
+        if (p_comment != NULL) {
+           *p_comment = '\0';
+        }
+        arg3[0] = '\0';
+        nbr     = sscanf(line, "%15s %127s %127s %15s", kw, arg1, arg2, arg3);
+        if (nbr <= 0) {
+            continue;
+        }
+
+        if ((strcmp(kw, "task") == 0) && (nbr >= 3)) {
+            if (Stk_TaskQty >= STK_TASK_MAX) {
+                fprintf(stderr, "%s:%lu: more than %u tasks\n", p_path, line_nbr, STK_TASK_MAX);
+                exit(EXIT_FAILURE);
+            }
+            p_task       = &Stk_TaskTbl[Stk_TaskQty++];
+            p_task->Fnct = Stk_FnctGet(arg1);
+            p_task->Size = strtoul(arg2, NULL, 0);
+            p_task->Used = 0u;
+            p_task->FP   = (strcmp(arg3, "fp") == 0) ? 1u : 0u;
+
+        } else if ((strcmp(kw, "used") == 0) && (nbr == 3)) {
+            fnct = Stk_FnctGet(arg1);
+            for (ix = 0u; ix < Stk_TaskQty; ix++) {
+                if (Stk_TaskTbl[ix].Fnct == fnct) {
+                    Stk_TaskTbl[ix].Used = strtoul(arg2, NULL, 0);
+                    break;
+                }
+            }
+            if (ix == Stk_TaskQty) {
+                fprintf(stderr, "%s:%lu: '%s' is not a task\n", p_path, line_nbr, arg1);
+                exit(EXIT_FAILURE);
+            }
+
+        } else if ((strcmp(kw, "stack") == 0) && (nbr == 3)) {
+            fnct = Stk_FnctGet(arg1);
+            Stk_FnctTbl[fnct].Frame = strtoul(arg2, NULL, 0);
+            Stk_FnctTbl[fnct].Known = 1u;
+
+        } else if ((strcmp(kw, "calls") == 0) && (nbr == 3)) {
+            fnct = Stk_FnctGet(arg1);
+            Stk_EdgeAdd(fnct, Stk_FnctGet(arg2));
+            Stk_FnctTbl[fnct].Resolved = 1u;
+
+        } else {
+            fprintf(stderr, "%s:%lu: syntax error\n", p_path, line_nbr);
+            exit(EXIT_FAILURE);
+        }
+    }
+    fclose(p_file);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                 WORST CASE DEPTH
+*
+* Note(s) : (1) The depth of a function is its frame plus the deepest depth of its callees, computed once per function.
+*               A callee found on the current path is a recursion: the edge is not followed and the path is flagged.
+**************************************************************************************************************************
+*/
+
+static  void  Stk_DepthCalc (long  fnct)
+{
+    STK_FNCT        *p_fnct;
+    STK_FNCT        *p_callee;
+    long             edge;
+    unsigned  long   depth_max;
+    unsigned  int    flags;
+
+
+    p_fnct        = &Stk_FnctTbl[fnct];
+    p_fnct->State = STK_STATE_OPEN;
+    flags         = p_fnct->Flags;
+    if (p_fnct->Resolved != 0u) {
+        flags &= ~STK_FLAG_INDIRECT;
+    }
+    if (p_fnct->Known == 0u) {
+        flags |= STK_FLAG_UNKNOWN;
+    }
+
+    depth_max = 0u;
+    for (edge = p_fnct->EdgeHead; edge >= 0; edge = Stk_EdgeTbl[edge].Next) {
+        p_callee = &Stk_FnctTbl[Stk_EdgeTbl[edge].Callee];
+        if (p_callee->State == STK_STATE_OPEN) {                /* See Note #1.                                         */
+            flags |= STK_FLAG_RECURSION;
+            continue;
+        }
+        if (p_callee->State == STK_STATE_NEW) {
+            Stk_DepthCalc(Stk_EdgeTbl[edge].Callee);
+        }
+        flags |= p_callee->DepthFlags;
+        if ((p_callee->Depth > depth_max) || (p_fnct->DepthNext < 0)) {
+            depth_max         = p_callee->Depth;
+            p_fnct->DepthNext = Stk_EdgeTbl[edge].Callee;
+        }
+    }
+
+    p_fnct->Depth      = p_fnct->Frame + depth_max;
+    p_fnct->DepthFlags = flags;
+    p_fnct->State      = STK_STATE_DONE;
+}
+
+
+static  void  Stk_FlagsStr (unsigned  int   flags,
+                            char           *p_str)
+{
+    p_str[0] = ((flags & STK_FLAG_RECURSION) != 0u) ? 'R' : '-';
+    p_str[1] = ((flags & STK_FLAG_INDIRECT)  != 0u) ? 'I' : '-';
+    p_str[2] = ((flags & STK_FLAG_DYNAMIC)   != 0u) ? 'D' : '-';
+    p_str[3] = ((flags & STK_FLAG_UNKNOWN)   != 0u) ? 'U' : '-';
+    p_str[4] = '\0';
+}
+
+
+static  void  Stk_PathPrint (long  fnct)                        /* Print the deepest path from a task entry             */
+{
+    STK_FNCT  *p_fnct;
+    char       flags[5];
+
+
+    while (fnct >= 0) {
+        p_fnct = &Stk_FnctTbl[fnct];
+        Stk_FlagsStr(p_fnct->Flags | ((p_fnct->Known == 0u) ? STK_FLAG_UNKNOWN : 0u), flags);
+        printf("      %6lu %6lu  %s  %s\n", p_fnct->Depth, p_fnct->Frame, flags, p_fnct->Name);
+        fnct = p_fnct->DepthNext;
+    }
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                      main()
+**************************************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    int             arg;
+    int             verbose;
+    unsigned  long  redzone;
+    unsigned  long  ix;
+    unsigned  long  bound;
+    unsigned  long  need;
+    unsigned  long  suggest;
+    long            margin;
+    int             fail;
+    STK_TASK       *p_task;
+    STK_FNCT       *p_fnct;
+    char            flags[5];
+    char            used[24];
+
+
+    verbose = 0;
+    redzone = 0u;
+    for (arg = 1; (arg < argc) && (argv[arg][0] == '-'); arg++) {
+        if (strcmp(argv[arg], "-v") == 0) {
+            verbose = 1;
+        } else if ((strcmp(argv[arg], "-r") == 0) && (arg + 1 < argc)) {
+            redzone = strtoul(argv[++arg], NULL, 0);
+        } else {
+            break;
+        }
+    }
+    if (argc - arg < 2) {
+        fprintf(stderr, "usage: os_stk_analyze [-v] [-r <redzone_depth>] <tasks_file> <file.ci> ...\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (ix = (unsigned long)arg + 1u; ix < (unsigned long)argc; ix++) {
+        Stk_CiLoad(argv[ix]);
+    }
+    Stk_TasksLoad(argv[arg]);                                   /* After the graphs: 'stack' lines override the frames  */
+
+    printf("Task                                  Bound    Size    Used  Margin  Suggest  Flags\n");
+    printf("                                    (bytes) (bytes) (bytes) (bytes)   (elem)\n");
+    fail = 0;
+    for (ix = 0u; ix < Stk_TaskQty; ix++) {
+        p_task = &Stk_TaskTbl[ix];
+        p_fnct = &Stk_FnctTbl[p_task->Fnct];
+        if (p_fnct->State == STK_STATE_NEW) {
+            Stk_DepthCalc(p_task->Fnct);
+        }
+        bound   = p_fnct->Depth
+                + ((p_task->FP != 0u) ? STK_FRAME_FP : STK_FRAME_INT)
+                + (redzone * STK_ELEM_SIZE);
+        need    = (p_task->Used > bound) ? p_task->Used : bound;
+        suggest = (need + STK_ELEM_SIZE - 1u) / STK_ELEM_SIZE;
+        suggest = (suggest + 1u) & ~1ul;                        /* Keep the stack 8-byte aligned (AAPCS)                */
+        margin  = (long)p_task->Size - (long)bound;
+        Stk_FlagsStr(p_fnct->DepthFlags, flags);
+        if (p_task->Used != 0u) {
+            snprintf(used, sizeof(used), "%lu", p_task->Used);
+        } else {
+            snprintf(used, sizeof(used), "-");
+        }
+        printf("%-34.34s %8lu %7lu %7s %7ld %8lu  %s%s\n",
+               p_fnct->Name,
+               bound,
+               p_task->Size,
+               used,
+               margin,
+               suggest,
+               flags,
+               ((margin < 0) || (p_task->Used > p_task->Size)) ? "  OVERFLOW" : "");
+        if ((margin < 0) || (p_task->Used > p_task->Size)) {
+            fail = 1;
+        }
+        if (p_task->Used > bound) {                             /* The graph misses calls, the bound is not one         */
+            printf("%-34s the high-water mark exceeds the bound\n", "");
+        }
+        if (verbose != 0) {
+            printf("       depth  frame  flags  function\n");
+            Stk_PathPrint(p_task->Fnct);
+        }
+    }
+
+    printf("\nFunctions that leave a bound open (see Note #4):\n");
+    for (ix = 0u; ix < Stk_FnctQty; ix++) {
+        p_fnct = &Stk_FnctTbl[ix];
+        if (p_fnct->State != STK_STATE_DONE) {
+            continue;
+        }
+        if ((p_fnct->Known == 0u) ||
+            ((p_fnct->Flags & STK_FLAG_DYNAMIC) != 0u) ||
+           (((p_fnct->Flags & STK_FLAG_INDIRECT) != 0u) && (p_fnct->Resolved == 0u))) {
+            Stk_FlagsStr((p_fnct->Flags & ((p_fnct->Resolved != 0u) ? ~STK_FLAG_INDIRECT : ~0u))
+                       | ((p_fnct->Known == 0u) ? STK_FLAG_UNKNOWN : 0u), flags);
+            printf("    %s  %s\n", flags, p_fnct->Name);
+        }
+    }
+
+    return ((fail != 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
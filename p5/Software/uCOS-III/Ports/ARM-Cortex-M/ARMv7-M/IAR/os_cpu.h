@@ -90,6 +90,8 @@ extern  "C" {                                    /* See Note #1.
 
 #define  OS_TASK_SW_SYNC()          __ISB()
 
+#define  OS_CPU_INT_NBR_GET()      ((CPU_INT16U)(__get_IPSR() & 0x1FFu))/* Exception number of the running ISR        */
+
 
 /*
 *********************************************************************************************************
@@ -150,6 +152,52 @@ extern  "C" {                                    /* See Note #1.
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                   MPU STACK GUARD CONFIGURATION
+*
+* Note(s) : (1) When OS_CPU_CFG_STK_GUARD_EN is enabled, OSTaskSwHook() moves one MPU region over the
+*               bottom of the stack of the task being switched in.  The region is read-only : the first
+*               write past the bottom of the stack (a push, a local variable or the exception frame)
+*               raises a MemManage fault instead of overwriting the memory below the stack.  Reading
+*               the guard stays allowed for OSTaskStkChk() and the stack scans.
+*
+*           (2) The guard is the lowest OS_CPU_CFG_STK_GUARD_SIZE bytes block of the stack aligned on
+*               its size.  It is part of the stack : a stack aligned on OS_CPU_CFG_STK_GUARD_SIZE
+*               loses OS_CPU_CFG_STK_GUARD_SIZE bytes, another one up to twice as much.  A function
+*               whose frame is larger than the guard can skip over it.
+*
+*           (3) The guard uses region OS_CPU_CFG_STK_GUARD_REGION, the highest numbered region takes
+*               precedence over the others.  The background map stays enabled for privileged code.
+*
+*           (4) The MemManage fault vector must call OS_CPU_MemManageHandler().
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_CFG_STK_GUARD_EN
+#define  OS_CPU_CFG_STK_GUARD_EN           DEF_DISABLED
+#endif
+
+#ifndef  OS_CPU_CFG_STK_GUARD_SIZE
+#define  OS_CPU_CFG_STK_GUARD_SIZE        32u               /* Power of 2, 32 bytes minimum (see Note #2).        */
+#endif
+
+#ifndef  OS_CPU_CFG_STK_GUARD_REGION
+#define  OS_CPU_CFG_STK_GUARD_REGION       7u               /* See Note #3.                                       */
+#endif
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+#if ((OS_CPU_CFG_STK_GUARD_SIZE < 32u) || \
+    ((OS_CPU_CFG_STK_GUARD_SIZE & (OS_CPU_CFG_STK_GUARD_SIZE - 1u)) != 0u))
+#error  "os_cpu.h, OS_CPU_CFG_STK_GUARD_SIZE MUST be a power of 2, 32 or more"
+#endif
+
+#if (OS_CPU_CFG_STK_GUARD_REGION > 7u)
+#error  "os_cpu.h, OS_CPU_CFG_STK_GUARD_REGION MUST be <= 7"
+#endif
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -158,6 +206,10 @@ extern  "C" {                                    /* See Note #1.
 
 OS_CPU_EXT  CPU_STK  *OS_CPU_ExceptStkBase;
 
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+OS_CPU_EXT  struct  os_tcb  *OS_CPU_StkGuardHitTCBPtr;         /* Task whose stack overflowed into its guard         */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -177,9 +229,10 @@ void  OS_CPU_SysTickInitFreq(CPU_INT32U  cpu_freq);
 void  OS_CPU_SysTickHandler(void);
 void  OS_CPU_PendSVHandler (void);
 
-#if (OS_CPU_ARM_FP_EN > 0u)
-void  OS_CPU_FP_Reg_Push(CPU_STK  *stkPtr);
-void  OS_CPU_FP_Reg_Pop (CPU_STK  *stkPtr);
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+void  OS_CPU_StkGuardInit    (void);
+void  OS_CPU_StkGuardSet     (CPU_STK  *p_stk_base);
+void  OS_CPU_MemManageHandler(void);
 #endif
 
 
@@ -45,11 +45,6 @@
     PUBLIC  OSIntCtxSw
     PUBLIC  OS_CPU_PendSVHandler
 
-#ifdef __ARMVFP__
-    PUBLIC  OS_CPU_FP_Reg_Push
-    PUBLIC  OS_CPU_FP_Reg_Pop
-#endif
-
 
 ;********************************************************************************************************
 ;                                               EQUATES
@@ -59,6 +54,8 @@ NVIC_INT_CTRL   EQU     0xE000ED04                              ; Interrupt cont
 NVIC_SYSPRI14   EQU     0xE000ED22                              ; System priority register (priority 14).
 NVIC_PENDSV_PRI EQU           0xFF                              ; PendSV priority value (lowest).
 NVIC_PENDSVSET  EQU     0x10000000                              ; Value to trigger PendSV exception.
+EXC_RETURN_FTYPE EQU          0x10                              ; EXC_RETURN bit clear: FP state stacked on exception.
+CONTROL_FPCA    EQU           0x04                              ; CONTROL bit set: FP context active.
 
 
 ;********************************************************************************************************
@@ -69,52 +66,6 @@ NVIC_PENDSVSET  EQU     0x10000000                              ; Value to trigg
     THUMB
 
 
-;********************************************************************************************************
-;                                   FLOATING POINT REGISTERS PUSH
-;                             void  OS_CPU_FP_Reg_Push (CPU_STK  *stkPtr)
-;
-; Note(s) : 1) This function saves S16-S31 registers of the Floating Point Unit.
-;
-;           2) Pseudo-code is:
-;              a) Push remaining FPU regs S16-S31 on process stack;
-;              b) Update OSTCBCurPtr->StkPtr;
-;********************************************************************************************************
-
-#ifdef __ARMVFP__
-OS_CPU_FP_Reg_Push
-    MRS     R1, PSP                                             ; PSP is process stack pointer
-    CBZ     R1, OS_CPU_FP_nosave                                ; Skip FP register save the first time
-
-    VSTMDB  R0!, {S16-S31}
-    LDR     R1, =OSTCBCurPtr
-    LDR     R2, [R1]
-    STR     R0, [R2]
-OS_CPU_FP_nosave
-    BX      LR
-#endif
-
-
-;********************************************************************************************************
-;                                   FLOATING POINT REGISTERS POP
-;                             void  OS_CPU_FP_Reg_Pop (CPU_STK  *stkPtr)
-;
-; Note(s) : 1) This function restores S16-S31 of the Floating Point Unit.
-;
-;           2) Pseudo-code is:
-;              a) Restore regs S16-S31 of new process stack;
-;              b) Update OSTCBHighRdyPtr->StkPtr pointer of new proces stack;
-;********************************************************************************************************
-
-#ifdef __ARMVFP__
-OS_CPU_FP_Reg_Pop
-    VLDMIA  R0!, {S16-S31}
-    LDR     R1, =OSTCBHighRdyPtr
-    LDR     R2, [R1]
-    STR     R0, [R2]
-    BX      LR
-#endif
-
-
 ;********************************************************************************************************
 ;                                         START MULTITASKING
 ;                                      void OSStartHighRdy(void)
@@ -134,6 +85,10 @@ OS_CPU_FP_Reg_Pop
 ;              f) Get new process SP from TCB, SP = OSTCBHighRdyPtr->StkPtr;
 ;              g) Restore R0-R11 and R14 from new process stack;
 ;              h) Enable interrupts (tasks will run with interrupts enabled).
+;
+;           4) CONTROL.FPCA is cleared so that the first task does not inherit the FP context of main().
+;              S16-S31 of a task created with OS_OPT_TASK_SAVE_FP are skipped: they only hold the values
+;              set by OSTaskStkInit().
 ;********************************************************************************************************
 
 OSStartHighRdy
@@ -149,7 +104,7 @@ OSStartHighRdy
     LDR     R1, [R0]
     MSR     MSP, R1
 
-    BL      OSTaskSwHook                                        ; Call OSTaskSwHook() for FPU Push & Pop
+    BL      OSTaskSwHook                                        ; Call OSTaskSwHook()
 
     MOV32   R0, OSPrioCur                                       ; OSPrioCur   = OSPrioHighRdy;
     MOV32   R1, OSPrioHighRdy
@@ -166,10 +121,18 @@ OSStartHighRdy
 
     MRS     R0, CONTROL
     ORR     R0, R0, #2
+#ifdef __ARMVFP__
+    BIC     R0, R0, #CONTROL_FPCA                               ; No FP context yet, see Note #4
+#endif
     MSR     CONTROL, R0
     ISB                                                         ; Sync instruction stream
 
     LDMFD    SP!, {R4-R11, LR}                                  ; Restore r4-11, lr from new process stack
+#ifdef __ARMVFP__
+    TST      LR, #EXC_RETURN_FTYPE                              ; Skip S16-S31 of a FP frame, see Note #4
+    IT       EQ
+    ADDEQ    SP, SP, #0x40
+#endif
     LDMFD    SP!, {R0-R3}                                       ; Restore r0, r3
     LDMFD    SP!, {R12, LR}                                     ; Load R12 and LR
     LDMFD    SP!, {R1, R2}                                      ; Load PC and discard xPSR
@@ -219,14 +182,16 @@ OSIntCtxSw
 ;
 ;           2) Pseudo-code is:
 ;              a) Get the process SP
-;              b) Save remaining regs r4-r11 & r14 on process stack;
-;              c) Save the process SP in its TCB, OSTCBCurPtr->OSTCBStkPtr = SP;
-;              d) Call OSTaskSwHook();
-;              e) Get current high priority, OSPrioCur = OSPrioHighRdy;
-;              f) Get current ready thread TCB, OSTCBCurPtr = OSTCBHighRdyPtr;
-;              g) Get new process SP from TCB, SP = OSTCBHighRdyPtr->OSTCBStkPtr;
-;              h) Restore R4-R11 and R14 from new process stack;
-;              i) Perform exception return which will restore remaining context.
+;              b) Save S16-S31 on process stack if the task has a FP context;
+;              c) Save remaining regs r4-r11 & r14 on process stack;
+;              d) Save the process SP in its TCB, OSTCBCurPtr->OSTCBStkPtr = SP;
+;              e) Call OSTaskSwHook();
+;              f) Get current high priority, OSPrioCur = OSPrioHighRdy;
+;              g) Get current ready thread TCB, OSTCBCurPtr = OSTCBHighRdyPtr;
+;              h) Get new process SP from TCB, SP = OSTCBHighRdyPtr->OSTCBStkPtr;
+;              i) Restore R4-R11 and R14 from new process stack;
+;              j) Restore S16-S31 from new process stack if the task has a FP context;
+;              k) Perform exception return which will restore remaining context.
 ;
 ;           3) On entry into PendSV handler:
 ;              a) The following have been saved on the process stack (by processor):
@@ -239,11 +204,27 @@ OSIntCtxSw
 ;           4) Since PendSV is set to lowest priority in the system (by OSStartHighRdy() above), we
 ;              know that it will only be run when no other exception or interrupt is active, and
 ;              therefore safe to assume that context being switched out was using the process stack (PSP).
+;
+;           5) The FP registers are saved lazily (FPCCR.ASPEN and FPCCR.LSPEN set, see OSInitHook()) :
+;              a) A task has a FP context once it executes a FP instruction (CONTROL.FPCA set).  The core
+;                 then reserves room for S0-S15 and FPSCR in the exception frame and clears bit 4 of
+;                 EXC_RETURN.  A task which never uses the FPU has a basic frame and nothing else saved.
+;              b) S0-S15 are only written to the reserved room when a FP instruction runs in the handler,
+;                 here the VSTMDB of S16-S31.
+;              c) EXC_RETURN is saved with R4-R11 so that each task resumes with its own frame type.
+;
+;           6) The exception return value is always the one saved by the task being resumed : the LR of
+;              PendSV itself is not kept across OSTaskSwHook().
 ;********************************************************************************************************
 
 OS_CPU_PendSVHandler
     CPSID   I                                                   ; Prevent interruption during context switch
     MRS     R0, PSP                                             ; PSP is process stack pointer
+#ifdef __ARMVFP__
+    TST     R14, #EXC_RETURN_FTYPE                              ; Save S16-S31 if the task has a FP context
+    IT      EQ                                                  ; ... see Note #5
+    VSTMDBEQ R0!, {S16-S31}
+#endif
     STMFD   R0!, {R4-R11, R14}                                  ; Save remaining regs r4-11, R14 on process stack
 
     MOV32   R5, OSTCBCurPtr                                     ; OSTCBCurPtr->StkPtr = SP;
@@ -251,8 +232,7 @@ OS_CPU_PendSVHandler
     STR     R0, [R1]                                            ; R0 is SP of process being switched out
 
                                                                 ; At this point, entire context of process has been saved
-    MOV     R4, LR                                              ; Save LR exc_return value
-    BL      OSTaskSwHook                                        ; Call OSTaskSwHook() for FPU Push & Pop
+    BL      OSTaskSwHook                                        ; Call OSTaskSwHook()
 
     MOV32   R0, OSPrioCur                                       ; OSPrioCur   = OSPrioHighRdy;
     MOV32   R1, OSPrioHighRdy
@@ -263,9 +243,13 @@ OS_CPU_PendSVHandler
     LDR     R2, [R1]
     STR     R2, [R5]
 
-    ORR     LR,  R4, #0x04                                      ; Ensure exception return uses process stack
     LDR     R0,  [R2]                                           ; R0 is new process SP; SP = OSTCBHighRdyPtr->StkPtr;
-    LDMFD   R0!, {R4-R11, R14}                                  ; Restore r4-11, R14 from new process stack
+    LDMFD   R0!, {R4-R11, R14}                                  ; Restore r4-11, R14 from new process stack, see Note #6
+#ifdef __ARMVFP__
+    TST     R14, #EXC_RETURN_FTYPE                              ; Restore S16-S31 if the task has a FP context
+    IT      EQ
+    VLDMIAEQ R0!, {S16-S31}
+#endif
     MSR     PSP, R0                                             ; Load PSP with new process SP
     CPSIE   I
     BX      LR                                                  ; Exception return will restore remaining context
@@ -77,6 +77,48 @@ extern  "C" {
                                                                         /* ..automatic state saving.                   */
 #define  CPU_REG_FPCCR_LAZY_STK                        0xC0000000uL
 
+                                                                        /* EXC_RETURN bit clear: FP context stacked.   */
+#define  CPU_REG_EXC_RETURN_FTYPE                      0x00000010uL
+                                                                        /* EXC_RETURN saved above R4-R11 by PendSV.    */
+#define  OS_CPU_STK_EXC_RETURN_IX                               8u
+
+
+/*
+*********************************************************************************************************
+*                                         MPU STACK GUARD DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+#define  CPU_REG_MPU_CTRL_ENABLE                       0x00000001uL
+#define  CPU_REG_MPU_CTRL_PRIVDEFENA                   0x00000004uL
+
+#define  CPU_REG_MPU_RBAR_VALID                        0x00000010uL
+                                                                        /* Region attributes of the guard:             */
+#define  CPU_REG_MPU_RASR_XN                           0x10000000uL     /* ... no instruction fetch,                   */
+#define  CPU_REG_MPU_RASR_AP_RO                        0x06000000uL     /* ... read-only, privileged or not,           */
+#define  CPU_REG_MPU_RASR_C_B                          0x00030000uL     /* ... normal memory, write-back like SRAM.    */
+#define  CPU_REG_MPU_RASR_ENABLE                       0x00000001uL
+
+#define  CPU_REG_NVIC_CFSR_MLSPERR                     0x00000020uL     /* Fault on the lazy FP state preservation.    */
+#define  CPU_REG_NVIC_CFSR_MMFSR                       0x000000FFuL
+
+                                                                        /* Guard of a stack: first aligned block.      */
+#define  OS_CPU_STK_GUARD_ADDR(p_stk_base)     ((((CPU_ADDR)(p_stk_base)) + (OS_CPU_CFG_STK_GUARD_SIZE - 1u)) \
+                                                 & ~((CPU_ADDR)OS_CPU_CFG_STK_GUARD_SIZE - 1u))
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+static  CPU_INT32U  OS_CPU_StkGuardAttr;                                /* Value of the RASR for the guard region.     */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -112,6 +154,8 @@ void  OSIdleTaskHook (void)
 * Note(s)    : 1) When using hardware floating point please do the following during the reset handler:
 *                 a) Set full access for CP10 & CP11 bits in CPACR register.
 *                 b) Set bits ASPEN and LSPEN in FPCCR register.
+*
+*              2) The MPU is enabled here, before any task runs, when OS_CPU_CFG_STK_GUARD_EN is enabled.
 *********************************************************************************************************
 */
 
@@ -124,6 +168,10 @@ void  OSInitHook (void)
     OS_CPU_ExceptStkBase = (CPU_STK *)(OSCfg_ISRStkBasePtr + OSCfg_ISRStkSize);
     OS_CPU_ExceptStkBase = (CPU_STK *)((CPU_STK)(OS_CPU_ExceptStkBase) & 0xFFFFFFF8);
 
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+    OS_CPU_StkGuardInit();                                      /* See Note (2).                                        */
+#endif
+
 #if (OS_CPU_ARM_FP_EN > 0u)
     reg_val = CPU_REG_FP_FPCCR;                                 /* Check the floating point mode.                       */
     if ((reg_val & CPU_REG_FPCCR_LAZY_STK) != CPU_REG_FPCCR_LAZY_STK) {
@@ -285,21 +333,24 @@ void  OSTaskReturnHook (OS_TCB  *p_tcb)
 *
 *              (2) All tasks run in Thread mode, using process stack.
 *
-*              (3) There are two different stack frames depending on whether the Floating-Point(FP)
-*                  co-processor is enabled or not.
+*              (3) There are two different stack frames depending on whether the task uses the Floating-Point(FP)
+*                  co-processor or not, see 'os_cpu_a.asm  OS_CPU_PendSVHandler()  Note #5'.
 *
-*                  (a) The stack frame shown in the diagram is used when the Co-processor Access Control
-*                      Register(CPACR) is disabling the Floating Point Unit. In this case, the FP
-*                      registers(S0- S31) & FP Status Control(FPSCR) register are not saved in the stack frame.
+*                  (a) The stack frame shown in the diagram is used when the Floating Point Unit is disabled or
+*                      when the task was not created with OS_OPT_TASK_SAVE_FP.  The FP registers(S0- S31) & FP
+*                      Status Control(FPSCR) register are not saved in the stack frame.  The frame switches to
+*                      (b) the first time the task executes a FP instruction.
 *
-*                  (b) The stack frame shown in the diagram is used when the Floating Point Unit is enabled,
-*                      that is, CP10 and CP11 field in CPACR are ones and FPCCR sets bits ASPEN and LSPEN to 1.
+*                  (b) The stack frame shown in the diagram is used for a task created with OS_OPT_TASK_SAVE_FP
+*                      when the Floating Point Unit is enabled, that is, CP10 and CP11 field in CPACR are ones
+*                      and FPCCR sets bits ASPEN and LSPEN to 1.
 *
 *                      (1) When enabling the FPU through CPACR, make sure to set bits ASPEN and LSPEN in the
 *                          Floating-Point Context Control Register (FPCCR).
 *
-*                                          +-------------+
-*                                          |             |
+*                      (2) S0-S15 and FPSCR are saved by the core, lazily.  S16-S31 are saved by
+*                          OS_CPU_PendSVHandler() above R4-R11 & EXEC_RETURN.
+*
 *                                          +-------------+
 *                                          |             |
 *                                          +-------------+
@@ -307,16 +358,10 @@ void  OSTaskReturnHook (OS_TCB  *p_tcb)
 *                                          +-------------+
 *                                          |     S15     |
 *                                          +-------------+
-*                                          |     S14     |
-*                                          +-------------+
-*                                          |     S13     |
-*                                          +-------------+
 *                                                .
 *                                                .
 *                                                .
 *                                          +-------------+
-*                                          |     S2      |
-*                                          +-------------+
 *                                          |     S1      |
 *                    +-------------+       +-------------+
 *                    |             |       |     S0      |
@@ -331,45 +376,29 @@ void  OSTaskReturnHook (OS_TCB  *p_tcb)
 *                    +-------------+       +-------------+
 *                    |    R3       |       |     R3      |
 *                    +-------------+       +-------------+
-*                    |    R2       |       |     R0      |
+*                    |    R2       |       |     R2      |
 *                    +-------------+       +-------------+
 *                    |    R1       |       |     R1      |
 *                    +-------------+       +-------------+
 *                    |    R0       |       |     R0      |
 *                    +-------------+       +-------------+
+*                          |               |     S31     |
+*                          |               +-------------+
+*                          |                     .
+*                          |                     .
+*                          |               +-------------+
+*                          |               |     S16     |
+*                    +-------------+       +-------------+
 *                    | EXEC_RETURN |       | EXEC_RETURN |
 *                    +-------------+       +-------------+
 *                    |    R11      |       |     R11     |
 *                    +-------------+       +-------------+
-*                    |    R10      |       |     R10     |
-*                    +-------------+       +-------------+
-*                    |    R9       |       |     R9      |
-*                    +-------------+       +-------------+
-*                    |    R8       |       |     R8      |
-*                    +-------------+       +-------------+
-*                    |    R7       |       |     R7      |
-*                    +-------------+       +-------------+
-*                    |    R6       |       |     R6      |
-*                    +-------------+       +-------------+
-*                    |    R5       |       |     R5      |
+*                                .                .
+*                                .                .
 *                    +-------------+       +-------------+
 *                    |    R4       |       |     R4      |
 *                    +-------------+       +-------------+
-*                          (a)             |     S31     |
-*                                          +-------------+
-*                                          |     S30     |
-*                                          +-------------+
-*                                          |     S29     |
-                                           +-------------+
-*                                                .
-*                                                .
-*                                                .
-*                                          +-------------+
-*                                          |     S17     |
-                                           +-------------+
-*                                          |     S16     |
-*                                          +-------------+
-*                                               (b)
+*                          (a)                   (b)
 *
 *             (4) The SP must be 8-byte aligned in conforming to the Procedure Call Standard for the ARM architecture
 *
@@ -447,32 +476,36 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
     CPU_STK    *p_stk;
 
 
+#if (OS_CPU_ARM_FP_EN == 0u)
     (void)opt;                                                  /* 'opt' is not used, prevent warning                   */
+#endif
 
     p_stk = &p_stk_base[stk_size];                              /* Load stack pointer                                   */
                                                                 /* Align the stack to 8-bytes.                          */
     p_stk = (CPU_STK *)((CPU_STK)(p_stk) & 0xFFFFFFF8u);
                                                                 /* Registers stacked as if auto-saved on exception      */
-#if (OS_CPU_ARM_FP_EN > 0u)                                     /* FPU auto-saved registers.                            */
-     --p_stk;
-    *(--p_stk) = (CPU_STK)0x02000000u;                          /* FPSCR                                                */
+#if (OS_CPU_ARM_FP_EN > 0u)
+    if ((opt & OS_OPT_TASK_SAVE_FP) != 0u) {                    /* FPU auto-saved registers, see Note 3b                */
+        --p_stk;
+        *(--p_stk) = (CPU_STK)0x02000000u;                      /* FPSCR                                                */
                                                                 /* Initialize S0-S15 floating point registers           */
-    *(--p_stk) = (CPU_STK)0x41700000u;                          /* S15                                                  */
-    *(--p_stk) = (CPU_STK)0x41600000u;                          /* S14                                                  */
-    *(--p_stk) = (CPU_STK)0x41500000u;                          /* S13                                                  */
-    *(--p_stk) = (CPU_STK)0x41400000u;                          /* S12                                                  */
-    *(--p_stk) = (CPU_STK)0x41300000u;                          /* S11                                                  */
-    *(--p_stk) = (CPU_STK)0x41200000u;                          /* S10                                                  */
-    *(--p_stk) = (CPU_STK)0x41100000u;                          /* S9                                                   */
-    *(--p_stk) = (CPU_STK)0x41000000u;                          /* S8                                                   */
-    *(--p_stk) = (CPU_STK)0x40E00000u;                          /* S7                                                   */
-    *(--p_stk) = (CPU_STK)0x40C00000u;                          /* S6                                                   */
-    *(--p_stk) = (CPU_STK)0x40A00000u;                          /* S5                                                   */
-    *(--p_stk) = (CPU_STK)0x40800000u;                          /* S4                                                   */
-    *(--p_stk) = (CPU_STK)0x40400000u;                          /* S3                                                   */
-    *(--p_stk) = (CPU_STK)0x40000000u;                          /* S2                                                   */
-    *(--p_stk) = (CPU_STK)0x3F800000u;                          /* S1                                                   */
-    *(--p_stk) = (CPU_STK)0x00000000u;                          /* S0                                                   */
+        *(--p_stk) = (CPU_STK)0x41700000u;                      /* S15                                                  */
+        *(--p_stk) = (CPU_STK)0x41600000u;                      /* S14                                                  */
+        *(--p_stk) = (CPU_STK)0x41500000u;                      /* S13                                                  */
+        *(--p_stk) = (CPU_STK)0x41400000u;                      /* S12                                                  */
+        *(--p_stk) = (CPU_STK)0x41300000u;                      /* S11                                                  */
+        *(--p_stk) = (CPU_STK)0x41200000u;                      /* S10                                                  */
+        *(--p_stk) = (CPU_STK)0x41100000u;                      /* S9                                                   */
+        *(--p_stk) = (CPU_STK)0x41000000u;                      /* S8                                                   */
+        *(--p_stk) = (CPU_STK)0x40E00000u;                      /* S7                                                   */
+        *(--p_stk) = (CPU_STK)0x40C00000u;                      /* S6                                                   */
+        *(--p_stk) = (CPU_STK)0x40A00000u;                      /* S5                                                   */
+        *(--p_stk) = (CPU_STK)0x40800000u;                      /* S4                                                   */
+        *(--p_stk) = (CPU_STK)0x40400000u;                      /* S3                                                   */
+        *(--p_stk) = (CPU_STK)0x40000000u;                      /* S2                                                   */
+        *(--p_stk) = (CPU_STK)0x3F800000u;                      /* S1                                                   */
+        *(--p_stk) = (CPU_STK)0x00000000u;                      /* S0                                                   */
+    }
 #endif
     *(--p_stk) = (CPU_STK)0x01000000u;                          /* xPSR                                                 */
     *(--p_stk) = (CPU_STK)p_task;                               /* Entry Point                                          */
@@ -484,7 +517,28 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
     *(--p_stk) = (CPU_STK)p_arg;                                /* R0 : argument                                        */
 
 #if (OS_CPU_ARM_FP_EN > 0u)
-    *(--p_stk) = (CPU_STK)0xFFFFFFEDuL;                         /* R14: EXEC_RETURN; See Note 5                         */
+    if ((opt & OS_OPT_TASK_SAVE_FP) != 0u) {
+                                                                /* Initialize S16-S31 floating point registers          */
+        *(--p_stk) = (CPU_STK)0x41F80000u;                      /* S31                                                  */
+        *(--p_stk) = (CPU_STK)0x41F00000u;                      /* S30                                                  */
+        *(--p_stk) = (CPU_STK)0x41E80000u;                      /* S29                                                  */
+        *(--p_stk) = (CPU_STK)0x41E00000u;                      /* S28                                                  */
+        *(--p_stk) = (CPU_STK)0x41D80000u;                      /* S27                                                  */
+        *(--p_stk) = (CPU_STK)0x41D00000u;                      /* S26                                                  */
+        *(--p_stk) = (CPU_STK)0x41C80000u;                      /* S25                                                  */
+        *(--p_stk) = (CPU_STK)0x41C00000u;                      /* S24                                                  */
+        *(--p_stk) = (CPU_STK)0x41B80000u;                      /* S23                                                  */
+        *(--p_stk) = (CPU_STK)0x41B00000u;                      /* S22                                                  */
+        *(--p_stk) = (CPU_STK)0x41A80000u;                      /* S21                                                  */
+        *(--p_stk) = (CPU_STK)0x41A00000u;                      /* S20                                                  */
+        *(--p_stk) = (CPU_STK)0x41980000u;                      /* S19                                                  */
+        *(--p_stk) = (CPU_STK)0x41900000u;                      /* S18                                                  */
+        *(--p_stk) = (CPU_STK)0x41880000u;                      /* S17                                                  */
+        *(--p_stk) = (CPU_STK)0x41800000u;                      /* S16                                                  */
+        *(--p_stk) = (CPU_STK)0xFFFFFFEDuL;                     /* R14: EXEC_RETURN; See Note 5                         */
+    } else {
+        *(--p_stk) = (CPU_STK)0xFFFFFFFDuL;                     /* R14: EXEC_RETURN; See Note 5                         */
+    }
 #else
     *(--p_stk) = (CPU_STK)0xFFFFFFFDuL;                         /* R14: EXEC_RETURN; See Note 5                         */
 #endif
@@ -498,26 +552,6 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
     *(--p_stk) = (CPU_STK)0x05050505uL;                         /* R5                                                   */
     *(--p_stk) = (CPU_STK)0x04040404uL;                         /* R4                                                   */
 
-#if (OS_CPU_ARM_FP_EN > 0u)
-                                                                /* Initialize S16-S31 floating point registers          */
-    *(--p_stk) = (CPU_STK)0x41F80000u;                          /* S31                                                  */
-    *(--p_stk) = (CPU_STK)0x41F00000u;                          /* S30                                                  */
-    *(--p_stk) = (CPU_STK)0x41E80000u;                          /* S29                                                  */
-    *(--p_stk) = (CPU_STK)0x41E00000u;                          /* S28                                                  */
-    *(--p_stk) = (CPU_STK)0x41D80000u;                          /* S27                                                  */
-    *(--p_stk) = (CPU_STK)0x41D00000u;                          /* S26                                                  */
-    *(--p_stk) = (CPU_STK)0x41C80000u;                          /* S25                                                  */
-    *(--p_stk) = (CPU_STK)0x41C00000u;                          /* S24                                                  */
-    *(--p_stk) = (CPU_STK)0x41B80000u;                          /* S23                                                  */
-    *(--p_stk) = (CPU_STK)0x41B00000u;                          /* S22                                                  */
-    *(--p_stk) = (CPU_STK)0x41A80000u;                          /* S21                                                  */
-    *(--p_stk) = (CPU_STK)0x41A00000u;                          /* S20                                                  */
-    *(--p_stk) = (CPU_STK)0x41980000u;                          /* S19                                                  */
-    *(--p_stk) = (CPU_STK)0x41900000u;                          /* S18                                                  */
-    *(--p_stk) = (CPU_STK)0x41880000u;                          /* S17                                                  */
-    *(--p_stk) = (CPU_STK)0x41800000u;                          /* S16                                                  */
-#endif
-
     return (p_stk);
 }
 
@@ -535,6 +569,11 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
 *              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
 *                 that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
 *                 to the task being switched out (i.e. the preempted task).
+*              3) The FP registers are saved and restored by OS_CPU_PendSVHandler(), only for the tasks
+*                 using the FPU.  A task switched out with a FP context gets OS_OPT_TASK_SAVE_FP in its
+*                 options : the flag tells which tasks need stack room for the FP frame.
+*              4) The MPU stack guard is moved to the stack of the task being switched in last, once the
+*                 hooks above no longer run on behalf of the task being switched out.
 *********************************************************************************************************
 */
 
@@ -550,8 +589,10 @@ void  OSTaskSwHook (void)
     CPU_BOOLEAN  stk_status;
 #endif
 
-#if (OS_CPU_ARM_FP_EN > 0u)
-    OS_CPU_FP_Reg_Push(OSTCBCurPtr->StkPtr);                    /* Push the FP registers of the current task.           */
+#if (OS_CPU_ARM_FP_EN > 0u)                                     /* See Note #3                                          */
+    if ((OSTCBCurPtr->StkPtr[OS_CPU_STK_EXC_RETURN_IX] & CPU_REG_EXC_RETURN_FTYPE) == 0u) {
+        OSTCBCurPtr->Opt |= OS_OPT_TASK_SAVE_FP;
+    }
 #endif
 
 #if OS_CFG_APP_HOOKS_EN > 0u
@@ -567,11 +608,22 @@ void  OSTaskSwHook (void)
     if (OSTCBCurPtr != OSTCBHighRdyPtr) {
         OSTCBCurPtr->CyclesDelta  = ts - OSTCBCurPtr->CyclesStart;
         OSTCBCurPtr->CyclesTotal += (OS_CYCLES)OSTCBCurPtr->CyclesDelta;
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+                                                                /* Charge the time slice, see OS_SchedRoundRobin()      */
+        OSTCBCurPtr->TimeQuantaCyclesUsed += OSTCBCurPtr->CyclesDelta;
+#endif
     }
 
     OSTCBHighRdyPtr->CyclesStart = ts;
 #endif
 
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+    if (OSLatISR_Pending == DEF_TRUE) {                         /* Task made ready by an ISR is being switched in       */
+        OSLatISR_Pending = DEF_FALSE;
+        OS_LatHistAdd(OS_LAT_HIST_ISR_TO_TASK, OS_TS_GET() - OSLatISR_TS);
+    }
+#endif
+
 #ifdef  CPU_CFG_INT_DIS_MEAS_EN
     int_dis_time = CPU_IntDisMeasMaxCurReset();                 /* Keep track of per-task interrupt disable time        */
     if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
@@ -595,8 +647,8 @@ void  OSTaskSwHook (void)
     }
 #endif
 
-#if (OS_CPU_ARM_FP_EN > 0u)
-    OS_CPU_FP_Reg_Pop(OSTCBHighRdyPtr->StkPtr);                 /* Pop the FP registers of the highest ready task.      */
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+    OS_CPU_StkGuardSet(OSTCBHighRdyPtr->StkBasePtr);            /* See Note #4                                          */
 #endif
 }
 
@@ -711,6 +763,144 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
     CPU_REG_NVIC_ST_CTRL  |= CPU_REG_NVIC_ST_CTRL_TICKINT;
 }
 
+
+/*
+*********************************************************************************************************
+*                                      INITIALIZE THE STACK GUARD
+*
+* Description: Enable the MPU and the MemManage fault for the stack guard.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is called by OSInitHook().
+*
+*              2) The regions already set up by the application are kept.  The background memory map
+*                 is enabled so that the memory outside the regions stays accessible to privileged code,
+*                 which all the tasks are.
+*
+*              3) The guard region stays disabled until the first task is switched in.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+void  OS_CPU_StkGuardInit (void)
+{
+    CPU_INT32U  size_field;
+    CPU_INT32U  size;
+
+
+    size_field = 0u;                                            /* Region of 2^(SIZE + 1) bytes.                        */
+    for (size = OS_CPU_CFG_STK_GUARD_SIZE; size > 2u; size >>= 1u) {
+        size_field++;
+    }
+    OS_CPU_StkGuardAttr      = CPU_REG_MPU_RASR_XN
+                             | CPU_REG_MPU_RASR_AP_RO
+                             | CPU_REG_MPU_RASR_C_B
+                             | (size_field << 1u)
+                             | CPU_REG_MPU_RASR_ENABLE;
+    OS_CPU_StkGuardHitTCBPtr = (OS_TCB *)0;
+
+    CPU_REG_MPU_REG_NBR      = OS_CPU_CFG_STK_GUARD_REGION;    /* See Note (3).                                        */
+    CPU_REG_MPU_REG_ATTR     = 0u;
+                                                                /* See Note (2).                                        */
+    CPU_REG_MPU_CTRL        |= CPU_REG_MPU_CTRL_PRIVDEFENA | CPU_REG_MPU_CTRL_ENABLE;
+    CPU_REG_NVIC_SHCSR      |= CPU_REG_NVIC_SHCSR_MEMFAULTENA;
+    __DSB();
+    __ISB();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          MOVE THE STACK GUARD
+*
+* Description: Move the guard region to the bottom of a task stack.
+*
+* Arguments  : p_stk_base   Base (lowest address) of the stack.
+*
+* Note(s)    : 1) This function is called by OSTaskSwHook() with interrupts disabled.
+*
+*              2) Writing the RBAR with its VALID bit set selects the region and sets its base at once :
+*                 the guard is moved with two stores.  The exception return that follows the switch
+*                 makes the new region effective for the task.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+void  OS_CPU_StkGuardSet (CPU_STK  *p_stk_base)
+{
+    CPU_REG_MPU_REG_BASE = OS_CPU_STK_GUARD_ADDR(p_stk_base)   /* See Note (2).                                        */
+                         | CPU_REG_MPU_RBAR_VALID
+                         | OS_CPU_CFG_STK_GUARD_REGION;
+    CPU_REG_MPU_REG_ATTR = OS_CPU_StkGuardAttr;
+    __DSB();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         MEMMANAGE FAULT HANDLER
+*
+* Description: Handle the MemManage fault : report a task stack overflow caught by the stack guard.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function MUST be placed on entry 4 of the Cortex-M vector table.
+*
+*              2) The stack of the running task overflowed when :
+*
+*                 a) The exception entry could not push the context on the task stack (MSTKERR), or
+*                    reserve room for the FP registers on it (MLSPERR).
+*
+*                 b) A data write faulted on an address of the guard of the task stack.
+*
+*                 The task is saved in OS_CPU_StkGuardHitTCBPtr and the guard is disabled so that the
+*                 stack can be inspected.  OSRedzoneHitHook() is called when the redzone is enabled.
+*
+*              3) A stack overflow or any other MemManage fault is not recoverable.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+void  OS_CPU_MemManageHandler (void)
+{
+    CPU_INT32U   mmfsr;
+    CPU_ADDR     guard;
+    CPU_ADDR     addr;
+    CPU_BOOLEAN  hit;
+
+
+    mmfsr = CPU_REG_NVIC_CFSR & CPU_REG_NVIC_CFSR_MMFSR;
+    hit   = DEF_NO;
+    if ((mmfsr & (CPU_REG_NVIC_CFSR_MSTKERR | CPU_REG_NVIC_CFSR_MLSPERR)) != 0u) {
+        hit = DEF_YES;                                          /* See Note (2a).                                       */
+
+    } else if ((mmfsr & (CPU_REG_NVIC_CFSR_MMARVALID | CPU_REG_NVIC_CFSR_DACCVIOL)) ==
+                        (CPU_REG_NVIC_CFSR_MMARVALID | CPU_REG_NVIC_CFSR_DACCVIOL)) {
+        guard = OS_CPU_STK_GUARD_ADDR(OSTCBCurPtr->StkBasePtr); /* See Note (2b).                                       */
+        addr  = (CPU_ADDR)CPU_REG_NVIC_MMFAR;
+        if ((addr >= guard) && (addr - guard < OS_CPU_CFG_STK_GUARD_SIZE)) {
+            hit = DEF_YES;
+        }
+    }
+
+    if (hit == DEF_YES) {
+        OS_CPU_StkGuardHitTCBPtr = OSTCBCurPtr;
+        CPU_REG_MPU_REG_NBR      = OS_CPU_CFG_STK_GUARD_REGION;
+        CPU_REG_MPU_REG_ATTR     = 0u;
+        __DSB();
+#if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
+        OSRedzoneHitHook(OSTCBCurPtr);
+#endif
+    }
+    CPU_REG_NVIC_CFSR = mmfsr;                                  /* Clear the MemManage status bits (write 1 to clear).  */
+
+    CPU_SW_EXCEPTION(;);                                        /* See Note (3).                                        */
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
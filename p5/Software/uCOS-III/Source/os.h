@@ -91,10 +91,150 @@ extern "C" {
 #define  OS_CFG_TASK_STK_REDZONE_EN      DEF_DISABLED
 #endif
 
+#ifndef OS_CFG_TASK_STK_SCAN_EN
+#define  OS_CFG_TASK_STK_SCAN_EN         DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_TASK_STK_SCAN_CHUNK
+#define  OS_CFG_TASK_STK_SCAN_CHUNK      32u
+#endif
+
+#ifndef OS_CFG_STAT_CYCLES_EN
+#define  OS_CFG_STAT_CYCLES_EN           DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_STAT_TASK_BATCH
+#define  OS_CFG_STAT_TASK_BATCH          16u
+#endif
+
+#ifndef OS_CFG_STAT_ISR_TBL_SIZE
+#define  OS_CFG_STAT_ISR_TBL_SIZE        1u
+#endif
+
+#ifndef OS_CPU_INT_NBR_GET
+#define  OS_CPU_INT_NBR_GET()            0u                     /* All ISRs are accounted in the same entry             */
+#endif
+
 #ifndef OS_CFG_INVALID_OS_CALLS_CHK_EN
 #define  OS_CFG_INVALID_OS_CALLS_CHK_EN  DEF_DISABLED
 #endif
 
+#ifndef OS_CFG_PROF_EN
+#define  OS_CFG_PROF_EN                  DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_PROF_RATE_HZ
+#define  OS_CFG_PROF_RATE_HZ             1u
+#endif
+
+#ifndef OS_CFG_LAT_HIST_EN
+#define  OS_CFG_LAT_HIST_EN              DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_PWR_EN
+#define  OS_CFG_PWR_EN                   DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_PWR_SLEEP_LAT_US
+#define  OS_CFG_PWR_SLEEP_LAT_US         10u
+#endif
+
+#ifndef OS_CFG_PWR_SLEEP_RESIDENCY_US
+#define  OS_CFG_PWR_SLEEP_RESIDENCY_US   2000u
+#endif
+
+#ifndef OS_CFG_PWR_STOP_LAT_US
+#define  OS_CFG_PWR_STOP_LAT_US          300u
+#endif
+
+#ifndef OS_CFG_PWR_STOP_RESIDENCY_US
+#define  OS_CFG_PWR_STOP_RESIDENCY_US    5000u
+#endif
+
+#ifndef OS_CFG_OBJ_REG_EN
+#define  OS_CFG_OBJ_REG_EN               DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_OBJ_REG_SIZE
+#define  OS_CFG_OBJ_REG_SIZE             64u
+#endif
+
+#ifndef OS_CFG_OBJ_REG_HASH_SIZE
+#define  OS_CFG_OBJ_REG_HASH_SIZE        128u
+#endif
+
+#ifndef OS_CFG_ISR_POST_DEFERRED_EN
+#define  OS_CFG_ISR_POST_DEFERRED_EN     DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_Q_MSG_RESERVE_EN
+#define  OS_CFG_Q_MSG_RESERVE_EN         DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MSG_BUF_EN
+#define  OS_CFG_MSG_BUF_EN               DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_Q_BATCH_EN
+#define  OS_CFG_Q_BATCH_EN               DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MEM_LOCK_FREE_EN
+#define  OS_CFG_MEM_LOCK_FREE_EN         DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MEM_CANARY_EN
+#define  OS_CFG_MEM_CANARY_EN            DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MUTEX_CEILING_EN
+#define  OS_CFG_MUTEX_CEILING_EN         DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MUTEX_FAST_EN
+#define  OS_CFG_MUTEX_FAST_EN            DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_RWLOCK_EN
+#define  OS_CFG_RWLOCK_EN                DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_RWLOCK_DEL_EN
+#define  OS_CFG_RWLOCK_DEL_EN            DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_RWLOCK_READ_MAX
+#define  OS_CFG_RWLOCK_READ_MAX          4u
+#endif
+
+#ifndef OS_CFG_FLAG_IDX_EN
+#define  OS_CFG_FLAG_IDX_EN              DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MON_KEY_EN
+#define  OS_CFG_MON_KEY_EN               DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MON_KEY_NBR
+#define  OS_CFG_MON_KEY_NBR              8u
+#endif
+
+#ifndef OS_CFG_SCHED_EDF_EN
+#define  OS_CFG_SCHED_EDF_EN             DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_SCHED_EDF_UTIL_MAX
+#define  OS_CFG_SCHED_EDF_UTIL_MAX       100u
+#endif
+
+#ifndef OS_CFG_SCHED_ROUND_ROBIN_US_EN
+#define  OS_CFG_SCHED_ROUND_ROBIN_US_EN  DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_TASK_BUDGET_EN
+#define  OS_CFG_TASK_BUDGET_EN           DEF_DISABLED
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -188,6 +328,7 @@ extern "C" {
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
 #define  OS_TASK_PEND_ON_COND_VAR             (OS_STATE)(  8u)  /* Pending on condition variable                      */
+#define  OS_TASK_PEND_ON_RWLOCK               (OS_STATE)(  9u)  /* Pending on reader-writer lock                      */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -216,8 +357,10 @@ extern "C" {
 #define  OS_OBJ_TYPE_MEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'E', 'M', ' ')
 #define  OS_OBJ_TYPE_MUTEX                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'U', 'T', 'X')
 #define  OS_OBJ_TYPE_Q                       (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'U', 'E', 'U')
+#define  OS_OBJ_TYPE_RWLOCK                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'W', 'L', 'K')
 #define  OS_OBJ_TYPE_SEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'M', 'A')
 #define  OS_OBJ_TYPE_MON                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'O', 'N', ' ')
+#define  OS_OBJ_TYPE_TASK                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'A', 'S', 'K')
 #define  OS_OBJ_TYPE_TASK_MSG                (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'S', 'G')
 #define  OS_OBJ_TYPE_TASK_RESUME             (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'R', 'E', 'S')
 #define  OS_OBJ_TYPE_TASK_SIGNAL             (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'S', 'I', 'G')
@@ -263,6 +406,12 @@ extern "C" {
 
 #define  OS_OPT_PEND_FLAG_CONSUME            (OS_OPT)(0x0100u)  /* Consume the flags if condition(s) satisfied        */
 
+#define  OS_FLAG_NBR_BITS                    (sizeof(OS_FLAGS) * DEF_OCTET_NBR_BITS)
+
+#define  OS_OPT_PEND_RWLOCK_READ             (OS_OPT)(0x0001u)  /* Shared access to a reader-writer lock              */
+#define  OS_OPT_PEND_RWLOCK_WRITE            (OS_OPT)(0x0002u)  /* Exclusive access to a reader-writer lock           */
+#define  OS_OPT_PEND_RWLOCK_MASK             (OS_OPT)(0x0003u)
+
 
 #define  OS_OPT_PEND_BLOCKING                (OS_OPT)(0x0000u)
 #define  OS_OPT_PEND_NON_BLOCKING            (OS_OPT)(0x8000u)
@@ -307,6 +456,9 @@ extern "C" {
 #define  OS_OPT_TASK_SAVE_FP                 (OS_OPT)(0x0004u)  /* Save the contents of any floating-point registers  */
 #define  OS_OPT_TASK_NO_TLS                  (OS_OPT)(0x0008u)  /* Specifies the task DOES NOT require TLS support    */
 
+#define  OS_OPT_BUDGET_DEMOTE                (OS_OPT)(0x0000u)  /* Lower the priority of a task out of budget         */
+#define  OS_OPT_BUDGET_SUSPEND               (OS_OPT)(0x0001u)  /* Suspend a task out of budget                       */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TIME OPTIONS
@@ -378,6 +530,15 @@ extern "C" {
                                                                     ((sizeof(OS_TICK) * DEF_OCTET_NBR_BITS) / 2u)))
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  EDF UTILIZATION
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_EDF_UTIL_ONE                    (OS_EDF_UTIL)(65536u)   /* Utilization of a task using all of the CPU     */
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                   MONITOR RESULTS
@@ -404,6 +565,101 @@ extern "C" {
 #define  OS_STACK_CHECK_DEPTH               8u
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                   MEMORY PARTITIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_MEM_CANARY_VAL                  0xC0DEFA11u        /* Written in the last word of each block              */
+
+#if (OS_CFG_MEM_CANARY_EN == DEF_ENABLED)
+#define  OS_MEM_CANARY_SIZE                 sizeof(CPU_INT32U) /* Bytes of each block used by the canary              */
+#else
+#define  OS_MEM_CANARY_SIZE                 0u
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                   MESSAGE BUFFERS
+------------------------------------------------------------------------------------------------------------------------
+*/
+                                                                /* Header placed before each buffer, keeps alignment    */
+#define  OS_MSG_BUF_HDR_SIZE              (((sizeof(OS_MEM *) + sizeof(CPU_ALIGN) - 1u) / sizeof(CPU_ALIGN)) * sizeof(CPU_ALIGN))
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      PROFILER
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_PROF_MAGIC                      0x464F5250u         /* 'PROF' in little-endian byte order                   */
+#define  OS_PROF_VER                        1u                  /* Layout version of OS_PROF_HDR and OS_PROF_REC        */
+#define  OS_PROF_NAME_LEN                   8u                  /* Number of task name characters kept in a record      */
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 LATENCY HISTOGRAMS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_LAT_HIST_INT_DIS                0u                  /* Interrupt disable time                               */
+#define  OS_LAT_HIST_SCHED_LOCK             1u                  /* Scheduler lock time                                  */
+#define  OS_LAT_HIST_ISR_TO_TASK            2u                  /* ISR entry to switch in of the task it made ready     */
+#define  OS_LAT_HIST_NBR                    3u
+
+#define  OS_LAT_HIST_NBR_BUCKETS           32u                  /* Bucket n holds samples of n significant bits         */
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  POWER MANAGEMENT
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_PWR_STATE_WFI                   0u                  /* Core clock gated, the tick keeps running             */
+#define  OS_PWR_STATE_SLEEP                 1u                  /* Core clock gated, the tick is stopped                */
+#define  OS_PWR_STATE_STOP                  2u                  /* Clocks and regulator down, the tick is stopped       */
+#define  OS_PWR_STATE_NBR                   3u
+
+#define  OS_PWR_LAT_MAX_NONE       0xFFFFFFFFu                  /* No constraint on the exit latency                    */
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                               KERNEL OBJECT REGISTRY
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OBJ_HANDLE_NONE         (OS_OBJ_HANDLE)0u           /* Never a valid handle, the generation starts at 1     */
+
+#define  OS_OBJ_HANDLE_IX_BITS              8u                  /* Handle: generation in the MSB, slot in the LSB       */
+#define  OS_OBJ_HANDLE_IX_MASK         0x00FFu
+
+#define  OS_OBJ_REG_IX_NONE              0xFFu                  /* End of the free slot list                            */
+#define  OS_OBJ_REG_HASH_IX_NONE       0xFFFFu                  /* Object registered without a name                     */
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                CPU USAGE MOVING AVERAGES
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_STAT_EMA_1S                     0u                  /* Time constant of 1 second                            */
+#define  OS_STAT_EMA_10S                    1u                  /* Time constant of 10 seconds                          */
+#define  OS_STAT_EMA_60S                    2u                  /* Time constant of 60 seconds                          */
+#define  OS_STAT_EMA_NBR                    3u
+
+#define  OS_STAT_INT_NEST_MAX               8u                  /* ISR nesting levels accounted separately              */
+
+                                                                /* Moving average to CPU usage (0.00-100.00%)           */
+#define  OS_STAT_EMA_TO_USAGE(ema)          ((OS_CPU_USAGE)(((ema) + 0x8000u) >> 16u))
+
+
 /*
 ************************************************************************************************************************
 ************************************************************************************************************************
@@ -425,6 +681,7 @@ typedef  enum  os_err {
     OS_ERR_ACCEPT_ISR                = 10001u,
 
     OS_ERR_B                         = 11000u,
+    OS_ERR_BUDGET_PARAM_INVALID      = 11001u,
 
     OS_ERR_C                         = 12000u,
     OS_ERR_CREATE_ISR                = 12001u,
@@ -433,6 +690,10 @@ typedef  enum  os_err {
     OS_ERR_DEL_ISR                   = 13001u,
 
     OS_ERR_E                         = 14000u,
+    OS_ERR_EDF_ADMIT                 = 14001u,
+    OS_ERR_EDF_NOT_ADMITTED          = 14002u,
+    OS_ERR_EDF_PARAM_INVALID         = 14003u,
+    OS_ERR_EDF_PRIO                  = 14004u,
 
     OS_ERR_F                         = 15000u,
     OS_ERR_FATAL_RETURN              = 15001u,
@@ -441,6 +702,7 @@ typedef  enum  os_err {
     OS_ERR_FLAG_NOT_RDY              = 15102u,
     OS_ERR_FLAG_PEND_OPT             = 15103u,
     OS_ERR_FLUSH_ISR                 = 15104u,
+    OS_ERR_FLAG_GRP_DUP              = 15105u,
 
     OS_ERR_G                         = 16000u,
 
@@ -449,11 +711,11 @@ typedef  enum  os_err {
     OS_ERR_I                         = 18000u,
     OS_ERR_ILLEGAL_CREATE_RUN_TIME   = 18001u,
 
-    OS_ERR_INT_Q                     = 18002u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_FULL                = 18003u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_SIZE                = 18004u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_STK_INVALID         = 18005u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_STK_SIZE_INVALID    = 18006u,                  /* OBSOLETE ERR CODE                                    */
+    OS_ERR_INT_Q                     = 18002u,
+    OS_ERR_INT_Q_FULL                = 18003u,
+    OS_ERR_INT_Q_SIZE                = 18004u,
+    OS_ERR_INT_Q_STK_INVALID         = 18005u,
+    OS_ERR_INT_Q_STK_SIZE_INVALID    = 18006u,
 
     OS_ERR_ILLEGAL_DEL_RUN_TIME      = 18007u,
 
@@ -464,6 +726,9 @@ typedef  enum  os_err {
     OS_ERR_L                         = 21000u,
     OS_ERR_LOCK_NESTING_OVF          = 21001u,
 
+    OS_ERR_LAT_HIST_INVALID          = 21101u,
+    OS_ERR_LAT_PERMILLE_INVALID      = 21102u,
+
     OS_ERR_M                         = 22000u,
 
     OS_ERR_MEM_CREATE_ISR            = 22201u,
@@ -476,14 +741,18 @@ typedef  enum  os_err {
     OS_ERR_MEM_INVALID_P_DATA        = 22208u,
     OS_ERR_MEM_INVALID_SIZE          = 22209u,
     OS_ERR_MEM_NO_FREE_BLKS          = 22210u,
+    OS_ERR_MEM_CANARY                = 22211u,
 
     OS_ERR_MSG_POOL_EMPTY            = 22301u,
     OS_ERR_MSG_POOL_NULL_PTR         = 22302u,
+    OS_ERR_MSG_BUF_CLASS_FULL        = 22303u,
+    OS_ERR_MSG_BUF_INVALID           = 22304u,
 
     OS_ERR_MUTEX_NOT_OWNER           = 22401u,
     OS_ERR_MUTEX_OWNER               = 22402u,
     OS_ERR_MUTEX_NESTING             = 22403u,
     OS_ERR_MUTEX_OVF                 = 22404u,
+    OS_ERR_MUTEX_CEILING             = 22405u,
 
     OS_ERR_N                         = 23000u,
     OS_ERR_NAME                      = 23001u,
@@ -494,6 +763,9 @@ typedef  enum  os_err {
     OS_ERR_OBJ_DEL                   = 24002u,
     OS_ERR_OBJ_PTR_NULL              = 24003u,
     OS_ERR_OBJ_TYPE                  = 24004u,
+    OS_ERR_OBJ_HANDLE_INVALID        = 24005u,
+    OS_ERR_OBJ_HANDLE_STALE          = 24006u,
+    OS_ERR_OBJ_NOT_FOUND             = 24007u,
 
     OS_ERR_OPT_INVALID               = 24101u,
 
@@ -521,17 +793,27 @@ typedef  enum  os_err {
 
     OS_ERR_PTR_INVALID               = 25301u,
 
+    OS_ERR_PROF_BUF_SIZE             = 25401u,
+    OS_ERR_PROF_ISR                  = 25402u,
+
+    OS_ERR_PWR_STATE_INVALID         = 25501u,
+
     OS_ERR_Q                         = 26000u,
     OS_ERR_Q_FULL                    = 26001u,
     OS_ERR_Q_EMPTY                   = 26002u,
     OS_ERR_Q_MAX                     = 26003u,
     OS_ERR_Q_SIZE                    = 26004u,
+    OS_ERR_Q_NOT_EMPTY               = 26005u,
 
     OS_ERR_R                         = 27000u,
     OS_ERR_REG_ID_INVALID            = 27001u,
     OS_ERR_ROUND_ROBIN_1             = 27002u,
     OS_ERR_ROUND_ROBIN_DISABLED      = 27003u,
 
+    OS_ERR_RWLOCK_NOT_OWNER          = 27101u,
+    OS_ERR_RWLOCK_OWNER              = 27102u,
+    OS_ERR_RWLOCK_OVF                = 27103u,
+
     OS_ERR_S                         = 28000u,
     OS_ERR_SCHED_INVALID_TIME_SLICE  = 28001u,
     OS_ERR_SCHED_LOCK_ISR            = 28002u,
@@ -643,6 +925,7 @@ typedef  enum  os_err {
 */
 
 typedef  struct  os_flag_grp         OS_FLAG_GRP;
+typedef  struct  os_flag_pend_data   OS_FLAG_PEND_DATA;
 
 typedef  struct  os_mem              OS_MEM;
 
@@ -650,6 +933,10 @@ typedef  struct  os_msg              OS_MSG;
 typedef  struct  os_msg_pool         OS_MSG_POOL;
 typedef  struct  os_msg_q            OS_MSG_Q;
 
+#if (OS_CFG_MSG_BUF_EN == DEF_ENABLED)
+typedef  struct  os_msg_buf_class    OS_MSG_BUF_CLASS;
+#endif
+
 typedef  struct  os_mutex            OS_MUTEX;
 
 typedef  struct  os_q                OS_Q;
@@ -658,6 +945,9 @@ typedef  struct  os_mon              OS_MON;
 typedef  struct  os_mon_data         OS_MON_DATA;
 typedef  struct  os_mon_ctx          OS_MON_CTX;
 
+typedef  struct  os_rwlock           OS_RWLOCK;
+typedef  struct  os_rwlock_read      OS_RWLOCK_READ;
+
 typedef  struct  os_sem              OS_SEM;
 
 typedef  void                      (*OS_TASK_PTR)(void *p_arg);
@@ -687,6 +977,35 @@ typedef  struct  os_tmr              OS_TMR;
 typedef  struct  os_pend_list        OS_PEND_LIST;
 typedef  struct  os_pend_obj         OS_PEND_OBJ;
 
+#if (OS_CFG_PROF_EN == DEF_ENABLED)
+typedef  struct  os_prof_hdr         OS_PROF_HDR;
+typedef  struct  os_prof_rec         OS_PROF_REC;
+typedef  struct  os_prof_snap        OS_PROF_SNAP;
+
+typedef  void                      (*OS_PROF_OUTPUT_FNCT)(void        *p_buf,
+                                                          CPU_SIZE_T   len);
+#endif
+
+typedef  struct  os_int_q            OS_INT_Q;
+
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+typedef  struct  os_lat_hist         OS_LAT_HIST;
+#endif
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+typedef  struct  os_pwr_stat         OS_PWR_STAT;
+#endif
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+typedef  struct  os_obj_reg_entry    OS_OBJ_REG_ENTRY;
+#endif
+
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+typedef  CPU_INT32U                  OS_CPU_USAGE_EMA;          /* CPU usage (0.00-100.00%) << 16                       */
+
+typedef  struct  os_stat_isr         OS_STAT_ISR;
+#endif
+
 #if (OS_CFG_APP_HOOKS_EN == DEF_ENABLED)
 typedef  void                      (*OS_APP_HOOK_VOID)(void);
 typedef  void                      (*OS_APP_HOOK_TCB)(OS_TCB *p_tcb);
@@ -793,9 +1112,46 @@ struct  os_flag_grp {                                       /* Event Flag Group
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
     CPU_INT16U           FlagID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FLAGS             WaitTblMask;                       /* Bits with at least one waiter in .WaitTbl[]            */
+    OS_FLAGS             WaitScanMask;                      /* Bits waited for by the scan list (superset)            */
+    OS_FLAG_PEND_DATA   *WaitScanPtr;                       /* Waiters for ANY of several bits                        */
+    OS_FLAG_PEND_DATA   *WaitTbl[OS_FLAG_NBR_BITS];         /* Waiters indexed by a bit they still miss               */
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_OBJ_HANDLE        Handle;                            /* Handle in the object registry                          */
+#endif
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 EVENT FLAG PEND DATA
+*
+* Note(s) : (1) An OS_FLAG_PEND_DATA describes what a task waits for in one event flag group.  OSFlagPend() uses the
+*               one in the task's OS_TCB, OSFlagPendMulti() a table supplied by the caller with one entry per group.
+*               The caller sets .GrpPtr, .Flags and .Opt, the kernel sets the other members.
+*
+*           (2) A waiter for ALL of its bits, or for a single bit, is linked in the group's .WaitTbl[] under ONE bit it
+*               still misses (.Bit) so that a post only looks at the waiters of the bits it sets.  A waiter for ANY of
+*               several bits is kept in the group's scan list (.Bit == OS_FLAG_NBR_BITS).
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+struct  os_flag_pend_data {
+    OS_FLAG_PEND_DATA   *PrevPtr;                           /* Links in the .WaitTbl[] or scan list of the group      */
+    OS_FLAG_PEND_DATA   *NextPtr;
+    OS_TCB              *TCBPtr;                            /* Task waiting                                           */
+    OS_FLAG_GRP         *GrpPtr;                            /* Event flag group waited on                             */
+    OS_FLAGS             Flags;                             /* Event flag(s) to wait on                               */
+    OS_OPT               Opt;                               /* OS_OPT_PEND_FLAG_SET_ALL/ANY [+ CONSUME]               */
+    OS_FLAGS             FlagsRdy;                          /* Event flags that satisfied the wait, 0 if not          */
+    CPU_INT08U           Bit;                               /* Bit indexed under, see Note #2                         */
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                   MEMORY PARTITIONS
@@ -811,10 +1167,20 @@ struct os_mem {                                             /* MEMORY CONTROL BL
     CPU_CHAR            *NamePtr;
 #endif
     void                *AddrPtr;                           /* Pointer to beginning of memory partition               */
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT32U           FreeHead;                          /* Tagged index of the first free block (see os_mem.c)    */
+#else
     void                *FreeListPtr;                       /* Pointer to list of free memory blocks                  */
+#endif
     OS_MEM_SIZE          BlkSize;                           /* Size (in bytes) of each block of memory                */
     OS_MEM_QTY           NbrMax;                            /* Total number of blocks in this partition               */
     OS_MEM_QTY           NbrFree;                           /* Number of memory blocks remaining in this partition    */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_MEM_QTY           NbrUsedMax;                        /* Peak number of memory blocks used                      */
+#endif
+#if (OS_CFG_MEM_CANARY_EN == DEF_ENABLED)
+    OS_MEM_QTY           CanaryErrCtr;                      /* Number of corrupted block canaries detected            */
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_MEM              *DbgPrevPtr;
     OS_MEM              *DbgNextPtr;
@@ -822,6 +1188,9 @@ struct os_mem {                                             /* MEMORY CONTROL BL
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
     CPU_INT16U           MemID;                             /* Unique ID for third-party debuggers and tracers.       */
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_OBJ_HANDLE        Handle;                            /* Handle in the object registry                          */
+#endif
 };
 
 
@@ -849,6 +1218,7 @@ struct  os_msg_pool {                                       /* OS_MSG POOL
     OS_MSG_QTY           NbrUsed;                           /* Current number of messages used                        */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_MSG_QTY           NbrUsedMax;                        /* Peak number of messages used                           */
+    CPU_INT32U           EmptyCtr;                          /* Number of times a message was needed and none was free */
 #endif
 };
 
@@ -862,12 +1232,28 @@ struct  os_msg_q {                                          /* OS_MSG_Q
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of entries in the queue                    */
 #endif
+#if (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED)
+    OS_MSG              *ResvPtr;                           /* List of free OS_MSGs reserved for this queue           */
+    OS_MSG_QTY           ResvSize;                          /* Number of OS_MSGs reserved for this queue              */
+    OS_MSG_QTY           ResvFree;                          /* Number of reserved OS_MSGs not holding a message       */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
     CPU_INT16U           MsgQID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
 };
 
 
+#if (OS_CFG_MSG_BUF_EN == DEF_ENABLED)
+struct  os_msg_buf_class {                                  /* SIZE CLASS OF MESSAGE BUFFERS                          */
+    OS_MEM              *MemPtr;                            /* Partition holding the buffers                          */
+    OS_MSG_SIZE          BufSize;                           /* Largest message a buffer can hold (in # bytes)         */
+    OS_MEM_QTY           NbrUsedMax;                        /* Peak number of buffers in use                          */
+    CPU_INT32U           GetCtr;                            /* Number of buffers obtained                             */
+    CPU_INT32U           EmptyCtr;                          /* Number of times the size class was exhausted           */
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                              MUTUAL EXCLUSION SEMAPHORES
@@ -894,12 +1280,66 @@ struct  os_mutex {                                          /* Mutual Exclusion
     OS_MUTEX            *MutexGrpNextPtr;
     OS_TCB              *OwnerTCBPtr;
     OS_NESTING_CTR       OwnerNestingCtr;                   /* Mutex is available when the counter is 0               */
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    OS_TCB              *LockOwnerPtr;                      /* Owner when taken w/o the kernel, see OSMutexPend()     */
+#endif
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    OS_PRIO              CeilingPrio;                       /* Priority ceiling, OS_PRIO_INIT for prio inheritance    */
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     CPU_TS               TS;
 #endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
     CPU_INT16U           MutexID;                           /* Unique ID for third-party debuggers and tracers.       */
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_OBJ_HANDLE        Handle;                            /* Handle in the object registry                          */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  READER-WRITER LOCKS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) Each read lock held is an entry of the reader's 'RWLockReadTbl[]', linked in the 'ReaderHeadPtr' list of
+*               the lock.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_rwlock_read {                                    /* Read lock held by a task, see Note #2                  */
+    OS_RWLOCK           *RWLockPtr;                         /* Lock read locked, DEF_NULL if the entry is free        */
+    OS_RWLOCK_READ      *NextPtr;                           /* Next read lock held on the same lock                   */
+};
+
+
+struct  os_rwlock {                                         /* Reader-Writer Lock                                     */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_RWLOCK                    */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Lock Name (NUL terminated ASCII)            */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of readers and writers waiting on the lock        */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_RWLOCK           *DbgPrevPtr;
+    OS_RWLOCK           *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_RWLOCK           *RWLockGrpNextPtr;                  /* Next lock write locked by the same writer              */
+    OS_TCB              *WriterTCBPtr;                      /* Writer holding the lock, DEF_NULL if none              */
+    OS_OBJ_QTY           ReaderCtr;                         /* Number of read locks held                              */
+    OS_RWLOCK_READ      *ReaderHeadPtr;                     /* Read locks held, see Note #2                           */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS               TS;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_OBJ_HANDLE        Handle;                            /* Handle in the object registry                          */
+#endif
 };
 
 
@@ -927,6 +1367,9 @@ struct  os_q {                                              /* Message Queue
 #endif
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
     OS_MSG_Q             MsgQ;                              /* List of messages                                       */
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_OBJ_HANDLE        Handle;                            /* Handle in the object registry                          */
+#endif
 };
 
 
@@ -960,6 +1403,9 @@ struct  os_sem {                                            /* Semaphore
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
     CPU_INT16U           SemID;                             /* Unique ID for third-party debuggers and tracers.       */
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_OBJ_HANDLE        Handle;                            /* Handle in the object registry                          */
+#endif
 };
 
 
@@ -980,11 +1426,24 @@ struct  os_mon {                                            /* Monitor
 #endif
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
     void                *MonDataPtr;
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+    OS_MON_KEYS          KeyWaitMask;                       /* Keys with at least one task waiting                    */
+    OS_TCB              *KeyTbl[OS_CFG_MON_KEY_NBR];        /* Tasks waiting per key, in priority order               */
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_OBJ_HANDLE        Handle;                            /* Handle in the object registry                          */
+#endif
 };
 
 struct  os_mon_data {
     void                 *p_eval_data;
     OS_MON_ON_EVAL_PTR    p_on_eval;
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+    OS_MON               *p_key_mon;                        /* Monitor whose key list holds the task, else DEF_NULL   */
+    OS_TCB               *p_key_next;
+    OS_TCB               *p_key_prev;
+    OS_MON_KEY            key;                              /* Condition waited for, see OSMonOpKey()                 */
+#endif
 };
 
 struct  os_mon_ctx {
@@ -1049,6 +1508,11 @@ struct os_tcb {
     OS_PRIO              BasePrio;                          /* Base priority (Not inherited)                          */
     OS_MUTEX            *MutexGrpHeadPtr;                   /* Owned mutex group head pointer                         */
 #endif
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+    OS_RWLOCK           *RWLockGrpHeadPtr;                  /* Write locked reader-writer lock group head pointer     */
+    OS_OPT               RWLockPendOpt;                     /* Access waited for, OS_OPT_PEND_RWLOCK_READ/WRITE       */
+    OS_RWLOCK_READ       RWLockReadTbl[OS_CFG_RWLOCK_READ_MAX]; /* Read locks held by the task                        */
+#endif
 
 #if ((OS_CFG_DBG_EN == DEF_ENABLED) || (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED) || (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED))
     CPU_STK_SIZE         StkSize;                           /* Size of task stack (in number of stack elements)       */
@@ -1072,6 +1536,39 @@ struct os_tcb {
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
     OS_TICK              TimeQuanta;
     OS_TICK              TimeQuantaCtr;
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+    CPU_TS               TimeQuantaCycles;                  /* Time slice in cycles of the time stamp timer           */
+    CPU_TS               TimeQuantaCyclesUsed;              /* Cycles run in the current time slice                   */
+    CPU_TS               TimeQuantaCyclesOverMax;           /* Most cycles run past the end of a time slice           */
+#endif
+    OS_CTR               TimeQuantaEndCtr;                  /* Number of time slices run to the end                   */
+    OS_CTR               TimeQuantaYieldCtr;                /* Number of time slices given up by a yield              */
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)                    /* EARLIEST DEADLINE FIRST                                */
+    OS_TICK              EdfPeriod;                         /* Period, 0 if the task is not in the EDF class          */
+    OS_TICK              EdfDeadlineRel;                    /* Deadline relative to the release of a job              */
+    OS_TICK              EdfWCET;                           /* Worst case execution time of a job                     */
+    OS_EDF_UTIL          EdfUtil;                           /* Share of the CPU reserved at admission                 */
+    OS_TICK              EdfRelease;                        /* Release of the current job                             */
+    OS_TICK              EdfDeadline;                       /* Absolute deadline of the current job                   */
+    OS_CTR               EdfJobCtr;                         /* Number of jobs completed                               */
+    OS_CTR               EdfMissCtr;                        /* Number of jobs completed after their deadline          */
+    OS_TICK              EdfLatenessMax;                    /* Largest completion time past a deadline                */
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)                  /* CPU BUDGET                                             */
+    OS_TCB              *BudgetNextPtr;                     /* Next task in the list of tasks with a budget           */
+    OS_TICK              BudgetPeriod;                      /* Replenishment period, 0 if the task has no budget      */
+    OS_TICK              Budget;                            /* Ticks the task may run per period                      */
+    OS_TICK              BudgetUsed;                        /* Ticks charged to the task in the current period        */
+    OS_TICK              BudgetRemain;                      /* Ticks to the replenishment, 0 if no period is open     */
+    OS_TICK              BudgetUsedMax;                     /* Most ticks charged in a period                         */
+    OS_CTR               BudgetOverrunCtr;                  /* Number of periods the budget was exhausted in          */
+    OS_OPT               BudgetOpt;                         /* What to do when the budget is exhausted                */
+    OS_PRIO              BudgetPrio;                        /* Priority of the task when demoted                      */
+    OS_PRIO              BudgetPrioSave;                    /* Priority restored at replenishment                     */
+    CPU_BOOLEAN          BudgetThrottled;                   /* The task was demoted or suspended                      */
 #endif
 
 #if (OS_MSG_EN == DEF_ENABLED)
@@ -1095,6 +1592,11 @@ struct os_tcb {
     OS_FLAGS             FlagsPend;                         /* Event flag(s) to wait on                               */
     OS_FLAGS             FlagsRdy;                          /* Event flags that made task ready to run                */
     OS_OPT               FlagsOpt;                          /* Options (See OS_OPT_FLAG_xxx)                          */
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FLAG_PEND_DATA    FlagPendData;                      /* Wait of OSFlagPend()                                   */
+    OS_FLAG_PEND_DATA   *FlagPendDataTblPtr;                /* Waits linked in event flag groups, DEF_NULL if none    */
+    OS_OBJ_QTY           FlagPendDataTblEntries;
+#endif
 #endif
 
 #if (OS_CFG_MON_EN == DEF_ENABLED)
@@ -1113,15 +1615,28 @@ struct os_tcb {
     CPU_TS               CyclesStart;                       /* Snapshot of cycle counter at start of task resumption  */
     OS_CYCLES            CyclesTotal;                       /* Total number of # of cycles the task has been running  */
     OS_CYCLES            CyclesTotalPrev;                   /* Snapshot of previous # of cycles                       */
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    CPU_TS               StatTS;                            /* Time of the previous statistic task update             */
+    OS_TICK              StatTickCtr;                       /* OSTickCtr at the previous statistic task update        */
+    OS_CPU_USAGE_EMA     CPUUsageEMA[OS_STAT_EMA_NBR];      /* Moving averages, see OS_STAT_EMA_xxx                   */
+#endif
 
     CPU_TS               SemPendTime;                       /* Time it took for signal to be received                 */
     CPU_TS               SemPendTimeMax;                    /* Max amount of time it took for signal to be received   */
 #endif
 
+#if (OS_CFG_PROF_EN == DEF_ENABLED)
+    OS_CTX_SW_CTR        CtxSwCtrPrev;                      /* .CtxSwCtr at previous profiler snapshot                */
+#endif
+
 #if (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED)
     CPU_STK_SIZE         StkUsed;                           /* Number of stack elements used from the stack           */
     CPU_STK_SIZE         StkFree;                           /* Number of stack elements free on   the stack           */
 #endif
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+    CPU_STK             *StkScanPtr;                        /* Where the idle task resumes the scan of the stack      */
+    CPU_STK_SIZE         StkUsedMax;                        /* Stack high-water mark found by the scan (elements)     */
+#endif
 
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
     CPU_TS               IntDisTimeMax;                     /* Maximum interrupt disable time                         */
@@ -1138,6 +1653,9 @@ struct os_tcb {
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
     CPU_INT16U           TaskID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_OBJ_HANDLE        Handle;                            /* Handle in the object registry                          */
+#endif
 };
 
 
@@ -1182,47 +1700,240 @@ struct  os_tmr {
     OS_TMR              *DbgPrevPtr;
     OS_TMR              *DbgNextPtr;
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_OBJ_HANDLE        Handle;                            /* Handle in the object registry                          */
+#endif
 };
 
 
 /*
-************************************************************************************************************************
-************************************************************************************************************************
-*                                           G L O B A L   V A R I A B L E S
-************************************************************************************************************************
-************************************************************************************************************************
+------------------------------------------------------------------------------------------------------------------------
+*                                                 PROFILER DATA TYPES
+*
+* Note(s) : (1) A snapshot is an OS_PROF_HDR immediately followed by .NbrRec OS_PROF_REC entries.  All fields are fixed
+*               width and naturally aligned so that the image can be streamed as-is and decoded off-target.
+*
+*           (2) Times are expressed in CPU timestamp counts; divide by OS_PROF_HDR.TS_Freq to obtain seconds.
+------------------------------------------------------------------------------------------------------------------------
 */
-                                                                        /* APPLICATION HOOKS ------------------------ */
-#if (OS_CFG_APP_HOOKS_EN == DEF_ENABLED)
-#if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
-OS_EXT           OS_APP_HOOK_TCB            OS_AppRedzoneHitHookPtr;
-#endif
-OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskCreateHookPtr;
-OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskDelHookPtr;
-OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskReturnHookPtr;
 
-OS_EXT           OS_APP_HOOK_VOID           OS_AppIdleTaskHookPtr;
-OS_EXT           OS_APP_HOOK_VOID           OS_AppStatTaskHookPtr;
-OS_EXT           OS_APP_HOOK_VOID           OS_AppTaskSwHookPtr;
-OS_EXT           OS_APP_HOOK_VOID           OS_AppTimeTickHookPtr;
-#endif
+#if (OS_CFG_PROF_EN == DEF_ENABLED)
+struct  os_prof_hdr {
+    CPU_INT32U           Magic;                             /* OS_PROF_MAGIC                                          */
+    CPU_INT16U           Ver;                               /* OS_PROF_VER                                            */
+    CPU_INT16U           NbrRec;                            /* Number of OS_PROF_REC following the header             */
+    CPU_INT32U           SeqNbr;                            /* Incremented on every snapshot                          */
+    CPU_INT32U           TickCtr;                           /* OSTickCtr when the snapshot was taken                  */
+    CPU_INT32U           TS_Freq;                           /* Frequency of the timestamp counter (Hz)                */
+    CPU_INT32U           CtxSwPerSec;                       /* Total context switches per second                      */
+    CPU_INT32U           IntDisTimeMax;                     /* Overall maximum interrupt disable time (TS counts)     */
+    CPU_INT16U           CPUUsage;                          /* Total CPU usage (0.00-100.00%)                         */
+    CPU_INT16U           RecSize;                           /* sizeof(OS_PROF_REC)                                    */
+};
 
-                                                                        /* IDLE TASK -------------------------------- */
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-OS_EXT            OS_IDLE_CTR               OSIdleTaskCtr;
-#endif
-#if (OS_CFG_TASK_IDLE_EN == DEF_ENABLED)
-OS_EXT            OS_TCB                    OSIdleTaskTCB;
-#endif
 
-                                                                        /* MISCELLANEOUS ---------------------------- */
-OS_EXT            OS_NESTING_CTR            OSIntNestingCtr;            /* Interrupt nesting level                    */
+struct  os_prof_rec {
+    CPU_CHAR             Name[OS_PROF_NAME_LEN];            /* First characters of the task name (not NUL terminated) */
+    CPU_INT32U           CtxSwPerSec;                       /* Times the task was switched in, per second             */
+    CPU_INT32U           IntDisTimeMax;                     /* Max interrupt disable time in task (TS counts)         */
+    CPU_INT32U           SchedLockTimeMax;                  /* Max scheduler lock time in task (TS counts)            */
+    CPU_INT32U           StkSize;                           /* Size of the task stack (bytes)                         */
+    CPU_INT32U           StkUsed;                           /* Stack high-water mark (bytes)                          */
+    CPU_INT16U           CPUUsage;                          /* CPU usage of task (0.00-100.00%)                       */
+    CPU_INT16U           CPUUsageMax;                       /* CPU usage of task (0.00-100.00%) - Peak                */
+    CPU_INT08U           Prio;                              /* Current task priority                                  */
+    CPU_INT08U           TaskState;                         /* See OS_TASK_STATE_xxx                                  */
+    CPU_INT16U           Rsvd;
+};
+
+
+struct  os_prof_snap {
+    OS_PROF_HDR          Hdr;
+    OS_PROF_REC          RecTbl[OS_CFG_PROF_TBL_SIZE];
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                               ISR POST QUEUE DATA TYPES
+*
+* Note(s) : (1) An entry records a post made from an ISR while OS_CFG_ISR_POST_DEFERRED_EN is enabled.  The ISR post
+*               queue task replays it at task level with the matching OSxxxPost() call.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+struct  os_int_q {
+    OS_OBJ_TYPE          Type;                              /* Type of object posted to                               */
+    void                *ObjPtr;                            /* Pointer to object posted to                            */
+    void                *MsgPtr;                            /* Pointer to message if posting to a message queue       */
+    OS_MSG_SIZE          MsgSize;                           /* Message Size       if posting to a message queue       */
+    OS_FLAGS             Flags;                             /* Value of flags if posting to an event flag group       */
+    OS_OPT               Opt;                               /* Post Options                                           */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                             LATENCY HISTOGRAM DATA TYPES
+*
+* Note(s) : (1) Samples are in CPU timestamp counts.  Bucket 0 counts samples of 0, bucket n (1 to 30) counts samples
+*               from 2^(n-1) to 2^n - 1 and the last bucket counts all samples of 2^30 and above.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+struct  os_lat_hist {
+    CPU_INT32U           Ctr;                               /* Number of samples                                      */
+    CPU_TS               Max;                               /* Largest sample                                         */
+                                                            /* Number of samples per log2 bucket (see Note #1)        */
+    CPU_INT32U           BucketTbl[OS_LAT_HIST_NBR_BUCKETS];
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                             POWER MANAGEMENT DATA TYPES
+*
+* Note(s) : (1) The residency is the time spent in a state, in microseconds, as measured by BSP_OS_PwrEnter().
+*
+*           (2) An early wake up is a residency shorter than the target residency of the state: an interrupt the idle
+*               task could not predict ended the idle period before the state paid for its entry and exit.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+struct  os_pwr_stat {
+    CPU_INT32U           EntryCtr;                          /* Number of times the state was entered                  */
+    CPU_INT32U           EarlyWakeCtr;                      /* Number of early wake ups (see Note #2)                 */
+    CPU_INT64U           ResidencyTotal;                    /* Time spent in the state (see Note #1)                  */
+    CPU_INT32U           ResidencyMax;                      /* Longest stay in the state                              */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                          KERNEL OBJECT REGISTRY DATA TYPES
+*
+* Note(s) : (1) A slot's generation is incremented each time its object is deleted, so that the handles given out for
+*               the deleted object are detected as stale.  A freed slot goes to the tail of the free list: a handle can
+*               only alias a newer object after OS_CFG_OBJ_REG_SIZE * 255 deletions.
+*
+*           (2) OSObjRegHashTbl[] holds the slot index + 1 of the named objects, 0 for an empty position.  Collisions
+*               are resolved by linear probing and deletions shift the following entries back, without tombstones.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+struct  os_obj_reg_entry {
+    void                *ObjPtr;                            /* Object, DEF_NULL if the slot is free                   */
+    CPU_CHAR            *NamePtr;                           /* Name given at creation, may be DEF_NULL                */
+    OS_OBJ_TYPE          Type;                              /* OS_OBJ_TYPE_xxx                                        */
+    CPU_INT32U           Hash;                              /* Hash of the name                                       */
+    CPU_INT16U           HashIx;                            /* Position in OSObjRegHashTbl[] (see Note #2)            */
+    CPU_INT08U           Gen;                               /* Generation of the slot (see Note #1)                   */
+    CPU_INT08U           NextFreeIx;                        /* Next slot in the free list                             */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                               ISR CPU USAGE DATA TYPES
+*
+* Note(s) : (1) One entry per exception number (OS_CPU_INT_NBR_GET()), for the ISRs that call OSIntEnter() and
+*               OSIntExit().  The cycles of a nested ISR are charged to it, not to the ISR it interrupted.  Exception
+*               numbers beyond the table are charged to entry 0.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+struct  os_stat_isr {
+    CPU_INT32U           Ctr;                               /* Number of times the ISR ran                            */
+    OS_CYCLES            CyclesTotal;                       /* Cycles spent in the ISR                                */
+    OS_CYCLES            CyclesTotalPrev;                   /* .CyclesTotal at the previous statistic task run        */
+    OS_CPU_USAGE         CPUUsage;                          /* CPU usage of the ISR (0.00-100.00%)                    */
+    OS_CPU_USAGE         CPUUsageMax;                       /* CPU usage of the ISR (0.00-100.00%) - Peak             */
+    OS_CPU_USAGE_EMA     CPUUsageEMA[OS_STAT_EMA_NBR];      /* Moving averages, see OS_STAT_EMA_xxx                   */
+};
+#endif
+
+
+/*
+************************************************************************************************************************
+************************************************************************************************************************
+*                                           G L O B A L   V A R I A B L E S
+************************************************************************************************************************
+************************************************************************************************************************
+*/
+                                                                        /* APPLICATION HOOKS ------------------------ */
+#if (OS_CFG_APP_HOOKS_EN == DEF_ENABLED)
+#if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
+OS_EXT           OS_APP_HOOK_TCB            OS_AppRedzoneHitHookPtr;
+#endif
+OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskCreateHookPtr;
+OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskDelHookPtr;
+OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskReturnHookPtr;
+
+OS_EXT           OS_APP_HOOK_VOID           OS_AppIdleTaskHookPtr;
+OS_EXT           OS_APP_HOOK_VOID           OS_AppStatTaskHookPtr;
+OS_EXT           OS_APP_HOOK_VOID           OS_AppTaskSwHookPtr;
+OS_EXT           OS_APP_HOOK_VOID           OS_AppTimeTickHookPtr;
+#endif
+
+                                                                        /* IDLE TASK -------------------------------- */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+OS_EXT            OS_IDLE_CTR               OSIdleTaskCtr;
+#endif
+#if (OS_CFG_TASK_IDLE_EN == DEF_ENABLED)
+OS_EXT            OS_TCB                    OSIdleTaskTCB;
+#endif
+
+                                                                        /* ISR POST QUEUE --------------------------- */
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+OS_EXT            CPU_INT32U                OSIntQInCtr;                /* Entries reserved by ISRs (free-running)    */
+OS_EXT            CPU_INT32U                OSIntQOutCtr;               /* Entries consumed by task (free-running)    */
+OS_EXT            OS_OBJ_QTY                OSIntQNbrEntriesMax;        /* Peak number of entries in the queue        */
+OS_EXT            CPU_INT32U                OSIntQOvfCtr;               /* Number of posts lost to a full queue       */
+OS_EXT            OS_TCB                    OSIntQTaskTCB;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+OS_EXT            CPU_TS                    OSIntQTaskTimeMax;
+#endif
+#endif
+
+                                                                        /* MISCELLANEOUS ---------------------------- */
+OS_EXT            OS_NESTING_CTR            OSIntNestingCtr;            /* Interrupt nesting level                    */
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
 #if (OS_CFG_TS_EN == DEF_ENABLED)
 OS_EXT            CPU_TS                    OSIntDisTimeMax;            /* Overall interrupt disable time             */
 #endif
 #endif
 
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+OS_EXT            OS_LAT_HIST               OSLatHistTbl[OS_LAT_HIST_NBR];
+OS_EXT            CPU_TS                    OSLatISR_TS;                /* Timestamp of the outermost ISR entry       */
+OS_EXT            CPU_BOOLEAN               OSLatISR_Pending;           /* ISR caused a context switch                */
+#endif
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+OS_EXT            OS_PWR_STAT               OSPwrStatTbl[OS_PWR_STATE_NBR];
+OS_EXT            CPU_INT32U                OSPwrLatMax;                /* Exit latency allowed, in microseconds      */
+OS_EXT            OS_TICK                   OSPwrIdleTicks;             /* Last idle period predicted, in ticks       */
+#endif
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+OS_EXT            OS_OBJ_REG_ENTRY          OSObjRegTbl[OS_CFG_OBJ_REG_SIZE];
+OS_EXT            CPU_INT08U                OSObjRegHashTbl[OS_CFG_OBJ_REG_HASH_SIZE];
+OS_EXT            CPU_INT08U                OSObjRegFreeHeadIx;         /* Free slots, oldest first                   */
+OS_EXT            CPU_INT08U                OSObjRegFreeTailIx;
+OS_EXT            OS_OBJ_QTY                OSObjRegQty;                /* Number of objects registered               */
+OS_EXT            OS_CTR                    OSObjRegOvfCtr;             /* Objects created with the registry full     */
+#endif
+
 OS_EXT            OS_STATE                  OSRunning;                  /* Flag indicating the kernel is running      */
 OS_EXT            OS_STATE                  OSInitialized;              /* Flag indicating the kernel is initialized  */
 
@@ -1246,6 +1957,10 @@ OS_EXT            OS_OBJ_QTY                OSMemQty;                   /* Numbe
                                                                         /* OS_MSG POOL ------------------------------ */
 #if (OS_MSG_EN == DEF_ENABLED)
 OS_EXT            OS_MSG_POOL               OSMsgPool;                  /* Pool of OS_MSG                             */
+#endif
+#if (OS_CFG_MSG_BUF_EN == DEF_ENABLED)
+OS_EXT            OS_MSG_BUF_CLASS          OSMsgBufClassTbl[OS_CFG_MSG_BUF_CLASS_MAX]; /* Sorted by buffer size      */
+OS_EXT            OS_OBJ_QTY                OSMsgBufClassQty;           /* Number of size classes added               */
 #endif
 
                                                                         /* MUTEX MANAGEMENT ------------------------- */
@@ -1261,6 +1976,15 @@ OS_EXT            OS_PRIO                   OSPrioCur;                  /* Prior
 OS_EXT            OS_PRIO                   OSPrioHighRdy;              /* Priority of highest priority task          */
 extern            CPU_DATA                  OSPrioTbl[OS_PRIO_TBL_SIZE];
 
+                                                                        /* PROFILER --------------------------------- */
+#if (OS_CFG_PROF_EN == DEF_ENABLED)
+OS_EXT            OS_PROF_SNAP              OSProfSnap;                 /* Latest snapshot, readable by debug tools   */
+OS_EXT            OS_PROF_OUTPUT_FNCT       OSProfOutputFnctPtr;        /* Called with every new snapshot             */
+OS_EXT            OS_CTX_SW_CTR             OSProfCtxSwCtrPrev;
+OS_EXT            OS_TICK                   OSProfTickCtrPrev;
+OS_EXT            OS_RATE_HZ                OSProfStatCtr;              /* Stat task runs left before next snapshot   */
+#endif
+
                                                                         /* QUEUES ----------------------------------- */
 #if (OS_CFG_Q_EN == DEF_ENABLED)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -1271,6 +1995,14 @@ OS_EXT            OS_OBJ_QTY                OSQQty;                     /* Numbe
 
 
 
+                                                                        /* READER-WRITER LOCKS ---------------------- */
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+OS_EXT            OS_RWLOCK                *OSRWLockDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSRWLockQty;                /* Number of reader-writer locks created      */
+#endif
+#endif
+
                                                                         /* READY LIST ------------------------------- */
 OS_EXT            OS_RDY_LIST               OSRdyList[OS_CFG_PRIO_MAX]; /* Table of tasks ready to run                */
 
@@ -1289,6 +2021,13 @@ OS_EXT            OS_NESTING_CTR            OSSchedLockNestingCtr;      /* Lock
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
 OS_EXT            OS_TICK                   OSSchedRoundRobinDfltTimeQuanta;
 OS_EXT            CPU_BOOLEAN               OSSchedRoundRobinEn;        /* Enable/Disable round-robin scheduling      */
+#endif
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+OS_EXT            OS_EDF_UTIL               OSEdfUtil;                  /* Total utilization admitted in EDF class    */
+OS_EXT            OS_OBJ_QTY                OSEdfTaskQty;               /* Number of tasks in the EDF class           */
+#endif
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+OS_EXT            OS_TCB                   *OSBudgetListPtr;            /* List of the tasks with a CPU budget        */
 #endif
                                                                         /* SEMAPHORES ------------------------------- */
 #if (OS_CFG_SEM_EN == DEF_ENABLED)
@@ -1319,6 +2058,22 @@ OS_EXT            OS_TCB                    OSStatTaskTCB;
 #if (OS_CFG_TS_EN == DEF_ENABLED)
 OS_EXT            CPU_TS                    OSStatTaskTimeMax;
 #endif
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+OS_EXT            OS_CPU_USAGE_EMA          OSStatTaskCPUUsageEMA[OS_STAT_EMA_NBR];
+OS_EXT            OS_CPU_USAGE              OSStatIntCPUUsage;          /* CPU Usage of the ISRs in %                 */
+OS_EXT            OS_CPU_USAGE_EMA          OSStatIntCPUUsageEMA[OS_STAT_EMA_NBR];
+OS_EXT            OS_STAT_ISR               OSStatISRTbl[OS_CFG_STAT_ISR_TBL_SIZE];
+OS_EXT            OS_CYCLES                 OSStatIntCyclesTotal;       /* Cycles spent in all ISRs                   */
+OS_EXT            CPU_TS                    OSStatIntTS;                /* Start of the running ISR slice             */
+OS_EXT            CPU_TS                    OSStatIntEntryTS;           /* Entry of the outermost ISR                 */
+OS_EXT            CPU_INT16U                OSStatIntNbrTbl[OS_STAT_INT_NEST_MAX];
+OS_EXT            OS_TCB                   *OSStatTaskTCBPtr;           /* Next task to update                        */
+OS_EXT            OS_CYCLES                 OSStatIdleCyclesPrev;
+OS_EXT            OS_CYCLES                 OSStatIntCyclesPrev;
+OS_EXT            CPU_TS                    OSStatTS;                   /* Time of the previous statistic task run    */
+OS_EXT            CPU_TS                    OSStatSleepTS;              /* Time slept missed by the timestamp timer   */
+OS_EXT            OS_TICK                   OSStatTickCtr;              /* OSTickCtr at the previous run              */
+#endif
 #endif
 
                                                                         /* TASKS ------------------------------------ */
@@ -1328,6 +2083,9 @@ OS_EXT            OS_CTX_SW_CTR             OSTaskCtxSwCtr;             /* Numbe
 OS_EXT            OS_TCB                   *OSTaskDbgListPtr;
 #endif
 #endif
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+OS_EXT            OS_TCB                   *OSTaskStkScanTCBPtr;        /* Task whose stack is being scanned          */
+#endif
 
 OS_EXT            OS_OBJ_QTY                OSTaskQty;                  /* Number of tasks created                    */
 
@@ -1394,6 +2152,14 @@ extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkLimit;
 extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkSize;
 extern  CPU_INT32U    const OSCfg_IdleTaskStkSizeRAM;
 
+extern  OS_INT_Q    * const OSCfg_IntQBasePtr;
+extern  OS_OBJ_QTY    const OSCfg_IntQSize;
+extern  CPU_INT32U    const OSCfg_IntQSizeRAM;
+extern  CPU_STK     * const OSCfg_IntQTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkSize;
+extern  CPU_INT32U    const OSCfg_IntQTaskStkSizeRAM;
+
 extern  CPU_STK     * const OSCfg_ISRStkBasePtr;
 extern  CPU_STK_SIZE  const OSCfg_ISRStkSize;
 extern  CPU_INT32U    const OSCfg_ISRStkSizeRAM;
@@ -1402,6 +2168,8 @@ extern  OS_MSG_SIZE   const OSCfg_MsgPoolSize;
 extern  CPU_INT32U    const OSCfg_MsgPoolSizeRAM;
 extern  OS_MSG      * const OSCfg_MsgPoolBasePtr;
 
+extern  OS_RATE_HZ    const OSCfg_ProfRate_Hz;
+
 extern  OS_PRIO       const OSCfg_StatTaskPrio;
 extern  OS_RATE_HZ    const OSCfg_StatTaskRate_Hz;
 extern  CPU_STK     * const OSCfg_StatTaskStkBasePtr;
@@ -1429,6 +2197,11 @@ extern  CPU_INT32U    const OSCfg_TmrTaskStkSizeRAM;
 extern  CPU_STK        OSCfg_IdleTaskStk[OS_CFG_IDLE_TASK_STK_SIZE];
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+extern  OS_INT_Q       OSCfg_IntQ[OS_CFG_INT_Q_SIZE];
+extern  CPU_STK        OSCfg_IntQTaskStk[OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
+
 #if (OS_CFG_ISR_STK_SIZE > 0u)
 extern  CPU_STK        OSCfg_ISRStk[];
 #endif
@@ -1487,6 +2260,15 @@ OS_OBJ_QTY    OSFlagPendAbort           (OS_FLAG_GRP           *p_grp,
 
 OS_FLAGS      OSFlagPendGetFlagsRdy     (OS_ERR                *p_err);
 
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+OS_OBJ_QTY    OSFlagPendMulti           (OS_FLAG_PEND_DATA     *p_pend_data_tbl,
+                                         OS_OBJ_QTY             tbl_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+#endif
+
 OS_FLAGS      OSFlagPost                (OS_FLAG_GRP           *p_grp,
                                          OS_FLAGS               flags,
                                          OS_OPT                 opt,
@@ -1510,6 +2292,82 @@ void          OS_FlagDbgListRemove      (OS_FLAG_GRP           *p_grp);
 void          OS_FlagTaskRdy            (OS_TCB                *p_tcb,
                                          OS_FLAGS               flags_rdy,
                                          CPU_TS                 ts);
+
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+void          OS_FlagWaitRemove         (OS_TCB                *p_tcb);
+#endif
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                   ISR POST QUEUE                                                   */
+/* ================================================================================================================== */
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_IntQPost               (OS_OBJ_TYPE            type,
+                                         void                  *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OS_IntQTask               (void                  *p_arg);
+
+void          OS_IntQTaskInit           (OS_ERR                *p_err);
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                 LATENCY HISTOGRAMS                                                 */
+/* ================================================================================================================== */
+
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+void          OSLatHistGet              (CPU_INT08U             hist,
+                                         OS_LAT_HIST           *p_hist,
+                                         OS_ERR                *p_err);
+
+CPU_TS        OSLatPercentileGet        (CPU_INT08U             hist,
+                                         CPU_INT16U             permille,
+                                         OS_ERR                *p_err);
+
+void          OSLatReset                (OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_LatInit                (void);
+
+void          OS_LatHistAdd             (CPU_INT08U             hist,
+                                         CPU_TS                 delta);
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                  POWER MANAGEMENT                                                  */
+/* ================================================================================================================== */
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+void          OSPwrLatMaxSet            (CPU_INT32U             lat_us,
+                                         OS_ERR                *p_err);
+
+void          OSPwrReset                (OS_ERR                *p_err);
+
+void          OSPwrStatGet              (CPU_INT08U             state,
+                                         OS_PWR_STAT           *p_stat,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_PwrIdle                (void);
+
+void          OS_PwrInit                (void);
+
+CPU_INT32U    BSP_OS_PwrEnter           (CPU_INT08U             state,
+                                         OS_TICK                ticks,
+                                         OS_TICK               *p_ticks_slept);
 #endif
 
 
@@ -1544,6 +2402,22 @@ void          OS_MemInit                (OS_ERR                *p_err);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                                  MESSAGE BUFFERS                                                   */
+/* ================================================================================================================== */
+
+#if (OS_CFG_MSG_BUF_EN == DEF_ENABLED)
+void          OSMsgBufClassAdd          (OS_MEM                *p_mem,
+                                         OS_ERR                *p_err);
+
+void         *OSMsgBufGet               (OS_MSG_SIZE            size,
+                                         OS_ERR                *p_err);
+
+void          OSMsgBufPut               (void                  *p_buf,
+                                         OS_ERR                *p_err);
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                     MONITORS                                                       */
 /* ================================================================================================================== */
@@ -1562,6 +2436,18 @@ void          OSMonOp                   (OS_MON                *p_mon,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+void          OSMonOpKey                (OS_MON                *p_mon,
+                                         OS_TICK                timeout,
+                                         void                  *p_arg,
+                                         OS_MON_ON_ENTER_PTR    p_on_enter,
+                                         OS_MON_ON_EVAL_PTR     p_on_eval,
+                                         OS_MON_KEY             key,
+                                         OS_MON_KEYS            keys_eval,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_MON_DEL_EN == DEF_ENABLED)
 OS_OBJ_QTY    OSMonDel                  (OS_MON                *p_mon,
                                          OS_OPT                 opt,
@@ -1578,6 +2464,9 @@ void          OS_MonDbgListAdd          (OS_MON                *p_mon);
 void          OS_MonDbgListRemove       (OS_MON                *p_mon);
 #endif
 
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+void          OS_MonKeyRemove           (OS_TCB                *p_tcb);
+#endif
 #endif
 
 
@@ -1591,6 +2480,13 @@ void          OSMutexCreate             (OS_MUTEX              *p_mutex,
                                          CPU_CHAR              *p_name,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+void          OSMutexCreateCeiling      (OS_MUTEX              *p_mutex,
+                                         CPU_CHAR              *p_name,
+                                         OS_PRIO                prio,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_MUTEX_DEL_EN == DEF_ENABLED)
 OS_OBJ_QTY    OSMutexDel                (OS_MUTEX              *p_mutex,
                                          OS_OPT                 opt,
@@ -1633,6 +2529,104 @@ void          OS_MutexGrpRemove         (OS_TCB                *p_tcb,
 OS_PRIO       OS_MutexGrpPrioFindHighest(OS_TCB                *p_tcb);
 
 void          OS_MutexGrpPostAll        (OS_TCB                *p_tcb);
+
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED) && (OS_CFG_TASK_DEL_EN == DEF_ENABLED)
+void          OS_MutexFastAdoptAll      (OS_TCB                *p_tcb);
+#endif
+#endif
+
+
+/* ================================================================================================================== */
+/*                                               KERNEL OBJECT REGISTRY                                               */
+/* ================================================================================================================== */
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+OS_OBJ_HANDLE OSObjFind                 (CPU_CHAR              *p_name,
+                                         OS_OBJ_TYPE            type,
+                                         OS_ERR                *p_err);
+
+void         *OSObjGet                  (OS_OBJ_HANDLE          handle,
+                                         OS_OBJ_TYPE            type,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+OS_OBJ_HANDLE OS_ObjRegAdd              (void                  *p_obj,
+                                         OS_OBJ_TYPE            type,
+                                         CPU_CHAR              *p_name,
+                                         CPU_INT32U             hash);
+
+CPU_INT32U    OS_ObjRegHash             (CPU_CHAR              *p_name);
+
+void          OS_ObjRegInit             (void);
+
+void          OS_ObjRegRemove           (OS_OBJ_HANDLE          handle);
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                 READER-WRITER LOCKS                                                */
+/* ================================================================================================================== */
+
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+
+void          OSRWLockCreate            (OS_RWLOCK             *p_rwlock,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_RWLOCK_DEL_EN == DEF_ENABLED)
+OS_OBJ_QTY    OSRWLockDel               (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSRWLockPend              (OS_RWLOCK             *p_rwlock,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSRWLockPost              (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_RWLockClr              (OS_RWLOCK             *p_rwlock);
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void          OS_RWLockDbgListAdd       (OS_RWLOCK             *p_rwlock);
+
+void          OS_RWLockDbgListRemove    (OS_RWLOCK             *p_rwlock);
+#endif
+
+OS_PRIO       OS_RWLockGrpPrioFindHighest(OS_TCB               *p_tcb);
+
+void          OS_RWLockGrpPostAll       (OS_TCB                *p_tcb);
+
+void          OS_RWLockPendRemoved      (OS_RWLOCK             *p_rwlock,
+                                         OS_PRIO                prio);
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                      PROFILER                                                      */
+/* ================================================================================================================== */
+
+#if (OS_CFG_PROF_EN == DEF_ENABLED)
+void          OSProfOutputSet           (OS_PROF_OUTPUT_FNCT    p_fnct,
+                                         OS_ERR                *p_err);
+
+CPU_SIZE_T    OSProfSnapshotGet         (void                  *p_buf,
+                                         CPU_SIZE_T             buf_size,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_ProfInit               (void);
+
+void          OS_ProfUpdate             (void);
 #endif
 
 
@@ -1658,6 +2652,12 @@ OS_MSG_QTY    OSQFlush                  (OS_Q                  *p_q,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED)
+void          OSQMsgReserve             (OS_Q                  *p_q,
+                                         OS_MSG_QTY             nbr,
+                                         OS_ERR                *p_err);
+#endif
+
 void         *OSQPend                   (OS_Q                  *p_q,
                                          OS_TICK                timeout,
                                          OS_OPT                 opt,
@@ -1665,6 +2665,17 @@ void         *OSQPend                   (OS_Q                  *p_q,
                                          CPU_TS                *p_ts,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY    OSQPendN                  (OS_Q                  *p_q,
+                                         void                 **p_msg_tbl,
+                                         OS_MSG_SIZE           *p_size_tbl,
+                                         OS_MSG_QTY             nbr,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_Q_PEND_ABORT_EN == DEF_ENABLED)
 OS_OBJ_QTY    OSQPendAbort              (OS_Q                  *p_q,
                                          OS_OPT                 opt,
@@ -1677,6 +2688,15 @@ void          OSQPost                   (OS_Q                  *p_q,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY    OSQPostN                  (OS_Q                  *p_q,
+                                         void                 **p_msg_tbl,
+                                         OS_MSG_SIZE           *p_size_tbl,
+                                         OS_MSG_QTY             nbr,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_QClr                   (OS_Q                  *p_q);
@@ -1771,6 +2791,25 @@ void          OSTaskDel                 (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+void          OSTaskEdfSet              (OS_TCB                *p_tcb,
+                                         OS_TICK                period,
+                                         OS_TICK                deadline,
+                                         OS_TICK                wcet,
+                                         OS_ERR                *p_err);
+
+void          OSTaskEdfWait             (OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+void          OSTaskBudgetSet           (OS_TCB                *p_tcb,
+                                         OS_TICK                budget,
+                                         OS_TICK                period,
+                                         OS_PRIO                prio,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
 OS_MSG_QTY    OSTaskQFlush              (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
@@ -1871,6 +2910,10 @@ void          OS_TaskInitTCB            (OS_TCB                *p_tcb);
 
 void          OS_TaskReturn             (void);
 
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+void          OS_TaskStkScan            (void);
+#endif
+
 #if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
 CPU_BOOLEAN   OS_TaskStkRedzoneChk      (CPU_STK               *p_base,
                                          CPU_STK_SIZE           stk_size);
@@ -2047,6 +3090,15 @@ void          OS_IdleTaskInit           (OS_ERR                *p_err);
 void          OS_StatTask               (void                  *p_arg);
 #endif
 
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+void          OS_StatIntEnter           (void);
+
+void          OS_StatIntExit            (void);
+
+void          OS_StatSleepAdd           (CPU_TS                 ts_counted,
+                                         CPU_INT32U             slept_us);
+#endif
+
 void          OS_StatTaskInit           (OS_ERR                *p_err);
 
 void          OS_TickTask               (void                  *p_arg);
@@ -2115,6 +3167,14 @@ void         *OS_MsgQGet                (OS_MSG_Q              *p_msg_q,
                                          CPU_TS                *p_ts,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY    OS_MsgQGetN               (OS_MSG_Q              *p_msg_q,
+                                         void                 **p_msg_tbl,
+                                         OS_MSG_SIZE           *p_size_tbl,
+                                         OS_MSG_QTY             nbr,
+                                         CPU_TS                *p_ts);
+#endif
+
 void          OS_MsgQInit               (OS_MSG_Q              *p_msg_q,
                                          OS_MSG_QTY             size);
 
@@ -2125,6 +3185,14 @@ void          OS_MsgQPut                (OS_MSG_Q              *p_msg_q,
                                          CPU_TS                 ts,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED)
+void          OS_MsgQResv               (OS_MSG_Q              *p_msg_q,
+                                         OS_MSG_QTY             nbr,
+                                         OS_ERR                *p_err);
+
+void          OS_MsgQResvRelease        (OS_MSG_Q              *p_msg_q);
+#endif
+
 /* ---------------------------------------------- PEND/POST MANAGEMENT ---------------------------------------------- */
 
 void          OS_Pend                   (OS_PEND_OBJ           *p_obj,
@@ -2160,6 +3228,22 @@ void          OS_SchedLockTimeMeasStop  (void);
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
 void          OS_SchedRoundRobin        (OS_RDY_LIST           *p_rdy_list);
+
+void          OS_SchedRoundRobinReload  (OS_TCB                *p_tcb);
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+void          OS_EdfRdyListInsert       (OS_TCB                *p_tcb);
+
+void          OS_EdfTaskRemove          (OS_TCB                *p_tcb);
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+void          OS_BudgetCharge           (void);
+
+void          OS_BudgetUpdate           (OS_TICK                ticks);
+
+void          OS_BudgetTaskRemove       (OS_TCB                *p_tcb);
 #endif
 
 /* --------------------------------------------- READY LIST MANAGEMENT ---------------------------------------------- */
@@ -2276,6 +3360,13 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 
 #ifndef OS_CFG_SCHED_ROUND_ROBIN_EN
 #error  "OS_CFG.H, Missing OS_CFG_SCHED_ROUND_ROBIN_EN: Include code for Round Robin Scheduling"
+#else
+    #if    (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED) && \
+          ((OS_CFG_SCHED_ROUND_ROBIN_EN    == DEF_DISABLED) || \
+           (OS_CFG_TS_EN                   == DEF_DISABLED) || \
+           (OS_CFG_TASK_PROFILE_EN         == DEF_DISABLED))
+    #error  "OS_CFG.H,         OS_CFG_SCHED_ROUND_ROBIN_EN, OS_CFG_TS_EN and OS_CFG_TASK_PROFILE_EN must be Enabled (1) for time slices in microseconds"
+    #endif
 #endif
 
 
@@ -2312,6 +3403,210 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
     #ifndef OS_CFG_FLAG_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_FLAG_PEND_ABORT_EN: Include code for aborting pends from another task"
     #endif
+
+    #if    (OS_CFG_FLAG_IDX_EN == DEF_ENABLED) && \
+           (OS_CFG_FLAG_EN     == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_FLAG_EN must be Enabled (1) to index the event flag waiters"
+    #endif
+
+    #if    (OS_CFG_FLAG_IDX_EN      == DEF_ENABLED) && \
+           (OS_CFG_FLAG_MODE_CLR_EN == DEF_ENABLED)
+    #error  "OS_CFG.H,         OS_CFG_FLAG_MODE_CLR_EN must be Disabled (0) to index the event flag waiters"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                       MONITORS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+    #if    (OS_CFG_MON_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_MON_EN must be Enabled (1) to use the monitor condition keys"
+    #endif
+
+    #if    (OS_CFG_MON_KEY_NBR <  1u) || \
+           (OS_CFG_MON_KEY_NBR > 32u)
+    #error  "OS_CFG.H,         OS_CFG_MON_KEY_NBR must be between 1 and 32 (one bit per key in OS_MON_KEYS)"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                               EARLIEST DEADLINE FIRST
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    #ifndef OS_CFG_SCHED_EDF_PRIO
+    #error  "OS_CFG.H, Missing OS_CFG_SCHED_EDF_PRIO: Priority level of the tasks scheduled by deadline"
+    #endif
+
+    #if    (OS_CFG_SCHED_EDF_PRIO <  1u) || \
+           (OS_CFG_SCHED_EDF_PRIO >= (OS_CFG_PRIO_MAX - 1u))
+    #error  "OS_CFG.H,         OS_CFG_SCHED_EDF_PRIO must be between 1 and OS_CFG_PRIO_MAX - 2"
+    #endif
+
+    #if    (OS_CFG_SCHED_EDF_UTIL_MAX <   1u) || \
+           (OS_CFG_SCHED_EDF_UTIL_MAX > 100u)
+    #error  "OS_CFG.H,         OS_CFG_SCHED_EDF_UTIL_MAX must be between 1 and 100 (percent)"
+    #endif
+
+    #if    (OS_CFG_TASK_TICK_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_TASK_TICK_EN must be Enabled (1) to release the EDF jobs"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                     CPU BUDGETS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    #if    (OS_CFG_TASK_TICK_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_TASK_TICK_EN must be Enabled (1) to enforce the CPU budgets"
+    #endif
+
+    #if    (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    #error  "OS_CFG.H,         OS_CFG_DYN_TICK_EN must be Disabled (0): CPU budgets are charged every tick"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                  STACK HIGH-WATER SCAN
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+    #if    (OS_CFG_DBG_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_DBG_EN must be Enabled (1) to scan the stacks of the tasks in the debug list"
+    #endif
+
+    #if    (OS_CFG_TASK_IDLE_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_TASK_IDLE_EN must be Enabled (1): the stacks are scanned by the idle task"
+    #endif
+
+    #if    (OS_CFG_TASK_STK_SCAN_CHUNK == 0u)
+    #error  "OS_CFG.H,         OS_CFG_TASK_STK_SCAN_CHUNK must be > 0"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                              CYCLE BASED CPU USAGE
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    #if    (OS_CFG_STAT_TASK_EN     == DEF_DISABLED) || \
+           (OS_CFG_TS_EN            == DEF_DISABLED) || \
+           (OS_CFG_TASK_PROFILE_EN  == DEF_DISABLED) || \
+           (OS_CFG_DBG_EN           == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_STAT_TASK_EN, OS_CFG_TS_EN, OS_CFG_TASK_PROFILE_EN and OS_CFG_DBG_EN must be Enabled (1) for cycle based CPU usage"
+    #endif
+
+    #if    (OS_CFG_TASK_IDLE_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_TASK_IDLE_EN must be Enabled (1): the idle time is the run time of the idle task"
+    #endif
+
+    #if    (OS_CFG_STAT_TASK_BATCH == 0u)
+    #error  "OS_CFG.H,         OS_CFG_STAT_TASK_BATCH must be > 0"
+    #endif
+
+    #if    (OS_CFG_STAT_ISR_TBL_SIZE == 0u)
+    #error  "OS_CFG.H,         OS_CFG_STAT_ISR_TBL_SIZE must be > 0"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                    ISR POST QUEUE
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    #ifndef OS_CFG_INT_Q_SIZE
+    #error  "OS_CFG_APP.H, Missing OS_CFG_INT_Q_SIZE: Number of entries in the ISR post queue"
+    #endif
+
+    #if    (OS_CFG_INT_Q_SIZE < 2u) || \
+          ((OS_CFG_INT_Q_SIZE & (OS_CFG_INT_Q_SIZE - 1u)) != 0u)
+    #error  "OS_CFG_APP.H,     OS_CFG_INT_Q_SIZE must be a power of 2 and >= 2"
+    #endif
+
+    #ifndef OS_CFG_INT_Q_TASK_STK_SIZE
+    #error  "OS_CFG_APP.H, Missing OS_CFG_INT_Q_TASK_STK_SIZE: Stack size of the ISR post queue task"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                  LATENCY HISTOGRAMS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+    #if    (OS_CFG_TS_EN                   == DEF_DISABLED) || \
+           (OS_CFG_SCHED_LOCK_TIME_MEAS_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_TS_EN and OS_CFG_SCHED_LOCK_TIME_MEAS_EN must be Enabled (1) to use the latency histograms"
+    #endif
+
+    #if    !defined(CPU_CFG_INT_DIS_MEAS_EN) || \
+           !defined(CPU_CFG_INT_DIS_MEAS_HIST_EN)
+    #error  "CPU_CFG.H,        CPU_CFG_INT_DIS_MEAS_EN and CPU_CFG_INT_DIS_MEAS_HIST_EN must be #define'd to use the latency histograms"
+    #endif
+
+    #if    (CPU_INT_DIS_MEAS_HIST_NBR != OS_LAT_HIST_NBR_BUCKETS)
+    #error  "CPU_CORE.H,       CPU_INT_DIS_MEAS_HIST_NBR must match OS_LAT_HIST_NBR_BUCKETS"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                   POWER MANAGEMENT
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+    #if    (OS_CFG_TASK_IDLE_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_TASK_IDLE_EN must be Enabled (1) to use the power management"
+    #endif
+
+    #if    (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    #error  "OS_CFG.H,         OS_CFG_DYN_TICK_EN must be Disabled (0): the idle task stops the periodic tick itself"
+    #endif
+
+    #if    (OS_CFG_PWR_SLEEP_RESIDENCY_US < OS_CFG_PWR_SLEEP_LAT_US) || \
+           (OS_CFG_PWR_STOP_RESIDENCY_US  < OS_CFG_PWR_STOP_LAT_US)
+    #error  "OS_CFG_APP.H,     OS_CFG_PWR_xxx_RESIDENCY_US must be >= OS_CFG_PWR_xxx_LAT_US"
+    #endif
+
+    #if    (OS_CFG_PWR_STOP_LAT_US       < OS_CFG_PWR_SLEEP_LAT_US) || \
+           (OS_CFG_PWR_STOP_RESIDENCY_US < OS_CFG_PWR_SLEEP_RESIDENCY_US)
+    #error  "OS_CFG_APP.H,     OS_CFG_PWR_STOP_xxx_US must be >= OS_CFG_PWR_SLEEP_xxx_US"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                               KERNEL OBJECT REGISTRY
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    #if    (OS_CFG_OBJ_REG_SIZE < 1u) || \
+           (OS_CFG_OBJ_REG_SIZE > 255u)
+    #error  "OS_CFG.H,         OS_CFG_OBJ_REG_SIZE must be between 1 and 255: the slot index is 8-bit"
+    #endif
+
+    #if    (OS_CFG_OBJ_REG_HASH_SIZE <= OS_CFG_OBJ_REG_SIZE) || \
+           (OS_CFG_OBJ_REG_HASH_SIZE >  32768u)               || \
+           ((OS_CFG_OBJ_REG_HASH_SIZE & (OS_CFG_OBJ_REG_HASH_SIZE - 1u)) != 0u)
+    #error  "OS_CFG.H,         OS_CFG_OBJ_REG_HASH_SIZE must be a power of 2 larger than OS_CFG_OBJ_REG_SIZE"
+    #endif
 #endif
 
 /*
@@ -2322,6 +3617,16 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 
 #ifndef OS_CFG_MEM_EN
 #error  "OS_CFG.H, Missing OS_CFG_MEM_EN: Enable (1) or Disable (0) code generation for MEMORY MANAGER"
+#else
+    #if    (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED) && \
+           (OS_CFG_MEM_EN           == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_MEM_EN must be Enabled (1) to use the lock-free memory partitions"
+    #endif
+
+    #if    (OS_CFG_MEM_CANARY_EN == DEF_ENABLED) && \
+           (OS_CFG_MEM_EN        == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_MEM_EN must be Enabled (1) to use the memory block canaries"
+    #endif
 #endif
 
 /*
@@ -2340,6 +3645,57 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
     #ifndef OS_CFG_MUTEX_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_MUTEX_PEND_ABORT_EN: Include code for OSMutexPendAbort()"
     #endif
+
+    #if    (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED) && \
+           (OS_CFG_MUTEX_EN         == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_MUTEX_EN must be Enabled (1) to use the priority ceiling mutexes"
+    #endif
+
+    #if    (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED) && \
+           (OS_CFG_MUTEX_EN      == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_MUTEX_EN must be Enabled (1) to use the mutex fast path"
+    #endif
+
+    #if    (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED) && \
+           (OS_CFG_TASK_DEL_EN   == DEF_ENABLED) && \
+           (OS_CFG_DBG_EN        == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_DBG_EN must be Enabled (1) for OSTaskDel() to release the fast path mutexes"
+    #endif
+
+    #if    (OS_CFG_RWLOCK_EN == DEF_ENABLED) && \
+           (OS_CFG_MUTEX_EN  == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_MUTEX_EN must be Enabled (1) to use the reader-writer locks"
+    #endif
+
+    #if    (OS_CFG_RWLOCK_EN       == DEF_ENABLED) && \
+          ((OS_CFG_RWLOCK_READ_MAX <    1u) || \
+           (OS_CFG_RWLOCK_READ_MAX >  255u))
+    #error  "OS_CFG.H,         OS_CFG_RWLOCK_READ_MAX must be between 1 and 255"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                       PROFILER
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PROF_EN == DEF_ENABLED)
+    #ifndef OS_CFG_PROF_TBL_SIZE
+    #error  "OS_CFG.H, Missing OS_CFG_PROF_TBL_SIZE: Maximum number of task records in a profiler snapshot"
+    #endif
+
+    #if    (OS_CFG_DBG_EN           == DEF_DISABLED) || \
+           (OS_CFG_TASK_PROFILE_EN  == DEF_DISABLED) || \
+           (OS_CFG_STAT_TASK_EN     == DEF_DISABLED) || \
+           (OS_CFG_TASK_TICK_EN     == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_DBG_EN, OS_CFG_TASK_PROFILE_EN, OS_CFG_STAT_TASK_EN and OS_CFG_TASK_TICK_EN must be Enabled (1) to use the profiler"
+    #endif
+
+    #if    (OS_CFG_PROF_RATE_HZ == 0u) || \
+           (OS_CFG_PROF_RATE_HZ >  OS_CFG_STAT_TASK_RATE_HZ)
+    #error  "OS_CFG_APP.H,     OS_CFG_PROF_RATE_HZ must be between 1 and OS_CFG_STAT_TASK_RATE_HZ"
+    #endif
 #endif
 
 /*
@@ -2362,6 +3718,33 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
     #ifndef OS_CFG_Q_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_Q_PEND_ABORT_EN: Include code for OSQPendAbort()"
     #endif
+
+    #if    (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED) && \
+           (OS_CFG_Q_EN             == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_Q_EN must be Enabled (1) to use OSQMsgReserve()"
+    #endif
+
+    #if    (OS_CFG_Q_BATCH_EN == DEF_ENABLED) && \
+           (OS_CFG_Q_EN       == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_Q_EN must be Enabled (1) to use OSQPostN() and OSQPendN()"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                   MESSAGE BUFFERS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_BUF_EN == DEF_ENABLED)
+    #ifndef OS_CFG_MSG_BUF_CLASS_MAX
+    #error  "OS_CFG.H, Missing OS_CFG_MSG_BUF_CLASS_MAX: Maximum number of message buffer size classes"
+    #endif
+
+    #if    (OS_CFG_MEM_EN == DEF_DISABLED) || \
+           (OS_MSG_EN     == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_MEM_EN and OS_CFG_Q_EN or OS_CFG_TASK_Q_EN must be Enabled (1) to use message buffers"
+    #endif
 #endif
 
 /*
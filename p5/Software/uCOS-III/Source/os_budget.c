@@ -0,0 +1,522 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                  TASK CPU BUDGETS
+*
+* File    : OS_BUDGET.C
+* By      : JJL
+* Version : V3.06.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+/*
+************************************************************************************************************************
+* Note(s) : (1) A task given a budget with OSTaskBudgetSet() may run 'Budget' ticks per replenishment period of
+*               'BudgetPeriod' ticks.  A period opens at the first tick charged to the task and the whole budget is
+*               given back when it closes, as a sporadic server with a single replenishment does : a task that
+*               sleeps costs nothing and a task that spins cannot take more than its budget per period.
+*
+*           (2) OSTimeTick() charges each tick to the task it interrupted, like the round robin time quanta : a task
+*               running less than a tick between two ticks may not be charged at all, a task interrupted by every
+*               tick is charged for the ISRs.  The budgets are for containing runaway tasks, not for accounting.
+*
+*           (3) The tick task replenishes the budgets and enforces them.  A task that has used its budget is either
+*               demoted to 'BudgetPrio' (OS_OPT_BUDGET_DEMOTE), where it only runs when the CPU is otherwise idle,
+*               or suspended (OS_OPT_BUDGET_SUSPEND) until the end of the period.  The enforcement takes effect
+*               within a tick of the overrun, unless the task has locked the scheduler.
+*
+*           (4) A demoted task owning a mutex keeps the priority of its highest priority waiter.  The priority is
+*               restored at replenishment unless OSTaskChangePrio() changed it in the meantime.  A suspension counts
+*               as one OSTaskSuspend() : OSTaskResume() ends it early.
+*
+*           (5) 'BudgetUsedMax' and 'BudgetOverrunCtr' in the OS_TCB tell how close to its budget a task runs and how
+*               often it ran out.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_budget__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_BudgetThrottle (OS_TCB   *p_tcb);
+
+static  void  OS_BudgetRelease  (OS_TCB   *p_tcb);
+
+static  void  OS_BudgetPrioSet  (OS_TCB   *p_tcb,
+                                 OS_PRIO   prio);
+
+
+/*
+************************************************************************************************************************
+*                                              SET THE CPU BUDGET OF A TASK
+*
+* Description: This function limits the CPU time a task may use per replenishment period, see Note #1 at the top.
+*
+* Arguments  : p_tcb        is a pointer to the task's OS_TCB.  A NULL pointer specifies the calling task.
+*
+*              budget       is the number of ticks the task may run per period.
+*
+*              period       is the replenishment period in ticks.  0 removes the budget of the task.
+*
+*              prio         is the priority of the task while it is out of budget (OS_OPT_BUDGET_DEMOTE only).
+*
+*              opt          specifies what to do when the task runs out of budget:
+*
+*                               OS_OPT_BUDGET_DEMOTE       Lower the priority of the task to 'prio'
+*                               OS_OPT_BUDGET_SUSPEND      Suspend the task
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                   The budget is set (or removed)
+*                               OS_ERR_BUDGET_PARAM_INVALID   'budget' is 0 or > 'period'
+*                               OS_ERR_OPT_INVALID            You specified an invalid option
+*                               OS_ERR_OS_NOT_RUNNING         'p_tcb' is NULL and uC/OS-III is not running yet
+*                               OS_ERR_PRIO_INVALID           'prio' is the idle task's (or the ISR handler task's)
+*                               OS_ERR_SET_ISR                If you called this function from an ISR
+*                               OS_ERR_TASK_INVALID           The tick task and the idle task can't have a budget
+*
+* Returns    : none
+*
+* Note(s)    : 1) Setting the budget of a task out of budget ends its demotion or suspension.  The next period opens at
+*                 the next tick charged to the task, the telemetry is kept.
+************************************************************************************************************************
+*/
+
+void  OSTaskBudgetSet (OS_TCB   *p_tcb,
+                       OS_TICK   budget,
+                       OS_TICK   period,
+                       OS_PRIO   prio,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    if (period > 0u) {
+        if ((budget == 0u) ||                                   /* Validate the budget                                  */
+            (budget >  period)) {
+           *p_err = OS_ERR_BUDGET_PARAM_INVALID;
+            return;
+        }
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+        switch (opt) {
+            case OS_OPT_BUDGET_DEMOTE:
+                 if (prio >= (OS_CFG_PRIO_MAX - 1u)) {          /* Cannot demote to the Idle Task priority              */
+                    *p_err = OS_ERR_PRIO_INVALID;
+                     return;
+                 }
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+                 if (prio == 0u) {                              /* Priority 0 is reserved for the ISR post queue task   */
+                    *p_err = OS_ERR_PRIO_INVALID;
+                     return;
+                 }
+#endif
+                 break;
+
+            case OS_OPT_BUDGET_SUSPEND:
+                 break;
+
+            default:
+                *p_err = OS_ERR_OPT_INVALID;
+                 return;
+        }
+#endif
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == DEF_NULL) {                                    /* Set the budget of the calling task?                  */
+        if (OSRunning != OS_STATE_OS_RUNNING) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_OS_NOT_RUNNING;
+            return;
+        }
+        p_tcb = OSTCBCurPtr;
+    }
+
+    if ((p_tcb == &OSTickTaskTCB)                               /* The tick task enforces the budgets                   */
+#if (OS_CFG_TASK_IDLE_EN == DEF_ENABLED)
+     || (p_tcb == &OSIdleTaskTCB)
+#endif
+       ) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_INVALID;
+        return;
+    }
+
+    if (p_tcb->BudgetThrottled == DEF_TRUE) {                   /* End the demotion or suspension, see Note #1          */
+        OS_BudgetRelease(p_tcb);
+    }
+
+    if (period == 0u) {
+        OS_BudgetTaskRemove(p_tcb);
+    } else if (p_tcb->BudgetPeriod == 0u) {                     /* Start charging the task                              */
+        p_tcb->BudgetNextPtr = OSBudgetListPtr;
+        OSBudgetListPtr      = p_tcb;
+    }
+    p_tcb->BudgetPeriod = period;
+    p_tcb->Budget       = budget;
+    p_tcb->BudgetUsed   = 0u;
+    p_tcb->BudgetRemain = 0u;
+    p_tcb->BudgetOpt    = opt;
+    p_tcb->BudgetPrio   = prio;
+    CPU_CRITICAL_EXIT();
+
+    OSSched();                                                  /* A released task may preempt the caller               */
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           CHARGE A TICK TO THE RUNNING TASK
+*
+* Description: This function is called by OSTimeTick() to charge the tick to the task it interrupted, see Note #2 at the
+*              top.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_BudgetCharge (void)
+{
+    OS_TCB  *p_tcb;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->BudgetPeriod > 0u) {
+        if (p_tcb->BudgetRemain == 0u) {                        /* Open a period at the first tick charged              */
+            p_tcb->BudgetRemain = p_tcb->BudgetPeriod;
+        }
+        p_tcb->BudgetUsed++;
+        if (p_tcb->BudgetUsedMax < p_tcb->BudgetUsed) {
+            p_tcb->BudgetUsedMax = p_tcb->BudgetUsed;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                         REPLENISH AND ENFORCE THE CPU BUDGETS
+*
+* Description: This function is called by the tick task to close the periods that ended and to throttle the tasks that
+*              have used their budget, see Note #3 at the top.
+*
+* Arguments  : ticks        is the number of ticks elapsed since the last call
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.  The tasks released become ready without calling
+*                 the scheduler: the tick task pends on its semaphore right after.
+************************************************************************************************************************
+*/
+
+void  OS_BudgetUpdate (OS_TICK  ticks)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = OSBudgetListPtr;
+    while (p_tcb != DEF_NULL) {
+        if (p_tcb->BudgetRemain > 0u) {
+            if (p_tcb->BudgetRemain > ticks) {
+                p_tcb->BudgetRemain -= ticks;
+            } else {                                            /* End of the period: replenish                         */
+                p_tcb->BudgetRemain  = 0u;
+                p_tcb->BudgetUsed    = 0u;
+                if (p_tcb->BudgetThrottled == DEF_TRUE) {
+                    OS_BudgetRelease(p_tcb);
+                }
+            }
+        }
+
+        if ((p_tcb->BudgetThrottled == DEF_FALSE) &&            /* Out of budget?                                       */
+            (p_tcb->BudgetUsed      >= p_tcb->Budget)) {
+            p_tcb->BudgetOverrunCtr++;
+            OS_BudgetThrottle(p_tcb);
+        }
+        p_tcb = p_tcb->BudgetNextPtr;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                          STOP CHARGING A TASK FOR CPU TIME
+*
+* Description: This function is called by OSTaskDel() and OSTaskBudgetSet() to remove a task from the list of tasks with
+*              a CPU budget.
+*
+* Arguments  : p_tcb        is a pointer to the OS_TCB of the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_BudgetTaskRemove (OS_TCB  *p_tcb)
+{
+    OS_TCB  *p_prev;
+
+
+    if (p_tcb->BudgetPeriod == 0u) {                            /* Not in the list                                      */
+        return;
+    }
+
+    if (OSBudgetListPtr == p_tcb) {
+        OSBudgetListPtr = p_tcb->BudgetNextPtr;
+    } else {
+        p_prev = OSBudgetListPtr;
+        while (p_prev->BudgetNextPtr != p_tcb) {
+            p_prev = p_prev->BudgetNextPtr;
+        }
+        p_prev->BudgetNextPtr = p_tcb->BudgetNextPtr;
+    }
+    p_tcb->BudgetNextPtr = DEF_NULL;
+    p_tcb->BudgetPeriod  = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             THROTTLE A TASK OUT OF BUDGET
+*
+* Description: This function demotes or suspends a task that has used its budget, see Note #3 at the top.  The states
+*              are changed the same way as by OSTaskSuspend().
+*
+* Arguments  : p_tcb        is a pointer to the OS_TCB of the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_BudgetThrottle (OS_TCB  *p_tcb)
+{
+    p_tcb->BudgetThrottled = DEF_TRUE;
+
+    if (p_tcb->BudgetOpt == OS_OPT_BUDGET_DEMOTE) {
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+        p_tcb->BudgetPrioSave = p_tcb->BasePrio;
+#else
+        p_tcb->BudgetPrioSave = p_tcb->Prio;
+#endif
+        OS_BudgetPrioSet(p_tcb, p_tcb->BudgetPrio);
+        return;
+    }
+
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+             p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+             p_tcb->SuspendCtr = 1u;
+             OS_RdyListRemove(p_tcb);
+             break;
+
+        case OS_TASK_STATE_DLY:
+             p_tcb->TaskState  = OS_TASK_STATE_DLY_SUSPENDED;
+             p_tcb->SuspendCtr = 1u;
+             break;
+
+        case OS_TASK_STATE_PEND:
+             p_tcb->TaskState  = OS_TASK_STATE_PEND_SUSPENDED;
+             p_tcb->SuspendCtr = 1u;
+             break;
+
+        case OS_TASK_STATE_PEND_TIMEOUT:
+             p_tcb->TaskState  = OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED;
+             p_tcb->SuspendCtr = 1u;
+             break;
+
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)-1) {     /* Already suspended as deep as it gets                 */
+                 p_tcb->BudgetThrottled = DEF_FALSE;
+                 return;
+             }
+             p_tcb->SuspendCtr++;
+             break;
+
+        default:
+             p_tcb->BudgetThrottled = DEF_FALSE;
+             return;
+    }
+    OS_TRACE_TASK_SUSPEND(p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            RELEASE A TASK AT REPLENISHMENT
+*
+* Description: This function restores the priority of a demoted task or resumes a suspended task, see Note #4 at the
+*              top.  The states are changed the same way as by OSTaskResume().
+*
+* Arguments  : p_tcb        is a pointer to the OS_TCB of the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_BudgetRelease (OS_TCB  *p_tcb)
+{
+    p_tcb->BudgetThrottled = DEF_FALSE;
+
+    if (p_tcb->BudgetOpt == OS_OPT_BUDGET_DEMOTE) {
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+        if (p_tcb->BasePrio == p_tcb->BudgetPrio) {             /* Unless the priority was changed meanwhile            */
+#else
+        if (p_tcb->Prio     == p_tcb->BudgetPrio) {
+#endif
+            OS_BudgetPrioSet(p_tcb, p_tcb->BudgetPrioSave);
+        }
+        return;
+    }
+
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_SUSPENDED:
+             p_tcb->SuspendCtr--;
+             if (p_tcb->SuspendCtr == 0u) {
+                 p_tcb->TaskState = OS_TASK_STATE_RDY;
+                 OS_RdyListInsert(p_tcb);                       /* Insert the task in the ready list                    */
+             }
+             break;
+
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             p_tcb->SuspendCtr--;
+             if (p_tcb->SuspendCtr == 0u) {
+                 p_tcb->TaskState = OS_TASK_STATE_DLY;
+             }
+             break;
+
+        case OS_TASK_STATE_PEND_SUSPENDED:
+             p_tcb->SuspendCtr--;
+             if (p_tcb->SuspendCtr == 0u) {
+                 p_tcb->TaskState = OS_TASK_STATE_PEND;
+             }
+             break;
+
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             p_tcb->SuspendCtr--;
+             if (p_tcb->SuspendCtr == 0u) {
+                 p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
+             }
+             break;
+
+        default:                                                /* Resumed by OSTaskResume() already                    */
+             return;
+    }
+    OS_TRACE_TASK_RESUME(p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          CHANGE THE PRIORITY OF A THROTTLED TASK
+*
+* Description: This function changes the base priority of a task the same way as OSTaskChangePrio() : a task owning a
+*              mutex is not lowered below the priority of its highest priority waiter.
+*
+* Arguments  : p_tcb        is a pointer to the OS_TCB of the task
+*
+*              prio         is the new base priority of the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_BudgetPrioSet (OS_TCB   *p_tcb,
+                                OS_PRIO   prio)
+{
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    OS_PRIO  prio_high;
+
+
+    p_tcb->BasePrio = prio;                                     /* Update base priority                                 */
+
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+    if ((p_tcb->MutexGrpHeadPtr  != DEF_NULL) ||                /* Owning a mutex or a write lock?                      */
+        (p_tcb->RWLockGrpHeadPtr != DEF_NULL)) {
+#else
+    if (p_tcb->MutexGrpHeadPtr != DEF_NULL) {                   /* Owning a mutex?                                      */
+#endif
+        if (prio > p_tcb->Prio) {
+            prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
+            if (prio > prio_high) {
+                prio = prio_high;
+            }
+        }
+    }
+#endif
+
+    if (prio != p_tcb->Prio) {
+        OS_TaskChangePrio(p_tcb, prio);
+        OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio);
+    }
+}
+#endif
@@ -96,8 +96,21 @@ void  OSInit (OS_ERR  *p_err)
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
     OSSchedRoundRobinEn             = DEF_FALSE;
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+    OSSchedRoundRobinDfltTimeQuanta = 1000000u / 10u;           /* Time slices in microseconds                          */
+#else
     OSSchedRoundRobinDfltTimeQuanta = OSCfg_TickRate_Hz / 10u;
 #endif
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    OSEdfUtil                       = 0u;                       /* No task in the EDF class                             */
+    OSEdfTaskQty                    = 0u;
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    OSBudgetListPtr                 = DEF_NULL;                 /* No task with a CPU budget                            */
+#endif
 
 #if (OS_CFG_ISR_STK_SIZE > 0u)
     p_stk = OSCfg_ISRStkBasePtr;                                /* Clear exception stack for stack checking.            */
@@ -136,6 +149,10 @@ void  OSInit (OS_ERR  *p_err)
 
     OS_RdyListInit();                                           /* Initialize the Ready List                            */
 
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_ObjRegInit();                                            /* Initialize the object registry, before any object    */
+#endif
+
 
 #if (OS_CFG_FLAG_EN == DEF_ENABLED)                             /* Initialize the Event Flag module                     */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -168,6 +185,14 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)                           /* Initialize the Reader-Writer Lock Manager module     */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OSRWLockDbgListPtr = DEF_NULL;
+    OSRWLockQty        = 0u;
+#endif
+#endif
+
+
 #if (OS_CFG_Q_EN == DEF_ENABLED)                                /* Initialize the Message Queue Manager module          */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OSQDbgListPtr = DEF_NULL;
@@ -214,6 +239,29 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    OS_IntQTaskInit(p_err);                                     /* Initialize the ISR post queue and its task           */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+
+#if (OS_CFG_PROF_EN == DEF_ENABLED)                             /* Initialize the profiler before the Statistic Task    */
+    OS_ProfInit();
+#endif
+
+
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+    OS_LatInit();                                               /* Initialize the latency histograms                    */
+#endif
+
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+    OS_PwrInit();                                               /* Initialize the power management                      */
+#endif
+
+
 #if (OS_CFG_STAT_TASK_EN == DEF_ENABLED)                        /* Initialize the Statistic Task                        */
     OS_StatTaskInit(p_err);
     if (*p_err != OS_ERR_NONE) {
@@ -282,6 +330,16 @@ void  OSIntEnter (void)
     }
 
     OSIntNestingCtr++;                                          /* Increment ISR nesting level                          */
+
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    OS_StatIntEnter();                                          /* Charge the ISR cycles to the ISR                     */
+#endif
+
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+    if (OSIntNestingCtr == 1u) {                                /* Start of the ISR to task latency                     */
+        OSLatISR_TS = OS_TS_GET();
+    }
+#endif
 }
 
 
@@ -325,6 +383,9 @@ void  OSIntExit (void)
         CPU_INT_EN();
         return;
     }
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    OS_StatIntExit();                                           /* Not to the task it interrupted                       */
+#endif
     OSIntNestingCtr--;
     if (OSIntNestingCtr > 0u) {                                 /* ISRs still nested?                                   */
         OS_TRACE_ISR_EXIT();
@@ -386,6 +447,10 @@ void  OSIntExit (void)
     OS_TLS_TaskSw();
 #endif
 
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+    OSLatISR_Pending = DEF_TRUE;                                /* OSTaskSwHook() ends the ISR to task latency          */
+#endif
+
     OS_TRACE_ISR_EXIT_TO_SCHEDULER();
 
     OSIntCtxSw();                                               /* Perform interrupt level ctx switch                   */
@@ -661,6 +726,7 @@ void  OSSchedUnlock (OS_ERR  *p_err)
 * Arguments  : en                determines whether round-robin will be enabled (when DEF_EN) or not (when DEF_DIS)
 *
 *              dflt_time_quanta  default number of ticks between time slices.  0 means OSCfg_TickRate_Hz / 10.
+*                                (in microseconds when OS_CFG_SCHED_ROUND_ROBIN_US_EN is enabled, 0 means 100000)
 *
 *              p_err             is a pointer to a variable that will contain an error code returned by this function.
 *
@@ -698,7 +764,11 @@ void  OSSchedRoundRobinCfg (CPU_BOOLEAN   en,
     if (dflt_time_quanta > 0u) {
         OSSchedRoundRobinDfltTimeQuanta = dflt_time_quanta;
     } else {
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+        OSSchedRoundRobinDfltTimeQuanta = (OS_TICK)(1000000u / 10u);
+#else
         OSSchedRoundRobinDfltTimeQuanta = (OS_TICK)(OSCfg_TickRate_Hz / 10u);
+#endif
     }
     CPU_CRITICAL_EXIT();
    *p_err = OS_ERR_NONE;
@@ -766,14 +836,18 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
        *p_err = OS_ERR_ROUND_ROBIN_1;
         return;
     }
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (OSPrioCur == OS_CFG_SCHED_EDF_PRIO) {                   /* EDF tasks are not time sliced                        */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_ROUND_ROBIN_1;
+        return;
+    }
+#endif
 
+    p_tcb = p_rdy_list->HeadPtr;
+    p_tcb->TimeQuantaYieldCtr++;
     OS_RdyListMoveHeadToTail(p_rdy_list);                       /* Move current OS_TCB to the end of the list           */
-    p_tcb = p_rdy_list->HeadPtr;                                /* Point to new OS_TCB at head of the list              */
-    if (p_tcb->TimeQuanta == 0u) {                              /* See if we need to use the default time slice         */
-        p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta;
-    } else {
-        p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;               /* Load time slice counter with new time                */
-    }
+    OS_SchedRoundRobinReload(p_tcb);                            /* Full time slice for its next turn                    */
 
     CPU_CRITICAL_EXIT();
 
@@ -910,12 +984,21 @@ CPU_INT16U  OSVersion (OS_ERR  *p_err)
 *                 uC/OS-III would thus never recognize interrupts.
 *
 *              3) This hook has been added to allow you to do such things as STOP the CPU to conserve power.
+*
+*              4) The idle task scans a small chunk of one task stack per loop, so the high-water marks are kept up to
+*                 date at no cost to the other tasks (see OS_TaskStkScan()).
+*
+*              5) With OS_CFG_STAT_CYCLES_EN, the statistic task reads the idle time from the cycles charged to the idle
+*                 task at each context switch : the loop doesn't count and 'OSIdleTaskCtr' stays at 0.
+*
+*              6) With OS_CFG_PWR_EN, each loop ends in the power state selected by OS_PwrIdle() for the idle period
+*                 predicted from the tick lists, the timers and the CPU budgets.
 ************************************************************************************************************************
 */
 #if (OS_CFG_TASK_IDLE_EN == DEF_ENABLED)
 void  OS_IdleTask (void  *p_arg)
 {
-#if ((OS_CFG_DBG_EN == DEF_ENABLED) || (OS_CFG_STAT_TASK_EN == DEF_ENABLED))
+#if ((OS_CFG_DBG_EN == DEF_ENABLED) || (OS_CFG_STAT_TASK_EN == DEF_ENABLED)) && (OS_CFG_STAT_CYCLES_EN == DEF_DISABLED)
     CPU_SR_ALLOC();
 #endif
 
@@ -923,8 +1006,8 @@ void  OS_IdleTask (void  *p_arg)
     (void)p_arg;                                                /* Prevent compiler warning for not using 'p_arg'       */
 
     for (;;) {
-#if ((OS_CFG_DBG_EN == DEF_ENABLED) || (OS_CFG_STAT_TASK_EN == DEF_ENABLED))
-        CPU_CRITICAL_ENTER();
+#if ((OS_CFG_DBG_EN == DEF_ENABLED) || (OS_CFG_STAT_TASK_EN == DEF_ENABLED)) && (OS_CFG_STAT_CYCLES_EN == DEF_DISABLED)
+        CPU_CRITICAL_ENTER();                                   /* See Note #5                                          */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
         OSIdleTaskCtr++;
 #endif
@@ -934,9 +1017,17 @@ void  OS_IdleTask (void  *p_arg)
         CPU_CRITICAL_EXIT();
 #endif
 
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+        OS_TaskStkScan();                                       /* Track the stack high-water marks (see Note #4)       */
+#endif
+
 #if (OS_CFG_APP_HOOKS_EN == DEF_ENABLED)
         OSIdleTaskHook();                                       /* Call user definable HOOK                             */
 #endif
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+        OS_PwrIdle();                                           /* Sleep until the next interrupt (see Note #6)         */
+#endif
     }
 }
 #endif
@@ -1211,6 +1302,9 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
     OS_PEND_OBJ   *p_obj;
 
     p_obj       =  p_tcb->PendObjPtr;                           /* Get pointer to pend list                             */
+    if (p_obj == DEF_NULL) {                                    /* Indexed event flag waits are not in a pend list      */
+        return;
+    }
     p_pend_list = &p_obj->PendList;
 
     if (p_pend_list->HeadPtr->PendNextPtr != DEF_NULL) {        /* Only move if multiple entries in the list            */
@@ -1416,6 +1510,17 @@ void  OS_PendListRemove (OS_TCB  *p_tcb)
     OS_TCB        *p_prev;
 
 
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    if (p_tcb->FlagPendDataTblPtr != DEF_NULL) {                /* Unlink event flag waits from the waiter index        */
+        OS_FlagWaitRemove(p_tcb);
+    }
+#endif
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+    if (p_tcb->MonData.p_key_mon != DEF_NULL) {                 /* Unregister from the key list of a monitor            */
+        OS_MonKeyRemove(p_tcb);
+    }
+#endif
+
     if (p_tcb->PendObjPtr != DEF_NULL) {                        /* Only remove if object has a pend list.               */
         p_pend_list = &p_tcb->PendObjPtr->PendList;             /* Get pointer to pend list                             */
 
@@ -1704,6 +1809,13 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* EDF level is kept in deadline order                  */
+        OS_EdfRdyListInsert(p_tcb);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->HeadPtr == DEF_NULL) {                      /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -1789,6 +1901,17 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* EDF level is kept in deadline order                  */
+        OS_EdfRdyListInsert(p_tcb);
+        return;
+    }
+#endif
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+    OS_SchedRoundRobinReload(p_tcb);                            /* A task joining the tail gets a full time slice       */
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->HeadPtr == DEF_NULL) {                      /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -2033,6 +2156,9 @@ void  OS_SchedLockTimeMeasStop (void)
         if (OSSchedLockTimeMaxCur < delta) {                    /* Detect peak value (for resettable value)             */
             OSSchedLockTimeMaxCur = delta;
         }
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+        OS_LatHistAdd(OS_LAT_HIST_SCHED_LOCK, (CPU_TS)delta);
+#endif
     }
 }
 #endif
@@ -2051,13 +2177,27 @@ void  OS_SchedLockTimeMeasStop (void)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When OS_CFG_SCHED_ROUND_ROBIN_US_EN is enabled, the time slices are in microseconds and the time run
+*                 by a task is measured with the time stamp timer: the ticks the task spent preempted by higher
+*                 priority tasks are not charged to it.  A slice is still ended by a tick, 'TimeQuantaCyclesOverMax'
+*                 tells how far past its end a task ran.
+*
+*              3) The microseconds are converted with the frequency of the time stamp timer at the first tick of each
+*                 slice, keeping the division out of OS_SchedRoundRobinReload().  Until the frequency is known, a slice
+*                 lasts until the next tick.
 ************************************************************************************************************************
 */
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
 void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 {
-    OS_TCB   *p_tcb;
+    OS_TCB           *p_tcb;
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+    CPU_TS            cycles_used;
+    CPU_TS_TMR_FREQ   ts_freq;
+    CPU_ERR           cpu_err;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -2080,6 +2220,25 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
     }
 #endif
 
+    if (p_tcb != OSTCBCurPtr) {                                 /* Only the running task uses up its time slice         */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+    if (p_tcb->TimeQuantaCycles == 0u) {                        /* Convert the time slice once per slice, see Note #3   */
+        ts_freq = CPU_TS_TmrFreqGet(&cpu_err);
+        if (cpu_err != CPU_ERR_NONE) {
+            ts_freq = 0u;
+        }
+        p_tcb->TimeQuantaCycles = (CPU_TS)(((CPU_INT64U)p_tcb->TimeQuantaCtr * ts_freq) / 1000000u);
+    }
+    cycles_used = p_tcb->TimeQuantaCyclesUsed + (OS_TS_GET() - p_tcb->CyclesStart);
+    if (cycles_used < p_tcb->TimeQuantaCycles) {                /* Task not done with its time quanta, see Note #2      */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#else
     if (p_tcb->TimeQuantaCtr > 0u) {
         p_tcb->TimeQuantaCtr--;
     }
@@ -2088,29 +2247,82 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
         CPU_CRITICAL_EXIT();
         return;
     }
+#endif
 
     if (p_rdy_list->HeadPtr == p_rdy_list->TailPtr) {           /* See if it's time to time slice current task          */
         CPU_CRITICAL_EXIT();                                    /* ... only if multiple tasks at same priority          */
         return;
     }
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (p_tcb->Prio == OS_CFG_SCHED_EDF_PRIO) {                 /* EDF tasks are not time sliced                        */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#endif
+
     if (OSSchedLockNestingCtr > 0u) {                           /* Can't round-robin if the scheduler is locked         */
         CPU_CRITICAL_EXIT();
         return;
     }
 
-    OS_RdyListMoveHeadToTail(p_rdy_list);                       /* Move current OS_TCB to the end of the list           */
-    p_tcb = p_rdy_list->HeadPtr;                                /* Point to new OS_TCB at head of the list              */
-    if (p_tcb->TimeQuanta == 0u) {                              /* See if we need to use the default time slice         */
-        p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta;
-    } else {
-        p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;               /* Load time slice counter with new time                */
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+    cycles_used -= p_tcb->TimeQuantaCycles;                     /* Cycles run past the end of the time slice            */
+    if (p_tcb->TimeQuantaCyclesOverMax < cycles_used) {
+        p_tcb->TimeQuantaCyclesOverMax = cycles_used;
     }
+#endif
+    p_tcb->TimeQuantaEndCtr++;
+    OS_RdyListMoveHeadToTail(p_rdy_list);                       /* Move current OS_TCB to the end of the list           */
+    OS_SchedRoundRobinReload(p_tcb);                            /* Full time slice for its next turn                    */
     CPU_CRITICAL_EXIT();
 }
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                                 START A NEW TIME SLICE
+*
+* Description: This function gives a task a full time slice.  It is called when a task goes to the tail of its ready
+*              list: the task at the head of a list keeps what is left of its slice while preempted.
+*
+* Arguments  : p_tcb         is a pointer to the OS_TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The cycles of a running task are charged when it is switched out, from its 'CyclesStart' : the slice
+*                 of the running task starts at the cycles it has already run so that it is charged from now on.
+*                 'TimeQuantaCtr' holds the slice in microseconds, converted to cycles by OS_SchedRoundRobin().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+void  OS_SchedRoundRobinReload (OS_TCB  *p_tcb)
+{
+    OS_TICK  time_quanta;
+
+
+    time_quanta = p_tcb->TimeQuanta;
+    if (time_quanta == 0u) {                                    /* See if we need to use the default time slice         */
+        time_quanta = OSSchedRoundRobinDfltTimeQuanta;
+    }
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+    p_tcb->TimeQuantaCycles     = 0u;                           /* Converted at the next tick                           */
+    p_tcb->TimeQuantaCyclesUsed = 0u;
+    if (p_tcb == OSTCBCurPtr) {                                 /* See Note #2                                          */
+        p_tcb->TimeQuantaCyclesUsed = (CPU_TS)0u - (OS_TS_GET() - p_tcb->CyclesStart);
+    }
+#endif
+    p_tcb->TimeQuantaCtr = time_quanta;                         /* Load time slice counter with new time                */
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                     BLOCK A TASK
@@ -62,12 +62,14 @@ OS_FLAG_GRP const  OSDbg_FlagGrp               = { 0u };
 CPU_INT08U  const  OSDbg_FlagDelEn             = OS_CFG_FLAG_DEL_EN;
 CPU_INT08U  const  OSDbg_FlagModeClrEn         = OS_CFG_FLAG_MODE_CLR_EN;
 CPU_INT08U  const  OSDbg_FlagPendAbortEn       = OS_CFG_FLAG_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_FlagIdxEn             = OS_CFG_FLAG_IDX_EN;
 CPU_INT16U  const  OSDbg_FlagGrpSize           = sizeof(OS_FLAG_GRP);          /* Size in Bytes of OS_FLAG_GRP        */
 CPU_INT16U  const  OSDbg_FlagWidth             = sizeof(OS_FLAGS);             /* Width (in bytes) of OS_FLAGS        */
 #else
 CPU_INT08U  const  OSDbg_FlagDelEn             = 0u;
 CPU_INT08U  const  OSDbg_FlagModeClrEn         = 0u;
 CPU_INT08U  const  OSDbg_FlagPendAbortEn       = 0u;
+CPU_INT08U  const  OSDbg_FlagIdxEn             = 0u;
 CPU_INT16U  const  OSDbg_FlagGrpSize           = 0u;
 CPU_INT16U  const  OSDbg_FlagWidth             = 0u;
 #endif
@@ -119,6 +121,17 @@ CPU_INT16U  const  OSDbg_PrioTblSize           = sizeof(OSPrioTbl);
 CPU_INT16U  const  OSDbg_PtrSize               = sizeof(void *);               /* Size in Bytes of a pointer          */
 
 
+OS_RWLOCK   const  OSDbg_RWLock                = { 0u };
+CPU_INT08U  const  OSDbg_RWLockEn              = OS_CFG_RWLOCK_EN;
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+CPU_INT08U  const  OSDbg_RWLockDelEn           = OS_CFG_RWLOCK_DEL_EN;
+CPU_INT16U  const  OSDbg_RWLockSize            = sizeof(OS_RWLOCK);            /* Size in bytes of OS_RWLOCK          */
+#else
+CPU_INT08U  const  OSDbg_RWLockDelEn           = 0u;
+CPU_INT16U  const  OSDbg_RWLockSize            = 0u;
+#endif
+
+
 OS_Q        const  OSDbg_Q                     = { 0u };
 CPU_INT08U  const  OSDbg_QEn                   = OS_CFG_Q_EN;
 #if (OS_CFG_Q_EN == DEF_ENABLED)
@@ -135,6 +148,17 @@ CPU_INT16U  const  OSDbg_QSize                 = 0u;
 
 
 CPU_INT08U  const  OSDbg_SchedRoundRobinEn     = OS_CFG_SCHED_ROUND_ROBIN_EN;
+CPU_INT08U  const  OSDbg_SchedRoundRobinUsEn   = OS_CFG_SCHED_ROUND_ROBIN_US_EN;
+CPU_INT08U  const  OSDbg_SchedEdfEn            = OS_CFG_SCHED_EDF_EN;
+CPU_INT08U  const  OSDbg_TaskBudgetEn          = OS_CFG_TASK_BUDGET_EN;
+CPU_INT08U  const  OSDbg_TaskStkScanEn         = OS_CFG_TASK_STK_SCAN_EN;
+CPU_INT08U  const  OSDbg_PwrEn                 = OS_CFG_PWR_EN;
+CPU_INT08U  const  OSDbg_ObjRegEn              = OS_CFG_OBJ_REG_EN;
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+CPU_INT16U  const  OSDbg_ObjRegSize            = OS_CFG_OBJ_REG_SIZE;
+#else
+CPU_INT16U  const  OSDbg_ObjRegSize            = 0u;
+#endif
 
 
 OS_SEM      const  OSDbg_Sem                   = { 0u };
@@ -159,6 +183,7 @@ CPU_INT08U  const  OSDbg_StkWidth              = sizeof(CPU_STK);
 
 CPU_INT08U  const  OSDbg_StatTaskEn            = OS_CFG_STAT_TASK_EN;
 CPU_INT08U  const  OSDbg_StatTaskStkChkEn      = OS_CFG_STAT_TASK_STK_CHK_EN;
+CPU_INT08U  const  OSDbg_StatCyclesEn          = OS_CFG_STAT_CYCLES_EN;
 
 CPU_INT08U  const  OSDbg_TaskChangePrioEn      = OS_CFG_TASK_CHANGE_PRIO_EN;
 CPU_INT08U  const  OSDbg_TaskDelEn             = OS_CFG_TASK_DEL_EN;
@@ -268,6 +293,13 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSMutexDbgListPtr)
                                   + sizeof(OSMutexQty)
 #endif
+#endif
+
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+                                  + sizeof(OSRWLockDbgListPtr)
+                                  + sizeof(OSRWLockQty)
+#endif
 #endif
 
                                   + sizeof(OSPrioCur)
@@ -296,6 +328,30 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSSchedRoundRobinEn)
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+                                  + sizeof(OSEdfUtil)
+                                  + sizeof(OSEdfTaskQty)
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+                                  + sizeof(OSBudgetListPtr)
+#endif
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+                                  + sizeof(OSPwrStatTbl)
+                                  + sizeof(OSPwrLatMax)
+                                  + sizeof(OSPwrIdleTicks)
+#endif
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+                                  + sizeof(OSObjRegTbl)
+                                  + sizeof(OSObjRegHashTbl)
+                                  + sizeof(OSObjRegFreeHeadIx)
+                                  + sizeof(OSObjRegFreeTailIx)
+                                  + sizeof(OSObjRegQty)
+                                  + sizeof(OSObjRegOvfCtr)
+#endif
+
 #if (OS_CFG_SEM_EN == DEF_ENABLED)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                                   + sizeof(OSSemDbgListPtr)
@@ -307,6 +363,9 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                                   + sizeof(OSTaskDbgListPtr)
 #endif
+#endif
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+                                  + sizeof(OSTaskStkScanTCBPtr)
 #endif
 
                                   + sizeof(OSTaskQty)
@@ -324,6 +383,22 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #if (OS_CFG_TS_EN == DEF_ENABLED)
                                   + sizeof(OSStatTaskTimeMax)
 #endif
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+                                  + sizeof(OSStatTaskCPUUsageEMA)
+                                  + sizeof(OSStatIntCPUUsage)
+                                  + sizeof(OSStatIntCPUUsageEMA)
+                                  + sizeof(OSStatISRTbl)
+                                  + sizeof(OSStatIntCyclesTotal)
+                                  + sizeof(OSStatIntTS)
+                                  + sizeof(OSStatIntEntryTS)
+                                  + sizeof(OSStatIntNbrTbl)
+                                  + sizeof(OSStatTaskTCBPtr)
+                                  + sizeof(OSStatIdleCyclesPrev)
+                                  + sizeof(OSStatIntCyclesPrev)
+                                  + sizeof(OSStatTS)
+                                  + sizeof(OSStatSleepTS)
+                                  + sizeof(OSStatTickCtr)
+#endif
 #endif
 
 #if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
@@ -408,6 +483,7 @@ void  OS_Dbg_Init (void)
     p_temp08 = (CPU_INT08U const *)&OSDbg_FlagDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_FlagModeClrEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_FlagPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_FlagIdxEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_FlagGrpSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_FlagWidth;
 #endif
@@ -443,6 +519,11 @@ void  OS_Dbg_Init (void)
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_PtrSize;
 
+    p_temp16 = (CPU_INT16U const *)&OSDbg_RWLock;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RWLockEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RWLockDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_RWLockSize;
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_Q;
     p_temp08 = (CPU_INT08U const *)&OSDbg_QEn;
 #if (OS_CFG_Q_EN == DEF_ENABLED)
@@ -453,6 +534,13 @@ void  OS_Dbg_Init (void)
 #endif
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_SchedRoundRobinEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SchedRoundRobinUsEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SchedEdfEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskBudgetEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskStkScanEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_PwrEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_ObjRegEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_ObjRegSize;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_Sem;
     p_temp08 = (CPU_INT08U const *)&OSDbg_SemEn;
@@ -470,6 +558,7 @@ void  OS_Dbg_Init (void)
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_StatTaskEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_StatTaskStkChkEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_StatCyclesEn;
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskChangePrioEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskDelEn;
@@ -0,0 +1,392 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                       EARLIEST DEADLINE FIRST (EDF) SCHEDULING
+*
+* File    : OS_EDF.C
+* By      : JJL
+* Version : V3.06.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+/*
+************************************************************************************************************************
+* Note(s) : (1) The EDF class is one priority level, OS_CFG_SCHED_EDF_PRIO, of the fixed priority scheduler : tasks at
+*               a higher priority preempt the EDF tasks and tasks at a lower priority only run when no EDF task is
+*               ready.  OSSched() is unchanged, the ready list of the EDF level is kept in deadline order instead of
+*               FIFO order so its head is the ready task with the earliest deadline.
+*
+*           (2) A task created at OS_CFG_SCHED_EDF_PRIO joins the class with OSTaskEdfSet(), giving its period, its
+*               relative deadline and its worst case execution time (WCET).  The task is admitted only if the total
+*               density of the class, the sum of WCET / min(period, deadline), stays within OS_CFG_SCHED_EDF_UTIL_MAX
+*               percent.  With deadlines equal to the periods and a 100% bound, this is the exact EDF test.
+*
+*           (3) An EDF task runs one job per period and calls OSTaskEdfWait() when the job is done : it then waits for
+*               its next release.  A job completed after its deadline is counted in 'EdfMissCtr' and the largest
+*               lateness is kept in 'EdfLatenessMax'.  A late task is released again immediately.
+*
+*           (4) Tasks at OS_CFG_SCHED_EDF_PRIO that are not in the class (not admitted yet or inheriting the priority
+*               of an EDF task through a mutex) are placed before the EDF tasks, in FIFO order.  A mutex owned by an
+*               EDF task does not inherit deadlines : keep the sections EDF tasks share short.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_edf__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_EdfTickGet (void);
+
+
+/*
+************************************************************************************************************************
+*                                              ADMIT A TASK IN THE EDF CLASS
+*
+* Description: This function sets the timing parameters of a task scheduled by deadline, see Note #2 at the top.
+*
+* Arguments  : p_tcb        is a pointer to the task's OS_TCB.  A NULL pointer specifies the calling task.
+*
+*              period       is the period of the task in ticks.  0 removes the task from the EDF class.
+*
+*              deadline     is the deadline of each job in ticks, relative to its release.  0 means the period.
+*
+*              wcet         is the worst case execution time of a job in ticks.
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                The task is admitted (or removed)
+*                               OS_ERR_EDF_ADMIT           The class would exceed OS_CFG_SCHED_EDF_UTIL_MAX
+*                               OS_ERR_EDF_PARAM_INVALID   'deadline' > 'period', 'wcet' is 0 or > 'deadline'
+*                               OS_ERR_EDF_PRIO            The task is not at OS_CFG_SCHED_EDF_PRIO
+*                               OS_ERR_SET_ISR             If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The first job of the task is released when this function is called.  Calling it again for a task of
+*                 the class changes its parameters and restarts its jobs, the counters are kept.
+*
+*              2) A task removed from the class stays at OS_CFG_SCHED_EDF_PRIO, see Note #4 at the top.  Change its
+*                 priority with OSTaskChangePrio().
+************************************************************************************************************************
+*/
+
+void  OSTaskEdfSet (OS_TCB   *p_tcb,
+                    OS_TICK   period,
+                    OS_TICK   deadline,
+                    OS_TICK   wcet,
+                    OS_ERR   *p_err)
+{
+    OS_EDF_UTIL  util;
+    OS_EDF_UTIL  util_total;
+    OS_TICK      tick_ctr;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    if (deadline == 0u) {                                       /* Implicit deadline                                    */
+        deadline = period;
+    }
+    util = 0u;
+    if (period > 0u) {
+        if ((deadline > period)  ||                             /* Validate the timing parameters                       */
+            (wcet     == 0u)     ||
+            (wcet     > deadline)) {
+           *p_err = OS_ERR_EDF_PARAM_INVALID;
+            return;
+        }
+        util = (OS_EDF_UTIL)((((CPU_INT64U)wcet * OS_EDF_UTIL_ONE) + deadline - 1u) / deadline); /* Round up density  */
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == DEF_NULL) {                                    /* Admit the calling task?                              */
+        p_tcb = OSTCBCurPtr;
+    }
+
+    if ((period      >  0u) &&
+        (p_tcb->Prio != OS_CFG_SCHED_EDF_PRIO)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_EDF_PRIO;
+        return;
+    }
+
+    util_total = OSEdfUtil - p_tcb->EdfUtil + util;             /* Admission control, see Note #2 at the top            */
+    if ((CPU_INT64U)util_total * 100u > (CPU_INT64U)OS_CFG_SCHED_EDF_UTIL_MAX * OS_EDF_UTIL_ONE) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_EDF_ADMIT;
+        return;
+    }
+
+    if (p_tcb->EdfPeriod == 0u) {
+        if (period > 0u) {
+            OSEdfTaskQty++;                                     /* One more task in the class                           */
+        }
+    } else if (period == 0u) {
+        OSEdfTaskQty--;                                         /* One less task in the class                           */
+    }
+    OSEdfUtil             = util_total;
+    tick_ctr              = OS_EdfTickGet();
+    p_tcb->EdfPeriod      = period;
+    p_tcb->EdfDeadlineRel = deadline;
+    p_tcb->EdfWCET        = wcet;
+    p_tcb->EdfUtil        = util;
+    p_tcb->EdfRelease     = tick_ctr;                           /* Release the first job now                            */
+    p_tcb->EdfDeadline    = tick_ctr + deadline;
+
+    if (p_tcb->TaskState == OS_TASK_STATE_RDY) {                /* Move the task to its place in the ready list         */
+        OS_RdyListRemove(p_tcb);
+        OS_PrioInsert(p_tcb->Prio);
+        OS_RdyListInsertTail(p_tcb);
+    }
+    CPU_CRITICAL_EXIT();
+
+    OSSched();                                                  /* An earlier deadline may preempt the task             */
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             END THE CURRENT JOB OF A TASK
+*
+* Description: This function is called by a task of the EDF class when its current job is done.  The task waits until
+*              the release of its next job, see Note #3 at the top.
+*
+* Arguments  : p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                The next job was released
+*                               OS_ERR_EDF_NOT_ADMITTED    The calling task is not in the EDF class
+*                               OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                               OS_ERR_SCHED_LOCKED        The scheduler is locked
+*                               OS_ERR_TIME_DLY_ISR        If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The releases do not drift : job 'n' is released 'n' periods after the call to OSTaskEdfSet().
+************************************************************************************************************************
+*/
+
+void  OSTaskEdfWait (OS_ERR  *p_err)
+{
+    OS_TCB   *p_tcb;
+    OS_TICK   tick_ctr;
+    OS_TICK   lateness;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't wait when the scheduler is locked              */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->EdfPeriod == 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_EDF_NOT_ADMITTED;
+        return;
+    }
+
+    tick_ctr = OS_EdfTickGet();
+    lateness = tick_ctr - p_tcb->EdfDeadline;
+    if ((lateness >  0u) &&                                     /* Completed after the deadline?                        */
+        (lateness <  OS_TICK_TH_INIT)) {
+        p_tcb->EdfMissCtr++;
+        if (lateness > p_tcb->EdfLatenessMax) {
+            p_tcb->EdfLatenessMax = lateness;
+        }
+    }
+    p_tcb->EdfJobCtr++;
+
+    p_tcb->EdfRelease  += p_tcb->EdfPeriod;                     /* Next job                                             */
+    p_tcb->EdfDeadline  = p_tcb->EdfRelease + p_tcb->EdfDeadlineRel;
+
+    OS_TickListInsertDly(p_tcb,                                 /* Wait for the release ...                             */
+                         p_tcb->EdfRelease,
+                         OS_OPT_TIME_MATCH,
+                         p_err);
+    if (*p_err == OS_ERR_NONE) {
+        OS_TRACE_TASK_DLY(p_tcb->EdfRelease - tick_ctr);
+        OS_RdyListRemove(p_tcb);
+    } else {                                                    /* ... unless it is already due: reorder by deadline    */
+        OS_RdyListRemove(p_tcb);
+        OS_PrioInsert(p_tcb->Prio);
+        OS_RdyListInsertTail(p_tcb);
+       *p_err = OS_ERR_NONE;
+    }
+    CPU_CRITICAL_EXIT();
+
+    OSSched();                                                  /* Find next task to run!                               */
+}
+
+
+/*
+************************************************************************************************************************
+*                                        INSERT A TASK IN THE EDF READY LIST
+*
+* Description: This function is called by OS_RdyListInsertHead() and OS_RdyListInsertTail() to insert a task at
+*              OS_CFG_SCHED_EDF_PRIO in the ready list.  The list is kept in deadline order, earliest first, and tasks
+*              with the same deadline are kept in FIFO order.  Tasks not in the class go first, see Note #4 at the top.
+*
+* Arguments  : p_tcb        is a pointer to the OS_TCB of the task to insert
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The deadlines are compared modulo the range of OS_TICK : the ready tasks' deadlines must be less than
+*                 OS_TICK_TH_INIT ticks apart.
+************************************************************************************************************************
+*/
+
+void  OS_EdfRdyListInsert (OS_TCB  *p_tcb)
+{
+    OS_RDY_LIST  *p_rdy_list;
+    OS_TCB       *p_prev;
+    OS_TCB       *p_next;
+
+
+    p_rdy_list = &OSRdyList[p_tcb->Prio];
+    p_prev     = DEF_NULL;
+    p_next     = p_rdy_list->HeadPtr;
+    if (p_tcb->EdfPeriod == 0u) {                               /* Not in the class: after the other such tasks         */
+        while ((p_next            != DEF_NULL) &&
+               (p_next->EdfPeriod == 0u)) {
+            p_prev = p_next;
+            p_next = p_next->NextPtr;
+        }
+    } else {                                                    /* After the tasks due no later than this one           */
+        while ((p_next != DEF_NULL) &&
+               ((p_next->EdfPeriod == 0u) ||
+                ((OS_TICK)(p_tcb->EdfDeadline - p_next->EdfDeadline) < OS_TICK_TH_INIT))) {
+            p_prev = p_next;
+            p_next = p_next->NextPtr;
+        }
+    }
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_rdy_list->NbrEntries++;                                   /* One more OS_TCB in the list                          */
+#endif
+    p_tcb->PrevPtr = p_prev;
+    p_tcb->NextPtr = p_next;
+    if (p_prev == DEF_NULL) {
+        p_rdy_list->HeadPtr = p_tcb;
+    } else {
+        p_prev->NextPtr     = p_tcb;
+    }
+    if (p_next == DEF_NULL) {
+        p_rdy_list->TailPtr = p_tcb;
+    } else {
+        p_next->PrevPtr     = p_tcb;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                         REMOVE A DELETED TASK FROM THE EDF CLASS
+*
+* Description: This function is called by OSTaskDel() to give back the share of the CPU reserved by a task of the EDF
+*              class.
+*
+* Arguments  : p_tcb        is a pointer to the OS_TCB of the task deleted
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_EdfTaskRemove (OS_TCB  *p_tcb)
+{
+    if (p_tcb->EdfPeriod > 0u) {
+        OSEdfUtil       -= p_tcb->EdfUtil;
+        OSEdfTaskQty--;
+        p_tcb->EdfPeriod = 0u;
+        p_tcb->EdfUtil   = 0u;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  READ THE TICK COUNTER
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_EdfTickGet (void)
+{
+#if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    return (BSP_OS_TickGet());
+#else
+    return (OSTickCtr);
+#endif
+}
+#endif
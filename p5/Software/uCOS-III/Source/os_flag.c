@@ -41,6 +41,40 @@ const  CPU_CHAR  *os_flag__c = "$Id: $";
 
 
 #if (OS_CFG_FLAG_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+static  void                OS_FlagBlockTbl     (OS_FLAG_PEND_DATA  *p_pend_data_tbl,
+                                                 OS_OBJ_QTY          tbl_size,
+                                                 OS_TICK             timeout);
+
+static  CPU_INT08U          OS_FlagBitHighest   (OS_FLAGS            flags);
+
+static  void                OS_FlagWaitAdd      (OS_FLAG_PEND_DATA  *p_pend_data);
+
+#if (OS_CFG_FLAG_DEL_EN == DEF_ENABLED) || (OS_CFG_FLAG_PEND_ABORT_EN == DEF_ENABLED)
+static  OS_FLAG_PEND_DATA  *OS_FlagWaitFirst    (OS_FLAG_GRP        *p_grp);
+#endif
+
+#if (OS_CFG_FLAG_PEND_ABORT_EN == DEF_ENABLED)
+static  OS_FLAG_PEND_DATA  *OS_FlagWaitHighest  (OS_FLAG_GRP        *p_grp);
+#endif
+
+static  void                OS_FlagWaitInit     (OS_FLAG_GRP        *p_grp);
+
+static  OS_OBJ_QTY          OS_FlagWaitPost     (OS_FLAG_GRP        *p_grp,
+                                                 OS_FLAGS            flags,
+                                                 CPU_TS              ts);
+
+static  OS_FLAGS            OS_FlagWaitRdy      (OS_FLAG_PEND_DATA  *p_pend_data);
+
+static  void                OS_FlagWaitUnlink   (OS_FLAG_PEND_DATA  *p_pend_data);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -71,6 +105,9 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
                     OS_FLAGS      flags,
                     OS_ERR       *p_err)
 {
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    CPU_INT32U  name_hash;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -102,6 +139,9 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
     }
 #endif
 
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    name_hash = OS_ObjRegHash(p_name);                          /* Hash the name with interrupts enabled                */
+#endif
     CPU_CRITICAL_ENTER();
 #if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
     p_grp->Type    = OS_OBJ_TYPE_FLAG;                          /* Set to event flag group type                         */
@@ -116,11 +156,17 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
     p_grp->TS      = 0u;
 #endif
     OS_PendListInit(&p_grp->PendList);
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FlagWaitInit(p_grp);
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_FlagDbgListAdd(p_grp);
     OSFlagQty++;
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    p_grp->Handle = OS_ObjRegAdd((void *)p_grp, OS_OBJ_TYPE_FLAG, p_name, name_hash);
+#endif
 
     OS_TRACE_FLAG_CREATE(p_grp, p_name);
 
@@ -168,10 +214,14 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
                        OS_OPT        opt,
                        OS_ERR       *p_err)
 {
-    OS_OBJ_QTY     nbr_tasks;
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    CPU_TS         ts;
+    OS_OBJ_QTY          nbr_tasks;
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FLAG_PEND_DATA  *p_pend_data;
+#else
+    OS_PEND_LIST       *p_pend_list;
+    OS_TCB             *p_tcb;
+#endif
+    CPU_TS              ts;
     CPU_SR_ALLOC();
 
 
@@ -224,14 +274,23 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
     }
 #endif
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_FLAG_IDX_EN == DEF_DISABLED)
     p_pend_list = &p_grp->PendList;
+#endif
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete group if no task waiting                      */
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+             if (OS_FlagWaitFirst(p_grp) == DEF_NULL) {
+#else
              if (p_pend_list->HeadPtr == DEF_NULL) {
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                  OS_FlagDbgListRemove(p_grp);
                  OSFlagQty--;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+                 OS_ObjRegRemove(p_grp->Handle);
 #endif
                  OS_TRACE_FLAG_DEL(p_grp);
                  OS_FlagClr(p_grp);
@@ -251,6 +310,16 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
 #else
              ts = 0u;
 #endif
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+             p_pend_data = OS_FlagWaitFirst(p_grp);
+             while (p_pend_data != DEF_NULL) {                  /* Remove all tasks from the waiter index               */
+                 OS_PendAbort(p_pend_data->TCBPtr,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+                 p_pend_data = OS_FlagWaitFirst(p_grp);
+             }
+#else
              while (p_pend_list->HeadPtr != DEF_NULL) {         /* Remove all tasks from the pend list                  */
                  p_tcb = p_pend_list->HeadPtr;
                  OS_PendAbort(p_tcb,
@@ -258,9 +327,13 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
                               OS_STATUS_PEND_DEL);
                  nbr_tasks++;
              }
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
              OS_FlagDbgListRemove(p_grp);
              OSFlagQty--;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+             OS_ObjRegRemove(p_grp->Handle);
 #endif
              OS_TRACE_FLAG_DEL(p_grp);
 
@@ -742,10 +815,14 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
                              OS_OPT        opt,
                              OS_ERR       *p_err)
 {
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    CPU_TS         ts;
-    OS_OBJ_QTY     nbr_tasks;
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FLAG_PEND_DATA  *p_pend_data;
+#else
+    OS_PEND_LIST       *p_pend_list;
+    OS_TCB             *p_tcb;
+#endif
+    CPU_TS              ts;
+    OS_OBJ_QTY          nbr_tasks;
     CPU_SR_ALLOC();
 
 
@@ -796,8 +873,17 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
 #endif
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    if (opt == OS_OPT_PEND_ABORT_ALL) {
+        p_pend_data = OS_FlagWaitFirst(p_grp);
+    } else {
+        p_pend_data = OS_FlagWaitHighest(p_grp);                /* Waiters are indexed by bit, not by priority          */
+    }
+    if (p_pend_data == DEF_NULL) {                              /* Any task waiting on flag group?                      */
+#else
     p_pend_list = &p_grp->PendList;
     if (p_pend_list->HeadPtr == DEF_NULL) {                     /* Any task waiting on flag group?                      */
+#endif
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
        *p_err = OS_ERR_PEND_ABORT_NONE;
         return (0u);
@@ -810,6 +896,18 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
     ts        = 0u;
 #endif
 
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    while (p_pend_data != DEF_NULL) {
+        OS_PendAbort(p_pend_data->TCBPtr,
+                     ts,
+                     OS_STATUS_PEND_ABORT);
+        nbr_tasks++;
+        if (opt != OS_OPT_PEND_ABORT_ALL) {                     /* Pend abort all tasks waiting?                        */
+            break;                                              /* No                                                   */
+        }
+        p_pend_data = OS_FlagWaitFirst(p_grp);
+    }
+#else
     while (p_pend_list->HeadPtr != DEF_NULL) {
         p_tcb = p_pend_list->HeadPtr;
         OS_PendAbort(p_tcb,
@@ -820,6 +918,7 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
             break;                                              /* No                                                   */
         }
     }
+#endif
     CPU_CRITICAL_EXIT();
 
     if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
@@ -886,6 +985,268 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (OS_ERR  *p_err)
 }
 
 
+/*
+************************************************************************************************************************
+*                                        WAIT ON SEVERAL EVENT FLAG GROUPS AT ONCE
+*
+* Description: This function is called to wait for a combination of bits to be set in ANY of several event flag groups.
+*              Each entry of the table describes the wait in one group, like the arguments of OSFlagPend() do.
+*
+* Arguments  : p_pend_data_tbl   is a pointer to a table of OS_FLAG_PEND_DATA.  For each entry, you must set:
+*
+*                                    .GrpPtr     a pointer to the event flag group to wait on
+*                                    .Flags      the bit(s) to wait for in this group
+*                                    .Opt        OS_OPT_PEND_FLAG_SET_ALL or OS_OPT_PEND_FLAG_SET_ANY
+*                                                optionally 'ADD' OS_OPT_PEND_FLAG_CONSUME
+*
+*                                .FlagsRdy of each entry is set to the flags that satisfied the wait in that group, or 0
+*                                if the wait in that group was not satisfied.
+*
+*              tbl_size          is the number of entries in the table.  The same group may not appear twice.
+*
+*              timeout           is an optional timeout (in clock ticks) that your task will wait for ANY entry to be
+*                                satisfied.  If you specify 0, however, your task will wait forever.
+*
+*              opt               determines whether the user wants to block if no entry is satisfied:
+*
+*                                    OS_OPT_PEND_BLOCKING
+*                                    OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts              is a pointer to a variable that will receive the timestamp of when an event flag group
+*                                was posted, aborted or deleted.  If you pass a NULL pointer you will not get the
+*                                timestamp.
+*
+*              p_err             is a pointer to an error code and can be:
+*
+*                                    OS_ERR_NONE                At least one entry is satisfied, see .FlagsRdy
+*                                    OS_ERR_FLAG_GRP_DUP        The same event flag group appears twice in the table
+*                                    OS_ERR_OBJ_DEL             If an event flag group was deleted
+*                                    OS_ERR_OBJ_PTR_NULL        If an entry has a NULL .GrpPtr
+*                                    OS_ERR_OBJ_TYPE            If an entry is not pointing to an event flag group
+*                                    OS_ERR_OPT_INVALID         An invalid 'opt' or entry .Opt, or an entry without .Flags
+*                                    OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                                    OS_ERR_PEND_ABORT          The wait was aborted
+*                                    OS_ERR_PEND_ISR            If you tried to PEND from an ISR
+*                                    OS_ERR_PEND_WOULD_BLOCK    If you specified non-blocking but no entry was satisfied
+*                                    OS_ERR_PTR_INVALID         If 'p_pend_data_tbl' is a NULL pointer or 'tbl_size' is 0
+*                                    OS_ERR_SCHED_LOCKED        If you called this function when the scheduler is locked
+*                                    OS_ERR_STATUS_INVALID      If the pend status has an invalid value
+*                                    OS_ERR_TIMEOUT             No entry was satisfied within the specified 'timeout'
+*
+* Returns    : The number of entries satisfied, or 0 if a timeout or an error occurred.
+*
+* Note(s)    : 1) The flags of ALL the entries satisfied are consumed if requested, not only those of the post that
+*                 readied the task.
+*
+*              2) Only available when OS_CFG_FLAG_IDX_EN is enabled : the task is linked in the waiter index of each
+*                 group rather than in a pend list, which can only hold a task once.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+OS_OBJ_QTY  OSFlagPendMulti (OS_FLAG_PEND_DATA  *p_pend_data_tbl,
+                             OS_OBJ_QTY          tbl_size,
+                             OS_TICK             timeout,
+                             OS_OPT              opt,
+                             CPU_TS             *p_ts,
+                             OS_ERR             *p_err)
+{
+    OS_FLAG_PEND_DATA  *p_pend_data;
+    OS_FLAGS            flags_rdy;
+    OS_OBJ_QTY          nbr_rdy;
+    OS_OBJ_QTY          i;
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    OS_OBJ_QTY          j;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from ISR ...                           */
+       *p_err = OS_ERR_PEND_ISR;                                /* ... can't PEND from an ISR                           */
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if ((p_pend_data_tbl == DEF_NULL) ||                        /* Validate the table                                   */
+        (tbl_size        == 0u)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+    for (i = 0u; i < tbl_size; i++) {                           /* Validate each entry                                  */
+        p_pend_data = &p_pend_data_tbl[i];
+        if (p_pend_data->GrpPtr == DEF_NULL) {
+           *p_err = OS_ERR_OBJ_PTR_NULL;
+            return (0u);
+        }
+        switch (p_pend_data->Opt) {
+            case OS_OPT_PEND_FLAG_SET_ALL:
+            case OS_OPT_PEND_FLAG_SET_ANY:
+            case OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_FLAG_CONSUME:
+            case OS_OPT_PEND_FLAG_SET_ANY | OS_OPT_PEND_FLAG_CONSUME:
+                 break;
+
+            default:
+                *p_err = OS_ERR_OPT_INVALID;
+                 return (0u);
+        }
+        if (p_pend_data->Flags == 0u) {                         /* Would be satisfied without any bit                   */
+           *p_err = OS_ERR_OPT_INVALID;
+            return (0u);
+        }
+        for (j = 0u; j < i; j++) {                              /* A group can only index a task once                   */
+            if (p_pend_data_tbl[j].GrpPtr == p_pend_data->GrpPtr) {
+               *p_err = OS_ERR_FLAG_GRP_DUP;
+                return (0u);
+            }
+        }
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    for (i = 0u; i < tbl_size; i++) {                           /* Validate that we are pointing at event flags         */
+        if (p_pend_data_tbl[i].GrpPtr->Type != OS_OBJ_TYPE_FLAG) {
+           *p_err = OS_ERR_OBJ_TYPE;
+            return (0u);
+        }
+    }
+#endif
+
+    if (p_ts != DEF_NULL) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
+
+    CPU_CRITICAL_ENTER();
+    for (i = 0u; i < tbl_size; i++) {
+        p_pend_data_tbl[i].FlagsRdy = 0u;
+    }
+    nbr_rdy = 0u;
+    for (i = 0u; i < tbl_size; i++) {                           /* See if any entry is already satisfied                */
+        p_pend_data = &p_pend_data_tbl[i];
+        flags_rdy   =  OS_FlagWaitRdy(p_pend_data);
+        if (flags_rdy != 0u) {
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+            if ((p_ts != DEF_NULL) && (nbr_rdy == 0u)) {
+               *p_ts = p_pend_data->GrpPtr->TS;
+            }
+#endif
+            p_pend_data->FlagsRdy = flags_rdy;
+            nbr_rdy++;
+        }
+    }
+
+    if (nbr_rdy == 0u) {
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_PEND_WOULD_BLOCK;                    /* Specified non-blocking so task would block           */
+            return (0u);
+        }
+        if (OSSchedLockNestingCtr > 0u) {                       /* See if called with scheduler locked ...              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;                        /* ... can't PEND when locked                           */
+            return (0u);
+        }
+
+        OSTCBCurPtr->FlagsPend = 0u;                            /* The waits are described by the table                 */
+        OSTCBCurPtr->FlagsOpt  = opt;
+        OSTCBCurPtr->FlagsRdy  = 0u;
+        OS_FlagBlockTbl(p_pend_data_tbl,
+                        tbl_size,
+                        timeout);
+        CPU_CRITICAL_EXIT();
+
+        OSSched();                                              /* Find next HPT ready to run                           */
+
+        CPU_CRITICAL_ENTER();
+        switch (OSTCBCurPtr->PendStatus) {
+            case OS_STATUS_PEND_OK:                             /* The post set .FlagsRdy of the entry it satisfied ... */
+                 for (i = 0u; i < tbl_size; i++) {              /* ... see if others are satisfied too                  */
+                     p_pend_data = &p_pend_data_tbl[i];
+                     if (p_pend_data->FlagsRdy == 0u) {
+                         p_pend_data->FlagsRdy = OS_FlagWaitRdy(p_pend_data);
+                     }
+                     if (p_pend_data->FlagsRdy != 0u) {
+                         nbr_rdy++;
+                     }
+                 }
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+                 if (p_ts != DEF_NULL) {
+                    *p_ts = OSTCBCurPtr->TS;
+                 }
+#endif
+                *p_err = OS_ERR_NONE;
+                 break;
+
+            case OS_STATUS_PEND_ABORT:                          /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+                 if (p_ts != DEF_NULL) {
+                    *p_ts = OSTCBCurPtr->TS;
+                 }
+#endif
+                *p_err = OS_ERR_PEND_ABORT;
+                 break;
+
+            case OS_STATUS_PEND_TIMEOUT:                        /* Indicate that we didn't get the flags within timeout */
+                *p_err = OS_ERR_TIMEOUT;
+                 break;
+
+            case OS_STATUS_PEND_DEL:                            /* Indicate that a group pended on has been deleted     */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+                 if (p_ts != DEF_NULL) {
+                    *p_ts = OSTCBCurPtr->TS;
+                 }
+#endif
+                *p_err = OS_ERR_OBJ_DEL;
+                 break;
+
+            default:
+                *p_err = OS_ERR_STATUS_INVALID;
+                 break;
+        }
+        if (*p_err != OS_ERR_NONE) {
+            CPU_CRITICAL_EXIT();
+            return (0u);
+        }
+    } else {
+       *p_err = OS_ERR_NONE;
+    }
+
+    for (i = 0u; i < tbl_size; i++) {                           /* Consume the flags of the entries satisfied           */
+        p_pend_data = &p_pend_data_tbl[i];
+        if ((p_pend_data->Opt & OS_OPT_PEND_FLAG_CONSUME) != 0u) {
+            p_pend_data->GrpPtr->Flags &= ~p_pend_data->FlagsRdy;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+    return (nbr_rdy);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                POST EVENT FLAG BIT(S)
@@ -925,6 +1286,9 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (OS_ERR  *p_err)
 * Returns    : the new value of the event flags bits that are still set.
 *
 * Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group.
+*
+*              2) When OS_CFG_FLAG_IDX_EN is enabled, the execution time only depends on the number of tasks waiting on
+*                 the bits that are set (see OS_FlagWaitPost()).  Clearing bits does not look at the waiters at all.
 ************************************************************************************************************************
 */
 
@@ -935,11 +1299,15 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 {
 
     OS_FLAGS       flags_cur;
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_OBJ_QTY     nbr_rdy;
+#else
     OS_FLAGS       flags_rdy;
     OS_OPT         mode;
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     OS_TCB        *p_tcb_next;
+#endif
     CPU_TS         ts;
     CPU_SR_ALLOC();
 
@@ -979,6 +1347,20 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        OS_IntQPost(OS_OBJ_TYPE_FLAG,                           /* Post to ISR queue                                    */
+                    (void *)p_grp,
+                    DEF_NULL,
+                    0u,
+                    flags,
+                    opt,
+                    p_err);
+        OS_TRACE_FLAG_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
@@ -1008,6 +1390,19 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     p_grp->TS   = ts;
 #endif
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    nbr_rdy = 0u;
+    if ((opt & OS_OPT_POST_FLAG_CLR) == 0u) {                   /* Only setting bits can satisfy a waiter               */
+        nbr_rdy = OS_FlagWaitPost(p_grp,
+                                  flags,
+                                  ts);
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((nbr_rdy > 0u) && ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();
+    }
+#else
     p_pend_list = &p_grp->PendList;
     if (p_pend_list->HeadPtr == DEF_NULL) {                     /* Any task waiting on event flag group?                */
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
@@ -1072,6 +1467,7 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
         OSSched();
     }
+#endif
 
     CPU_CRITICAL_ENTER();
     flags_cur = p_grp->Flags;
@@ -1112,7 +1508,10 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 *
 * Returns    : none
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) When OS_CFG_FLAG_IDX_EN is enabled, the task is linked in the waiter index of the group instead of its
+*                 pend list (see OS_FlagBlockTbl()).
 ************************************************************************************************************************
 */
 
@@ -1121,16 +1520,82 @@ void  OS_FlagBlock (OS_FLAG_GRP  *p_grp,
                     OS_OPT        opt,
                     OS_TICK       timeout)
 {
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FLAG_PEND_DATA  *p_pend_data;
+
+
+#endif
     OSTCBCurPtr->FlagsPend = flags;                             /* Save the flags that we need to wait for              */
     OSTCBCurPtr->FlagsOpt  = opt;                               /* Save the type of wait we are doing                   */
     OSTCBCurPtr->FlagsRdy  = 0u;
 
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    p_pend_data         = &OSTCBCurPtr->FlagPendData;
+    p_pend_data->GrpPtr =  p_grp;
+    p_pend_data->Flags  =  flags;
+    p_pend_data->Opt    =  opt;
+    OS_FlagBlockTbl(p_pend_data,
+                    1u,
+                    timeout);
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OSTCBCurPtr->DbgNamePtr = p_grp->NamePtr;
+#endif
+#else
     OS_Pend((OS_PEND_OBJ *)((void *)p_grp),
              OS_TASK_PEND_ON_FLAG,
              timeout);
+#endif
 }
 
 
+/*
+************************************************************************************************************************
+*                             SUSPEND TASK UNTIL ONE OF SEVERAL EVENT FLAG WAITS IS SATISFIED
+*
+* Description: This function is internal to uC/OS-III and is used to put a task to sleep until one of the waits described
+*              by a table of OS_FLAG_PEND_DATA is satisfied.  Each wait is linked in the waiter index of its group.
+*
+* Arguments  : p_pend_data_tbl   is a pointer to the table of waits.  None of them must be satisfied.
+*              ---------------
+*
+*              tbl_size          is the number of entries in the table
+*
+*              timeout           is the desired amount of time that the task will wait
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The task is not placed in any pend list (its .PendObjPtr is DEF_NULL).  OS_PendListRemove() unlinks the
+*                 waits through OS_FlagWaitRemove() whenever the task stops pending.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+static  void  OS_FlagBlockTbl (OS_FLAG_PEND_DATA  *p_pend_data_tbl,
+                               OS_OBJ_QTY          tbl_size,
+                               OS_TICK             timeout)
+{
+    OS_FLAG_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY          i;
+
+
+    OS_Pend(DEF_NULL,                                           /* Block without a pend list ...                        */
+            OS_TASK_PEND_ON_FLAG,
+            timeout);
+
+    for (i = 0u; i < tbl_size; i++) {                           /* ... and link each wait in the index of its group     */
+        p_pend_data           = &p_pend_data_tbl[i];
+        p_pend_data->TCBPtr   =  OSTCBCurPtr;
+        p_pend_data->FlagsRdy =  0u;
+        OS_FlagWaitAdd(p_pend_data);
+    }
+    OSTCBCurPtr->FlagPendDataTblPtr     = p_pend_data_tbl;
+    OSTCBCurPtr->FlagPendDataTblEntries = tbl_size;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                      CLEAR THE CONTENTS OF AN EVENT FLAG GROUP
@@ -1161,6 +1626,9 @@ void  OS_FlagClr (OS_FLAG_GRP  *p_grp)
     p_grp->Flags            =  0u;
     p_pend_list             = &p_grp->PendList;
     OS_PendListInit(p_pend_list);
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FlagWaitInit(p_grp);
+#endif
 }
 
 
@@ -1284,4 +1752,250 @@ void   OS_FlagTaskRdy (OS_TCB    *p_tcb,
     }
     OS_PendListRemove(p_tcb);
 }
+
+
+/*
+************************************************************************************************************************
+*                                           EVENT FLAG WAITER INDEX MANAGEMENT
+*
+* Description: These functions are internal to uC/OS-III and maintain the waiter index of an event flag group :
+*
+*                  OS_FlagWaitAdd()       Link a wait under a bit it still misses, or in the scan list
+*                  OS_FlagWaitFirst()     Return any wait linked in the group, DEF_NULL if none
+*                  OS_FlagWaitHighest()   Return the wait of the highest priority task, DEF_NULL if none
+*                  OS_FlagWaitInit()      Empty the index
+*                  OS_FlagWaitPost()      Ready the tasks whose wait is satisfied after bits were set
+*                  OS_FlagWaitRdy()       Return the flags satisfying a wait, 0 if it is not satisfied
+*                  OS_FlagWaitRemove()    Unlink all the waits of a task
+*                  OS_FlagWaitUnlink()    Unlink a wait
+*
+* Note(s)    : 1) A wait is linked in .WaitTbl[] under a bit that is CLEAR in the group.  As only OSFlagPost() sets bits,
+*                 a post only needs to look at the waits linked under the bits it sets : a wait that is still not
+*                 satisfied is moved under another bit it misses.  This is why OS_CFG_FLAG_MODE_CLR_EN must be
+*                 disabled : a CLR_xxx wait with OS_OPT_PEND_FLAG_CONSUME sets bits from OSFlagPend().
+*
+*              2) A wait for ANY of several bits is satisfied by any of them and cannot be linked under a single bit.
+*                 Those are kept in the scan list, which is only walked when a post sets one of the bits in
+*                 .WaitScanMask.  The mask is a superset of the bits waited for, recomputed while walking the list.
+*
+*              3) These functions are INTERNAL to uC/OS-III and your application should not call them.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+static  CPU_INT08U  OS_FlagBitHighest (OS_FLAGS  flags)
+{
+    CPU_DATA  lz;
+
+
+    lz = CPU_CntLeadZeros((CPU_DATA)flags);
+    return ((CPU_INT08U)((DEF_INT_CPU_NBR_BITS - 1u) - lz));
+}
+
+
+static  void  OS_FlagWaitAdd (OS_FLAG_PEND_DATA  *p_pend_data)
+{
+    OS_FLAG_GRP        *p_grp;
+    OS_FLAG_PEND_DATA  *p_head;
+    OS_FLAGS            flags_miss;
+    CPU_INT08U          bit;
+
+
+    p_grp      = p_pend_data->GrpPtr;
+    flags_miss = p_pend_data->Flags & ~p_grp->Flags;            /* Not 0, the wait is not satisfied                     */
+    if (((p_pend_data->Opt & OS_OPT_PEND_FLAG_MASK) == OS_OPT_PEND_FLAG_SET_ANY) &&
+        ((p_pend_data->Flags & (p_pend_data->Flags - 1u)) != 0u)) {
+        p_pend_data->Bit     = (CPU_INT08U)OS_FLAG_NBR_BITS;    /* ANY of several bits: scan list, see Note #2          */
+        p_head               = p_grp->WaitScanPtr;
+        p_grp->WaitScanPtr   = p_pend_data;
+        p_grp->WaitScanMask |= p_pend_data->Flags;
+    } else {
+        bit                  = OS_FlagBitHighest(flags_miss);   /* Link under a missing bit, see Note #1                */
+        p_pend_data->Bit     = bit;
+        p_head               = p_grp->WaitTbl[bit];
+        p_grp->WaitTbl[bit]  = p_pend_data;
+        p_grp->WaitTblMask  |= (OS_FLAGS)1u << bit;
+    }
+    p_pend_data->PrevPtr = DEF_NULL;                            /* Insert at the head of the list                       */
+    p_pend_data->NextPtr = p_head;
+    if (p_head != DEF_NULL) {
+        p_head->PrevPtr  = p_pend_data;
+    }
+}
+
+
+#if (OS_CFG_FLAG_DEL_EN == DEF_ENABLED) || (OS_CFG_FLAG_PEND_ABORT_EN == DEF_ENABLED)
+static  OS_FLAG_PEND_DATA  *OS_FlagWaitFirst (OS_FLAG_GRP  *p_grp)
+{
+    if (p_grp->WaitTblMask != 0u) {
+        return (p_grp->WaitTbl[OS_FlagBitHighest(p_grp->WaitTblMask)]);
+    }
+    return (p_grp->WaitScanPtr);
+}
+#endif
+
+
+#if (OS_CFG_FLAG_PEND_ABORT_EN == DEF_ENABLED)
+static  OS_FLAG_PEND_DATA  *OS_FlagWaitHighest (OS_FLAG_GRP  *p_grp)
+{
+    OS_FLAG_PEND_DATA  *p_pend_data;
+    OS_FLAG_PEND_DATA  *p_pend_data_hp;
+    OS_FLAGS            bits;
+    CPU_INT08U          bit;
+
+
+    p_pend_data_hp = DEF_NULL;
+    bits           = p_grp->WaitTblMask;
+    bit            = (CPU_INT08U)OS_FLAG_NBR_BITS;              /* Walk the lists of .WaitTbl[], then the scan list     */
+    p_pend_data    = p_grp->WaitScanPtr;
+    for (;;) {
+        while (p_pend_data != DEF_NULL) {
+            if ((p_pend_data_hp == DEF_NULL) ||
+                (p_pend_data->TCBPtr->Prio < p_pend_data_hp->TCBPtr->Prio)) {
+                p_pend_data_hp = p_pend_data;
+            }
+            p_pend_data = p_pend_data->NextPtr;
+        }
+        if (bits == 0u) {
+            break;
+        }
+        bit          = OS_FlagBitHighest(bits);
+        bits        &= ~((OS_FLAGS)1u << bit);
+        p_pend_data  = p_grp->WaitTbl[bit];
+    }
+    return (p_pend_data_hp);
+}
+#endif
+
+
+static  void  OS_FlagWaitInit (OS_FLAG_GRP  *p_grp)
+{
+    CPU_INT08U  bit;
+
+
+    p_grp->WaitTblMask  = 0u;
+    p_grp->WaitScanMask = 0u;
+    p_grp->WaitScanPtr  = DEF_NULL;
+    for (bit = 0u; bit < OS_FLAG_NBR_BITS; bit++) {
+        p_grp->WaitTbl[bit] = DEF_NULL;
+    }
+}
+
+
+static  OS_OBJ_QTY  OS_FlagWaitPost (OS_FLAG_GRP  *p_grp,
+                                     OS_FLAGS      flags,
+                                     CPU_TS        ts)
+{
+    OS_FLAG_PEND_DATA  *p_pend_data;
+    OS_FLAG_PEND_DATA  *p_pend_data_next;
+    OS_FLAGS            flags_rdy;
+    OS_FLAGS            flags_scan;
+    OS_FLAGS            bits;
+    CPU_INT08U          bit;
+    OS_OBJ_QTY          nbr_rdy;
+
+
+    nbr_rdy = 0u;
+    bits    = flags & p_grp->WaitTblMask;                       /* Only the waits under the bits just set ...           */
+    while (bits != 0u) {
+        bit         = OS_FlagBitHighest(bits);
+        bits       &= ~((OS_FLAGS)1u << bit);
+        p_pend_data = p_grp->WaitTbl[bit];
+        while (p_pend_data != DEF_NULL) {
+            p_pend_data_next = p_pend_data->NextPtr;
+            flags_rdy        = OS_FlagWaitRdy(p_pend_data);
+            if (flags_rdy != 0u) {
+                p_pend_data->FlagsRdy = flags_rdy;
+                OS_FlagTaskRdy(p_pend_data->TCBPtr,             /* Make task RTR, unlinks all its waits                 */
+                               flags_rdy,
+                               ts);
+                nbr_rdy++;
+            } else {                                            /* ... may miss another bit: move it under that bit     */
+                OS_FlagWaitUnlink(p_pend_data);
+                OS_FlagWaitAdd(p_pend_data);
+            }
+            p_pend_data = p_pend_data_next;
+        }
+    }
+
+    if ((flags & p_grp->WaitScanMask) != 0u) {                  /* Scan list waits on one of the bits just set?         */
+        flags_scan  = 0u;
+        p_pend_data = p_grp->WaitScanPtr;
+        while (p_pend_data != DEF_NULL) {
+            p_pend_data_next = p_pend_data->NextPtr;
+            flags_rdy        = OS_FlagWaitRdy(p_pend_data);
+            if (flags_rdy != 0u) {
+                p_pend_data->FlagsRdy = flags_rdy;
+                OS_FlagTaskRdy(p_pend_data->TCBPtr,
+                               flags_rdy,
+                               ts);
+                nbr_rdy++;
+            } else {
+                flags_scan |= p_pend_data->Flags;
+            }
+            p_pend_data = p_pend_data_next;
+        }
+        p_grp->WaitScanMask = flags_scan;                       /* Exact again after the walk                           */
+    }
+    return (nbr_rdy);
+}
+
+
+static  OS_FLAGS  OS_FlagWaitRdy (OS_FLAG_PEND_DATA  *p_pend_data)
+{
+    OS_FLAGS  flags_rdy;
+
+
+    flags_rdy = p_pend_data->GrpPtr->Flags & p_pend_data->Flags;
+    if (((p_pend_data->Opt & OS_OPT_PEND_FLAG_MASK) == OS_OPT_PEND_FLAG_SET_ALL) &&
+        (flags_rdy != p_pend_data->Flags)) {                    /* Must match ALL the bits for SET_ALL                  */
+        flags_rdy = 0u;
+    }
+    return (flags_rdy);
+}
+
+
+void  OS_FlagWaitRemove (OS_TCB  *p_tcb)
+{
+    OS_OBJ_QTY  i;
+
+
+    for (i = 0u; i < p_tcb->FlagPendDataTblEntries; i++) {
+        OS_FlagWaitUnlink(&p_tcb->FlagPendDataTblPtr[i]);
+    }
+    p_tcb->FlagPendDataTblPtr     = DEF_NULL;
+    p_tcb->FlagPendDataTblEntries = 0u;
+}
+
+
+static  void  OS_FlagWaitUnlink (OS_FLAG_PEND_DATA  *p_pend_data)
+{
+    OS_FLAG_GRP        *p_grp;
+    OS_FLAG_PEND_DATA  *p_prev;
+    OS_FLAG_PEND_DATA  *p_next;
+
+
+    p_grp  = p_pend_data->GrpPtr;
+    p_prev = p_pend_data->PrevPtr;
+    p_next = p_pend_data->NextPtr;
+    if (p_next != DEF_NULL) {
+        p_next->PrevPtr = p_prev;
+    }
+    if (p_prev != DEF_NULL) {
+        p_prev->NextPtr = p_next;
+    } else if (p_pend_data->Bit == OS_FLAG_NBR_BITS) {          /* Head of the scan list                                */
+        p_grp->WaitScanPtr = p_next;
+        if (p_next == DEF_NULL) {
+            p_grp->WaitScanMask = 0u;
+        }
+    } else {                                                    /* Head of a .WaitTbl[] list                            */
+        p_grp->WaitTbl[p_pend_data->Bit] = p_next;
+        if (p_next == DEF_NULL) {
+            p_grp->WaitTblMask &= ~((OS_FLAGS)1u << p_pend_data->Bit);
+        }
+    }
+    p_pend_data->PrevPtr = DEF_NULL;
+    p_pend_data->NextPtr = DEF_NULL;
+}
+#endif
 #endif
@@ -0,0 +1,370 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                 ISR POST QUEUE
+*
+* File    : OS_INT.C
+* Version : V3.06.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, OSSemPost(), OSQPost(), OSFlagPost(), OSTaskSemPost() and
+*               OSTaskQPost() called from an ISR only record the request in the ISR post queue and signal the ISR post
+*               queue task.  The task runs at priority 0 and replays the requests at task level, with interrupts
+*               enabled.  The time interrupts are disabled by an ISR post no longer depends on the number of tasks
+*               waiting on the object.
+*
+*           (2) The queue is a ring of OS_CFG_INT_Q_SIZE entries indexed by two free-running counters.  ISRs reserve
+*               entries by incrementing OSIntQInCtr with LDREX/STREX, the ISR post queue task releases them by
+*               incrementing OSIntQOutCtr.  On a single CPU, an ISR that preempts another one completes before the
+*               preempted ISR resumes and every ISR completes before a task runs, so the task never sees an entry
+*               that is reserved but not yet written.
+*
+*           (3) The replayed post is time stamped when the ISR post queue task runs, not when the ISR posted.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_int__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_IntQRePost (OS_INT_Q  *p_entry);
+
+
+/*
+************************************************************************************************************************
+*                                             POST TO THE ISR POST QUEUE
+*
+* Description: This function is called by the OSxxxPost() services when they are called from an ISR.  The request is
+*              placed in the ISR post queue and the ISR post queue task is signaled.
+*
+* Arguments  : type       is the type of kernel object the post is destined to:
+*
+*                             OS_OBJ_TYPE_SEM
+*                             OS_OBJ_TYPE_Q
+*                             OS_OBJ_TYPE_FLAG
+*                             OS_OBJ_TYPE_TASK_MSG
+*                             OS_OBJ_TYPE_TASK_SIGNAL
+*
+*              p_obj      is a pointer to the kernel object to post to.  This can be a pointer to a semaphore,
+*              -----      a message queue, an event flag group or a TCB.
+*
+*              p_void     is a pointer to a message that is being posted.  This is used when posting to a message
+*                         queue or directly to a task.
+*
+*              msg_size   is the size of the message being posted
+*
+*              flags      if the post is done to an event flag group then this corresponds to the flags being posted
+*
+*              opt        is the option passed to the OSxxxPost() service
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE         if the post was queued
+*                             OS_ERR_INT_Q_FULL   if the ISR post queue is full and the post was lost
+*
+* Returns    : none
+*
+* Note(s)    : (1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              (2) Interrupts are only disabled to update the overflow counter and to signal the task, both are O(1).
+************************************************************************************************************************
+*/
+
+void  OS_IntQPost (OS_OBJ_TYPE   type,
+                   void         *p_obj,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_FLAGS      flags,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
+{
+    OS_INT_Q    *p_entry;
+    CPU_INT32U   in;
+    CPU_INT32U   nbr_entries;
+    CPU_SR_ALLOC();
+
+
+#if defined(__ICCARM__)
+    do {                                                        /* Reserve an entry (see Note #2 in header)             */
+        in          = (CPU_INT32U)__LDREX((unsigned long *)&OSIntQInCtr);
+        nbr_entries = in - OSIntQOutCtr;
+        if (nbr_entries >= (CPU_INT32U)OSCfg_IntQSize) {
+            __CLREX();
+            break;
+        }
+    } while (__STREX((unsigned long)(in + 1u), (unsigned long *)&OSIntQInCtr) != 0u);
+#else
+    CPU_CRITICAL_ENTER();
+    in          = OSIntQInCtr;
+    nbr_entries = in - OSIntQOutCtr;
+    if (nbr_entries < (CPU_INT32U)OSCfg_IntQSize) {
+        OSIntQInCtr = in + 1u;
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+
+    if (nbr_entries >= (CPU_INT32U)OSCfg_IntQSize) {            /* Is the queue full?                                   */
+        CPU_CRITICAL_ENTER();
+        OSIntQOvfCtr++;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_INT_Q_FULL;
+        return;
+    }
+    if (OSIntQNbrEntriesMax < (OS_OBJ_QTY)(nbr_entries + 1u)) { /* Keep track of the peak number of entries            */
+        OSIntQNbrEntriesMax = (OS_OBJ_QTY)(nbr_entries + 1u);
+    }
+
+    p_entry          = &OSCfg_IntQBasePtr[in & ((CPU_INT32U)OSCfg_IntQSize - 1u)];
+    p_entry->Type    = type;                                    /* Save object type being posted                        */
+    p_entry->ObjPtr  = p_obj;                                   /* Save pointer to object being posted                  */
+    p_entry->MsgPtr  = p_void;                                  /* Save pointer to message if posting to a queue        */
+    p_entry->MsgSize = msg_size;                                /* Save the message size  if posting to a queue         */
+    p_entry->Flags   = flags;                                   /* Save the flags if posting to an event flag group     */
+    p_entry->Opt     = opt;                                     /* Save post options                                    */
+
+    CPU_CRITICAL_ENTER();                                       /* Signal the ISR post queue task                       */
+    if ((OSIntQTaskTCB.TaskState == OS_TASK_STATE_PEND) &&
+        (OSIntQTaskTCB.PendOn    == OS_TASK_PEND_ON_TASK_SEM)) {
+        OS_Post(DEF_NULL,
+                &OSIntQTaskTCB,
+                DEF_NULL,
+                0u,
+                0u);
+    } else {
+        OSIntQTaskTCB.SemCtr = 1u;                              /* One signal drains every entry                        */
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                ISR POST QUEUE TASK
+*
+* Description: This task is internal to uC/OS-III and replays, at task level, the posts queued by ISRs.
+*
+* Arguments  : p_arg     is an argument passed to the task when the task is created (unused).
+*
+* Returns    : none
+*
+* Note(s)    : (1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              (2) Every entry queued since the task was last signaled is drained in one batch.  The posts are made
+*                  with OS_OPT_POST_NO_SCHED, the scheduler runs once when the task pends again.
+************************************************************************************************************************
+*/
+
+void  OS_IntQTask (void  *p_arg)
+{
+    OS_INT_Q   entry;
+    OS_ERR     err;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS     ts_start;
+    CPU_TS     ts_delta;
+#endif
+
+
+    (void)p_arg;                                                /* Prevent compiler warning                             */
+
+    for (;;) {
+        (void)OSTaskSemPend(0u,
+                            OS_OPT_PEND_BLOCKING,
+                            DEF_NULL,
+                            &err);                              /* Wait for signal from an ISR                          */
+        if (err != OS_ERR_NONE) {
+            continue;
+        }
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        ts_start = OS_TS_GET();
+#endif
+        while (OSIntQOutCtr != OSIntQInCtr) {                   /* Drain the queue (see Note #2)                        */
+            entry = OSCfg_IntQBasePtr[OSIntQOutCtr & ((CPU_INT32U)OSCfg_IntQSize - 1u)];
+            OSIntQOutCtr++;                                     /* Release the entry before replaying the post          */
+            OS_IntQRePost(&entry);
+        }
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        ts_delta = OS_TS_GET() - ts_start;                      /* Measure execution time of the batch                  */
+        if (OSIntQTaskTimeMax < ts_delta) {
+            OSIntQTaskTimeMax = ts_delta;
+        }
+#endif
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                            INITIALIZE THE ISR POST QUEUE
+*
+* Description: This function is called by OSInit() to initialize the ISR post queue and create the ISR post queue task.
+*
+* Arguments  : p_err   is a pointer to a variable that will hold the value of an error code:
+*
+*                          OS_ERR_INT_Q                    if the pointer to the ISR post queue is a NULL pointer
+*                          OS_ERR_INT_Q_SIZE               if the ISR post queue size is not a power of 2 >= 2
+*                          OS_ERR_INT_Q_STK_INVALID        if the pointer to the task stack is a NULL pointer
+*                          OS_ERR_INT_Q_STK_SIZE_INVALID   if the task stack is smaller than OS_CFG_STK_SIZE_MIN
+*                          OS_ERR_??                       other error code returned by OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : (1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              (2) The ISR post queue task is the only task allowed at priority 0.
+************************************************************************************************************************
+*/
+
+void  OS_IntQTaskInit (OS_ERR  *p_err)
+{
+    OSIntQInCtr         = 0u;
+    OSIntQOutCtr        = 0u;
+    OSIntQNbrEntriesMax = 0u;
+    OSIntQOvfCtr        = 0u;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    OSIntQTaskTimeMax   = 0u;
+#endif
+
+    if (OSCfg_IntQBasePtr == DEF_NULL) {
+       *p_err = OS_ERR_INT_Q;
+        return;
+    }
+
+    if ((OSCfg_IntQSize < 2u) ||
+       ((OSCfg_IntQSize & (OSCfg_IntQSize - 1u)) != 0u)) {
+       *p_err = OS_ERR_INT_Q_SIZE;
+        return;
+    }
+
+                                                                /* ---------- CREATE THE ISR POST QUEUE TASK ---------- */
+    if (OSCfg_IntQTaskStkBasePtr == DEF_NULL) {
+       *p_err = OS_ERR_INT_Q_STK_INVALID;
+        return;
+    }
+
+    if (OSCfg_IntQTaskStkSize < OSCfg_StkSizeMin) {
+       *p_err = OS_ERR_INT_Q_STK_SIZE_INVALID;
+        return;
+    }
+
+    OSTaskCreate(&OSIntQTaskTCB,
+                 (CPU_CHAR   *)("uC/OS-III ISR Queue Task"),
+                 OS_IntQTask,
+                 DEF_NULL,
+                 0u,                                            /* See Note #2                                          */
+                 OSCfg_IntQTaskStkBasePtr,
+                 OSCfg_IntQTaskStkLimit,
+                 OSCfg_IntQTaskStkSize,
+                 0u,
+                 0u,
+                 DEF_NULL,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS),
+                 p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               REPLAY A DEFERRED POST
+*
+* Description: This function calls the post service matching the type of the entry, at task level.
+*
+* Arguments  : p_entry   is a pointer to a copy of the ISR post queue entry
+*
+* Returns    : none
+*
+* Note(s)    : (1) Errors cannot be reported to the ISR that made the post, they are discarded.
+************************************************************************************************************************
+*/
+
+static  void  OS_IntQRePost (OS_INT_Q  *p_entry)
+{
+    OS_OPT  opt;
+    OS_ERR  err;
+
+
+    opt = p_entry->Opt | OS_OPT_POST_NO_SCHED;
+    switch (p_entry->Type) {                                    /* Errors are discarded (see Note #1)                   */
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+        case OS_OBJ_TYPE_FLAG:
+             (void)OSFlagPost((OS_FLAG_GRP *)p_entry->ObjPtr,
+                              p_entry->Flags,
+                              opt,
+                              &err);
+             break;
+#endif
+
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+        case OS_OBJ_TYPE_Q:
+             OSQPost((OS_Q *)p_entry->ObjPtr,
+                     p_entry->MsgPtr,
+                     p_entry->MsgSize,
+                     opt,
+                     &err);
+             break;
+#endif
+
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+        case OS_OBJ_TYPE_SEM:
+             (void)OSSemPost((OS_SEM *)p_entry->ObjPtr,
+                             opt,
+                             &err);
+             break;
+#endif
+
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
+        case OS_OBJ_TYPE_TASK_MSG:
+             OSTaskQPost((OS_TCB *)p_entry->ObjPtr,
+                         p_entry->MsgPtr,
+                         p_entry->MsgSize,
+                         opt,
+                         &err);
+             break;
+#endif
+
+        case OS_OBJ_TYPE_TASK_SIGNAL:
+             (void)OSTaskSemPost((OS_TCB *)p_entry->ObjPtr,
+                                 opt,
+                                 &err);
+             break;
+
+        default:
+             break;
+    }
+}
+#endif
@@ -0,0 +1,310 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                  LATENCY HISTOGRAMS
+*
+* File    : OS_LAT.C
+* Version : V3.06.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) Three latencies are recorded in log2 histograms, in CPU timestamp counts:
+*
+*                   OS_LAT_HIST_INT_DIS       every interrupt disable span, measured by uC/CPU (CPU_IntDisMeasStop())
+*                   OS_LAT_HIST_SCHED_LOCK    every scheduler lock span, measured by OS_SchedLockTimeMeasStop()
+*                   OS_LAT_HIST_ISR_TO_TASK   from the entry of the outermost ISR to the switch in of the task that
+*                                             the ISR made ready, measured by OSIntEnter() and OSTaskSwHook()
+*
+*           (2) Unlike the maximum values kept by the kernel, the histograms tell how often a latency budget is
+*               exceeded.  OSLatPercentileGet() returns an upper bound of a given percentile.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_lat__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_LAT_HIST_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                  READ A HISTOGRAM
+*
+* Description: This function copies one of the latency histograms.
+*
+* Arguments  : hist       selects the histogram:
+*
+*                             OS_LAT_HIST_INT_DIS        Interrupt disable time
+*                             OS_LAT_HIST_SCHED_LOCK     Scheduler lock time
+*                             OS_LAT_HIST_ISR_TO_TASK    ISR entry to task switch in
+*
+*              p_hist     is a pointer to the histogram that will receive the copy.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                The histogram was copied
+*                             OS_ERR_LAT_HIST_INVALID    'hist' is not a valid histogram
+*                             OS_ERR_PTR_INVALID         If 'p_hist' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) The maximum of the interrupt disable histogram is CPU_IntDisMeasMaxGet(), it is not reset by
+*                 OSLatReset().
+************************************************************************************************************************
+*/
+
+void  OSLatHistGet (CPU_INT08U    hist,
+                    OS_LAT_HIST  *p_hist,
+                    OS_ERR       *p_err)
+{
+    CPU_INT08U  i;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (hist >= OS_LAT_HIST_NBR) {                              /* Validate 'hist'                                      */
+       *p_err = OS_ERR_LAT_HIST_INVALID;
+        return;
+    }
+    if (p_hist == DEF_NULL) {                                   /* Validate 'p_hist'                                    */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    if (hist == OS_LAT_HIST_INT_DIS) {                          /* Interrupt disable histogram is kept by uC/CPU        */
+        CPU_IntDisMeasHistGet(&p_hist->BucketTbl[0], DEF_NO);
+        p_hist->Max = (CPU_TS)CPU_IntDisMeasMaxGet();
+        p_hist->Ctr = 0u;
+        for (i = 0u; i < OS_LAT_HIST_NBR_BUCKETS; i++) {
+            p_hist->Ctr += p_hist->BucketTbl[i];
+        }
+    } else {
+        CPU_CRITICAL_ENTER();
+       *p_hist = OSLatHistTbl[hist];
+        CPU_CRITICAL_EXIT();
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 COMPUTE A PERCENTILE
+*
+* Description: This function returns an upper bound of a percentile of one of the latency histograms, e.g. the 99.9th
+*              percentile of the interrupt disable time is obtained with:
+*
+*                  OSLatPercentileGet(OS_LAT_HIST_INT_DIS, 999u, &err);
+*
+* Arguments  : hist       selects the histogram (see OSLatHistGet()).
+*
+*              permille   is the percentile in tenths of a percent (0 to 1000).
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                    The percentile was computed
+*                             OS_ERR_LAT_HIST_INVALID        'hist' is not a valid histogram
+*                             OS_ERR_LAT_PERMILLE_INVALID    'permille' is larger than 1000
+*
+* Returns    : The upper limit of the bucket holding the percentile, capped to the largest sample, in CPU timestamp
+*              counts.  0 is returned when the histogram is empty.
+*
+* Note(s)    : 1) Since buckets are a power of 2 wide, the value returned is at most twice the actual percentile.
+************************************************************************************************************************
+*/
+
+CPU_TS  OSLatPercentileGet (CPU_INT08U   hist,
+                            CPU_INT16U   permille,
+                            OS_ERR      *p_err)
+{
+    OS_LAT_HIST  lat_hist;
+    CPU_INT32U   ctr_target;
+    CPU_INT32U   ctr;
+    CPU_INT08U   i;
+    CPU_TS       lat;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (permille > 1000u) {                                     /* Validate 'permille'                                  */
+       *p_err = OS_ERR_LAT_PERMILLE_INVALID;
+        return (0u);
+    }
+#endif
+
+    OSLatHistGet(hist, &lat_hist, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return (0u);
+    }
+    if (lat_hist.Ctr == 0u) {                                   /* No samples yet                                       */
+        return (0u);
+    }
+                                                                /* Rank of the sample holding the percentile            */
+    ctr_target = (CPU_INT32U)((((CPU_INT64U)lat_hist.Ctr * permille) + 999u) / 1000u);
+    if (ctr_target == 0u) {
+        ctr_target = 1u;
+    }
+
+    ctr = 0u;
+    for (i = 0u; i < (OS_LAT_HIST_NBR_BUCKETS - 1u); i++) {
+        ctr += lat_hist.BucketTbl[i];
+        if (ctr >= ctr_target) {
+            break;
+        }
+    }
+
+    if (i == (OS_LAT_HIST_NBR_BUCKETS - 1u)) {                  /* Last bucket has no upper limit                       */
+        lat = lat_hist.Max;
+    } else {
+        lat = (CPU_TS)((1uL << i) - 1u);                        /* Upper limit of bucket 'i'                            */
+        if (lat > lat_hist.Max) {
+            lat = lat_hist.Max;
+        }
+    }
+    return (lat);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 RESET THE HISTOGRAMS
+*
+* Description: This function clears all the latency histograms, e.g. once the system reached its steady state.
+*
+* Arguments  : p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE            The histograms were cleared
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSLatReset (OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_LatInit();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            INITIALIZE THE HISTOGRAMS
+*
+* Description: This function is called by OSInit() and OSLatReset() to clear the histograms.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_LatInit (void)
+{
+    OS_LAT_HIST  *p_hist;
+    CPU_INT08U    i;
+    CPU_INT08U    j;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    for (i = 0u; i < OS_LAT_HIST_NBR; i++) {
+        p_hist      = &OSLatHistTbl[i];
+        p_hist->Ctr =  0u;
+        p_hist->Max =  0u;
+        for (j = 0u; j < OS_LAT_HIST_NBR_BUCKETS; j++) {
+            p_hist->BucketTbl[j] = 0u;
+        }
+    }
+    OSLatISR_Pending = DEF_FALSE;
+    CPU_CRITICAL_EXIT();
+
+    CPU_IntDisMeasHistGet(DEF_NULL, DEF_YES);                   /* Clear the interrupt disable histogram in uC/CPU      */
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  ADD A SAMPLE
+*
+* Description: This function counts a latency in its histogram.
+*
+* Arguments  : hist       selects the histogram, OS_LAT_HIST_SCHED_LOCK or OS_LAT_HIST_ISR_TO_TASK.
+*
+*              delta      is the latency in CPU timestamp counts.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_LatHistAdd (CPU_INT08U  hist,
+                     CPU_TS      delta)
+{
+    OS_LAT_HIST  *p_hist;
+    CPU_DATA      ix;
+
+
+    p_hist = &OSLatHistTbl[hist];
+    ix     = (CPU_DATA)(DEF_INT_CPU_NBR_BITS - CPU_CntLeadZeros((CPU_DATA)delta));
+    if (ix >= OS_LAT_HIST_NBR_BUCKETS) {                        /* Last bucket holds all the large latencies            */
+        ix  = OS_LAT_HIST_NBR_BUCKETS - 1u;
+    }
+    p_hist->BucketTbl[ix]++;
+    p_hist->Ctr++;
+    if (p_hist->Max < delta) {
+        p_hist->Max = delta;
+    }
+}
+#endif
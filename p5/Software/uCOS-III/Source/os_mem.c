@@ -35,12 +35,50 @@
 #define   MICRIUM_SOURCE
 #include "os.h"
 
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED) && !defined(__ICCARM__) && \
+    (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__))
+#define   OS_MEM_C11_ATOMICS                                    /* Host build, see OS_MemCAS()                          */
+#include <stdatomic.h>
+#endif
+
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
 const  CPU_CHAR  *os_mem__c = "$Id: $";
 #endif
 
 
 #if (OS_CFG_MEM_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#define  OS_MEM_FREE_IX_MSK                 0x0000FFFFu         /* Index+1 of the first free block, 0 if none           */
+#define  OS_MEM_FREE_TAG_INC                0x00010000u         /* ABA tag, incremented by every pop and push           */
+
+
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+static  CPU_INT32U   OS_MemCAS       (CPU_INT32U  *p_word,
+                                      CPU_INT32U   cmp,
+                                      CPU_INT32U   val);
+
+static  OS_MEM_QTY   OS_MemQtyCAS    (OS_MEM_QTY  *p_word,
+                                      OS_MEM_QTY   cmp,
+                                      OS_MEM_QTY   val);
+#endif
+
+#if (OS_CFG_MEM_CANARY_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  OS_MemCanaryChk (OS_MEM      *p_mem,
+                                      void        *p_blk);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               CREATE A MEMORY PARTITION
@@ -73,7 +111,8 @@ const  CPU_CHAR  *os_mem__c = "$Id: $";
 *                                                             - must be able to hold an integral number of pointers
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : (1) With OS_CFG_MEM_CANARY_EN, the last 32-bit word of each block holds a canary and is not available to
+*                  the application.  The block size must also hold it.
 ************************************************************************************************************************
 */
 
@@ -88,9 +127,14 @@ void  OSMemCreate (OS_MEM       *p_mem,
     CPU_DATA       align_msk;
 #endif
     OS_MEM_QTY     i;
-    OS_MEM_QTY     loops;
     CPU_INT08U    *p_blk;
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_DISABLED)
+    OS_MEM_QTY     loops;
     void         **p_link;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    CPU_INT32U     name_hash;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -125,7 +169,7 @@ void  OSMemCreate (OS_MEM       *p_mem,
        *p_err = OS_ERR_MEM_INVALID_BLKS;
         return;
     }
-    if (blk_size < sizeof(void *)) {                            /* Must contain space for at least a pointer            */
+    if (blk_size < (sizeof(void *) + OS_MEM_CANARY_SIZE)) {     /* Must contain space for at least a pointer            */
        *p_err = OS_ERR_MEM_INVALID_SIZE;
         return;
     }
@@ -142,6 +186,14 @@ void  OSMemCreate (OS_MEM       *p_mem,
     }
 #endif
 
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    p_blk  = (CPU_INT08U *)p_addr;                              /* Create linked list of free memory block indexes      */
+    for (i = 1u; i < n_blks; i++) {
+       *(CPU_INT32U *)(void *)p_blk = (CPU_INT32U)i + 1u;       /* Save index+1 of NEXT block in CURRENT block          */
+        p_blk += blk_size;
+    }
+   *(CPU_INT32U *)(void *)p_blk = 0u;                           /* Last memory block has no next block                  */
+#else
     p_link = (void **)p_addr;                                   /* Create linked list of free memory blocks             */
     p_blk  = (CPU_INT08U *)p_addr;
     loops  = n_blks - 1u;
@@ -151,7 +203,19 @@ void  OSMemCreate (OS_MEM       *p_mem,
         p_link = (void **)(void *)p_blk;                        /* Position     to NEXT block                           */
     }
    *p_link             = DEF_NULL;                              /* Last memory block points to NULL                     */
+#endif
+
+#if (OS_CFG_MEM_CANARY_EN == DEF_ENABLED)
+    p_blk  = (CPU_INT08U *)p_addr + blk_size - OS_MEM_CANARY_SIZE;
+    for (i = 0u; i < n_blks; i++) {                             /* Place the canary at the end of each block (Note #1)  */
+       *(CPU_INT32U *)(void *)p_blk = OS_MEM_CANARY_VAL;
+        p_blk += blk_size;
+    }
+#endif
 
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    name_hash = OS_ObjRegHash(p_name);                          /* Hash the name with interrupts enabled                */
+#endif
     CPU_CRITICAL_ENTER();
 #if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
     p_mem->Type        = OS_OBJ_TYPE_MEM;                       /* Set the type of object                               */
@@ -162,15 +226,28 @@ void  OSMemCreate (OS_MEM       *p_mem,
     (void)p_name;
 #endif
     p_mem->AddrPtr     = p_addr;                                /* Store start address of memory partition              */
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    p_mem->FreeHead    = 1u;                                    /* First free block is block #0, tag is 0               */
+#else
     p_mem->FreeListPtr = p_addr;                                /* Initialize pointer to pool of free blocks            */
+#endif
     p_mem->NbrFree     = n_blks;                                /* Store number of free blocks in MCB                   */
     p_mem->NbrMax      = n_blks;
     p_mem->BlkSize     = blk_size;                              /* Store block size of each memory blocks               */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_mem->NbrUsedMax  = 0u;
+#endif
+#if (OS_CFG_MEM_CANARY_EN == DEF_ENABLED)
+    p_mem->CanaryErrCtr = 0u;
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_MemDbgListAdd(p_mem);
     OSMemQty++;
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    p_mem->Handle = OS_ObjRegAdd((void *)p_mem, OS_OBJ_TYPE_MEM, p_name, name_hash);
+#endif
 
     OS_TRACE_MEM_CREATE(p_mem, p_name);
     CPU_CRITICAL_EXIT();
@@ -197,15 +274,34 @@ void  OSMemCreate (OS_MEM       *p_mem,
 * Returns    : A pointer to a memory block if no error is detected
 *              A pointer to NULL if an error is detected
 *
-* Note(s)    : none
+* Note(s)    : (1) With OS_CFG_MEM_LOCK_FREE_EN, the block is removed from the free list with a compare-and-swap on
+*                  'FreeHead' and interrupts are not disabled.  'FreeHead' holds the index of the first free block and
+*                  a tag incremented by every operation: a preempted compare-and-swap fails even when the same block
+*                  is back at the head of the list (ABA).
+*
+*              (2) With OS_CFG_MEM_CANARY_EN, a corrupted canary (the block was written after being released) is
+*                  counted in 'CanaryErrCtr' and repaired, the block is still returned.
 ************************************************************************************************************************
 */
 
 void  *OSMemGet (OS_MEM  *p_mem,
                  OS_ERR  *p_err)
 {
-    void    *p_blk;
+    void        *p_blk;
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT32U   head;
+    CPU_INT32U   head_old;
+    CPU_INT32U   head_new;
+    CPU_INT32U   ix;
+    OS_MEM_QTY   nbr_free;
+    OS_MEM_QTY   nbr_old;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_MEM_QTY   nbr_used;
+    OS_MEM_QTY   nbr_used_max;
+#endif
+#else
     CPU_SR_ALLOC();
+#endif
 
 
 
@@ -236,6 +332,50 @@ void  *OSMemGet (OS_MEM  *p_mem,
 #endif
 
 
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    p_blk = DEF_NULL;
+    head  = p_mem->FreeHead;
+    for (;;) {                                                  /* Pop the first free block (see Note #1)               */
+        ix = head & OS_MEM_FREE_IX_MSK;
+        if (ix == 0u) {                                         /* See if there are any free memory blocks              */
+            break;
+        }
+        p_blk    = (void *)((CPU_INT08U *)p_mem->AddrPtr + ((CPU_SIZE_T)(ix - 1u) * p_mem->BlkSize));
+        head_new = ((head + OS_MEM_FREE_TAG_INC) & ~OS_MEM_FREE_IX_MSK)
+                 | (*(CPU_INT32U *)p_blk & OS_MEM_FREE_IX_MSK);
+        head_old = OS_MemCAS(&p_mem->FreeHead, head, head_new);
+        if (head_old == head) {
+            break;
+        }
+        head     = head_old;                                    /* Preempted, retry with the new head                   */
+    }
+    if (ix == 0u) {
+        OS_TRACE_MEM_GET_FAILED(p_mem);
+        OS_TRACE_MEM_GET_EXIT(OS_ERR_MEM_NO_FREE_BLKS);
+       *p_err = OS_ERR_MEM_NO_FREE_BLKS;                        /* No,  Notify caller of empty memory partition         */
+        return (DEF_NULL);                                      /* Return NULL pointer to caller                        */
+    }
+
+    nbr_free = p_mem->NbrFree;                                  /* One less memory block in this partition              */
+    for (;;) {
+        nbr_old = OS_MemQtyCAS(&p_mem->NbrFree, nbr_free, nbr_free - 1u);
+        if (nbr_old == nbr_free) {
+            break;
+        }
+        nbr_free = nbr_old;
+    }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    nbr_used     = p_mem->NbrMax - (nbr_free - 1u);             /* Keep track of the peak usage                         */
+    nbr_used_max = p_mem->NbrUsedMax;
+    while (nbr_used > nbr_used_max) {
+        nbr_old = OS_MemQtyCAS(&p_mem->NbrUsedMax, nbr_used_max, nbr_used);
+        if (nbr_old == nbr_used_max) {
+            break;
+        }
+        nbr_used_max = nbr_old;
+    }
+#endif
+#else
     CPU_CRITICAL_ENTER();
     if (p_mem->NbrFree == 0u) {                                 /* See if there are any free memory blocks              */
         CPU_CRITICAL_EXIT();
@@ -247,7 +387,17 @@ void  *OSMemGet (OS_MEM  *p_mem,
     p_blk              = p_mem->FreeListPtr;                    /* Yes, point to next free memory block                 */
     p_mem->FreeListPtr = *(void **)p_blk;                       /* Adjust pointer to new free list                      */
     p_mem->NbrFree--;                                           /* One less memory block in this partition              */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    if (p_mem->NbrUsedMax < (p_mem->NbrMax - p_mem->NbrFree)) { /* Keep track of the peak usage                         */
+        p_mem->NbrUsedMax = p_mem->NbrMax - p_mem->NbrFree;
+    }
+#endif
     CPU_CRITICAL_EXIT();
+#endif
+
+#if (OS_CFG_MEM_CANARY_EN == DEF_ENABLED)
+    (void)OS_MemCanaryChk(p_mem, p_blk);                        /* See Note #2                                          */
+#endif
     OS_TRACE_MEM_GET(p_mem);
     OS_TRACE_MEM_GET_EXIT(OS_ERR_NONE);
    *p_err = OS_ERR_NONE;                                        /* No error                                             */
@@ -268,15 +418,22 @@ void  *OSMemGet (OS_MEM  *p_mem,
 *               p_err    is a pointer to a variable that will contain an error code returned by this function.
 *
 *                            OS_ERR_NONE               If the memory block was inserted into the partition
+*                            OS_ERR_MEM_CANARY         If the canary of the block was overwritten, the block was
+*                                                      released nonetheless (see Note #2)
 *                            OS_ERR_MEM_FULL           If you are returning a memory block to an already FULL memory
 *                                                      partition (You freed more blocks than you allocated!)
-*                            OS_ERR_MEM_INVALID_P_BLK  If you passed a NULL pointer for the block to release.
+*                            OS_ERR_MEM_INVALID_P_BLK  If you passed a NULL pointer for the block to release, or a
+*                                                      pointer that is not a block of the partition
 *                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_mem'
 *                            OS_ERR_OBJ_TYPE           If 'p_mem' is not pointing at a memory partition
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : (1) With OS_CFG_MEM_LOCK_FREE_EN, the block is inserted with a compare-and-swap, see OSMemGet().  The
+*                  free block count is reserved first so that releasing too many blocks is still detected.
+*
+*              (2) With OS_CFG_MEM_CANARY_EN, a corrupted canary (the application wrote past the end of the block) is
+*                  counted in 'CanaryErrCtr' and repaired.
 ************************************************************************************************************************
 */
 
@@ -284,7 +441,17 @@ void  OSMemPut (OS_MEM  *p_mem,
                 void    *p_blk,
                 OS_ERR  *p_err)
 {
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_SIZE_T   offset;
+    CPU_INT32U   head;
+    CPU_INT32U   head_old;
+    CPU_INT32U   ix;
+    OS_MEM_QTY   nbr_free;
+    OS_MEM_QTY   nbr_old;
+#else
     CPU_SR_ALLOC();
+#endif
+    OS_ERR       err;
 
 
 
@@ -320,7 +487,56 @@ void  OSMemPut (OS_MEM  *p_mem,
     }
 #endif
 
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    offset = (CPU_SIZE_T)((CPU_INT08U *)p_blk - (CPU_INT08U *)p_mem->AddrPtr);
+    ix     = (CPU_INT32U)(offset / p_mem->BlkSize);
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (((CPU_INT08U *)p_blk < (CPU_INT08U *)p_mem->AddrPtr) || /* The free list holds block indexes, the block ...     */
+        (ix                  >= p_mem->NbrMax)                || /* ... must belong to the partition                    */
+        ((offset % p_mem->BlkSize) != 0u)) {
+        OS_TRACE_MEM_PUT_FAILED(p_mem);
+        OS_TRACE_MEM_PUT_EXIT(OS_ERR_MEM_INVALID_P_BLK);
+       *p_err  = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+#endif
+
+    err = OS_ERR_NONE;
+#if (OS_CFG_MEM_CANARY_EN == DEF_ENABLED)
+    if (OS_MemCanaryChk(p_mem, p_blk) != DEF_OK) {              /* See Note #2                                          */
+        err = OS_ERR_MEM_CANARY;
+    }
+#endif
+
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    nbr_free = p_mem->NbrFree;                                  /* Reserve a free block count (see Note #1)             */
+    for (;;) {
+        if (nbr_free >= p_mem->NbrMax) {                        /* Make sure all blocks not already returned            */
+            OS_TRACE_MEM_PUT_FAILED(p_mem);
+            OS_TRACE_MEM_PUT_EXIT(OS_ERR_MEM_FULL);
+           *p_err = OS_ERR_MEM_FULL;
+            return;
+        }
+        nbr_old = OS_MemQtyCAS(&p_mem->NbrFree, nbr_free, nbr_free + 1u);
+        if (nbr_old == nbr_free) {
+            break;
+        }
+        nbr_free = nbr_old;
+    }
 
+    head = p_mem->FreeHead;
+    for (;;) {                                                  /* Insert released block into free block list           */
+       *(CPU_INT32U *)p_blk = head & OS_MEM_FREE_IX_MSK;
+        head_old = OS_MemCAS(&p_mem->FreeHead,
+                              head,
+                             ((head + OS_MEM_FREE_TAG_INC) & ~OS_MEM_FREE_IX_MSK) | (ix + 1u));
+        if (head_old == head) {
+            break;
+        }
+        head = head_old;                                        /* Preempted, retry with the new head                   */
+    }
+#else
     CPU_CRITICAL_ENTER();
     if (p_mem->NbrFree >= p_mem->NbrMax) {                      /* Make sure all blocks not already returned            */
         CPU_CRITICAL_EXIT();
@@ -333,10 +549,147 @@ void  OSMemPut (OS_MEM  *p_mem,
     p_mem->FreeListPtr = p_blk;
     p_mem->NbrFree++;                                           /* One more memory block in this partition              */
     CPU_CRITICAL_EXIT();
+#endif
     OS_TRACE_MEM_PUT(p_mem);
-    OS_TRACE_MEM_PUT_EXIT(OS_ERR_NONE);
-   *p_err              = OS_ERR_NONE;                           /* Notify caller that memory block was released         */
+    OS_TRACE_MEM_PUT_EXIT(err);
+   *p_err              = err;                                   /* Notify caller that memory block was released         */
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 CHECK A BLOCK CANARY
+*
+* Description : This function checks the canary in the last word of a memory block and repairs it if it was overwritten.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_blk    is a pointer to the memory block
+*
+* Returns     : DEF_OK   if the canary was intact
+*               DEF_FAIL if the canary was corrupted, the corruption is counted in 'CanaryErrCtr'
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_CANARY_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  OS_MemCanaryChk (OS_MEM  *p_mem,
+                                      void    *p_blk)
+{
+    CPU_INT32U  *p_canary;
+    CPU_SR_ALLOC();
+
+
+    p_canary = (CPU_INT32U *)(void *)((CPU_INT08U *)p_blk + p_mem->BlkSize - OS_MEM_CANARY_SIZE);
+    if (*p_canary == OS_MEM_CANARY_VAL) {
+        return (DEF_OK);
+    }
+   *p_canary = OS_MEM_CANARY_VAL;                               /* Repair it so that it is only reported once           */
+    CPU_CRITICAL_ENTER();
+    p_mem->CanaryErrCtr++;
+    CPU_CRITICAL_EXIT();
+    return (DEF_FAIL);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   COMPARE AND SWAP
+*
+* Description : These functions atomically replace the value of a word with 'val' if it is equal to 'cmp'.
+*
+* Arguments   : p_word   is a pointer to the word (OS_MemCAS()) or the block count (OS_MemQtyCAS())
+*
+*               cmp      is the expected value
+*
+*               val      is the new value
+*
+* Returns     : The value read.  The word was replaced if and only if it is equal to 'cmp'.
+*
+* Note(s)    : (1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              (2) On the Cortex-M7, LDREX/STREX are used.  The exclusive monitor is cleared on exception entry and
+*                  return, a failed store only means that the sequence was preempted and it is retried.  On a host,
+*                  C11 atomics are used.  Otherwise, interrupts are disabled for the comparison.
+*
+*              (3) OS_MemQtyCAS() uses LDREXH/STREXH and thus assumes a 16-bit OS_MEM_QTY.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+static  CPU_INT32U  OS_MemCAS (CPU_INT32U  *p_word,
+                               CPU_INT32U   cmp,
+                               CPU_INT32U   val)
+{
+    CPU_INT32U  cur;
+#if defined(__ICCARM__)
+
+
+    do {                                                        /* See Note #2                                          */
+        cur = (CPU_INT32U)__LDREX((unsigned long *)p_word);
+        if (cur != cmp) {
+            __CLREX();
+            break;
+        }
+    } while (__STREX((unsigned long)val, (unsigned long *)p_word) != 0u);
+#elif defined(OS_MEM_C11_ATOMICS)
+
+
+    cur = cmp;
+    (void)atomic_compare_exchange_strong((_Atomic CPU_INT32U *)p_word, &cur, val);
+#else
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    cur = *p_word;
+    if (cur == cmp) {
+       *p_word = val;
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+
+    return (cur);
+}
+
+
+static  OS_MEM_QTY  OS_MemQtyCAS (OS_MEM_QTY  *p_word,
+                                  OS_MEM_QTY   cmp,
+                                  OS_MEM_QTY   val)
+{
+    OS_MEM_QTY  cur;
+#if defined(__ICCARM__)
+
+
+    do {                                                        /* See Note #2 and #3                                   */
+        cur = (OS_MEM_QTY)__LDREXH((unsigned short *)p_word);
+        if (cur != cmp) {
+            __CLREX();
+            break;
+        }
+    } while (__STREXH((unsigned short)val, (unsigned short *)p_word) != 0u);
+#elif defined(OS_MEM_C11_ATOMICS)
+
+
+    cur = cmp;
+    (void)atomic_compare_exchange_strong((_Atomic OS_MEM_QTY *)p_word, &cur, val);
+#else
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    cur = *p_word;
+    if (cur == cmp) {
+       *p_word = val;
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+
+    return (cur);
 }
+#endif
 
 
 /*
@@ -40,6 +40,26 @@ const  CPU_CHAR  *os_mon__c = "$Id: $";
 #endif
 
 #if (OS_CFG_MON_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+static  OS_OBJ_QTY  OS_MonKeyEval    (OS_MON       *p_mon,
+                                      OS_MON_KEYS   keys,
+                                      void         *p_scan_data,
+                                      OS_OPT        opt);
+
+static  void        OS_MonKeyInit    (OS_MON       *p_mon);
+
+static  void        OS_MonKeyInsert  (OS_MON       *p_mon,
+                                      OS_TCB       *p_tcb,
+                                      OS_MON_KEY    key);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                  CREATE A MONITOR
@@ -76,6 +96,9 @@ void  OSMonCreate (OS_MON   *p_mon,
                    void     *p_mon_data,
                    OS_ERR   *p_err)
 {
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    CPU_INT32U  name_hash;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -107,6 +130,9 @@ void  OSMonCreate (OS_MON   *p_mon,
     }
 #endif
 
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    name_hash = OS_ObjRegHash(p_name);                          /* Hash the name with interrupts enabled                */
+#endif
     CPU_CRITICAL_ENTER();
 #if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
     p_mon->Type    = OS_OBJ_TYPE_MON;                           /* Mark the data structure as a monitor                 */
@@ -119,11 +145,17 @@ void  OSMonCreate (OS_MON   *p_mon,
 #endif
 
     OS_PendListInit(&p_mon->PendList);
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+    OS_MonKeyInit(p_mon);
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_MonDbgListAdd(p_mon);
     OSMonQty++;
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    p_mon->Handle = OS_ObjRegAdd((void *)p_mon, OS_OBJ_TYPE_MON, p_name, name_hash);
+#endif
 
     if (p_mon_data != DEF_NULL) {
         p_mon->MonDataPtr = p_mon_data;
@@ -234,6 +266,9 @@ OS_OBJ_QTY  OSMonDel (OS_MON  *p_mon,
  #if (OS_CFG_DBG_EN == DEF_ENABLED)
                   OS_MonDbgListRemove(p_mon);
                   OSMonQty--;
+ #endif
+ #if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+                  OS_ObjRegRemove(p_mon->Handle);
  #endif
                   OS_MonClr(p_mon);
                   CPU_CRITICAL_EXIT();
@@ -255,6 +290,9 @@ OS_OBJ_QTY  OSMonDel (OS_MON  *p_mon,
  #if (OS_CFG_DBG_EN == DEF_ENABLED)
               OS_MonDbgListRemove(p_mon);
               OSMonQty--;
+ #endif
+ #if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+              OS_ObjRegRemove(p_mon->Handle);
  #endif
               OS_MonClr(p_mon);
               CPU_CRITICAL_EXIT();
@@ -432,6 +470,186 @@ void  OSMonOp (OS_MON               *p_mon,
 }
 
 
+/*
+************************************************************************************************************************
+*                                      PERFORM A KEYED OPERATION ON A MONITOR
+*
+* Description: This function performs an operation on a monitor like OSMonOp() but the waiting tasks are registered under
+*              a condition key : only the tasks waiting under the keys the operation may have changed are evaluated.
+*
+* Arguments  : p_mon      Pointer to the monitor
+*
+*              timeout    Optional timeout to be applied if the monitor blocks (pend).
+*
+*              p_arg      Argument of the monitor.
+*
+*              p_on_enter Callback called at the entry of the OSMonOpKey.
+*
+*              p_on_eval  Callback to be registered as the monitor's evaluation function.
+*
+*              key        Condition the calling task waits for if 'p_on_enter' blocks it, 0 to OS_CFG_MON_KEY_NBR - 1.
+*
+*              keys_eval  Conditions the operation may have changed, one bit per key (bit 'n' for key 'n').  Only the
+*                         tasks waiting under these keys are evaluated.
+*
+*              opt        Possible options are :
+*                           OS_OPT_POST_1            Signal: ready the highest priority task whose evaluation allows it
+*                           OS_OPT_POST_ALL          Broadcast: ready all the tasks whose evaluation allows them
+*
+*                         You can also 'ADD' OS_OPT_POST_NO_SCHED to prevent the scheduler from being called.
+*
+*              p_err      Pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE            The call was successful and the monitor was signaled.
+*                           OS_ERR_OBJ_DEL         If the monitor was deleted while the task was waiting
+*                           OS_ERR_OBJ_PTR_NULL    If 'p_mon' is a NULL pointer.
+*                           OS_ERR_OBJ_TYPE        If 'p_mon' is not pointing at a monitor
+*                           OS_ERR_OPT_INVALID     If 'key' or 'opt' is invalid
+*                           OS_ERR_OS_NOT_RUNNING  If uC/OS-III is not running yet
+*                           OS_ERR_PEND_ABORT      If the wait was aborted
+*                           OS_ERR_STATUS_INVALID  If the pend status has an invalid value
+*                           OS_ERR_TIMEOUT         If the task was not readied within 'timeout'
+*
+* Returns    : none.
+*
+* Note(s)    : 1) The tasks are evaluated in priority order across the keys in 'keys_eval', as OSMonOp() evaluates them
+*                 in the order of the pend list.  An evaluation returning OS_MON_RES_STOP_EVAL ends the evaluations.
+*
+*              2) Tasks blocked by OSMonOp() have no key and are only evaluated by OSMonOp(), which still evaluates all
+*                 the tasks waiting on the monitor.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+void  OSMonOpKey (OS_MON               *p_mon,
+                  OS_TICK               timeout,
+                  void                 *p_arg,
+                  OS_MON_ON_ENTER_PTR   p_on_enter,
+                  OS_MON_ON_EVAL_PTR    p_on_eval,
+                  OS_MON_KEY            key,
+                  OS_MON_KEYS           keys_eval,
+                  OS_OPT                opt,
+                  OS_ERR               *p_err)
+{
+    OS_MON_RES   op_res;
+    CPU_BOOLEAN  sched;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mon == DEF_NULL) {                                    /* Validate 'p_mon'                                     */
+       *p_err  = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (key >= OS_CFG_MON_KEY_NBR) {                            /* Validate 'key'                                       */
+       *p_err  = OS_ERR_OPT_INVALID;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_1:
+        case OS_OPT_POST_ALL:
+        case OS_OPT_POST_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mon->Type != OS_OBJ_TYPE_MON) {                       /* Make sure monitor was created                        */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    sched = DEF_NO;
+
+    CPU_CRITICAL_ENTER();
+
+    if (p_on_enter != DEF_NULL) {
+        op_res = (*p_on_enter)(p_mon, p_arg);
+    } else {
+        op_res = OS_MON_RES_BLOCK | OS_MON_RES_STOP_EVAL;
+    }
+
+    if (DEF_BIT_IS_SET(op_res, OS_MON_RES_BLOCK) == DEF_YES) {
+        OS_Pend((OS_PEND_OBJ *)(p_mon),                         /* Block task pending on Condition Variable             */
+                OS_TASK_PEND_ON_COND_VAR,
+                timeout);
+        OS_MonKeyInsert(p_mon,                                  /* ... and register it under its condition              */
+                        OSTCBCurPtr,
+                        key);
+
+        sched = DEF_YES;
+    }
+
+    OSTCBCurPtr->MonData.p_eval_data = p_arg;
+    OSTCBCurPtr->MonData.p_on_eval   = p_on_eval;
+
+    if (DEF_BIT_IS_CLR(op_res, OS_MON_RES_STOP_EVAL) == DEF_YES) {
+        if (OS_MonKeyEval(p_mon,                                /* Only evaluate the tasks waiting under 'keys_eval'    */
+                          keys_eval & p_mon->KeyWaitMask,
+                          p_arg,
+                          opt) > 0u) {
+            if (DEF_BIT_IS_CLR(opt, OS_OPT_POST_NO_SCHED) == DEF_YES) {
+                sched = DEF_YES;
+            }
+        }
+    }
+
+    CPU_CRITICAL_EXIT();
+
+    if (sched == DEF_YES) {
+        OSSched();                                              /* Find the next highest priority task ready to run     */
+    }
+
+    if (DEF_BIT_IS_SET(op_res, OS_MON_RES_BLOCK) == DEF_YES) {
+        CPU_CRITICAL_ENTER();
+        switch (OSTCBCurPtr->PendStatus) {
+            case OS_STATUS_PEND_OK:                             /* We got the monitor                                   */
+                *p_err = OS_ERR_NONE;
+                 break;
+
+            case OS_STATUS_PEND_ABORT:                          /* Indicate that we aborted                             */
+                *p_err = OS_ERR_PEND_ABORT;
+                 break;
+
+            case OS_STATUS_PEND_TIMEOUT:                        /* Indicate that we didn't get monitor within timeout   */
+                *p_err = OS_ERR_TIMEOUT;
+                 break;
+
+            case OS_STATUS_PEND_DEL:                            /* Indicate that object pended on has been deleted      */
+                *p_err = OS_ERR_OBJ_DEL;
+                 break;
+
+            default:
+                *p_err = OS_ERR_STATUS_INVALID;
+        }
+        CPU_CRITICAL_EXIT();
+    } else {
+       *p_err = OS_ERR_NONE;
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                           CLEAR THE CONTENTS OF A MONITOR
@@ -458,6 +676,9 @@ void  OS_MonClr (OS_MON  *p_mon)
     p_mon->NamePtr    = (CPU_CHAR *)((void *)"?MON");
 #endif
     OS_PendListInit(&p_mon->PendList);                          /* Initialize the waiting list                          */
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+    OS_MonKeyInit(p_mon);
+#endif
 }
 
 
@@ -518,4 +739,159 @@ void  OS_MonDbgListRemove (OS_MON  *p_mon)
     }
 }
 #endif
+
+
+/*
+************************************************************************************************************************
+*                                          MONITOR CONDITION KEY MANAGEMENT
+*
+* Description: These functions are internal to uC/OS-III and maintain the lists of tasks waiting under each condition key
+*              of a monitor :
+*
+*                  OS_MonKeyEval()      Evaluate the tasks waiting under a set of keys, ready those allowed to run
+*                  OS_MonKeyInit()      Empty the key lists
+*                  OS_MonKeyInsert()    Register the task under a key, in priority order
+*                  OS_MonKeyRemove()    Unregister the task, called by OS_PendListRemove()
+*
+* Note(s)    : 1) A task waiting under a key is ALSO in the pend list of the monitor, so deleting the monitor or aborting,
+*                 timing out and deleting the task work as for OSMonOp().  OS_PendListRemove() unregisters the task.
+*
+*              2) Like the pend list of a monitor, a key list is not reordered when a waiting task changes priority.
+*
+*              3) These functions are INTERNAL to uC/OS-III and your application should not call them.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+static  OS_OBJ_QTY  OS_MonKeyEval (OS_MON       *p_mon,
+                                   OS_MON_KEYS   keys,
+                                   void         *p_scan_data,
+                                   OS_OPT        opt)
+{
+    OS_TCB              *p_cur_tbl[OS_CFG_MON_KEY_NBR];
+    OS_TCB              *p_tcb;
+    OS_MON_ON_EVAL_PTR   p_on_eval;
+    OS_MON_RES           mon_res;
+    OS_MON_KEY           key;
+    OS_MON_KEY           nbr_cur;
+    OS_MON_KEY           ix;
+    OS_MON_KEY           ix_hp;
+    OS_OBJ_QTY           nbr_rdy;
+
+
+    nbr_cur = 0u;                                               /* One cursor per non-empty key list to evaluate        */
+    for (key = 0u; key < OS_CFG_MON_KEY_NBR; key++) {
+        if (DEF_BIT_IS_SET(keys, DEF_BIT(key)) == DEF_YES) {
+            p_cur_tbl[nbr_cur] = p_mon->KeyTbl[key];
+            nbr_cur++;
+        }
+    }
+
+    nbr_rdy = 0u;
+    while (nbr_cur > 0u) {
+        ix_hp = 0u;                                             /* Merge the lists: highest priority head first         */
+        for (ix = 1u; ix < nbr_cur; ix++) {
+            if (p_cur_tbl[ix]->Prio < p_cur_tbl[ix_hp]->Prio) {
+                ix_hp = ix;
+            }
+        }
+        p_tcb = p_cur_tbl[ix_hp];
+        if (p_tcb->MonData.p_key_next != DEF_NULL) {            /* Advance before OS_Post() unregisters the task        */
+            p_cur_tbl[ix_hp] = p_tcb->MonData.p_key_next;
+        } else {                                                /* List evaluated, drop its cursor                      */
+            nbr_cur--;
+            p_cur_tbl[ix_hp] = p_cur_tbl[nbr_cur];
+        }
+
+        p_on_eval = p_tcb->MonData.p_on_eval;
+        if (p_on_eval != DEF_NULL) {
+            mon_res = (*p_on_eval)(p_mon, p_tcb->MonData.p_eval_data, p_scan_data);
+        } else {
+            mon_res = OS_MON_RES_STOP_EVAL;
+        }
+
+        if (DEF_BIT_IS_CLR(mon_res, OS_MON_RES_BLOCK) == DEF_YES) {
+            OS_Post((OS_PEND_OBJ *)(p_mon), p_tcb, DEF_NULL, 0u, 0u);
+            nbr_rdy++;
+            if ((opt & OS_OPT_POST_ALL) == 0u) {                /* Signal: only one task                                */
+                break;
+            }
+        }
+
+        if (DEF_BIT_IS_SET(mon_res, OS_MON_RES_STOP_EVAL) == DEF_YES) {
+            break;
+        }
+    }
+    return (nbr_rdy);
+}
+
+
+static  void  OS_MonKeyInit (OS_MON  *p_mon)
+{
+    OS_MON_KEY  key;
+
+
+    p_mon->KeyWaitMask = 0u;
+    for (key = 0u; key < OS_CFG_MON_KEY_NBR; key++) {
+        p_mon->KeyTbl[key] = DEF_NULL;
+    }
+}
+
+
+static  void  OS_MonKeyInsert (OS_MON      *p_mon,
+                               OS_TCB      *p_tcb,
+                               OS_MON_KEY   key)
+{
+    OS_TCB  *p_prev;
+    OS_TCB  *p_next;
+
+
+    p_prev = DEF_NULL;                                          /* Insert after the tasks of the same or higher prio    */
+    p_next = p_mon->KeyTbl[key];
+    while ((p_next != DEF_NULL) && (p_next->Prio <= p_tcb->Prio)) {
+        p_prev = p_next;
+        p_next = p_next->MonData.p_key_next;
+    }
+    p_tcb->MonData.p_key_mon  = p_mon;
+    p_tcb->MonData.p_key_prev = p_prev;
+    p_tcb->MonData.p_key_next = p_next;
+    p_tcb->MonData.key        = key;
+    if (p_prev == DEF_NULL) {
+        p_mon->KeyTbl[key]        = p_tcb;
+    } else {
+        p_prev->MonData.p_key_next = p_tcb;
+    }
+    if (p_next != DEF_NULL) {
+        p_next->MonData.p_key_prev = p_tcb;
+    }
+    DEF_BIT_SET(p_mon->KeyWaitMask, DEF_BIT(key));
+}
+
+
+void  OS_MonKeyRemove (OS_TCB  *p_tcb)
+{
+    OS_MON  *p_mon;
+    OS_TCB  *p_prev;
+    OS_TCB  *p_next;
+
+
+    p_mon  = p_tcb->MonData.p_key_mon;
+    p_prev = p_tcb->MonData.p_key_prev;
+    p_next = p_tcb->MonData.p_key_next;
+    if (p_next != DEF_NULL) {
+        p_next->MonData.p_key_prev = p_prev;
+    }
+    if (p_prev != DEF_NULL) {
+        p_prev->MonData.p_key_next = p_next;
+    } else {
+        p_mon->KeyTbl[p_tcb->MonData.key] = p_next;
+        if (p_next == DEF_NULL) {
+            DEF_BIT_CLR(p_mon->KeyWaitMask, DEF_BIT(p_tcb->MonData.key));
+        }
+    }
+    p_tcb->MonData.p_key_mon  = DEF_NULL;
+    p_tcb->MonData.p_key_prev = DEF_NULL;
+    p_tcb->MonData.p_key_next = DEF_NULL;
+}
+#endif
 #endif
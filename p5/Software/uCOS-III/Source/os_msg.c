@@ -41,6 +41,242 @@ const  CPU_CHAR  *os_msg__c = "$Id: $";
 
 
 #if (OS_MSG_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_MSG  *OS_MsgAlloc (OS_MSG_Q  *p_msg_q);
+
+static  void     OS_MsgFree  (OS_MSG_Q  *p_msg_q,
+                              OS_MSG    *p_msg);
+
+
+#if (OS_CFG_MSG_BUF_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                          ADD A SIZE CLASS OF MESSAGE BUFFERS
+*
+* Description: This function adds a memory partition to the size classes used by OSMsgBufGet().  Every block of the
+*              partition becomes a message buffer that can be passed through a message queue without copying.
+*
+* Arguments  : p_mem     is a pointer to a memory partition created with OSMemCreate().  Each block holds a small
+*                        header (see Note #2) followed by the message.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                  if the size class was added
+*                            OS_ERR_CREATE_ISR            if you called this function from an ISR
+*                            OS_ERR_MEM_INVALID_P_MEM     if you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_MEM_INVALID_SIZE      if the blocks are too small to hold the header
+*                            OS_ERR_MSG_BUF_CLASS_FULL    if OS_CFG_MSG_BUF_CLASS_MAX size classes were already added
+*                            OS_ERR_OBJ_TYPE              if 'p_mem' is not pointing to a memory partition
+*
+* Returns    : none
+*
+* Note(s)    : (1) The size classes are kept sorted by buffer size, they can be added in any order.
+*
+*              (2) The header records the partition of the buffer so that OSMsgBufPut() only needs the buffer.
+************************************************************************************************************************
+*/
+
+void  OSMsgBufClassAdd (OS_MEM  *p_mem,
+                        OS_ERR  *p_err)
+{
+    OS_MSG_BUF_CLASS  *p_class;
+    OS_OBJ_QTY         i;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to add a size class from an ISR          */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mem == DEF_NULL) {                                    /* Validate 'p_mem'                                     */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the memory partition was created           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (p_mem->BlkSize <= (OS_MSG_BUF_HDR_SIZE +                /* Blocks must hold the header and at least one byte    */
+                           OS_MEM_CANARY_SIZE)) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (OSMsgBufClassQty >= OS_CFG_MSG_BUF_CLASS_MAX) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MSG_BUF_CLASS_FULL;
+        return;
+    }
+    i = OSMsgBufClassQty;                                       /* Insert sorted by buffer size (see Note #1)           */
+    while ((i > 0u) &&
+           (OSMsgBufClassTbl[i - 1u].MemPtr->BlkSize > p_mem->BlkSize)) {
+        OSMsgBufClassTbl[i] = OSMsgBufClassTbl[i - 1u];
+        i--;
+    }
+    p_class              = &OSMsgBufClassTbl[i];
+    p_class->MemPtr      =  p_mem;
+    p_class->BufSize     = (OS_MSG_SIZE)(p_mem->BlkSize - OS_MSG_BUF_HDR_SIZE - OS_MEM_CANARY_SIZE);
+    p_class->NbrUsedMax  =  0u;
+    p_class->GetCtr      =  0u;
+    p_class->EmptyCtr    =  0u;
+    OSMsgBufClassQty++;
+    CPU_CRITICAL_EXIT();
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              GET A MESSAGE BUFFER
+*
+* Description: This function obtains a buffer able to hold a message of 'size' bytes from the smallest size class that
+*              has a free buffer.  The buffer is filled in place and posted to a queue with OSQPost() or OSTaskQPost():
+*              only the pointer is queued and the receiver becomes the owner of the buffer.
+*
+* Arguments  : size      is the size (in bytes) of the message to hold
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                if a buffer was obtained
+*                            OS_ERR_MEM_INVALID_SIZE    if no size class has buffers large enough
+*                            OS_ERR_MEM_NO_FREE_BLKS    if every size class large enough is exhausted
+*
+* Returns    : A pointer to the buffer or a NULL pointer upon error.
+*
+* Note(s)    : (1) When the best fitting size class is exhausted the buffer is taken from the next larger one and the
+*                  exhaustion is counted in its EmptyCtr.
+*
+*              (2) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  *OSMsgBufGet (OS_MSG_SIZE   size,
+                    OS_ERR       *p_err)
+{
+    OS_MSG_BUF_CLASS  *p_class;
+    OS_MEM           **p_hdr;
+    OS_MEM_QTY         nbr_used;
+    OS_OBJ_QTY         i;
+    OS_ERR             err;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (DEF_NULL);
+    }
+#endif
+
+   *p_err = OS_ERR_MEM_INVALID_SIZE;                            /* Assume no size class is large enough                 */
+    for (i = 0u; i < OSMsgBufClassQty; i++) {
+        p_class = &OSMsgBufClassTbl[i];
+        if (p_class->BufSize < size) {
+            continue;
+        }
+        p_hdr = (OS_MEM **)OSMemGet(p_class->MemPtr, &err);
+        if (err != OS_ERR_NONE) {                               /* Size class exhausted, try a larger one (see Note #1) */
+            CPU_CRITICAL_ENTER();
+            p_class->EmptyCtr++;
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+            continue;
+        }
+       *p_hdr = p_class->MemPtr;                                /* Remember the partition of the buffer                 */
+
+        CPU_CRITICAL_ENTER();
+        p_class->GetCtr++;
+        nbr_used = p_class->MemPtr->NbrMax - p_class->MemPtr->NbrFree;
+        if (p_class->NbrUsedMax < nbr_used) {
+            p_class->NbrUsedMax = nbr_used;
+        }
+        CPU_CRITICAL_EXIT();
+
+       *p_err = OS_ERR_NONE;
+        return ((void *)((CPU_INT08U *)p_hdr + OS_MSG_BUF_HDR_SIZE));
+    }
+    return (DEF_NULL);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            RELEASE A MESSAGE BUFFER
+*
+* Description: This function returns a buffer obtained with OSMsgBufGet() to its size class.  It is called by the owner
+*              of the buffer, normally the task that received it from a message queue.
+*
+* Arguments  : p_buf     is a pointer to the buffer, as returned by OSMsgBufGet()
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                if the buffer was released
+*                            OS_ERR_MEM_FULL            if the size class already has all its buffers
+*                            OS_ERR_MSG_BUF_INVALID     if 'p_buf' is not a buffer obtained with OSMsgBufGet()
+*
+* Returns    : none
+*
+* Note(s)    : (1) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSMsgBufPut (void    *p_buf,
+                   OS_ERR  *p_err)
+{
+    OS_MEM      *p_mem;
+    OS_MEM     **p_hdr;
+    OS_OBJ_QTY   i;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_buf == DEF_NULL) {                                    /* Validate 'p_buf'                                     */
+       *p_err = OS_ERR_MSG_BUF_INVALID;
+        return;
+    }
+#endif
+
+    p_hdr = (OS_MEM **)((CPU_INT08U *)p_buf - OS_MSG_BUF_HDR_SIZE);
+    p_mem = *p_hdr;
+    for (i = 0u; i < OSMsgBufClassQty; i++) {                   /* Header must point to one of the size classes         */
+        if (OSMsgBufClassTbl[i].MemPtr == p_mem) {
+            OSMemPut(p_mem, (void *)p_hdr, p_err);
+            return;
+        }
+    }
+   *p_err = OS_ERR_MSG_BUF_INVALID;
+}
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -105,6 +341,10 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
     OSMsgPool.NbrUsed    = 0u;
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OSMsgPool.NbrUsedMax = 0u;
+    OSMsgPool.EmptyCtr   = 0u;
+#endif
+#if (OS_CFG_MSG_BUF_EN == DEF_ENABLED)
+    OSMsgBufClassQty     = 0u;
 #endif
    *p_err                =  OS_ERR_NONE;
 }
@@ -134,11 +374,19 @@ OS_MSG_QTY  OS_MsgQFreeAll (OS_MSG_Q  *p_msg_q)
 
     qty = p_msg_q->NbrEntries;                                  /* Get the number of OS_MSGs being freed                */
     if (p_msg_q->NbrEntries > 0u) {
+#if (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED)
+        while (p_msg_q->OutPtr != DEF_NULL) {                   /* Refill the reserve first (see OS_MsgFree())          */
+            p_msg           = p_msg_q->OutPtr;
+            p_msg_q->OutPtr = p_msg->NextPtr;
+            OS_MsgFree(p_msg_q, p_msg);
+        }
+#else
         p_msg                   = p_msg_q->InPtr;               /* Point to end of message chain                        */
         p_msg->NextPtr          = OSMsgPool.NextPtr;
         OSMsgPool.NextPtr       = p_msg_q->OutPtr;              /* Point to beginning of message chain                  */
         OSMsgPool.NbrUsed      -= p_msg_q->NbrEntries;          /* Update statistics for free list of messages          */
         OSMsgPool.NbrFree      += p_msg_q->NbrEntries;
+#endif
         p_msg_q->NbrEntries     = 0u;                           /* Flush the message queue                              */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
         p_msg_q->NbrEntriesMax  = 0u;
@@ -177,6 +425,11 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
 #endif
     p_msg_q->InPtr          = DEF_NULL;
     p_msg_q->OutPtr         = DEF_NULL;
+#if (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED)
+    p_msg_q->ResvPtr        = DEF_NULL;
+    p_msg_q->ResvSize       = 0u;
+    p_msg_q->ResvFree       = 0u;
+#endif
 }
 
 
@@ -246,16 +499,82 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
         p_msg_q->NbrEntries--;                                  /* Yes, One less message in the queue                   */
     }
 
-    p_msg->NextPtr    = OSMsgPool.NextPtr;                      /* Return message control block to free list            */
-    OSMsgPool.NextPtr = p_msg;
-    OSMsgPool.NbrFree++;
-    OSMsgPool.NbrUsed--;
+    OS_MsgFree(p_msg_q, p_msg);                                 /* Return message control block to free list            */
 
    *p_err             = OS_ERR_NONE;
     return (p_void);
 }
 
 
+/*
+************************************************************************************************************************
+*                                      GET UP TO 'N' MESSAGES FROM MESSAGE QUEUE
+*
+* Description: This function retrieves up to 'nbr' messages from a message queue in a single pass.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue where we want to extract the messages from
+*              -------
+*
+*              p_msg_tbl   is a pointer to an array of at least 'nbr' entries that will receive the messages
+*
+*              p_size_tbl  is a pointer to an array of at least 'nbr' entries that will receive the message sizes
+*
+*              nbr         is the maximum number of messages to extract
+*
+*              p_ts        is a pointer to where the time stamp of the first message will be placed (may be NULL)
+*
+* Returns    : The number of messages extracted (0 if the queue is empty).
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Interrupts are disabled by the caller.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY  OS_MsgQGetN (OS_MSG_Q      *p_msg_q,
+                         void         **p_msg_tbl,
+                         OS_MSG_SIZE   *p_size_tbl,
+                         OS_MSG_QTY     nbr,
+                         CPU_TS        *p_ts)
+{
+    OS_MSG      *p_msg;
+    OS_MSG_QTY   nbr_rx;
+
+
+    if (nbr > p_msg_q->NbrEntries) {                            /* Can't extract more than what the queue holds         */
+        nbr = p_msg_q->NbrEntries;
+    }
+    if (nbr == 0u) {
+        return (0u);
+    }
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    if (p_ts != DEF_NULL) {
+       *p_ts = p_msg_q->OutPtr->MsgTS;                          /* Time stamp of the first message extracted            */
+    }
+#else
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'p_ts'        */
+#endif
+
+    for (nbr_rx = 0u; nbr_rx < nbr; nbr_rx++) {
+        p_msg                = p_msg_q->OutPtr;
+        p_msg_tbl[nbr_rx]    = p_msg->MsgPtr;
+        p_size_tbl[nbr_rx]   = p_msg->MsgSize;
+        p_msg_q->OutPtr      = p_msg->NextPtr;
+        OS_MsgFree(p_msg_q, p_msg);                             /* Return message control block to free list            */
+    }
+
+    p_msg_q->NbrEntries -= nbr;
+    if (p_msg_q->NbrEntries == 0u) {                            /* Are there any more messages in the queue?            */
+        p_msg_q->InPtr  = DEF_NULL;                             /* No                                                   */
+        p_msg_q->OutPtr = DEF_NULL;
+    }
+    return (nbr);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                           DEPOSIT MESSAGE IN MESSAGE QUEUE
@@ -308,22 +627,12 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
         return;
     }
 
-    if (OSMsgPool.NbrFree == 0u) {
+    p_msg = OS_MsgAlloc(p_msg_q);                               /* Remove message control block from free list          */
+    if (p_msg == DEF_NULL) {
        *p_err = OS_ERR_MSG_POOL_EMPTY;                          /* No more OS_MSG to use                                */
         return;
     }
 
-    p_msg = OSMsgPool.NextPtr;                                  /* Remove message control block from free list          */
-    OSMsgPool.NextPtr = p_msg->NextPtr;
-    OSMsgPool.NbrFree--;
-    OSMsgPool.NbrUsed++;
-
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-    if (OSMsgPool.NbrUsedMax < OSMsgPool.NbrUsed) {
-        OSMsgPool.NbrUsedMax = OSMsgPool.NbrUsed;
-    }
-#endif
-
     if (p_msg_q->NbrEntries == 0u) {                            /* Is this first message placed in the queue?           */
         p_msg_q->InPtr         = p_msg;                         /* Yes                                                  */
         p_msg_q->OutPtr        = p_msg;
@@ -355,4 +664,182 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
 #endif
    *p_err          = OS_ERR_NONE;
 }
+
+
+/*
+************************************************************************************************************************
+*                                         RESERVE OS_MSGs FOR A MESSAGE QUEUE
+*
+* Description: This function moves OS_MSGs from the free list to the reserve of a message queue.  OS_MSGs in the reserve
+*              are only used by that message queue, before the ones of the free list.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue
+*              -------
+*
+*              nbr         is the number of OS_MSGs to reserve
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_MSG_POOL_EMPTY  if the free list holds less than 'nbr' OS_MSGs
+*                              OS_ERR_NONE            the OS_MSGs were reserved
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The message queue must be empty and must not already have a reserve.
+*
+*              3) Interrupts are disabled by the caller.  Reserving is done once, when the message queue is set up,
+*                 the loop is bounded by 'nbr'.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED)
+void  OS_MsgQResv (OS_MSG_Q    *p_msg_q,
+                   OS_MSG_QTY   nbr,
+                   OS_ERR      *p_err)
+{
+    OS_MSG      *p_msg;
+    OS_MSG_QTY   i;
+
+
+    if (OSMsgPool.NbrFree < nbr) {
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+        OSMsgPool.EmptyCtr++;
+#endif
+       *p_err = OS_ERR_MSG_POOL_EMPTY;
+        return;
+    }
+
+    for (i = 0u; i < nbr; i++) {                                /* See Note #3                                          */
+        p_msg             = OSMsgPool.NextPtr;
+        OSMsgPool.NextPtr = p_msg->NextPtr;
+        p_msg->NextPtr    = p_msg_q->ResvPtr;
+        p_msg_q->ResvPtr  = p_msg;
+    }
+    OSMsgPool.NbrFree -= nbr;
+    OSMsgPool.NbrUsed += nbr;                                   /* Reserved OS_MSGs are in use from the pool's view     */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    if (OSMsgPool.NbrUsedMax < OSMsgPool.NbrUsed) {
+        OSMsgPool.NbrUsedMax = OSMsgPool.NbrUsed;
+    }
+#endif
+    p_msg_q->ResvSize  = nbr;
+    p_msg_q->ResvFree  = nbr;
+   *p_err              = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                   RETURN THE RESERVED OS_MSGs TO THE FREE LIST
+*
+* Description: This function returns the reserve of a message queue to the free list.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue
+*              -------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The message queue must have been emptied with OS_MsgQFreeAll() first.
+************************************************************************************************************************
+*/
+
+void  OS_MsgQResvRelease (OS_MSG_Q  *p_msg_q)
+{
+    OS_MSG  *p_msg;
+
+
+    while (p_msg_q->ResvPtr != DEF_NULL) {
+        p_msg             = p_msg_q->ResvPtr;
+        p_msg_q->ResvPtr  = p_msg->NextPtr;
+        p_msg->NextPtr    = OSMsgPool.NextPtr;
+        OSMsgPool.NextPtr = p_msg;
+    }
+    OSMsgPool.NbrFree += p_msg_q->ResvFree;
+    OSMsgPool.NbrUsed -= p_msg_q->ResvFree;
+    p_msg_q->ResvSize  = 0u;
+    p_msg_q->ResvFree  = 0u;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          ALLOCATE/FREE AN 'OS_MSG'
+*
+* Description: These functions obtain an OS_MSG for a message queue and release it.  The reserve of the message queue
+*              is used first, then the free list.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue
+*              -------
+*
+*              p_msg       is a pointer to the OS_MSG to release
+*
+* Returns    : OS_MsgAlloc() returns a pointer to the OS_MSG or a NULL pointer if none is available.
+*
+* Note(s)    : 1) A released OS_MSG refills the reserve of the message queue before going back to the free list.
+*                 OS_MSGs are interchangeable, it does not matter where a given OS_MSG was taken from.
+*
+*              2) Interrupts are disabled by the caller.
+************************************************************************************************************************
+*/
+
+static  OS_MSG  *OS_MsgAlloc (OS_MSG_Q  *p_msg_q)
+{
+    OS_MSG  *p_msg;
+
+
+#if (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED)
+    if (p_msg_q->ResvFree > 0u) {                               /* Use the reserve of the queue first                   */
+        p_msg            = p_msg_q->ResvPtr;
+        p_msg_q->ResvPtr = p_msg->NextPtr;
+        p_msg_q->ResvFree--;
+        return (p_msg);
+    }
+#else
+    (void)p_msg_q;                                              /* Prevent compiler warning for not using 'p_msg_q'     */
+#endif
+
+    if (OSMsgPool.NbrFree == 0u) {
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+        OSMsgPool.EmptyCtr++;                                   /* Keep track of pool exhaustion                        */
+#endif
+        return (DEF_NULL);
+    }
+
+    p_msg             = OSMsgPool.NextPtr;
+    OSMsgPool.NextPtr = p_msg->NextPtr;
+    OSMsgPool.NbrFree--;
+    OSMsgPool.NbrUsed++;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    if (OSMsgPool.NbrUsedMax < OSMsgPool.NbrUsed) {
+        OSMsgPool.NbrUsedMax = OSMsgPool.NbrUsed;
+    }
+#endif
+    return (p_msg);
+}
+
+
+static  void  OS_MsgFree (OS_MSG_Q  *p_msg_q,
+                          OS_MSG    *p_msg)
+{
+#if (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED)
+    if (p_msg_q->ResvFree < p_msg_q->ResvSize) {                /* Refill the reserve of the queue first (see Note #1)  */
+        p_msg->NextPtr   = p_msg_q->ResvPtr;
+        p_msg_q->ResvPtr = p_msg;
+        p_msg_q->ResvFree++;
+        return;
+    }
+#else
+    (void)p_msg_q;                                              /* Prevent compiler warning for not using 'p_msg_q'     */
+#endif
+
+    p_msg->NextPtr    = OSMsgPool.NextPtr;
+    OSMsgPool.NextPtr = p_msg;
+    OSMsgPool.NbrFree++;
+    OSMsgPool.NbrUsed--;
+}
 #endif
@@ -35,12 +35,67 @@
 #define  MICRIUM_SOURCE
 #include "os.h"
 
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED) && !defined(__ICCARM__) && \
+    (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__))
+#define  OS_MUTEX_C11_ATOMICS                                   /* Host build, see OS_MutexCAS()                        */
+#include <stdatomic.h>
+#endif
+
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
 const  CPU_CHAR  *os_mutex__c = "$Id: $";
 #endif
 
 
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+#define  OS_MUTEX_LOCK_KERNEL          ((OS_TCB *)1u)           /* 'LockOwnerPtr': owner is in 'OwnerTCBPtr'            */
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)                     /* Mutexes that may take the fast path                  */
+#define  OS_MUTEX_FAST_TYPE_OK(p_mutex)    ((p_mutex)->Type == OS_OBJ_TYPE_MUTEX)
+#else
+#define  OS_MUTEX_FAST_TYPE_OK(p_mutex)    (DEF_TRUE)
+#endif
+
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+#define  OS_MUTEX_FAST_PROTO_OK(p_mutex)   ((p_mutex)->CeilingPrio == OS_PRIO_INIT)
+#else
+#define  OS_MUTEX_FAST_PROTO_OK(p_mutex)   (DEF_TRUE)
+#endif
+
+#define  OS_MUTEX_FAST_OK(p_mutex)         ((OSIntNestingCtr == 0u)                  && \
+                                            (OSRunning       == OS_STATE_OS_RUNNING) && \
+                                            ((p_mutex)       != DEF_NULL)            && \
+                                             OS_MUTEX_FAST_TYPE_OK(p_mutex)          && \
+                                             OS_MUTEX_FAST_PROTO_OK(p_mutex))
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void     OS_MutexCreate    (OS_MUTEX  *p_mutex,
+                                    CPU_CHAR  *p_name,
+                                    OS_PRIO    prio,
+                                    OS_ERR    *p_err);
+
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+static  OS_TCB  *OS_MutexCAS       (OS_TCB   **p_owner,
+                                    OS_TCB    *cmp,
+                                    OS_TCB    *val);
+
+static  void     OS_MutexFastAdopt (OS_MUTEX  *p_mutex);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   CREATE A MUTEX
@@ -70,9 +125,58 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
                      CPU_CHAR  *p_name,
                      OS_ERR    *p_err)
 {
-    CPU_SR_ALLOC();
+    OS_MutexCreate(p_mutex, p_name, OS_PRIO_INIT, p_err);       /* Priority inheritance                                 */
+}
+
 
+/*
+************************************************************************************************************************
+*                                          CREATE A PRIORITY CEILING MUTEX
+*
+* Description: This function creates a mutex that uses the immediate priority ceiling protocol instead of priority
+*              inheritance.
+*
+* Arguments  : p_mutex       is a pointer to the mutex to initialize.  Your application is responsible for allocating
+*                            storage for the mutex.
+*
+*              p_name        is a pointer to the name you would like to give the mutex.
+*
+*              prio          is the priority ceiling of the mutex.  It MUST be the priority of the highest priority task
+*                            that uses the mutex.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the mutex after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_mutex' is a NULL pointer
+*                                OS_ERR_PRIO_INVALID            If 'prio' is the idle task priority or higher
+*
+* Returns    : none
+*
+* Note(s)    : 1) The owner of the mutex runs at the ceiling from the moment it gets the mutex until it releases it.  No
+*                 other task that uses the mutex can preempt it, so:
+*
+*                 a) a task is blocked by at most one critical section of a lower priority task, and never by a chain
+*                    of them;
+*
+*                 b) OSMutexPend() and OSMutexPost() never walk the pend lists or the owner's mutex group when the
+*                    mutex is not contended and the owner holds no other mutex.
+*
+*              2) A task with a base priority higher than the ceiling gets OS_ERR_MUTEX_CEILING from OSMutexPend().
+*
+*              3) Contention can still happen if the owner blocks while it holds the mutex.  The waiting tasks then
+*                 inherit nothing, the owner already runs at the ceiling.
+************************************************************************************************************************
+*/
 
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+void  OSMutexCreateCeiling (OS_MUTEX  *p_mutex,
+                            CPU_CHAR  *p_name,
+                            OS_PRIO    prio,
+                            OS_ERR    *p_err)
+{
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == DEF_NULL) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -80,53 +184,16 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
     }
 #endif
 
-#ifdef OS_SAFETY_CRITICAL_IEC61508
-    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
-       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
-        return;
-    }
-#endif
-
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
-       *p_err = OS_ERR_CREATE_ISR;
-        return;
-    }
-#endif
-
 #if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
-    if (p_mutex == DEF_NULL) {                                  /* Validate 'p_mutex'                                   */
-       *p_err = OS_ERR_OBJ_PTR_NULL;
+    if (prio >= (OS_CFG_PRIO_MAX - 1u)) {                       /* Ceiling cannot be the Idle Task priority             */
+       *p_err = OS_ERR_PRIO_INVALID;
         return;
     }
 #endif
 
-    CPU_CRITICAL_ENTER();
-#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
-    p_mutex->Type              =  OS_OBJ_TYPE_MUTEX;            /* Mark the data structure as a mutex                   */
-#endif
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-    p_mutex->NamePtr           =  p_name;
-#else
-    (void)p_name;
-#endif
-    p_mutex->MutexGrpNextPtr   = DEF_NULL;
-    p_mutex->OwnerTCBPtr       = DEF_NULL;
-    p_mutex->OwnerNestingCtr   = 0u;                            /* Mutex is available                                   */
-#if (OS_CFG_TS_EN == DEF_ENABLED)
-    p_mutex->TS                = 0u;
-#endif
-    OS_PendListInit(&p_mutex->PendList);                        /* Initialize the waiting list                          */
-
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-    OS_MutexDbgListAdd(p_mutex);
-    OSMutexQty++;
-#endif
-
-    OS_TRACE_MUTEX_CREATE(p_mutex, p_name);
-    CPU_CRITICAL_EXIT();
-   *p_err = OS_ERR_NONE;
+    OS_MutexCreate(p_mutex, p_name, prio, p_err);
 }
+#endif
 
 
 /*
@@ -240,6 +307,9 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                  OS_MutexDbgListRemove(p_mutex);
                  OSMutexQty--;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+                 OS_ObjRegRemove(p_mutex->Handle);
 #endif
                  OS_TRACE_MUTEX_DEL(p_mutex);
                  if (p_mutex->OwnerTCBPtr != DEF_NULL) {        /* Does the mutex belong to a task?                     */
@@ -270,6 +340,9 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
              OS_MutexDbgListRemove(p_mutex);
              OSMutexQty--;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+             OS_ObjRegRemove(p_mutex->Handle);
 #endif
              OS_TRACE_MUTEX_DEL(p_mutex);
              p_tcb_owner = p_mutex->OwnerTCBPtr;
@@ -330,6 +403,8 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *              p_err         is a pointer to a variable that will contain an error code returned by this function.
 *
 *                                OS_ERR_NONE               The call was successful and your task owns the resource
+*                                OS_ERR_MUTEX_CEILING      If the calling task's base priority is higher than the
+*                                                          priority ceiling of the mutex
 *                                OS_ERR_MUTEX_OWNER        If calling task already owns the mutex
 *                                OS_ERR_MUTEX_OVF          Mutex nesting counter overflowed
 *                                OS_ERR_OBJ_DEL            If 'p_mutex' was deleted
@@ -348,7 +423,16 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) The owner of a priority ceiling mutex is raised to the ceiling when it gets the mutex, see
+*                 OSMutexCreateCeiling().
+*
+*              2) When OS_CFG_MUTEX_FAST_EN is enabled, a task takes a free priority inheritance mutex, or nests on
+*                 one it took that way, with a single compare-and-swap of 'LockOwnerPtr' and without entering a
+*                 critical section.  The argument, ISR and type checks are reduced to what the swap needs.  The mutex
+*                 is then neither in 'OwnerTCBPtr' nor in the owner's group.  The first task that finds it owned
+*                 enters the kernel path below which adopts the owner (see OS_MutexFastAdopt()) so that priority
+*                 inheritance, the timeout and the release to the waiters work as usual.  OSTaskDel() adopts the
+*                 mutexes the deleted task took that way (see OS_MutexFastAdoptAll()) and releases them with the others.
 ************************************************************************************************************************
 */
 
@@ -359,6 +443,9 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
                    OS_ERR    *p_err)
 {
     OS_TCB  *p_tcb;
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    OS_TCB  *p_owner;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -373,6 +460,36 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
     }
 #endif
 
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    if (OS_MUTEX_FAST_OK(p_mutex)) {                            /* Uncontended fast path, see Note #2                   */
+        p_tcb   = OSTCBCurPtr;
+        p_owner = OS_MutexCAS(&p_mutex->LockOwnerPtr, DEF_NULL, p_tcb);
+        if (p_owner == DEF_NULL) {                              /* Mutex was free, the caller owns it                   */
+            p_mutex->OwnerNestingCtr = 1u;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+            if (p_ts != DEF_NULL) {
+               *p_ts = p_mutex->TS;
+            }
+#endif
+            OS_TRACE_MUTEX_PEND(p_mutex);
+           *p_err = OS_ERR_NONE;
+            return;
+        }
+        if ((p_owner                  == p_tcb) &&              /* Caller already owns it through the fast path         */
+            (p_mutex->OwnerNestingCtr != (OS_NESTING_CTR)-1)) {
+            p_mutex->OwnerNestingCtr++;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+            if (p_ts != DEF_NULL) {
+               *p_ts = p_mutex->TS;
+            }
+#endif
+            OS_TRACE_MUTEX_PEND_FAILED(p_mutex);
+           *p_err = OS_ERR_MUTEX_OWNER;
+            return;
+        }
+    }                                                           /* Owned by another task: take the kernel path          */
+#endif
+
     OS_TRACE_MUTEX_PEND_ENTER(p_mutex, timeout, opt, p_ts);
 
 #if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
@@ -422,7 +539,26 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
 #endif
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    OS_MutexFastAdopt(p_mutex);                                 /* The kernel tracks the owner from now on              */
+#endif
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    if ((p_mutex->CeilingPrio   != OS_PRIO_INIT) &&             /* Caller's priority MUST NOT be above the ceiling      */
+        (OSTCBCurPtr->BasePrio  <  p_mutex->CeilingPrio)) {
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_MUTEX_PEND_FAILED(p_mutex);
+        OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_MUTEX_CEILING);
+       *p_err = OS_ERR_MUTEX_CEILING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    if (p_mutex->LockOwnerPtr == DEF_NULL) {                    /* Resource available?                                  */
+        p_mutex->LockOwnerPtr    = OS_MUTEX_LOCK_KERNEL;
+#else
     if (p_mutex->OwnerNestingCtr == 0u) {                       /* Resource available?                                  */
+#endif
         p_mutex->OwnerTCBPtr     = OSTCBCurPtr;                 /* Yes, caller may proceed                              */
         p_mutex->OwnerNestingCtr = 1u;
 #if (OS_CFG_TS_EN == DEF_ENABLED)
@@ -431,6 +567,13 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
         }
 #endif
         OS_MutexGrpAdd(OSTCBCurPtr, p_mutex);                   /* Add mutex to owner's group                           */
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+        if (p_mutex->CeilingPrio < OSTCBCurPtr->Prio) {         /* Raise owner to the ceiling, see Note #1              */
+            OS_TaskChangePrio(OSTCBCurPtr, p_mutex->CeilingPrio);
+            OSPrioCur = p_mutex->CeilingPrio;
+            OS_TRACE_MUTEX_TASK_PRIO_INHERIT(OSTCBCurPtr, OSPrioCur);
+        }
+#endif
         CPU_CRITICAL_EXIT();
         OS_TRACE_MUTEX_PEND(p_mutex);
         OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_NONE);
@@ -721,7 +864,12 @@ OS_OBJ_QTY  OSMutexPendAbort (OS_MUTEX  *p_mutex,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) The owner's priority is lowered back to the highest of its base priority, the ceilings of the other
+*                 mutexes it owns and the priorities of the tasks waiting on them.
+*
+*              2) A mutex taken through the fast path of OSMutexPend() and still not wanted by another task is released
+*                 with a compare-and-swap of 'LockOwnerPtr'.  The swap fails once a waiter had the kernel adopt the
+*                 owner, the release then goes through the kernel path which hands the mutex over.
 ************************************************************************************************************************
 */
 
@@ -733,6 +881,7 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     OS_TCB        *p_tcb;
     CPU_TS         ts;
     OS_PRIO        prio_new;
+    OS_PRIO        prio_cur;
     CPU_SR_ALLOC();
 
 
@@ -743,6 +892,27 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     }
 #endif
 
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    if (OS_MUTEX_FAST_OK(p_mutex)) {                            /* Uncontended fast path, see Note #2                   */
+        p_tcb = OSTCBCurPtr;
+        if (p_mutex->LockOwnerPtr == p_tcb) {
+            if (p_mutex->OwnerNestingCtr > 1u) {                /* Not done with all nestings                           */
+                p_mutex->OwnerNestingCtr--;
+               *p_err = OS_ERR_MUTEX_NESTING;
+                return;
+            }
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+            p_mutex->TS = OS_TS_GET();
+#endif
+            if (OS_MutexCAS(&p_mutex->LockOwnerPtr, p_tcb, DEF_NULL) == p_tcb) {
+                OS_TRACE_MUTEX_POST(p_mutex);
+               *p_err = OS_ERR_NONE;
+                return;
+            }
+        }
+    }                                                           /* A task waits on the mutex: take the kernel path      */
+#endif
+
     OS_TRACE_MUTEX_POST_ENTER(p_mutex, opt);
 
 #if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
@@ -792,6 +962,9 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 #endif
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    OS_MutexFastAdopt(p_mutex);
+#endif
     if (OSTCBCurPtr != p_mutex->OwnerTCBPtr) {                  /* Make sure the mutex owner is releasing the mutex     */
         CPU_CRITICAL_EXIT();
         OS_TRACE_MUTEX_POST_FAILED(p_mutex);
@@ -818,28 +991,46 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 
     OS_MutexGrpRemove(OSTCBCurPtr, p_mutex);                    /* Remove mutex from owner's group                      */
 
+    prio_cur = OSTCBCurPtr->Prio;
+    if (prio_cur != OSTCBCurPtr->BasePrio) {                    /* Has owner inherited a priority or a ceiling?         */
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+        if ((OSTCBCurPtr->MutexGrpHeadPtr  == DEF_NULL) &&      /* Yes, back to base prio if it owns no other mutex ... */
+            (OSTCBCurPtr->RWLockGrpHeadPtr == DEF_NULL)) {      /* ... nor write lock ...                               */
+#else
+        if (OSTCBCurPtr->MutexGrpHeadPtr == DEF_NULL) {         /* Yes, back to base prio if it owns no other mutex ... */
+#endif
+            prio_new = OSTCBCurPtr->BasePrio;
+        } else {                                                /* ... else find highest priority pending or ceiling    */
+            prio_new = OS_MutexGrpPrioFindHighest(OSTCBCurPtr);
+            prio_new = (prio_new > OSTCBCurPtr->BasePrio) ? OSTCBCurPtr->BasePrio : prio_new;
+        }
+        if (prio_new > prio_cur) {                              /* See Note #1                                          */
+            OS_RdyListRemove(OSTCBCurPtr);
+            OSTCBCurPtr->Prio = prio_new;                       /* Lower owner's priority back to its original one      */
+            OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(OSTCBCurPtr, prio_new);
+            OS_PrioInsert(prio_new);
+            OS_RdyListInsertTail(OSTCBCurPtr);                  /* Insert owner in ready list at new priority           */
+            OSPrioCur         = prio_new;
+        }
+    }
+
     p_pend_list = &p_mutex->PendList;
     if (p_pend_list->HeadPtr == DEF_NULL) {                     /* Any task waiting on mutex?                           */
         p_mutex->OwnerTCBPtr     = DEF_NULL;                    /* No                                                   */
         p_mutex->OwnerNestingCtr = 0u;
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+        p_mutex->LockOwnerPtr    = DEF_NULL;                    /* The fast path may take it again                      */
+#endif
         CPU_CRITICAL_EXIT();
+        if ((OSTCBCurPtr->Prio != prio_cur) &&                  /* Tasks may be ready above the lowered priority        */
+            ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+            OSSched();
+        }
         OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
        *p_err = OS_ERR_NONE;
         return;
     }
                                                                 /* Yes                                                  */
-    if (OSTCBCurPtr->Prio != OSTCBCurPtr->BasePrio) {           /* Has owner inherited a priority?                      */
-        prio_new = OS_MutexGrpPrioFindHighest(OSTCBCurPtr);     /* Yes, find highest priority pending                   */
-        prio_new = (prio_new > OSTCBCurPtr->BasePrio) ? OSTCBCurPtr->BasePrio : prio_new;
-        if (prio_new > OSTCBCurPtr->Prio) {
-            OS_RdyListRemove(OSTCBCurPtr);
-            OSTCBCurPtr->Prio = prio_new;                       /* Lower owner's priority back to its original one      */
-            OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(OSTCBCurPtr, prio_new);
-            OS_PrioInsert(prio_new);
-            OS_RdyListInsertTail(OSTCBCurPtr);                  /* Insert owner in ready list at new priority           */
-            OSPrioCur         = prio_new;
-        }
-    }
                                                                 /* Get TCB from head of pend list                       */
     p_tcb                    = p_pend_list->HeadPtr;
     p_mutex->OwnerTCBPtr     = p_tcb;                           /* Give mutex to new owner                              */
@@ -852,6 +1043,13 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
                            0u,
                            ts);
 
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    if (p_mutex->CeilingPrio < p_tcb->Prio) {                   /* Raise new owner to the ceiling                       */
+        OS_TaskChangePrio(p_tcb, p_mutex->CeilingPrio);
+        OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
+    }
+#endif
+
     CPU_CRITICAL_EXIT();
 
     if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
@@ -889,6 +1087,12 @@ void  OS_MutexClr (OS_MUTEX  *p_mutex)
     p_mutex->MutexGrpNextPtr   = DEF_NULL;
     p_mutex->OwnerTCBPtr       = DEF_NULL;
     p_mutex->OwnerNestingCtr   = 0u;
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    p_mutex->LockOwnerPtr      = DEF_NULL;
+#endif
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    p_mutex->CeilingPrio       = OS_PRIO_INIT;
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     p_mutex->TS                = 0u;
 #endif
@@ -1025,6 +1229,8 @@ void  OS_MutexGrpRemove (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 * Returns    : Highest priority pending or OS_CFG_PRIO_MAX - 1u if none found.
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The ceilings of the priority ceiling mutexes of the group count as pending priorities.
 ************************************************************************************************************************
 */
 
@@ -1047,9 +1253,22 @@ OS_PRIO  OS_MutexGrpPrioFindHighest (OS_TCB  *p_tcb)
                 highest_prio = prio;
             }
         }
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+        prio = (*pp_mutex)->CeilingPrio;                        /* See Note #2                                          */
+        if(prio < highest_prio) {
+            highest_prio = prio;
+        }
+#endif
         pp_mutex = &(*pp_mutex)->MutexGrpNextPtr;
     }
 
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+    prio = OS_RWLockGrpPrioFindHighest(p_tcb);                  /* Write locks are inherited like mutexes               */
+    if (prio < highest_prio) {
+        highest_prio = prio;
+    }
+#endif
+
     return (highest_prio);
 }
 
@@ -1099,10 +1318,13 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
         if (p_pend_list->HeadPtr == DEF_NULL) {                 /* Any task waiting on mutex?                           */
             p_mutex->OwnerNestingCtr = 0u;                      /* Decrement owner's nesting counter                    */
             p_mutex->OwnerTCBPtr     = DEF_NULL;                /* No                                                   */
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+            p_mutex->LockOwnerPtr    = DEF_NULL;
+#endif
         } else {
                                                                 /* Get TCB from head of pend list                       */
             p_tcb_new                = p_pend_list->HeadPtr;
-            p_mutex->OwnerTCBPtr     = p_tcb;                   /* Give mutex to new owner                              */
+            p_mutex->OwnerTCBPtr     = p_tcb_new;               /* Give mutex to new owner                              */
             p_mutex->OwnerNestingCtr = 1u;
             OS_MutexGrpAdd(p_tcb_new, p_mutex);
                                                                 /* Post to mutex                                        */
@@ -1111,6 +1333,12 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
                                    DEF_NULL,
                                    0u,
                                    ts);
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+            if (p_mutex->CeilingPrio < p_tcb_new->Prio) {       /* Raise new owner to the ceiling                       */
+                OS_TaskChangePrio(p_tcb_new, p_mutex->CeilingPrio);
+                OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb_new, p_tcb_new->Prio);
+            }
+#endif
         }
 
         p_mutex = p_mutex_next;
@@ -1118,4 +1346,239 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
 
 }
 
+
+/*
+************************************************************************************************************************
+*                                                   CREATE A MUTEX
+*
+* Description: This function is called by OSMutexCreate() and OSMutexCreateCeiling() to initialize a mutex.
+*
+* Arguments  : p_mutex       is a pointer to the mutex to initialize
+*
+*              p_name        is a pointer to the name of the mutex
+*
+*              prio          is the priority ceiling of the mutex, OS_PRIO_INIT for priority inheritance
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*                            See OSMutexCreate().
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The ceiling is set in the critical section that marks the mutex as created.  Otherwise, a task
+*                 readied in between could take a ceiling mutex through the fast path, without being raised to the
+*                 ceiling (see OSMutexPend() Note #2).
+************************************************************************************************************************
+*/
+
+static  void  OS_MutexCreate (OS_MUTEX  *p_mutex,
+                              CPU_CHAR  *p_name,
+                              OS_PRIO    prio,
+                              OS_ERR    *p_err)
+{
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    CPU_INT32U  name_hash;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mutex == DEF_NULL) {                                  /* Validate 'p_mutex'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    name_hash = OS_ObjRegHash(p_name);                          /* Hash the name with interrupts enabled                */
+#endif
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_mutex->Type              =  OS_OBJ_TYPE_MUTEX;            /* Mark the data structure as a mutex                   */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_mutex->NamePtr           =  p_name;
+#else
+    (void)p_name;
+#endif
+    p_mutex->MutexGrpNextPtr   = DEF_NULL;
+    p_mutex->OwnerTCBPtr       = DEF_NULL;
+    p_mutex->OwnerNestingCtr   = 0u;                            /* Mutex is available                                   */
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    p_mutex->LockOwnerPtr      = DEF_NULL;
+#endif
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    p_mutex->CeilingPrio       = prio;                          /* Set with the type, see Note #2                       */
+#else
+    (void)prio;
+#endif
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_mutex->TS                = 0u;
+#endif
+    OS_PendListInit(&p_mutex->PendList);                        /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_MutexDbgListAdd(p_mutex);
+    OSMutexQty++;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    p_mutex->Handle = OS_ObjRegAdd((void *)p_mutex, OS_OBJ_TYPE_MUTEX, p_name, name_hash);
+#endif
+
+    OS_TRACE_MUTEX_CREATE(p_mutex, p_name);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   COMPARE AND SWAP
+*
+* Description: This function atomically replaces the owner of a mutex taken through the fast path with 'val' if it is
+*              equal to 'cmp'.
+*
+* Arguments  : p_owner      is a pointer to the 'LockOwnerPtr' of the mutex
+*
+*              cmp          is the expected owner
+*
+*              val          is the new owner
+*
+* Returns    : The owner read.  It was replaced if and only if it is equal to 'cmp'.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) See OS_MemCAS(), LDREX/STREX are used on the Cortex-M7 and C11 atomics on a host.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+static  OS_TCB  *OS_MutexCAS (OS_TCB  **p_owner,
+                              OS_TCB   *cmp,
+                              OS_TCB   *val)
+{
+    OS_TCB  *cur;
+#if defined(__ICCARM__)
+
+
+    do {                                                        /* See Note #2                                          */
+        cur = (OS_TCB *)__LDREX((unsigned long *)p_owner);
+        if (cur != cmp) {
+            __CLREX();
+            break;
+        }
+    } while (__STREX((unsigned long)val, (unsigned long *)p_owner) != 0u);
+#elif defined(OS_MUTEX_C11_ATOMICS)
+
+
+    cur = cmp;
+    (void)atomic_compare_exchange_strong((OS_TCB * _Atomic *)p_owner, &cur, val);
+#else
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    cur = *p_owner;
+    if (cur == cmp) {
+       *p_owner = val;
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+
+    return (cur);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           ADOPT A FAST PATH MUTEX OWNER
+*
+* Description: This function is called by the kernel path of OSMutexPend() and OSMutexPost() to make the kernel track
+*              the owner of a mutex taken through the fast path.
+*
+* Argument(s): p_mutex      is a pointer to the mutex
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.  The store to 'LockOwnerPtr' makes a later
+*                 OSMutexPost() fast path fail, an owner preempted within OS_MutexCAS() retries and sees it.
+************************************************************************************************************************
+*/
+
+static  void  OS_MutexFastAdopt (OS_MUTEX  *p_mutex)
+{
+    OS_TCB  *p_owner;
+
+
+    p_owner = p_mutex->LockOwnerPtr;
+    if ((p_owner != DEF_NULL) &&                                /* Owned through the fast path?                         */
+        (p_owner != OS_MUTEX_LOCK_KERNEL)) {
+        p_mutex->OwnerTCBPtr  = p_owner;                        /* Yes, add the mutex to the owner's group              */
+        OS_MutexGrpAdd(p_owner, p_mutex);
+        p_mutex->LockOwnerPtr = OS_MUTEX_LOCK_KERNEL;           /* See Note #2                                          */
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                      ADOPT THE FAST PATH MUTEXES OF A DELETED TASK
+*
+* Description: This function is called by OSTaskDel() to make the kernel track the mutexes that the task being deleted
+*              took through the fast path, so that OS_MutexGrpPostAll() releases them with the others.
+*
+* Argument(s): p_tcb        is a pointer to the TCB of the task being deleted
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) A mutex taken through the fast path is only known by its 'LockOwnerPtr', all the mutexes in the debug
+*                 list are checked.  OS_CFG_DBG_EN is required for that (see os.h).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_DEL_EN == DEF_ENABLED)
+void  OS_MutexFastAdoptAll (OS_TCB  *p_tcb)
+{
+    OS_MUTEX  *p_mutex;
+
+
+    p_mutex = OSMutexDbgListPtr;                                /* See Note #3                                          */
+    while (p_mutex != DEF_NULL) {
+        if (p_mutex->LockOwnerPtr == p_tcb) {
+            OS_MutexFastAdopt(p_mutex);
+        }
+        p_mutex = p_mutex->DbgNextPtr;
+    }
+}
+#endif
+#endif
+
 #endif /* OS_CFG_MUTEX_EN */
@@ -0,0 +1,516 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                               KERNEL OBJECT REGISTRY
+*
+* File    : OS_OBJ.C
+* Version : V3.06.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) Each task, event flag group, memory partition, monitor, mutex, message queue, reader-writer lock,
+*               semaphore and timer is registered when it is created and removed from the registry when it is deleted.
+*               Its 16-bit handle is kept in its 'Handle' member:
+*
+*                   bits 15..8    generation of the slot, 1 to 255
+*                   bits  7..0    slot in OSObjRegTbl[]
+*
+*               OSObjGet() turns a handle back into a pointer in constant time and rejects the handles of deleted
+*               objects.  OSObjFind() looks an object up by the name given at creation through a hash table, in
+*               constant time on average.  Both can be called while the kernel runs, e.g. by a task serving a remote
+*               inspector, without walking the debug lists.
+*
+*           (2) An object created while the registry is full works normally but has no handle (OS_OBJ_HANDLE_NONE):
+*               see 'OSObjRegOvfCtr'.
+*
+*           (3) The registry only keeps a pointer to the name: the name must remain valid while the object exists, as
+*               for the debug lists.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_obj__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#define  OS_OBJ_REG_HASH_MASK          (OS_CFG_OBJ_REG_HASH_SIZE - 1u)
+
+#define  OS_OBJ_REG_FNV_OFFSET           2166136261u            /* 32-bit FNV-1a                                        */
+#define  OS_OBJ_REG_FNV_PRIME              16777619u
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void         OS_ObjRegHashDel   (CPU_INT16U   hash_ix);
+
+static  CPU_BOOLEAN  OS_ObjRegNameCmp   (CPU_CHAR    *p_name1,
+                                         CPU_CHAR    *p_name2);
+
+
+/*
+************************************************************************************************************************
+*                                                FIND AN OBJECT BY NAME
+*
+* Description: This function returns the handle of the object created with the name 'p_name'.
+*
+* Arguments  : p_name     is a pointer to the name to look for (NUL terminated ASCII).
+*
+*              type       is the type of object to look for (OS_OBJ_TYPE_xxx), OS_OBJ_TYPE_NONE for any type.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                The object was found
+*                             OS_ERR_OBJ_NOT_FOUND       No object of that type has that name
+*                             OS_ERR_PTR_INVALID         If 'p_name' is a NULL pointer
+*
+* Returns    : The handle of the object, OS_OBJ_HANDLE_NONE if not found.
+*
+* Note(s)    : 1) When several objects share a name, the handle of one of them is returned.
+*
+*              2) The names are compared with interrupts disabled, only for the entries whose hash matches.
+************************************************************************************************************************
+*/
+
+OS_OBJ_HANDLE  OSObjFind (CPU_CHAR     *p_name,
+                          OS_OBJ_TYPE   type,
+                          OS_ERR       *p_err)
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    OS_OBJ_HANDLE      handle;
+    CPU_INT32U         hash;
+    CPU_INT16U         hash_ix;
+    CPU_INT08U         ix;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_OBJ_HANDLE_NONE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_name == DEF_NULL) {                                   /* Validate 'p_name'                                    */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (OS_OBJ_HANDLE_NONE);
+    }
+#endif
+
+    hash    = OS_ObjRegHash(p_name);
+    hash_ix = (CPU_INT16U)(hash & OS_OBJ_REG_HASH_MASK);
+    handle  = OS_OBJ_HANDLE_NONE;
+
+    CPU_CRITICAL_ENTER();
+    ix = OSObjRegHashTbl[hash_ix];
+    while (ix != 0u) {                                          /* Probe up to the next empty position                  */
+        p_entry = &OSObjRegTbl[ix - 1u];
+        if ((p_entry->Hash == hash) &&
+            ((type == OS_OBJ_TYPE_NONE) || (p_entry->Type == type)) &&
+            (OS_ObjRegNameCmp(p_entry->NamePtr, p_name) == DEF_YES)) {   /* See Note #2                            */
+            handle = (OS_OBJ_HANDLE)(((OS_OBJ_HANDLE)p_entry->Gen << OS_OBJ_HANDLE_IX_BITS) | (ix - 1u));
+            break;
+        }
+        hash_ix = (hash_ix + 1u) & OS_OBJ_REG_HASH_MASK;
+        ix      = OSObjRegHashTbl[hash_ix];
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (handle == OS_OBJ_HANDLE_NONE) {
+       *p_err = OS_ERR_OBJ_NOT_FOUND;
+    } else {
+       *p_err = OS_ERR_NONE;
+    }
+    return (handle);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               GET AN OBJECT BY HANDLE
+*
+* Description: This function validates a handle and returns the object it designates.
+*
+* Arguments  : handle     is the handle of the object (see Note #1 at the top).
+*
+*              type       is the type of object expected (OS_OBJ_TYPE_xxx), OS_OBJ_TYPE_NONE for any type.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                The handle designates a live object of that type
+*                             OS_ERR_OBJ_HANDLE_INVALID  The handle was never given out by the registry
+*                             OS_ERR_OBJ_HANDLE_STALE    The object was deleted
+*                             OS_ERR_OBJ_TYPE            The object is not of the type expected
+*
+* Returns    : A pointer to the object, DEF_NULL if the handle is not valid.
+*
+* Note(s)    : 1) The pointer is valid until the object is deleted: a task that could race with the deletion should
+*                 lock the scheduler while it uses the object.
+************************************************************************************************************************
+*/
+
+void  *OSObjGet (OS_OBJ_HANDLE   handle,
+                 OS_OBJ_TYPE     type,
+                 OS_ERR         *p_err)
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    void              *p_obj;
+    CPU_INT08U         ix;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (DEF_NULL);
+    }
+#endif
+
+    ix = (CPU_INT08U)(handle & OS_OBJ_HANDLE_IX_MASK);
+    if ((handle == OS_OBJ_HANDLE_NONE  ) ||
+        (ix     >= OS_CFG_OBJ_REG_SIZE ) ||
+        ((handle >> OS_OBJ_HANDLE_IX_BITS) == 0u)) {
+       *p_err = OS_ERR_OBJ_HANDLE_INVALID;
+        return (DEF_NULL);
+    }
+
+    p_entry = &OSObjRegTbl[ix];
+    CPU_CRITICAL_ENTER();
+    if ((p_entry->ObjPtr == DEF_NULL) ||                        /* Slot freed or reused since (see os.h Note #1)        */
+        (p_entry->Gen    != (CPU_INT08U)(handle >> OS_OBJ_HANDLE_IX_BITS))) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_HANDLE_STALE;
+        return (DEF_NULL);
+    }
+    if ((type           != OS_OBJ_TYPE_NONE) &&
+        (p_entry->Type  != type)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (DEF_NULL);
+    }
+    p_obj = p_entry->ObjPtr;
+    CPU_CRITICAL_EXIT();
+
+   *p_err = OS_ERR_NONE;
+    return (p_obj);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  REGISTER AN OBJECT
+*
+* Description: This function is called by the xxxCreate() functions to give a handle to a new object.
+*
+* Arguments  : p_obj      is a pointer to the object.
+*
+*              type       is the type of the object (OS_OBJ_TYPE_xxx).
+*
+*              p_name     is a pointer to the name of the object, DEF_NULL if it has none.
+*
+*              hash       is the hash of the name, computed by OS_ObjRegHash() (see Note #3).
+*
+* Returns    : The handle of the object, OS_OBJ_HANDLE_NONE if the registry is full (see Note #2 at the top).
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The hash table is larger than the registry: the probe always ends on an empty position.
+*
+*              3) The xxxCreate() functions call this function with interrupts disabled.  They hash the name before,
+*                 so that the time spent with interrupts disabled does not depend on the length of the name.
+************************************************************************************************************************
+*/
+
+OS_OBJ_HANDLE  OS_ObjRegAdd (void         *p_obj,
+                             OS_OBJ_TYPE   type,
+                             CPU_CHAR     *p_name,
+                             CPU_INT32U    hash)
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    OS_OBJ_HANDLE      handle;
+    CPU_INT16U         hash_ix;
+    CPU_INT08U         ix;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    ix = OSObjRegFreeHeadIx;
+    if (ix == OS_OBJ_REG_IX_NONE) {                             /* Registry full                                        */
+        OSObjRegOvfCtr++;
+        CPU_CRITICAL_EXIT();
+        return (OS_OBJ_HANDLE_NONE);
+    }
+    p_entry            = &OSObjRegTbl[ix];
+    OSObjRegFreeHeadIx = p_entry->NextFreeIx;
+    if (OSObjRegFreeHeadIx == OS_OBJ_REG_IX_NONE) {
+        OSObjRegFreeTailIx = OS_OBJ_REG_IX_NONE;
+    }
+
+    p_entry->ObjPtr     = p_obj;
+    p_entry->NamePtr    = p_name;
+    p_entry->Type       = type;
+    p_entry->Hash       = hash;
+    p_entry->NextFreeIx = OS_OBJ_REG_IX_NONE;
+    p_entry->HashIx     = OS_OBJ_REG_HASH_IX_NONE;
+    if (p_name != DEF_NULL) {                                   /* Insert the name in the hash table (see Note #2)      */
+        hash_ix = (CPU_INT16U)(hash & OS_OBJ_REG_HASH_MASK);
+        while (OSObjRegHashTbl[hash_ix] != 0u) {
+            hash_ix = (hash_ix + 1u) & OS_OBJ_REG_HASH_MASK;
+        }
+        OSObjRegHashTbl[hash_ix] = ix + 1u;
+        p_entry->HashIx          = hash_ix;
+    }
+    OSObjRegQty++;
+
+    handle = (OS_OBJ_HANDLE)(((OS_OBJ_HANDLE)p_entry->Gen << OS_OBJ_HANDLE_IX_BITS) | ix);
+    CPU_CRITICAL_EXIT();
+
+    return (handle);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          INITIALIZE THE OBJECT REGISTRY
+*
+* Description: This function is called by OSInit() to empty the registry, before any object is created.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_ObjRegInit (void)
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    CPU_INT16U         i;
+
+
+    for (i = 0u; i < OS_CFG_OBJ_REG_SIZE; i++) {                /* Chain all the slots in the free list                 */
+        p_entry             = &OSObjRegTbl[i];
+        p_entry->ObjPtr     = DEF_NULL;
+        p_entry->NamePtr    = DEF_NULL;
+        p_entry->Type       = OS_OBJ_TYPE_NONE;
+        p_entry->Hash       = 0u;
+        p_entry->HashIx     = OS_OBJ_REG_HASH_IX_NONE;
+        p_entry->Gen        = 1u;
+        p_entry->NextFreeIx = (CPU_INT08U)(i + 1u);
+    }
+    OSObjRegTbl[OS_CFG_OBJ_REG_SIZE - 1u].NextFreeIx = OS_OBJ_REG_IX_NONE;
+    OSObjRegFreeHeadIx = 0u;
+    OSObjRegFreeTailIx = OS_CFG_OBJ_REG_SIZE - 1u;
+
+    for (i = 0u; i < OS_CFG_OBJ_REG_HASH_SIZE; i++) {
+        OSObjRegHashTbl[i] = 0u;
+    }
+    OSObjRegQty    = 0u;
+    OSObjRegOvfCtr = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 UNREGISTER AN OBJECT
+*
+* Description: This function is called by the xxxDel() functions to free the slot of a deleted object.
+*
+* Arguments  : handle     is the handle of the object, OS_OBJ_HANDLE_NONE or a stale handle are ignored.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The slot goes to the tail of the free list with the next generation (see os.h, Note #1).
+************************************************************************************************************************
+*/
+
+void  OS_ObjRegRemove (OS_OBJ_HANDLE  handle)
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    CPU_INT08U         ix;
+    CPU_SR_ALLOC();
+
+
+    ix = (CPU_INT08U)(handle & OS_OBJ_HANDLE_IX_MASK);
+    if ((handle == OS_OBJ_HANDLE_NONE) ||
+        (ix     >= OS_CFG_OBJ_REG_SIZE)) {
+        return;
+    }
+
+    p_entry = &OSObjRegTbl[ix];
+    CPU_CRITICAL_ENTER();
+    if ((p_entry->ObjPtr == DEF_NULL) ||
+        (p_entry->Gen    != (CPU_INT08U)(handle >> OS_OBJ_HANDLE_IX_BITS))) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    if (p_entry->HashIx != OS_OBJ_REG_HASH_IX_NONE) {
+        OS_ObjRegHashDel(p_entry->HashIx);
+    }
+    p_entry->ObjPtr     = DEF_NULL;
+    p_entry->NamePtr    = DEF_NULL;
+    p_entry->Type       = OS_OBJ_TYPE_NONE;
+    p_entry->HashIx     = OS_OBJ_REG_HASH_IX_NONE;
+    p_entry->Gen++;                                             /* Invalidate the handles given out (see Note #2)       */
+    if (p_entry->Gen == 0u) {
+        p_entry->Gen = 1u;
+    }
+
+    p_entry->NextFreeIx = OS_OBJ_REG_IX_NONE;                   /* Append to the free list                              */
+    if (OSObjRegFreeTailIx == OS_OBJ_REG_IX_NONE) {
+        OSObjRegFreeHeadIx = ix;
+    } else {
+        OSObjRegTbl[OSObjRegFreeTailIx].NextFreeIx = ix;
+    }
+    OSObjRegFreeTailIx = ix;
+    OSObjRegQty--;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   HASH A NAME
+*
+* Description: This function computes the 32-bit FNV-1a hash of a name.
+*
+* Arguments  : p_name     is a pointer to the name (NUL terminated ASCII), DEF_NULL if the object has none.
+*
+* Returns    : The hash, 0 for no name.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Called with interrupts enabled, see OS_ObjRegAdd() Note #3.
+************************************************************************************************************************
+*/
+
+CPU_INT32U  OS_ObjRegHash (CPU_CHAR  *p_name)
+{
+    CPU_INT32U  hash;
+
+
+    if (p_name == DEF_NULL) {
+        return (0u);
+    }
+    hash = OS_OBJ_REG_FNV_OFFSET;
+    while (*p_name != (CPU_CHAR)'\0') {
+        hash ^= (CPU_INT32U)(CPU_INT08U)*p_name;
+        hash *= OS_OBJ_REG_FNV_PRIME;
+        p_name++;
+    }
+    return (hash);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          REMOVE A NAME FROM THE HASH TABLE
+*
+* Description: This function empties a position of the hash table and moves back the entries of the same probe
+*              sequence that follow it, so that a lookup never stops on the hole.
+*
+* Arguments  : hash_ix    is the position to empty.
+*
+* Returns    : none
+*
+* Note(s)    : 1) Interrupts are disabled.
+*
+*              2) The entry at 'ix' can fill the hole unless its home position lies after the hole, up to 'ix'
+*                 (cyclically): it would then no longer be reachable from its home position.
+************************************************************************************************************************
+*/
+
+static  void  OS_ObjRegHashDel (CPU_INT16U  hash_ix)
+{
+    CPU_INT16U  hole;
+    CPU_INT16U  ix;
+    CPU_INT16U  home;
+    CPU_INT08U  slot;
+
+
+    hole = hash_ix;
+    ix   = hash_ix;
+    for (;;) {
+        ix   = (ix + 1u) & OS_OBJ_REG_HASH_MASK;
+        slot = OSObjRegHashTbl[ix];
+        if (slot == 0u) {
+            break;
+        }
+        home = (CPU_INT16U)(OSObjRegTbl[slot - 1u].Hash & OS_OBJ_REG_HASH_MASK);
+        if (((ix > hole) && ((home <= hole) || (home > ix))) ||     /* See Note #2                                      */
+            ((ix < hole) && ((home <= hole) && (home > ix)))) {
+            OSObjRegHashTbl[hole]            = slot;
+            OSObjRegTbl[slot - 1u].HashIx    = hole;
+            hole                             = ix;
+        }
+    }
+    OSObjRegHashTbl[hole] = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  COMPARE TWO NAMES
+*
+* Description: This function compares two NUL terminated names.
+*
+* Arguments  : p_name1    is a pointer to the first name.
+*
+*              p_name2    is a pointer to the second name.
+*
+* Returns    : DEF_YES if the names are equal, DEF_NO otherwise.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_ObjRegNameCmp (CPU_CHAR  *p_name1,
+                                       CPU_CHAR  *p_name2)
+{
+    while (*p_name1 == *p_name2) {
+        if (*p_name1 == (CPU_CHAR)'\0') {
+            return (DEF_YES);
+        }
+        p_name1++;
+        p_name2++;
+    }
+    return (DEF_NO);
+}
+#endif
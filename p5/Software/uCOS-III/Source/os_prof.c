@@ -0,0 +1,378 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                   PROFILER MODULE
+*
+* File    : OS_PROF.C
+* Version : V3.06.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_prof__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_PROF_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_ProfRateCalc (OS_CTX_SW_CTR  ctr,
+                                     OS_TICK        ticks);
+
+
+/*
+************************************************************************************************************************
+*                                             SET SNAPSHOT OUTPUT FUNCTION
+*
+* Description: This function installs a function that is called with every new profiler snapshot.  This is typically
+*              used to stream the snapshot over a serial link (UART, SWO, ...) to a host that decodes it.
+*
+* Arguments  : p_fnct     is a pointer to the output function or DEF_NULL to stop the output.  The function receives a
+*                         pointer to the snapshot image (an OS_PROF_HDR followed by OS_PROF_HDR.NbrRec OS_PROF_REC) and
+*                         the size of that image in bytes.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE            The call succeeded
+*
+* Returns    : none
+*
+* Note(s)    : 1) The output function is called from the statistic task, with the scheduler unlocked.  It MUST NOT
+*                 modify the snapshot and should fit in the statistic task stack (see OS_CFG_STAT_TASK_STK_SIZE).
+************************************************************************************************************************
+*/
+
+void  OSProfOutputSet (OS_PROF_OUTPUT_FNCT   p_fnct,
+                       OS_ERR               *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OSProfOutputFnctPtr = p_fnct;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 READ LATEST SNAPSHOT
+*
+* Description: This function copies the latest profiler snapshot into a buffer supplied by the caller.
+*
+* Arguments  : p_buf      is a pointer to the buffer that will receive the snapshot image.
+*
+*              buf_size   is the size of the buffer in bytes.  The buffer must be large enough to hold the header and
+*                         all the records of the latest snapshot.  A buffer of sizeof(OS_PROF_SNAP) always fits.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE            The snapshot was copied
+*                             OS_ERR_PROF_BUF_SIZE   'buf_size' is too small for the latest snapshot
+*                             OS_ERR_PROF_ISR        If you called this function from an ISR
+*                             OS_ERR_PTR_INVALID     If 'p_buf' is a NULL pointer
+*
+* Returns    : The number of bytes copied into 'p_buf', 0 if the snapshot could not be copied.
+*
+* Note(s)    : 1) The snapshot is only refreshed once per 1/OS_CFG_PROF_RATE_HZ second.  OS_PROF_HDR.SeqNbr is 0 until
+*                 the first snapshot is taken.
+************************************************************************************************************************
+*/
+
+CPU_SIZE_T  OSProfSnapshotGet (void        *p_buf,
+                               CPU_SIZE_T   buf_size,
+                               OS_ERR      *p_err)
+{
+    CPU_INT08U  *p_src;
+    CPU_INT08U  *p_dest;
+    CPU_SIZE_T   size;
+    CPU_SIZE_T   i;
+    OS_ERR       err;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't lock the scheduler from an ISR                 */
+       *p_err = OS_ERR_PROF_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_buf == DEF_NULL) {                                    /* Validate 'p_buf'                                     */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+#endif
+
+    OSSchedLock(&err);                                          /* Prevent the statistic task from updating the snapshot*/
+    size = sizeof(OS_PROF_HDR)
+         + (CPU_SIZE_T)OSProfSnap.Hdr.NbrRec * sizeof(OS_PROF_REC);
+    if (buf_size < size) {
+        OSSchedUnlock(&err);
+       *p_err = OS_ERR_PROF_BUF_SIZE;
+        return (0u);
+    }
+
+    p_src  = (CPU_INT08U *)&OSProfSnap;
+    p_dest = (CPU_INT08U *)p_buf;
+    for (i = 0u; i < size; i++) {
+       *p_dest++ = *p_src++;
+    }
+    OSSchedUnlock(&err);
+    (void)err;
+
+   *p_err = OS_ERR_NONE;
+    return (size);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               INITIALIZE THE PROFILER
+*
+* Description: This function is called by OSInit() to initialize the profiler.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_ProfInit (void)
+{
+    OSProfSnap.Hdr.Magic         = OS_PROF_MAGIC;
+    OSProfSnap.Hdr.Ver           = OS_PROF_VER;
+    OSProfSnap.Hdr.NbrRec        = 0u;
+    OSProfSnap.Hdr.SeqNbr        = 0u;
+    OSProfSnap.Hdr.TickCtr       = 0u;
+    OSProfSnap.Hdr.TS_Freq       = 0u;
+    OSProfSnap.Hdr.CtxSwPerSec   = 0u;
+    OSProfSnap.Hdr.IntDisTimeMax = 0u;
+    OSProfSnap.Hdr.CPUUsage      = 0u;
+    OSProfSnap.Hdr.RecSize       = (CPU_INT16U)sizeof(OS_PROF_REC);
+
+    OSProfOutputFnctPtr          = DEF_NULL;
+    OSProfCtxSwCtrPrev           = 0u;
+    OSProfTickCtrPrev            = 0u;
+    OSProfStatCtr                = OSCfg_StatTaskRate_Hz / OSCfg_ProfRate_Hz;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  TAKE A SNAPSHOT
+*
+* Description: This function is called by the statistic task every time it computes the CPU usage.  Once every
+*              OS_CFG_STAT_TASK_RATE_HZ / OS_CFG_PROF_RATE_HZ calls, it walks the task debug list and records, for each
+*              task, the CPU usage, the stack high-water mark, the maximum interrupt disable and scheduler lock times
+*              and the context switch rate into OSProfSnap.  The output function, if any, is then called.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The scheduler is locked while OSProfSnap is being written so that readers never see a partial
+*                 snapshot.  Interrupts are only disabled while a single TCB is being sampled.
+*
+*              3) Tasks beyond OS_CFG_PROF_TBL_SIZE are not recorded.
+************************************************************************************************************************
+*/
+
+void  OS_ProfUpdate (void)
+{
+    OS_PROF_HDR          *p_hdr;
+    OS_PROF_REC          *p_rec;
+    OS_TCB               *p_tcb;
+    CPU_CHAR             *p_name;
+    OS_PROF_OUTPUT_FNCT   p_fnct;
+    OS_TICK               tick_ctr;
+    OS_TICK               ticks;
+    OS_CTX_SW_CTR         ctx_sw_ctr;
+    OS_CTX_SW_CTR         ctx_sw_delta;
+    CPU_INT16U            nbr_rec;
+    CPU_INT08U            i;
+    CPU_SIZE_T            size;
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+    CPU_ERR               cpu_err;
+#endif
+    OS_ERR                err;
+    CPU_SR_ALLOC();
+
+
+    if (OSProfStatCtr > 1u) {                                   /* Is a snapshot due?                                   */
+        OSProfStatCtr--;
+        return;
+    }
+    OSProfStatCtr = OSCfg_StatTaskRate_Hz / OSCfg_ProfRate_Hz;
+
+    OSSchedLock(&err);
+
+    CPU_CRITICAL_ENTER();
+    tick_ctr   = OSTickCtr;
+    ctx_sw_ctr = OSTaskCtxSwCtr;
+    CPU_CRITICAL_EXIT();
+
+    ticks = tick_ctr - OSProfTickCtrPrev;                       /* Elapsed time since the previous snapshot             */
+    if (ticks == 0u) {
+        ticks = 1u;
+    }
+    OSProfTickCtrPrev = tick_ctr;
+
+    p_hdr              = &OSProfSnap.Hdr;
+    p_hdr->CtxSwPerSec = OS_ProfRateCalc(ctx_sw_ctr - OSProfCtxSwCtrPrev, ticks);
+    OSProfCtxSwCtrPrev = ctx_sw_ctr;
+
+    nbr_rec = 0u;
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTaskDbgListPtr;
+    CPU_CRITICAL_EXIT();
+    while ((p_tcb   != DEF_NULL) &&
+           (nbr_rec <  OS_CFG_PROF_TBL_SIZE)) {
+        p_rec = &OSProfSnap.RecTbl[nbr_rec];
+
+        CPU_CRITICAL_ENTER();                                   /* Sample the TCB as a whole                            */
+        ctx_sw_delta            = p_tcb->CtxSwCtr - p_tcb->CtxSwCtrPrev;
+        p_tcb->CtxSwCtrPrev     = p_tcb->CtxSwCtr;
+        p_rec->CPUUsage         = (CPU_INT16U)p_tcb->CPUUsage;
+        p_rec->CPUUsageMax      = (CPU_INT16U)p_tcb->CPUUsageMax;
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+        p_rec->IntDisTimeMax    = (CPU_INT32U)p_tcb->IntDisTimeMax;
+#else
+        p_rec->IntDisTimeMax    = 0u;
+#endif
+#if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN == DEF_ENABLED)
+        p_rec->SchedLockTimeMax = (CPU_INT32U)p_tcb->SchedLockTimeMax;
+#else
+        p_rec->SchedLockTimeMax = 0u;
+#endif
+        p_rec->StkSize          = (CPU_INT32U)p_tcb->StkSize * sizeof(CPU_STK);
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+        p_rec->StkUsed          = (CPU_INT32U)p_tcb->StkUsedMax * sizeof(CPU_STK);
+#elif (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED)
+        p_rec->StkUsed          = (CPU_INT32U)p_tcb->StkUsed * sizeof(CPU_STK);
+#else
+        p_rec->StkUsed          = 0u;
+#endif
+        p_rec->Prio             = (CPU_INT08U)p_tcb->Prio;
+        p_rec->TaskState        = (CPU_INT08U)p_tcb->TaskState;
+        p_rec->Rsvd             = 0u;
+        p_name                  = p_tcb->NamePtr;
+        CPU_CRITICAL_EXIT();
+
+        p_rec->CtxSwPerSec = OS_ProfRateCalc(ctx_sw_delta, ticks);
+
+        for (i = 0u; i < OS_PROF_NAME_LEN; i++) {               /* Copy the beginning of the name, pad with NULs        */
+            if ((p_name != DEF_NULL) && (*p_name != (CPU_CHAR)0)) {
+                p_rec->Name[i] = *p_name++;
+            } else {
+                p_rec->Name[i] = (CPU_CHAR)0;
+            }
+        }
+
+        nbr_rec++;
+
+        CPU_CRITICAL_ENTER();
+        p_tcb = p_tcb->DbgNextPtr;
+        CPU_CRITICAL_EXIT();
+    }
+
+    p_hdr->NbrRec   = nbr_rec;
+    p_hdr->SeqNbr++;
+    p_hdr->TickCtr  = (CPU_INT32U)tick_ctr;
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+    p_hdr->TS_Freq  = (CPU_INT32U)CPU_TS_TmrFreqGet(&cpu_err);
+#endif
+#if (defined(CPU_CFG_INT_DIS_MEAS_EN) && (OS_CFG_TS_EN == DEF_ENABLED))
+    p_hdr->IntDisTimeMax = (CPU_INT32U)OSIntDisTimeMax;
+#endif
+    p_hdr->CPUUsage = (CPU_INT16U)OSStatTaskCPUUsage;
+
+    size   = sizeof(OS_PROF_HDR)
+           + (CPU_SIZE_T)nbr_rec * sizeof(OS_PROF_REC);
+    p_fnct = OSProfOutputFnctPtr;
+
+    OSSchedUnlock(&err);
+    (void)err;
+
+    if (p_fnct != DEF_NULL) {                                   /* Stream the snapshot out, if requested                */
+        (*p_fnct)((void *)&OSProfSnap, size);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                           COMPUTE A PER-SECOND EVENT RATE
+*
+* Description: This function converts a number of events counted over a number of ticks into events per second.
+*
+* Arguments  : ctr        is the number of events counted.
+*
+*              ticks      is the number of ticks over which the events were counted (must not be 0).
+*
+* Returns    : The number of events per second.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_ProfRateCalc (OS_CTX_SW_CTR  ctr,
+                                     OS_TICK        ticks)
+{
+    CPU_INT64U  rate;
+
+
+    rate = ((CPU_INT64U)ctr * (CPU_INT64U)OSCfg_TickRate_Hz) / (CPU_INT64U)ticks;
+    return ((CPU_INT32U)rate);
+}
+
+#endif
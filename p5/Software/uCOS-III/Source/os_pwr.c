@@ -0,0 +1,490 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                  POWER MANAGEMENT
+*
+* File    : OS_PWR.C
+* Version : V3.06.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+* Note(s) : (1) Each loop of the idle task calls OS_PwrIdle(), which predicts how long the CPU will stay idle and puts
+*               it in the deepest of the OS_PWR_STATE_NBR states that pays off:
+*
+*                   OS_PWR_STATE_WFI      the core waits for an interrupt, the tick keeps running
+*                   OS_PWR_STATE_SLEEP    same, with the tick stopped until the next event
+*                   OS_PWR_STATE_STOP     the clocks and the regulator are stopped, with the tick
+*
+*               A state is deep enough when its target residency (OS_CFG_PWR_xxx_RESIDENCY_US), the time after which
+*               it saves more energy than its entry and exit cost, is shorter than the idle period predicted.  A state
+*               whose exit latency (OS_CFG_PWR_xxx_LAT_US) is larger than the constraint set with OSPwrLatMaxSet() is
+*               never used.
+*
+*           (2) The idle period lasts at least until the next event the kernel knows of:
+*
+*               (a) the task at the head of the delay or timeout tick list is made ready,
+*               (b) a timer expires,
+*               (c) the budget of a throttled task is replenished.
+*
+*               Interrupts of the peripherals cannot be predicted, they end an idle period early: see the
+*               'EarlyWakeCtr' of each state.
+*
+*           (3) BSP_OS_PwrEnter() enters the state and returns with the number of ticks elapsed while the tick was
+*               stopped.  The idle task announces them to the tick task and the timer task as OSTimeTick() would.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_pwr__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+************************************************************************************************************************
+*/
+
+static  const  CPU_INT32U  OS_PwrLatTbl[OS_PWR_STATE_NBR] = {         /* Exit latency of each state, microseconds     */
+    0u,
+    OS_CFG_PWR_SLEEP_LAT_US,
+    OS_CFG_PWR_STOP_LAT_US
+};
+
+static  const  CPU_INT32U  OS_PwrResidencyTbl[OS_PWR_STATE_NBR] = {   /* Target residency of each state, microseconds */
+    0u,
+    OS_CFG_PWR_SLEEP_RESIDENCY_US,
+    OS_CFG_PWR_STOP_RESIDENCY_US
+};
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_TICK     OS_PwrIdlePredict  (void);
+
+static  CPU_INT08U  OS_PwrStateSelect  (OS_TICK     ticks);
+
+static  void        OS_PwrTickAnnounce (OS_TICK     ticks);
+
+
+/*
+************************************************************************************************************************
+*                                              SET THE EXIT LATENCY ALLOWED
+*
+* Description: This function sets the longest exit latency the application tolerates, e.g. the longest time an
+*              interrupt may wait for the clocks to be restored.  The idle task does not use the states whose exit
+*              latency is larger.
+*
+* Arguments  : lat_us     is the exit latency allowed, in microseconds:
+*
+*                             0                          only OS_PWR_STATE_WFI is used
+*                             OS_PWR_LAT_MAX_NONE        all the states may be used (default)
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                The constraint was set
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSPwrLatMaxSet (CPU_INT32U   lat_us,
+                      OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OSPwrLatMax = lat_us;                                       /* Read once per idle period                            */
+   *p_err       = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                RESET THE STATISTICS
+*
+* Description: This function clears the residency statistics of all the states.
+*
+* Arguments  : p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                The statistics were cleared
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSPwrReset (OS_ERR  *p_err)
+{
+    CPU_INT08U  i;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    for (i = 0u; i < OS_PWR_STATE_NBR; i++) {
+        CPU_CRITICAL_ENTER();
+        OSPwrStatTbl[i].EntryCtr       = 0u;
+        OSPwrStatTbl[i].EarlyWakeCtr   = 0u;
+        OSPwrStatTbl[i].ResidencyTotal = 0u;
+        OSPwrStatTbl[i].ResidencyMax   = 0u;
+        CPU_CRITICAL_EXIT();
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                READ THE STATISTICS
+*
+* Description: This function copies the residency statistics of a state.  The share of the idle time spent in each
+*              state is its 'ResidencyTotal' over the sum of the 'ResidencyTotal' of all the states.
+*
+* Arguments  : state      is the state (OS_PWR_STATE_xxx).
+*
+*              p_stat     is a pointer to the statistics that will receive the copy.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                The statistics were copied
+*                             OS_ERR_PWR_STATE_INVALID   'state' is not a valid state
+*                             OS_ERR_PTR_INVALID         If 'p_stat' is a NULL pointer
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSPwrStatGet (CPU_INT08U    state,
+                    OS_PWR_STAT  *p_stat,
+                    OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (state >= OS_PWR_STATE_NBR) {                            /* Validate 'state'                                     */
+       *p_err = OS_ERR_PWR_STATE_INVALID;
+        return;
+    }
+    if (p_stat == DEF_NULL) {                                   /* Validate 'p_stat'                                    */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();                                       /* 'ResidencyTotal' is not read atomically              */
+   *p_stat = OSPwrStatTbl[state];
+    CPU_CRITICAL_EXIT();
+   *p_err  = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    IDLE PERIOD
+*
+* Description: This function is called by the idle task to spend the time until the next interrupt in the deepest
+*              power state allowed (see Note #1 at the top).
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Interrupts are disabled from the prediction to the wake up: an interrupt raised after the prediction
+*                 makes BSP_OS_PwrEnter() return at once, the ISR runs when the critical section ends.
+*
+*              3) The tick task runs once per tick announced (see Note #3 at the top).  The ticks are announced before
+*                 the ISR that ended the idle period runs, so that the tasks it makes ready see the current time.
+*
+*              4) The timestamp timer may stop in the state : the time it missed is charged to the idle task so that
+*                 the CPU usage doesn't count the time slept as busy (see 'os_stat.c  Note #2e').
+************************************************************************************************************************
+*/
+
+void  OS_PwrIdle (void)
+{
+    OS_TICK       ticks;
+    OS_TICK       ticks_slept;
+    CPU_INT32U    residency;
+    CPU_INT08U    state;
+    OS_PWR_STAT  *p_stat;
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    CPU_TS        ts;
+#endif
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #2                                          */
+    ticks          = OS_PwrIdlePredict();
+    state          = OS_PwrStateSelect(ticks);
+    OSPwrIdleTicks = ticks;
+
+    ticks_slept    = 0u;
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    ts             = OS_TS_GET();
+#endif
+    residency      = BSP_OS_PwrEnter(state, ticks, &ticks_slept);
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    OS_StatSleepAdd(OS_TS_GET() - ts, residency);               /* See Note #4                                          */
+#endif
+
+    p_stat         = &OSPwrStatTbl[state];
+    p_stat->EntryCtr++;
+    p_stat->ResidencyTotal += residency;
+    if (p_stat->ResidencyMax < residency) {
+        p_stat->ResidencyMax = residency;
+    }
+    if (residency < OS_PwrResidencyTbl[state]) {
+        p_stat->EarlyWakeCtr++;
+    }
+
+    if (ticks_slept > 0u) {
+        OS_PwrTickAnnounce(ticks_slept);                        /* See Note #3                                          */
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (ticks_slept > 0u) {
+        OSSched();                                              /* Run the tick task if no ISR did                      */
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                          INITIALIZE THE POWER MANAGEMENT
+*
+* Description: This function is called by OSInit() to clear the statistics and allow all the states.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_PwrInit (void)
+{
+    CPU_INT08U  i;
+
+
+    for (i = 0u; i < OS_PWR_STATE_NBR; i++) {
+        OSPwrStatTbl[i].EntryCtr       = 0u;
+        OSPwrStatTbl[i].EarlyWakeCtr   = 0u;
+        OSPwrStatTbl[i].ResidencyTotal = 0u;
+        OSPwrStatTbl[i].ResidencyMax   = 0u;
+    }
+    OSPwrLatMax    = OS_PWR_LAT_MAX_NONE;
+    OSPwrIdleTicks = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               PREDICT THE IDLE PERIOD
+*
+* Description: This function returns the number of ticks until the next event the kernel knows of (see Note #2 at the
+*              top): the event happens when the tick task processes that tick.
+*
+* Arguments  : none
+*
+* Returns    : The number of ticks, (OS_TICK)-1 if no event is pending.
+*
+* Note(s)    : 1) Interrupts are disabled.  The idle task only runs when the tick task and the timer task are waiting:
+*                 the tick lists and the timer list are up to date.
+*
+*              2) The timer task is signaled every OSTmrUpdateCnt ticks, the first time in OSTmrUpdateCtr ticks, and a
+*                 timer expires when its 'Remain' reaches 0.  The signals before the first expiry only decrement
+*                 'Remain': they are announced after the wake up and do not end the idle period.
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_PwrIdlePredict (void)
+{
+    OS_TICK   ticks;
+#if (OS_CFG_TMR_EN == DEF_ENABLED)
+    OS_TMR   *p_tmr;
+    OS_TICK   remain;
+    OS_TICK   ticks_tmr;
+#endif
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    OS_TCB   *p_tcb;
+#endif
+
+
+    ticks = (OS_TICK)-1;
+
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)                        /* ------------------ (a) TICK LISTS ------------------ */
+    if (OSTickListDly.TCB_Ptr != DEF_NULL) {
+        ticks = OSTickListDly.TCB_Ptr->TickRemain;
+    }
+    if (OSTickListTimeout.TCB_Ptr != DEF_NULL) {
+        if (ticks > OSTickListTimeout.TCB_Ptr->TickRemain) {
+            ticks = OSTickListTimeout.TCB_Ptr->TickRemain;
+        }
+    }
+
+#if (OS_CFG_TMR_EN == DEF_ENABLED)                              /* -------------------- (b) TIMERS -------------------- */
+    remain = (OS_TICK)-1;
+    p_tmr  = OSTmrListPtr;
+    while (p_tmr != DEF_NULL) {
+        if (remain > p_tmr->Remain) {
+            remain = p_tmr->Remain;
+        }
+        p_tmr = p_tmr->NextPtr;
+    }
+    if (remain != (OS_TICK)-1) {                                /* See Note #2                                          */
+        ticks_tmr = OSTmrUpdateCtr + ((remain - 1u) * OSTmrUpdateCnt);
+        if (ticks > ticks_tmr) {
+            ticks = ticks_tmr;
+        }
+    }
+#endif
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)                      /* ----------------- (c) CPU BUDGETS ------------------ */
+    p_tcb = OSBudgetListPtr;
+    while (p_tcb != DEF_NULL) {
+        if ((p_tcb->BudgetThrottled == DEF_TRUE) &&
+            (ticks                  >  p_tcb->BudgetRemain)) {
+            ticks = p_tcb->BudgetRemain;
+        }
+        p_tcb = p_tcb->BudgetNextPtr;
+    }
+#endif
+
+    if (ticks == 0u) {                                          /* Already due, the tick task catches up at next tick   */
+        ticks = 1u;
+    }
+    return (ticks);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  SELECT A STATE
+*
+* Description: This function returns the deepest state whose target residency is covered by the idle period and whose
+*              exit latency is allowed.
+*
+* Arguments  : ticks      is the idle period predicted, in ticks.
+*
+* Returns    : The state (OS_PWR_STATE_xxx).
+*
+* Note(s)    : 1) The period ends at the 'ticks'th tick from now, the current tick is partly elapsed: the period is at
+*                 least 'ticks - 1' tick periods.
+************************************************************************************************************************
+*/
+
+static  CPU_INT08U  OS_PwrStateSelect (OS_TICK  ticks)
+{
+    CPU_INT64U  idle_us;
+    CPU_INT08U  state;
+
+
+    idle_us = ((CPU_INT64U)(ticks - 1u) * 1000000u) / OSCfg_TickRate_Hz;   /* See Note #1                             */
+
+    state = OS_PWR_STATE_NBR - 1u;
+    while (state > OS_PWR_STATE_WFI) {
+        if ((OS_PwrResidencyTbl[state] <= idle_us) &&
+            (OS_PwrLatTbl[state]       <= OSPwrLatMax)) {
+            break;
+        }
+        state--;
+    }
+    return (state);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 ANNOUNCE THE TICKS
+*
+* Description: This function signals the tick task and the timer task once per tick elapsed while the tick was
+*              stopped, as OSTimeTick() does, without rescheduling.
+*
+* Arguments  : ticks      is the number of ticks elapsed.
+*
+* Returns    : none
+*
+* Note(s)    : 1) Interrupts are disabled.  The round-robin and the CPU budgets of OSTimeTick() only concern the running
+*                 task, the idle task.
+************************************************************************************************************************
+*/
+
+static  void  OS_PwrTickAnnounce (OS_TICK  ticks)
+{
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+    OS_ERR  err;
+#endif
+
+
+    while (ticks > 0u) {
+        OSTimeTickHook();                                       /* Call user definable hook                             */
+
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+       (void)OSTaskSemPost(&OSTickTaskTCB,                      /* Signal tick task                                     */
+                            OS_OPT_POST_NO_SCHED,
+                           &err);
+
+#if (OS_CFG_TMR_EN == DEF_ENABLED)
+        OSTmrUpdateCtr--;
+        if (OSTmrUpdateCtr == 0u) {
+            OSTmrUpdateCtr = OSTmrUpdateCnt;
+            (void)OSTaskSemPost(&OSTmrTaskTCB,                  /* Signal timer task                                    */
+                                 OS_OPT_POST_NO_SCHED,
+                                &err);
+        }
+#endif
+#endif
+        ticks--;
+    }
+}
+#endif
@@ -76,6 +76,9 @@ void  OSQCreate (OS_Q        *p_q,
                  OS_ERR      *p_err)
 
 {
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    CPU_INT32U  name_hash;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -111,6 +114,9 @@ void  OSQCreate (OS_Q        *p_q,
     }
 #endif
 
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    name_hash = OS_ObjRegHash(p_name);                          /* Hash the name with interrupts enabled                */
+#endif
     CPU_CRITICAL_ENTER();
 #if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
     p_q->Type    = OS_OBJ_TYPE_Q;                               /* Mark the data structure as a message queue           */
@@ -127,6 +133,9 @@ void  OSQCreate (OS_Q        *p_q,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_QDbgListAdd(p_q);
     OSQQty++;                                                   /* One more queue created                               */
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    p_q->Handle = OS_ObjRegAdd((void *)p_q, OS_OBJ_TYPE_Q, p_name, name_hash);
 #endif
     OS_TRACE_Q_CREATE(p_q, p_name);
     CPU_CRITICAL_EXIT();
@@ -241,6 +250,9 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                  OS_QDbgListRemove(p_q);
                  OSQQty--;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+                 OS_ObjRegRemove(p_q->Handle);
 #endif
                  OS_TRACE_Q_DEL(p_q);
                  OS_QClr(p_q);
@@ -268,6 +280,9 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
              OS_QDbgListRemove(p_q);
              OSQQty--;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+             OS_ObjRegRemove(p_q->Handle);
 #endif
              OS_TRACE_Q_DEL(p_q);
              OS_QClr(p_q);
@@ -366,6 +381,94 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                        RESERVE MESSAGES FOR A MESSAGE QUEUE
+*
+* Description : This function reserves OS_MSGs of the shared pool for the exclusive use of a message queue.  Posts to
+*               the queue use the reserved OS_MSGs first, so a queue receiving bursts of messages from another part of
+*               the application cannot starve this queue.
+*
+* Arguments   : p_q        is a pointer to the message queue
+*
+*               nbr        is the number of OS_MSGs to reserve, at most the size of the queue
+*
+*               p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              Upon success
+*                              OS_ERR_CREATE_ISR        If you called this function from an ISR
+*                              OS_ERR_MSG_POOL_EMPTY    If the pool doesn't have 'nbr' free OS_MSGs
+*                              OS_ERR_OBJ_PTR_NULL      If you passed a NULL pointer for 'p_q'
+*                              OS_ERR_OBJ_TYPE          If you didn't create the message queue
+*                              OS_ERR_Q_NOT_EMPTY       If the queue holds messages or already has a reserve
+*                              OS_ERR_Q_SIZE            If 'nbr' is 0 or larger than the size of the queue
+*
+* Returns     : none
+*
+* Note(s)     : 1) Call this function right after OSQCreate(), before the queue is used.  The reserve is returned to the
+*                  pool by OSQDel().
+*
+*               2) The OS_MSGs only carry pointers.  Use OSMsgBufGet() and OSMsgBufPut() to pass the messages themselves
+*                  without copying them.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED)
+void  OSQMsgReserve (OS_Q        *p_q,
+                     OS_MSG_QTY   nbr,
+                     OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't reserve messages from an ISR                   */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_q == DEF_NULL) {                                      /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if ((nbr == 0u) ||
+        (nbr >  p_q->MsgQ.NbrEntriesSize)) {                    /* More than the queue can hold would be wasted         */
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if ((p_q->MsgQ.NbrEntries != 0u) ||                         /* See Note #1                                          */
+        (p_q->MsgQ.ResvSize   != 0u)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_Q_NOT_EMPTY;
+        return;
+    }
+    OS_MsgQResv(&p_q->MsgQ, nbr, p_err);
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                            PEND ON A QUEUE FOR A MESSAGE
@@ -587,6 +690,232 @@ void  *OSQPend (OS_Q         *p_q,
 }
 
 
+/*
+************************************************************************************************************************
+*                                         PEND ON A QUEUE FOR UP TO 'N' MESSAGES
+*
+* Description: This function waits for messages to be sent to a queue and retrieves up to 'nbr' of them at once.  All
+*              the messages available are extracted in a single critical section.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+*              p_msg_tbl     is a pointer to an array of at least 'nbr' entries that will receive the messages
+*
+*              p_size_tbl    is a pointer to an array of at least 'nbr' entries that will receive the size of each
+*                            message
+*
+*              nbr           is the maximum number of messages to retrieve
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            message to arrive at the queue up to the amount of time specified by this argument.  If you
+*                            specify 0, however, your task will wait forever at the specified queue or, until a message
+*                            arrives.
+*
+*              opt           determines whether the user wants to block if the queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of the first message received,
+*                            pend aborted or the message queue deleted.  If you pass a NULL pointer (i.e. (CPU_TS *)0)
+*                            then you will not get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received messages
+*                                OS_ERR_OBJ_DEL            If 'p_q' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_q'
+*                                OS_ERR_OBJ_TYPE           If the message queue was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was empty
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_msg_tbl' or 'p_size_tbl'
+*                                OS_ERR_Q_SIZE             If you specified 0 for 'nbr'
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
+*
+* Returns    : The number of messages received, 0 upon error.
+*
+* Note(s)    : (1) When the task had to wait, it is readied with a single message by OSQPost() or OSQPostN().  The
+*                  messages queued after that one, up to 'nbr' in total, are also returned.
+*
+*              (2) Interrupts are disabled while the messages are extracted, the interrupt disable time thus grows with
+*                  'nbr'.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY  OSQPendN (OS_Q          *p_q,
+                      void         **p_msg_tbl,
+                      OS_MSG_SIZE   *p_size_tbl,
+                      OS_MSG_QTY     nbr,
+                      OS_TICK        timeout,
+                      OS_OPT         opt,
+                      CPU_TS        *p_ts,
+                      OS_ERR        *p_err)
+{
+    OS_MSG_QTY  nbr_rx;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_PEND_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_q == DEF_NULL) {                                      /* Validate arguments                                   */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if ((p_msg_tbl  == DEF_NULL) ||
+        (p_size_tbl == DEF_NULL)) {
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (nbr == 0u) {
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    if (p_ts != DEF_NULL) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
+
+    CPU_CRITICAL_ENTER();
+    nbr_rx = OS_MsgQGetN(&p_q->MsgQ,                            /* Any messages waiting in the message queue?           */
+                         p_msg_tbl,
+                         p_size_tbl,
+                         nbr,
+                         p_ts);
+    if (nbr_rx > 0u) {
+        OS_TRACE_Q_PEND(p_q);
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return (nbr_rx);                                        /* Yes, Return messages received                        */
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_Q_PEND_FAILED(p_q);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    OS_Pend((OS_PEND_OBJ *)((void *)p_q),                       /* Block task pending on Message Queue                  */
+            OS_TASK_PEND_ON_Q,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_Q_PEND_BLOCK(p_q);
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
+             p_msg_tbl[0]  = OSTCBCurPtr->MsgPtr;
+             p_size_tbl[0] = OSTCBCurPtr->MsgSize;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts     != DEF_NULL) {
+                *p_ts     =  OSTCBCurPtr->TS;
+             }
+#endif
+             nbr_rx        = 1u;
+             if (nbr > 1u) {                                    /* Also return the messages queued since (see Note #1)  */
+                 nbr_rx   += OS_MsgQGetN(&p_q->MsgQ,
+                                         &p_msg_tbl[1],
+                                         &p_size_tbl[1],
+                                         nbr - 1u,
+                                         DEF_NULL);
+             }
+             OS_TRACE_Q_PEND(p_q);
+            *p_err         = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts     != DEF_NULL) {
+                *p_ts     =  OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err         = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get event within TO          */
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err         = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts     != DEF_NULL) {
+                *p_ts     =  OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err         = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err         = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (nbr_rx);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                             ABORT WAITING ON A MESSAGE QUEUE
@@ -833,6 +1162,20 @@ void  OSQPost (OS_Q         *p_q,
         return;
     }
 #endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        OS_IntQPost(OS_OBJ_TYPE_Q,                              /* Post to ISR queue                                    */
+                    (void *)p_q,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    p_err);
+        OS_TRACE_Q_POST_EXIT(*p_err);
+        return;
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
@@ -885,6 +1228,192 @@ void  OSQPost (OS_Q         *p_q,
 }
 
 
+/*
+************************************************************************************************************************
+*                                            POST UP TO 'N' MESSAGES TO A QUEUE
+*
+* Description: This function sends a burst of messages to a queue in a single critical section and runs the scheduler
+*              at most once.  The messages are handed to the waiting tasks, one message per task in priority order, and
+*              the remaining ones are placed in the queue.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_msg_tbl     is a pointer to an array of 'nbr' messages to send.
+*
+*              p_size_tbl    is a pointer to an array of 'nbr' message sizes (in bytes).
+*
+*              nbr           is the number of messages to send.
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_FIFO         POST messages to end of queue (FIFO)
+*                                OS_OPT_POST_LIFO         POST messages to the front of the queue (LIFO), each message
+*                                                         goes in front of the previous one
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the other options.
+*                                     2) OS_OPT_POST_ALL is not supported, a burst is not broadcast.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and all the messages were sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place a message into
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_PTR_INVALID       If you passed a NULL pointer for 'p_msg_tbl' or 'p_size_tbl'
+*                                OS_ERR_Q_MAX             If the queue is full
+*                                OS_ERR_Q_SIZE            If you specified 0 for 'nbr'
+*
+* Returns    : The number of messages sent.  Upon OS_ERR_Q_MAX or OS_ERR_MSG_POOL_EMPTY, the messages that follow the
+*              ones sent are not posted.
+*
+* Note(s)    : (1) Interrupts are disabled while the messages are posted, the interrupt disable time thus grows with
+*                  'nbr'.
+*
+*              (2) From an ISR with OS_CFG_ISR_POST_DEFERRED_EN, each message is deferred to the ISR post queue.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_BATCH_EN == DEF_ENABLED)
+OS_MSG_QTY  OSQPostN (OS_Q          *p_q,
+                      void         **p_msg_tbl,
+                      OS_MSG_SIZE   *p_size_tbl,
+                      OS_MSG_QTY     nbr,
+                      OS_OPT         opt,
+                      OS_ERR        *p_err)
+{
+    OS_OPT         post_type;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_MSG_QTY     nbr_tx;
+    CPU_BOOLEAN    sched;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_q == DEF_NULL) {                                      /* Validate 'p_q'                                       */
+        OS_TRACE_Q_POST_FAILED(p_q);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if ((p_msg_tbl  == DEF_NULL) ||                             /* Validate the tables                                  */
+        (p_size_tbl == DEF_NULL)) {
+        OS_TRACE_Q_POST_FAILED(p_q);
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (nbr == 0u) {
+        OS_TRACE_Q_POST_FAILED(p_q);
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_Q_POST_FAILED(p_q);
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR (see Note #2)              */
+        for (nbr_tx = 0u; nbr_tx < nbr; nbr_tx++) {
+            OS_IntQPost(OS_OBJ_TYPE_Q,                          /* Post to ISR queue                                    */
+                        (void *)p_q,
+                        p_msg_tbl[nbr_tx],
+                        p_size_tbl[nbr_tx],
+                        0u,
+                        opt,
+                        p_err);
+            if (*p_err != OS_ERR_NONE) {
+                break;
+            }
+        }
+        return (nbr_tx);
+    }
+#endif
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts = OS_TS_GET();                                           /* Get timestamp, shared by all the messages            */
+#else
+    ts = 0u;
+#endif
+
+    if ((opt & OS_OPT_POST_LIFO) == 0u) {                       /* Determine whether we post FIFO or LIFO               */
+        post_type = OS_OPT_POST_FIFO;
+    } else {
+        post_type = OS_OPT_POST_LIFO;
+    }
+
+    OS_TRACE_Q_POST(p_q);
+
+    sched       = DEF_NO;
+   *p_err       = OS_ERR_NONE;
+    p_pend_list = &p_q->PendList;
+    CPU_CRITICAL_ENTER();
+    for (nbr_tx = 0u; nbr_tx < nbr; nbr_tx++) {
+        p_tcb = p_pend_list->HeadPtr;
+        if (p_tcb != DEF_NULL) {                                /* Give the message to the highest priority waiter      */
+            OS_Post((OS_PEND_OBJ *)((void *)p_q),
+                    p_tcb,
+                    p_msg_tbl[nbr_tx],
+                    p_size_tbl[nbr_tx],
+                    ts);
+            sched = DEF_YES;
+        } else {
+            OS_MsgQPut(&p_q->MsgQ,                              /* Place message in the message queue                   */
+                       p_msg_tbl[nbr_tx],
+                       p_size_tbl[nbr_tx],
+                       post_type,
+                       ts,
+                       p_err);
+            if (*p_err != OS_ERR_NONE) {                        /* Queue full or no more OS_MSGs, stop here             */
+                break;
+            }
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((sched == DEF_YES) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler once for the whole burst           */
+    }
+
+    return (nbr_tx);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                        CLEAR THE CONTENTS OF A MESSAGE QUEUE
@@ -904,6 +1433,9 @@ void  OSQPost (OS_Q         *p_q,
 void  OS_QClr (OS_Q  *p_q)
 {
     (void)OS_MsgQFreeAll(&p_q->MsgQ);                           /* Return all OS_MSGs to the free list                  */
+#if (OS_CFG_Q_MSG_RESERVE_EN == DEF_ENABLED)
+    OS_MsgQResvRelease(&p_q->MsgQ);                             /* Return the reserved OS_MSGs to the free list         */
+#endif
 #if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
     p_q->Type    =  OS_OBJ_TYPE_NONE;                           /* Mark the data structure as a NONE                    */
 #endif
@@ -0,0 +1,1211 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                               READER-WRITER LOCK MANAGEMENT
+*
+* File    : OS_RWLOCK.C
+* By      : JJL
+* Version : V3.06.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+/*
+************************************************************************************************************************
+* Note(s) : (1) A reader-writer lock is held either by any number of readers or by a single writer.  Readers and
+*               writers wait in the same priority ordered pend list, 'RWLockPendOpt' in the TCB tells them apart.
+*
+*           (2) Writers have preference : a reader waits as long as a writer holds the lock or waits for it.  When
+*               the lock is released, the highest priority writer waiting gets it and, if no writer waits, all the
+*               readers waiting get it.
+*
+*           (3) The writer holding the lock inherits the priority of the tasks waiting for it, like a mutex owner.
+*               Write locked reader-writer locks are kept in the writer's 'RWLockGrpHeadPtr' list which is also
+*               walked by OS_MutexGrpPrioFindHighest().  Readers do not inherit priorities.
+*
+*           (4) Each read lock held takes an entry of the reader's 'RWLockReadTbl[]', linked in the reader list of the
+*               lock : a task holds at most OS_CFG_RWLOCK_READ_MAX read locks at a time, only releases the read locks
+*               it holds and OSTaskDel() releases the read locks of the task deleted with its write locks.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_rwlock__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_TCB   *OS_RWLockWriterFind (OS_RWLOCK  *p_rwlock);
+
+static  CPU_BOOLEAN  OS_RWLockGrant   (OS_RWLOCK  *p_rwlock,
+                                       CPU_TS      ts);
+
+static  void      OS_RWLockGrpAdd     (OS_TCB     *p_tcb,
+                                       OS_RWLOCK  *p_rwlock);
+
+static  void      OS_RWLockGrpRemove  (OS_TCB     *p_tcb,
+                                       OS_RWLOCK  *p_rwlock);
+
+static  OS_RWLOCK_READ  *OS_RWLockReadFind   (OS_TCB          *p_tcb,
+                                              OS_RWLOCK       *p_rwlock);
+
+static  void             OS_RWLockReadAdd    (OS_TCB          *p_tcb,
+                                              OS_RWLOCK       *p_rwlock);
+
+static  void             OS_RWLockReadRemove (OS_RWLOCK_READ  *p_read);
+
+
+/*
+************************************************************************************************************************
+*                                             CREATE A READER-WRITER LOCK
+*
+* Description: This function creates a reader-writer lock.
+*
+* Arguments  : p_rwlock      is a pointer to the reader-writer lock to initialize.  Your application is responsible
+*                            for allocating storage for the lock.
+*
+*              p_name        is a pointer to the name you would like to give the reader-writer lock.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the lock after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_rwlock' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSRWLockCreate (OS_RWLOCK  *p_rwlock,
+                      CPU_CHAR   *p_name,
+                      OS_ERR     *p_err)
+{
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    CPU_INT32U  name_hash;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_rwlock == DEF_NULL) {                                 /* Validate 'p_rwlock'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    name_hash = OS_ObjRegHash(p_name);                          /* Hash the name with interrupts enabled                */
+#endif
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_rwlock->Type             =  OS_OBJ_TYPE_RWLOCK;           /* Mark the data structure as a reader-writer lock      */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_rwlock->NamePtr          =  p_name;
+#else
+    (void)p_name;
+#endif
+    p_rwlock->RWLockGrpNextPtr = DEF_NULL;
+    p_rwlock->WriterTCBPtr     = DEF_NULL;                      /* Lock is available                                    */
+    p_rwlock->ReaderCtr        = 0u;
+    p_rwlock->ReaderHeadPtr    = DEF_NULL;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_rwlock->TS               = 0u;
+#endif
+    OS_PendListInit(&p_rwlock->PendList);                       /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_RWLockDbgListAdd(p_rwlock);
+    OSRWLockQty++;                                              /* One more reader-writer lock created                  */
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    p_rwlock->Handle = OS_ObjRegAdd((void *)p_rwlock, OS_OBJ_TYPE_RWLOCK, p_name, name_hash);
+#endif
+
+    OS_TRACE_RWLOCK_CREATE(p_rwlock, p_name);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             DELETE A READER-WRITER LOCK
+*
+* Description: This function deletes a reader-writer lock and readies all tasks pending on it.
+*
+* Arguments  : p_rwlock      is a pointer to the reader-writer lock to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the lock ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the lock even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the lock was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the lock from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the lock after you called
+*                                                                 OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_rwlock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_rwlock' is not pointing to a reader-writer lock
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            One or more tasks were waiting on the lock
+*
+* Returns    : == 0          if no tasks were waiting on the lock, or upon error.
+*              >  0          if one or more tasks waiting on the lock are now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of the lock MUST
+*                 check the return code of OSRWLockPend().
+*
+*              2) Because ALL tasks pending on the lock will be readied, you MUST be careful because the resource(s)
+*                 will no longer be guarded by the lock.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RWLOCK_DEL_EN == DEF_ENABLED)
+OS_OBJ_QTY  OSRWLockDel (OS_RWLOCK  *p_rwlock,
+                         OS_OPT      opt,
+                         OS_ERR     *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_owner;
+    CPU_TS         ts;
+    OS_PRIO        prio_new;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a lock from an ISR             */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_rwlock == DEF_NULL) {                                 /* Validate 'p_rwlock'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {                 /* Make sure the lock was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_rwlock->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete the lock only if no task waiting              */
+             if (p_pend_list->HeadPtr == DEF_NULL) {
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+                 OS_RWLockDbgListRemove(p_rwlock);
+                 OSRWLockQty--;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+                 OS_ObjRegRemove(p_rwlock->Handle);
+#endif
+                 OS_TRACE_RWLOCK_DEL(p_rwlock);
+                 if (p_rwlock->WriterTCBPtr != DEF_NULL) {      /* Write locked?                                        */
+                     OS_RWLockGrpRemove(p_rwlock->WriterTCBPtr, p_rwlock); /* Yes, remove it from the writer's group    */
+                 }
+                 OS_RWLockClr(p_rwlock);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the lock                               */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             ts = OS_TS_GET();                                  /* Get timestamp                                        */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != DEF_NULL) {         /* Remove all tasks from the pend list                  */
+                 p_tcb = p_pend_list->HeadPtr;
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+             OS_RWLockDbgListRemove(p_rwlock);
+             OSRWLockQty--;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+             OS_ObjRegRemove(p_rwlock->Handle);
+#endif
+             OS_TRACE_RWLOCK_DEL(p_rwlock);
+             p_tcb_owner = p_rwlock->WriterTCBPtr;
+             if (p_tcb_owner != DEF_NULL) {                     /* Write locked?                                        */
+                 OS_RWLockGrpRemove(p_tcb_owner, p_rwlock);     /* Yes, remove it from the writer's group               */
+                 if (p_tcb_owner->Prio != p_tcb_owner->BasePrio) { /* Did we had to change the prio of the writer?      */
+                     prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                     prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                     OS_TaskChangePrio(p_tcb_owner, prio_new);
+                     OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+                 }
+             }
+             OS_RWLockClr(p_rwlock);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             PEND ON A READER-WRITER LOCK
+*
+* Description: This function waits for a reader-writer lock, for shared (read) or exclusive (write) access.
+*
+* Arguments  : p_rwlock      is a pointer to the reader-writer lock
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            lock up to the amount of time (in 'ticks') specified by this argument.  If you specify 0,
+*                            however, your task will wait forever at the specified lock or, until it becomes available.
+*
+*              opt           determines the access and whether the user wants to block if the lock is not available:
+*
+*                                OS_OPT_PEND_RWLOCK_READ      Shared access, with other readers
+*                                OS_OPT_PEND_RWLOCK_WRITE     Exclusive access
+*
+*                            PLUS
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the lock was released
+*                            or pend aborted or the lock deleted.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then
+*                            you will not get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task holds the lock
+*                                OS_ERR_OBJ_DEL            If 'p_rwlock' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rwlock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_rwlock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the lock was not
+*                                                          available
+*                                OS_ERR_RWLOCK_OVF         The reader counter overflowed or the calling task already
+*                                                          holds OS_CFG_RWLOCK_READ_MAX read locks
+*                                OS_ERR_RWLOCK_OWNER       If the calling task already holds the write lock
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            The lock was not received within the specified timeout
+*
+* Returns    : none
+*
+* Note(s)    : 1) The locks are not recursive : a writer cannot pend again on the lock it holds, a reader pending again
+*                 on a lock it holds blocks if a writer waits for it.  See 'os_rwlock.c  Note #2'.
+************************************************************************************************************************
+*/
+
+void  OSRWLockPend (OS_RWLOCK  *p_rwlock,
+                    OS_TICK     timeout,
+                    OS_OPT      opt,
+                    CPU_TS     *p_ts,
+                    OS_ERR     *p_err)
+{
+    OS_OPT    access;
+    OS_TCB   *p_tcb;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN == DEF_DISABLED)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    access = opt & OS_OPT_PEND_RWLOCK_MASK;
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_rwlock == DEF_NULL) {                                 /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (((access != OS_OPT_PEND_RWLOCK_READ) &&                 /* Validate 'opt'                                       */
+         (access != OS_OPT_PEND_RWLOCK_WRITE)) ||
+        ((opt & ~(OS_OPT_PEND_RWLOCK_MASK | OS_OPT_PEND_NON_BLOCKING)) != 0u)) {
+        OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {                 /* Make sure the lock was created                       */
+        OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_rwlock->WriterTCBPtr;
+    if (p_tcb == OSTCBCurPtr) {                                 /* Caller already holds the write lock?                 */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+       *p_err = OS_ERR_RWLOCK_OWNER;                            /* Yes, see Note #1                                     */
+        return;
+    }
+
+    if (access == OS_OPT_PEND_RWLOCK_READ) {                    /* Room for one more read lock?                         */
+        if ((p_rwlock->ReaderCtr == (OS_OBJ_QTY)-1) ||
+            (OS_RWLockReadFind(OSTCBCurPtr, DEF_NULL) == DEF_NULL)) {
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+           *p_err = OS_ERR_RWLOCK_OVF;
+            return;
+        }
+    }
+
+    if (p_tcb == DEF_NULL) {                                    /* Not write locked, is the lock available?             */
+        if (access == OS_OPT_PEND_RWLOCK_WRITE) {
+            if (p_rwlock->ReaderCtr == 0u) {                    /* Writers need the lock free                           */
+                p_rwlock->WriterTCBPtr = OSTCBCurPtr;
+                OS_RWLockGrpAdd(OSTCBCurPtr, p_rwlock);
+                p_tcb = OSTCBCurPtr;
+            }
+        } else {
+            if (OS_RWLockWriterFind(p_rwlock) == DEF_NULL) {    /* Readers need no writer waiting                       */
+                OS_RWLockReadAdd(OSTCBCurPtr, p_rwlock);
+                p_tcb = OSTCBCurPtr;
+            }
+        }
+        if (p_tcb == OSTCBCurPtr) {                             /* Caller got the lock                                  */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+            if (p_ts != DEF_NULL) {
+               *p_ts = p_rwlock->TS;
+            }
+#endif
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_RWLOCK_PEND(p_rwlock, access);
+           *p_err = OS_ERR_NONE;
+            return;
+        }
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        if (p_ts != DEF_NULL) {
+           *p_ts = 0u;
+        }
+#endif
+        OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return;
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+            if (p_ts != DEF_NULL) {
+               *p_ts = 0u;
+            }
+#endif
+            OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+
+    p_tcb = p_rwlock->WriterTCBPtr;                             /* Point to the TCB of the writer, if any               */
+    if ((p_tcb       != DEF_NULL) &&                            /* See if the writer has a lower priority than current  */
+        (p_tcb->Prio >  OSTCBCurPtr->Prio)) {
+        OS_TaskChangePrio(p_tcb, OSTCBCurPtr->Prio);
+        OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
+    }
+
+    OSTCBCurPtr->RWLockPendOpt = access;
+    OS_Pend((OS_PEND_OBJ *)((void *)p_rwlock),                  /* Block task pending on the lock                       */
+             OS_TASK_PEND_ON_RWLOCK,
+             timeout);
+
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_RWLOCK_PEND_BLOCK(p_rwlock, access);
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* We got the lock                                      */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != DEF_NULL) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_RWLOCK_PEND(p_rwlock, access);
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != DEF_NULL) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get the lock within timeout  */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != DEF_NULL) {
+                *p_ts = 0u;
+             }
+#endif
+             OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != DEF_NULL) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock);
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                            RELEASE A READER-WRITER LOCK
+*
+* Description: This function releases a reader-writer lock held by the calling task, for reading or writing.
+*
+* Arguments  : p_rwlock      is a pointer to the reader-writer lock
+*
+*              opt           is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                                OS_OPT_POST_NONE        No special option selected
+*                                OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the lock was released
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rwlock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_rwlock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_POST_ISR           If you attempted to post from an ISR
+*                                OS_ERR_RWLOCK_NOT_OWNER   If the calling task holds neither the write lock nor a read
+*                                                          lock
+*
+* Returns    : none
+*
+* Note(s)    : 1) A task that does not hold the write lock releases one of the read locks it holds, see
+*                 'os_rwlock.c  Note #4'.
+*
+*              2) The writer's priority is lowered back like a mutex owner's, see OSMutexPost().
+************************************************************************************************************************
+*/
+
+void  OSRWLockPost (OS_RWLOCK  *p_rwlock,
+                    OS_OPT      opt,
+                    OS_ERR     *p_err)
+{
+    OS_PRIO          prio_new;
+    OS_PRIO          prio_cur;
+    CPU_TS           ts;
+    CPU_BOOLEAN      sched;
+    OS_RWLOCK_READ  *p_read;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        OS_TRACE_RWLOCK_POST_FAILED(p_rwlock);
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_rwlock == DEF_NULL) {                                 /* Validate 'p_rwlock'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_RWLOCK_POST_FAILED(p_rwlock);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {                 /* Make sure the lock was created                       */
+        OS_TRACE_RWLOCK_POST_FAILED(p_rwlock);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    sched = DEF_NO;
+    CPU_CRITICAL_ENTER();
+    if (p_rwlock->WriterTCBPtr == OSTCBCurPtr) {                /* Release the write lock ...                           */
+        OS_RWLockGrpRemove(OSTCBCurPtr, p_rwlock);
+        p_rwlock->WriterTCBPtr = DEF_NULL;
+
+        prio_cur = OSTCBCurPtr->Prio;
+        if (prio_cur != OSTCBCurPtr->BasePrio) {                /* Has the writer inherited a priority? See Note #2     */
+            prio_new = OS_MutexGrpPrioFindHighest(OSTCBCurPtr);
+            prio_new = (prio_new > OSTCBCurPtr->BasePrio) ? OSTCBCurPtr->BasePrio : prio_new;
+            if (prio_new > prio_cur) {
+                OS_RdyListRemove(OSTCBCurPtr);
+                OSTCBCurPtr->Prio = prio_new;                   /* Lower writer's priority back                         */
+                OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(OSTCBCurPtr, prio_new);
+                OS_PrioInsert(prio_new);
+                OS_RdyListInsertTail(OSTCBCurPtr);
+                OSPrioCur         = prio_new;
+                sched             = DEF_YES;
+            }
+        }
+    } else {                                                    /* ... or one of its read locks, see Note #1            */
+        p_read = OS_RWLockReadFind(OSTCBCurPtr, p_rwlock);
+        if (p_read == DEF_NULL) {
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_RWLOCK_POST_FAILED(p_rwlock);
+           *p_err = OS_ERR_RWLOCK_NOT_OWNER;
+            return;
+        }
+        OS_RWLockReadRemove(p_read);
+    }
+
+    OS_TRACE_RWLOCK_POST(p_rwlock);
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts           = OS_TS_GET();                                 /* Get timestamp                                        */
+    p_rwlock->TS = ts;
+#else
+    ts           = 0u;
+#endif
+
+    if (OS_RWLockGrant(p_rwlock, ts) == DEF_YES) {              /* Give the lock to the tasks waiting, if possible      */
+        sched = DEF_YES;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((sched == DEF_YES) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                       CLEAR THE CONTENTS OF A READER-WRITER LOCK
+*
+* Description: This function is called by OSRWLockDel() to clear the contents of a reader-writer lock
+*
+* Argument(s): p_rwlock     is a pointer to the reader-writer lock to clear
+*              --------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The entries of the read locks still held are freed in the readers' tables.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockClr (OS_RWLOCK  *p_rwlock)
+{
+    OS_RWLOCK_READ  *p_read;
+
+
+    p_read = p_rwlock->ReaderHeadPtr;                           /* See Note #2                                          */
+    while (p_read != DEF_NULL) {
+        p_read->RWLockPtr = DEF_NULL;
+        p_read            = p_read->NextPtr;
+    }
+
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+    p_rwlock->Type             =  OS_OBJ_TYPE_NONE;             /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_rwlock->NamePtr          = (CPU_CHAR *)((void *)"?RWLOCK");
+#endif
+    p_rwlock->RWLockGrpNextPtr = DEF_NULL;
+    p_rwlock->WriterTCBPtr     = DEF_NULL;
+    p_rwlock->ReaderCtr        = 0u;
+    p_rwlock->ReaderHeadPtr    = DEF_NULL;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_rwlock->TS               = 0u;
+#endif
+    OS_PendListInit(&p_rwlock->PendList);                       /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                   ADD/REMOVE READER-WRITER LOCK TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a reader-writer lock to/from the debug list.
+*
+* Arguments  : p_rwlock    is a pointer to the reader-writer lock to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void  OS_RWLockDbgListAdd (OS_RWLOCK  *p_rwlock)
+{
+    p_rwlock->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_rwlock->DbgPrevPtr               = DEF_NULL;
+    if (OSRWLockDbgListPtr == DEF_NULL) {
+        p_rwlock->DbgNextPtr           = DEF_NULL;
+    } else {
+        p_rwlock->DbgNextPtr           =  OSRWLockDbgListPtr;
+        OSRWLockDbgListPtr->DbgPrevPtr =  p_rwlock;
+    }
+    OSRWLockDbgListPtr                 =  p_rwlock;
+}
+
+
+void  OS_RWLockDbgListRemove (OS_RWLOCK  *p_rwlock)
+{
+    OS_RWLOCK  *p_rwlock_next;
+    OS_RWLOCK  *p_rwlock_prev;
+
+
+    p_rwlock_prev = p_rwlock->DbgPrevPtr;
+    p_rwlock_next = p_rwlock->DbgNextPtr;
+
+    if (p_rwlock_prev == DEF_NULL) {
+        OSRWLockDbgListPtr = p_rwlock_next;
+        if (p_rwlock_next != DEF_NULL) {
+            p_rwlock_next->DbgPrevPtr = DEF_NULL;
+        }
+        p_rwlock->DbgNextPtr = DEF_NULL;
+
+    } else if (p_rwlock_next == DEF_NULL) {
+        p_rwlock_prev->DbgNextPtr = DEF_NULL;
+        p_rwlock->DbgPrevPtr      = DEF_NULL;
+
+    } else {
+        p_rwlock_prev->DbgNextPtr =  p_rwlock_next;
+        p_rwlock_next->DbgPrevPtr =  p_rwlock_prev;
+        p_rwlock->DbgNextPtr      = DEF_NULL;
+        p_rwlock->DbgPrevPtr      = DEF_NULL;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                  READER-WRITER LOCK GROUP HIGHEST PENDING PRIORITY
+*
+* Description: This function is called by OS_MutexGrpPrioFindHighest() to find the highest priority task pending on
+*              the reader-writer locks write locked by a task.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the writer.
+*
+* Returns    : Highest priority pending, or the lowest priority if no task is pending.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_PRIO  OS_RWLockGrpPrioFindHighest (OS_TCB  *p_tcb)
+{
+    OS_RWLOCK  *p_rwlock;
+    OS_TCB     *p_head;
+    OS_PRIO     highest_prio;
+
+
+    highest_prio = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
+    p_rwlock     = p_tcb->RWLockGrpHeadPtr;
+
+    while (p_rwlock != DEF_NULL) {
+        p_head = p_rwlock->PendList.HeadPtr;                    /* Readers and writers wait on the writer               */
+        if ((p_head       != DEF_NULL) &&
+            (p_head->Prio <  highest_prio)) {
+            highest_prio = p_head->Prio;
+        }
+        p_rwlock = p_rwlock->RWLockGrpNextPtr;
+    }
+
+    return (highest_prio);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         READER-WRITER LOCK GROUP POST ALL
+*
+* Description: This function is called by OSTaskDel() to release the reader-writer locks write locked and read locked
+*              by a task.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the task to process.
+*
+* Returns    : none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockGrpPostAll (OS_TCB  *p_tcb)
+{
+    OS_RWLOCK   *p_rwlock;
+    OS_RWLOCK   *p_rwlock_next;
+    CPU_TS       ts;
+    CPU_INT08U   i;
+
+
+    p_rwlock = p_tcb->RWLockGrpHeadPtr;
+
+    while (p_rwlock != DEF_NULL) {
+        OS_TRACE_RWLOCK_POST(p_rwlock);
+
+        p_rwlock_next = p_rwlock->RWLockGrpNextPtr;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        ts            = OS_TS_GET();                            /* Get timestamp                                        */
+        p_rwlock->TS  = ts;
+#else
+        ts            = 0u;
+#endif
+        OS_RWLockGrpRemove(p_tcb, p_rwlock);
+        p_rwlock->WriterTCBPtr = DEF_NULL;
+        (void)OS_RWLockGrant(p_rwlock, ts);
+
+        p_rwlock = p_rwlock_next;
+    }
+
+    for (i = 0u; i < OS_CFG_RWLOCK_READ_MAX; i++) {             /* Release the read locks                               */
+        p_rwlock = p_tcb->RWLockReadTbl[i].RWLockPtr;
+        if (p_rwlock != DEF_NULL) {
+            OS_TRACE_RWLOCK_POST(p_rwlock);
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+            ts           = OS_TS_GET();                         /* Get timestamp                                        */
+            p_rwlock->TS = ts;
+#else
+            ts           = 0u;
+#endif
+            OS_RWLockReadRemove(&p_tcb->RWLockReadTbl[i]);
+            (void)OS_RWLockGrant(p_rwlock, ts);
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       TASK REMOVED FROM A READER-WRITER LOCK
+*
+* Description: This function is called by the kernel after it removed a task from the pend list of a reader-writer lock
+*              because the task timed out or was deleted.
+*
+* Argument(s): p_rwlock     is a pointer to the reader-writer lock.
+*
+*              prio         is the priority of the task removed.
+*
+* Returns    : none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) If the lock is write locked, the writer may have inherited the priority of the task.  Otherwise, the
+*                 task may have been the last writer waiting and the readers behind it can now get the lock.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockPendRemoved (OS_RWLOCK  *p_rwlock,
+                            OS_PRIO     prio)
+{
+    OS_TCB   *p_tcb_owner;
+    OS_PRIO   prio_new;
+    CPU_TS    ts;
+
+
+    p_tcb_owner = p_rwlock->WriterTCBPtr;
+    if (p_tcb_owner != DEF_NULL) {                              /* See Note #2                                          */
+        if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+            (p_tcb_owner->Prio == prio)) {                      /* Has the writer inherited the task's priority?        */
+            prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+            prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+            if (prio_new != p_tcb_owner->Prio) {
+                OS_TaskChangePrio(p_tcb_owner, prio_new);
+                OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+            }
+        }
+    } else {
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        ts = OS_TS_GET();
+#else
+        ts = 0u;
+#endif
+        (void)OS_RWLockGrant(p_rwlock, ts);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                         GIVE A READER-WRITER LOCK TO WAITERS
+*
+* Description: This function gives a reader-writer lock that is not write locked to the tasks waiting for it, see
+*              'os_rwlock.c  Note #2'.
+*
+* Argument(s): p_rwlock     is a pointer to the reader-writer lock.
+*
+*              ts           is the timestamp given to the tasks readied.
+*
+* Returns    : DEF_YES      if at least one task was readied.
+*              DEF_NO       otherwise.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Readers may wait behind the new writer with a higher priority : the writer inherits the highest.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_RWLockGrant (OS_RWLOCK  *p_rwlock,
+                                     CPU_TS      ts)
+{
+    OS_TCB  *p_tcb;
+    OS_TCB  *p_head;
+
+
+    p_tcb = OS_RWLockWriterFind(p_rwlock);
+    if (p_tcb != DEF_NULL) {                                    /* A writer waits ...                                   */
+        if (p_rwlock->ReaderCtr > 0u) {                         /* ... until the last reader releases the lock          */
+            return (DEF_NO);
+        }
+        p_rwlock->WriterTCBPtr = p_tcb;                         /* Give the lock to the highest priority writer         */
+        OS_RWLockGrpAdd(p_tcb, p_rwlock);
+        OS_Post((OS_PEND_OBJ *)((void *)p_rwlock),
+                                        p_tcb,
+                                        DEF_NULL,
+                                        0u,
+                                        ts);
+        p_head = p_rwlock->PendList.HeadPtr;
+        if ((p_head       != DEF_NULL) &&                       /* See Note #2                                          */
+            (p_head->Prio <  p_tcb->Prio)) {
+            OS_TaskChangePrio(p_tcb, p_head->Prio);
+            OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
+        }
+        return (DEF_YES);
+    }
+
+    p_tcb = p_rwlock->PendList.HeadPtr;
+    if (p_tcb == DEF_NULL) {
+        return (DEF_NO);
+    }
+    while (p_tcb != DEF_NULL) {                                 /* Only readers wait, give them all the lock            */
+        OS_RWLockReadAdd(p_tcb, p_rwlock);
+        OS_Post((OS_PEND_OBJ *)((void *)p_rwlock),
+                                        p_tcb,
+                                        DEF_NULL,
+                                        0u,
+                                        ts);
+        p_tcb = p_rwlock->PendList.HeadPtr;
+    }
+    return (DEF_YES);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          FIND THE FIRST WRITER WAITING
+*
+* Description: This function returns the highest priority task waiting for write access to a reader-writer lock.
+*
+* Argument(s): p_rwlock     is a pointer to the reader-writer lock.
+*
+* Returns    : A pointer to the TCB of the writer, DEF_NULL if no writer waits.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  OS_TCB  *OS_RWLockWriterFind (OS_RWLOCK  *p_rwlock)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = p_rwlock->PendList.HeadPtr;                         /* The pend list is sorted by priority                  */
+    while ((p_tcb                != DEF_NULL) &&
+           (p_tcb->RWLockPendOpt != OS_OPT_PEND_RWLOCK_WRITE)) {
+        p_tcb = p_tcb->PendNextPtr;
+    }
+    return (p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                    READER-WRITER LOCK GROUP ADD/REMOVE
+*
+* Description: These functions add or remove a reader-writer lock to/from the group of the locks write locked by a task.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the writer.
+*
+*              p_rwlock     is a pointer to the reader-writer lock.
+*
+* Returns    : none.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+************************************************************************************************************************
+*/
+
+static  void  OS_RWLockGrpAdd (OS_TCB     *p_tcb,
+                               OS_RWLOCK  *p_rwlock)
+{
+    p_rwlock->RWLockGrpNextPtr = p_tcb->RWLockGrpHeadPtr;       /* The group is not sorted, add to head of list         */
+    p_tcb->RWLockGrpHeadPtr    = p_rwlock;
+}
+
+
+static  void  OS_RWLockGrpRemove (OS_TCB     *p_tcb,
+                                  OS_RWLOCK  *p_rwlock)
+{
+    OS_RWLOCK  **pp_rwlock;
+
+
+    pp_rwlock = &p_tcb->RWLockGrpHeadPtr;
+    while (*pp_rwlock != p_rwlock) {
+        pp_rwlock = &(*pp_rwlock)->RWLockGrpNextPtr;
+    }
+   *pp_rwlock = p_rwlock->RWLockGrpNextPtr;
+    p_rwlock->RWLockGrpNextPtr = DEF_NULL;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              FIND A READ LOCK OF A TASK
+*
+* Description: This function returns the entry of a task's 'RWLockReadTbl[]' holding a read lock on a reader-writer
+*              lock, see 'os_rwlock.c  Note #4'.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the task.
+*
+*              p_rwlock     is a pointer to the reader-writer lock, DEF_NULL to find a free entry.
+*
+* Returns    : A pointer to the entry, DEF_NULL if none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  OS_RWLOCK_READ  *OS_RWLockReadFind (OS_TCB     *p_tcb,
+                                            OS_RWLOCK  *p_rwlock)
+{
+    CPU_INT08U  i;
+
+
+    for (i = 0u; i < OS_CFG_RWLOCK_READ_MAX; i++) {
+        if (p_tcb->RWLockReadTbl[i].RWLockPtr == p_rwlock) {
+            return (&p_tcb->RWLockReadTbl[i]);
+        }
+    }
+    return (DEF_NULL);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              READ LOCK ADD/REMOVE
+*
+* Description: These functions record or release a read lock held by a task.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the reader.
+*
+*              p_rwlock     is a pointer to the reader-writer lock.
+*
+*              p_read       is a pointer to the entry of the read lock to release.
+*
+* Returns    : none.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) OSRWLockPend() checks that the reader has a free entry before it gets or waits for the lock.
+************************************************************************************************************************
+*/
+
+static  void  OS_RWLockReadAdd (OS_TCB     *p_tcb,
+                                OS_RWLOCK  *p_rwlock)
+{
+    OS_RWLOCK_READ  *p_read;
+
+
+    p_read                  = OS_RWLockReadFind(p_tcb, DEF_NULL); /* See Note #2                                        */
+    p_read->RWLockPtr       = p_rwlock;
+    p_read->NextPtr         = p_rwlock->ReaderHeadPtr;          /* The list is not sorted, add to head of list          */
+    p_rwlock->ReaderHeadPtr = p_read;
+    p_rwlock->ReaderCtr++;
+}
+
+
+static  void  OS_RWLockReadRemove (OS_RWLOCK_READ  *p_read)
+{
+    OS_RWLOCK        *p_rwlock;
+    OS_RWLOCK_READ  **pp_read;
+
+
+    p_rwlock = p_read->RWLockPtr;
+    pp_read  = &p_rwlock->ReaderHeadPtr;
+    while (*pp_read != p_read) {
+        pp_read = &(*pp_read)->NextPtr;
+    }
+   *pp_read           = p_read->NextPtr;
+    p_read->RWLockPtr = DEF_NULL;
+    p_read->NextPtr   = DEF_NULL;
+    p_rwlock->ReaderCtr--;
+}
+
+#endif /* OS_CFG_RWLOCK_EN */
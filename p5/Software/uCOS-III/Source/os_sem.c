@@ -75,6 +75,9 @@ void  OSSemCreate (OS_SEM      *p_sem,
                    OS_SEM_CTR   cnt,
                    OS_ERR      *p_err)
 {
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    CPU_INT32U  name_hash;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -106,6 +109,9 @@ void  OSSemCreate (OS_SEM      *p_sem,
     }
 #endif
 
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    name_hash = OS_ObjRegHash(p_name);                          /* Hash the name with interrupts enabled                */
+#endif
     CPU_CRITICAL_ENTER();
 #if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
     p_sem->Type    = OS_OBJ_TYPE_SEM;                           /* Mark the data structure as a semaphore               */
@@ -125,6 +131,9 @@ void  OSSemCreate (OS_SEM      *p_sem,
     OS_SemDbgListAdd(p_sem);
     OSSemQty++;
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    p_sem->Handle = OS_ObjRegAdd((void *)p_sem, OS_OBJ_TYPE_SEM, p_name, name_hash);
+#endif
 
     OS_TRACE_SEM_CREATE(p_sem, p_name);
 
@@ -240,6 +249,9 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                  OS_SemDbgListRemove(p_sem);
                  OSSemQty--;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+                 OS_ObjRegRemove(p_sem->Handle);
 #endif
                  OS_TRACE_SEM_DEL(p_sem);
                  OS_SemClr(p_sem);
@@ -267,6 +279,9 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
              OS_SemDbgListRemove(p_sem);
              OSSemQty--;
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+             OS_ObjRegRemove(p_sem->Handle);
 #endif
              OS_TRACE_SEM_DEL(p_sem);
              OS_SemClr(p_sem);
@@ -732,6 +747,20 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
         return (0u);
     }
 #endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        OS_IntQPost(OS_OBJ_TYPE_SEM,                            /* Post to ISR queue                                    */
+                    (void *)p_sem,
+                    DEF_NULL,
+                    0u,
+                    0u,
+                    opt,
+                    p_err);
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
@@ -42,6 +42,70 @@ const  CPU_CHAR  *os_stat__c = "$Id: $";
 
 #if (OS_CFG_STAT_TASK_EN == DEF_ENABLED)
 
+/*
+************************************************************************************************************************
+* Note(s) : (1) By default, the CPU usage is computed from the number of idle task loops per statistic task period,
+*               against the number counted without any other task by OSStatTaskCPUUsageInit().  The count depends on
+*               the caches and on OSIdleTaskHook() and each loop enters a critical section.
+*
+*           (2) With OS_CFG_STAT_CYCLES_EN, the CPU usage is computed from the timestamps (CPU cycles) charged to each
+*               task at each context switch :
+*
+*               (a) The idle time is the run time of the idle task, the idle task loop doesn't count anything and no
+*                   calibration is needed.
+*
+*               (b) OSIntEnter() and OSIntExit() charge the cycles of the ISRs to an entry of 'OSStatISRTbl[]' per
+*                   exception number and not to the task they interrupted.
+*
+*               (c) Besides the usage over the last period, the statistic task keeps moving averages of the usages over
+*                   1, 10 and 60 seconds (OS_STAT_EMA_xxx), as with a load average.
+*
+*               (d) The statistic task updates OS_CFG_STAT_TASK_BATCH tasks per run, resuming where it stopped, and
+*                   all the ISR entries : its run time doesn't depend on the number of tasks.  Each task is updated
+*                   over the time since its previous update.
+*
+*               (e) The timestamp timer, e.g. the DWT cycle counter, may stop with the core clock while the idle task
+*                   is in a low power state (see 'os_pwr.c').  OS_StatSleepAdd() charges the time slept it missed to
+*                   the idle task and adds it to 'OSStatSleepTS', which the statistics add to the timestamps.
+************************************************************************************************************************
+*/
+
+/*
+************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+static  const  CPU_INT08U  OS_StatEMA_TauTbl[OS_STAT_EMA_NBR] = {   /* Time constants of the moving averages (s)        */
+    1u,
+    10u,
+    60u
+};
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_CPU_USAGE  OS_StatUsageCalc      (OS_CYCLES          cycles,
+                                             CPU_TS             ts_elapsed);
+
+static  void          OS_StatEMAUpdate      (OS_CPU_USAGE_EMA  *p_ema_tbl,
+                                             OS_CPU_USAGE       usage,
+                                             OS_TICK            ticks);
+
+static  void          OS_StatIntCharge      (OS_NESTING_CTR     nesting,
+                                             CPU_TS             ts);
+
+static  void          OS_StatCPUUsageUpdate (void);
+
+static  void          OS_StatTaskUpdate     (void);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   RESET STATISTICS
@@ -68,6 +132,9 @@ void  OSStatReset (OS_ERR  *p_err)
 #if (OS_CFG_Q_EN == DEF_ENABLED)
     OS_Q        *p_q;
 #endif
+#endif
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    CPU_INT16U   i;
 #endif
     CPU_SR_ALLOC();
 
@@ -80,6 +147,12 @@ void  OSStatReset (OS_ERR  *p_err)
     }
 #endif
 
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    for (i = 0u; i < OS_CFG_STAT_ISR_TBL_SIZE; i++) {
+        OSStatISRTbl[i].CPUUsageMax = 0u;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
 #if (OS_CFG_STAT_TASK_EN == DEF_ENABLED)
     OSStatTaskCPUUsageMax = 0u;
@@ -137,12 +210,18 @@ void  OSStatReset (OS_ERR  *p_err)
         p_tcb->CtxSwCtr         = 0u;
         p_tcb->CPUUsage         = 0u;
         p_tcb->CPUUsageMax      = 0u;
+#if (OS_CFG_STAT_CYCLES_EN == DEF_DISABLED)                     /* The cycles are read as deltas, see Note #2d          */
         p_tcb->CyclesTotal      = 0u;
         p_tcb->CyclesTotalPrev  = 0u;
 #if (OS_CFG_TS_EN == DEF_ENABLED)
         p_tcb->CyclesStart      = OS_TS_GET();
 #endif
 #endif
+#endif
+
+#if (OS_CFG_PROF_EN == DEF_ENABLED)
+        p_tcb->CtxSwCtrPrev     = 0u;
+#endif
 
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
         p_msg_q                 = &p_tcb->MsgQ;
@@ -191,14 +270,17 @@ void  OSStatReset (OS_ERR  *p_err)
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_STAT_CYCLES_EN, there is nothing to calibrate : this function only starts the statistic
+*                 task, which OS_StatTaskInit() already did (see Note #2a at the top).
 ************************************************************************************************************************
 */
 
 void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_STAT_CYCLES_EN == DEF_DISABLED)
     OS_ERR   err;
     OS_TICK  dly;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -217,6 +299,12 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     }
 #endif
 
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)                      /* See Note #1                                          */
+    CPU_CRITICAL_ENTER();
+    OSStatTaskRdy = OS_STATE_RDY;
+    CPU_CRITICAL_EXIT();
+   *p_err         = OS_ERR_NONE;
+#else
 #if ((OS_CFG_TMR_EN == DEF_ENABLED) && (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED))
     OSTaskSuspend(&OSTmrTaskTCB, &err);
     if (err != OS_ERR_NONE) {
@@ -265,6 +353,7 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     OSStatTaskRdy     = OS_STATE_RDY;
     CPU_CRITICAL_EXIT();
    *p_err             = OS_ERR_NONE;
+#endif
 }
 
 
@@ -291,11 +380,15 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
 *                 for the idle counter.
 *
 *              4) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              5) With OS_CFG_STAT_CYCLES_EN, the CPU usage is computed from the idle task run time instead, see Note #2
+*                 at the top.
 ************************************************************************************************************************
 */
 
 void  OS_StatTask (void  *p_arg)
 {
+#if (OS_CFG_STAT_CYCLES_EN == DEF_DISABLED)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
 #if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)
     OS_CPU_USAGE usage;
@@ -309,6 +402,7 @@ void  OS_StatTask (void  *p_arg)
     OS_TICK      ctr_max;
     OS_TICK      ctr_mult;
     OS_TICK      ctr_div;
+#endif
     OS_ERR       err;
     OS_TICK      dly;
 #if (OS_CFG_TS_EN == DEF_ENABLED)
@@ -328,6 +422,15 @@ void  OS_StatTask (void  *p_arg)
     }
     OSStatReset(&err);                                          /* Reset statistics                                     */
 
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    CPU_CRITICAL_ENTER();                                       /* Start of the first period                            */
+    OSStatTS             = OS_TS_GET() + OSStatSleepTS;         /* See Note #2e at the top                              */
+    OSStatTickCtr        = OSTickCtr;
+    OSStatIdleCyclesPrev = OSIdleTaskTCB.CyclesTotal;
+    OSStatIntCyclesPrev  = OSStatIntCyclesTotal;
+    CPU_CRITICAL_EXIT();
+#endif
+
     dly = (OS_TICK)0;                                           /* Compute statistic task sleep delay                   */
     if (OSCfg_TickRate_Hz > OSCfg_StatTaskRate_Hz) {
         dly = (OSCfg_TickRate_Hz / OSCfg_StatTaskRate_Hz);
@@ -344,6 +447,13 @@ void  OS_StatTask (void  *p_arg)
         OSIntDisTimeMax = CPU_IntDisMeasMaxGet();
 #endif
 
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+        OS_StatCPUUsageUpdate();                                /* Overall and ISR CPU usage, see Note #5               */
+
+        OSStatTaskHook();                                       /* Invoke user definable hook                           */
+
+        OS_StatTaskUpdate();                                    /* Next batch of tasks                                  */
+#else
         CPU_CRITICAL_ENTER();                                   /* ---------------- OVERALL CPU USAGE ----------------- */
         OSStatTaskCtrRun   = OSStatTaskCtr;                     /* Obtain the of the stat counter for the past .1 second*/
         OSStatTaskCtr      = 0u;                                /* Reset the stat counter for the next .1 second        */
@@ -452,6 +562,11 @@ void  OS_StatTask (void  *p_arg)
             CPU_CRITICAL_EXIT();
         }
 #endif
+#endif
+
+#if (OS_CFG_PROF_EN == DEF_ENABLED)
+        OS_ProfUpdate();                                        /* Take a profiler snapshot when one is due             */
+#endif
 
         if (OSStatResetFlag == DEF_TRUE) {                      /* Check if need to reset statistics                    */
             OSStatResetFlag  = DEF_FALSE;
@@ -494,12 +609,40 @@ void  OS_StatTask (void  *p_arg)
 
 void  OS_StatTaskInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    CPU_INT16U  i;
+    CPU_INT08U  j;
+#endif
+
+
     OSStatTaskCtr    = 0u;
     OSStatTaskCtrRun = 0u;
     OSStatTaskCtrMax = 0u;
     OSStatTaskRdy    = OS_STATE_NOT_RDY;                        /* Statistic task is not ready                          */
     OSStatResetFlag  = DEF_FALSE;
 
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    OSStatTaskRdy        = OS_STATE_RDY;                        /* Nothing to calibrate, see Note #2a at the top        */
+    OSStatTaskTCBPtr     = DEF_NULL;
+    OSStatIntCPUUsage    = 0u;
+    OSStatIntCyclesTotal = 0u;
+    OSStatSleepTS        = 0u;
+    for (j = 0u; j < OS_STAT_EMA_NBR; j++) {
+        OSStatTaskCPUUsageEMA[j] = 0u;
+        OSStatIntCPUUsageEMA[j]  = 0u;
+    }
+    for (i = 0u; i < OS_CFG_STAT_ISR_TBL_SIZE; i++) {
+        OSStatISRTbl[i].Ctr             = 0u;
+        OSStatISRTbl[i].CyclesTotal     = 0u;
+        OSStatISRTbl[i].CyclesTotalPrev = 0u;
+        OSStatISRTbl[i].CPUUsage        = 0u;
+        OSStatISRTbl[i].CPUUsageMax     = 0u;
+        for (j = 0u; j < OS_STAT_EMA_NBR; j++) {
+            OSStatISRTbl[i].CPUUsageEMA[j] = 0u;
+        }
+    }
+#endif
+
                                                                 /* --------------- CREATE THE STAT TASK --------------- */
     if (OSCfg_StatTaskStkBasePtr == DEF_NULL) {
        *p_err = OS_ERR_STAT_STK_INVALID;
@@ -531,4 +674,362 @@ void  OS_StatTaskInit (OS_ERR  *p_err)
                  p_err);
 }
 
+
+/*
+************************************************************************************************************************
+*                                                 ISR ENTRY AND EXIT
+*
+* Description: These functions are called by OSIntEnter(), after the nesting counter is incremented, and by OSIntExit(),
+*              before it is decremented, to charge the cycles of the ISRs (see Note #2b at the top) :
+*
+*                  - the cycles from the entry or the return of a nested ISR to the next entry or exit are charged to
+*                    the entry of 'OSStatISRTbl[]' of the running ISR
+*
+*                  - the cycles from the entry to the exit of the outermost ISR are added to 'OSStatIntCyclesTotal'
+*                    and removed from the run time of the interrupted task by moving its 'CyclesStart'
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) Interrupts are disabled when these functions are called.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+void  OS_StatIntEnter (void)
+{
+    CPU_TS      ts;
+    CPU_INT16U  nbr;
+
+
+    ts  = OS_TS_GET();
+    nbr = (CPU_INT16U)OS_CPU_INT_NBR_GET();
+    if (nbr >= OS_CFG_STAT_ISR_TBL_SIZE) {
+        nbr = 0u;
+    }
+
+    if (OSIntNestingCtr == 1u) {                                /* Outermost ISR                                        */
+        OSStatIntEntryTS = ts;
+    } else {
+        OS_StatIntCharge(OSIntNestingCtr - 1u, ts);             /* Stop charging the ISR being interrupted              */
+    }
+    if (OSIntNestingCtr <= OS_STAT_INT_NEST_MAX) {
+        OSStatIntNbrTbl[OSIntNestingCtr - 1u] = nbr;
+    }
+    OSStatISRTbl[nbr].Ctr++;
+    OSStatIntTS = ts;
+}
+
+
+void  OS_StatIntExit (void)
+{
+    CPU_TS  ts;
+    CPU_TS  cycles;
+
+
+    ts = OS_TS_GET();
+    OS_StatIntCharge(OSIntNestingCtr, ts);
+    OSStatIntTS = ts;
+
+    if (OSIntNestingCtr == 1u) {                                /* Return to a task                                     */
+        cycles                    = ts - OSStatIntEntryTS;
+        OSStatIntCyclesTotal     += (OS_CYCLES)cycles;
+        OSTCBCurPtr->CyclesStart += cycles;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                           CHARGE THE TIME SLEPT TO THE IDLE TASK
+*
+* Description: This function is called by OS_PwrIdle() after a low power state to charge the time slept that the
+*              timestamp timer missed to the idle task (see Note #2e at the top).
+*
+* Arguments  : ts_counted   is the number of timestamps counted while in the state.
+*
+*              slept_us     is the time spent in the state, in microseconds, as measured by BSP_OS_PwrEnter().
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Interrupts are disabled and the idle task is running: its cycles since 'CyclesStart' are charged
+*                 when it is switched out, the time missed is charged now.
+*
+*              3) A timer that keeps running in the state counts at least the time measured, nothing is charged.
+************************************************************************************************************************
+*/
+
+void  OS_StatSleepAdd (CPU_TS      ts_counted,
+                       CPU_INT32U  slept_us)
+{
+    CPU_TS_TMR_FREQ  ts_freq;
+    CPU_TS           ts_slept;
+    CPU_ERR          cpu_err;
+
+
+    ts_freq = CPU_TS_TmrFreqGet(&cpu_err);
+    if (cpu_err != CPU_ERR_NONE) {
+        return;
+    }
+    ts_slept = (CPU_TS)(((CPU_INT64U)slept_us * ts_freq) / 1000000u);
+    if (ts_slept > ts_counted) {                                /* See Note #3                                          */
+        OSIdleTaskTCB.CyclesTotal += (OS_CYCLES)(ts_slept - ts_counted);
+        OSStatSleepTS             += ts_slept - ts_counted;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                              CHARGE THE RUNNING ISR
+*
+* Description: This function charges the cycles since the last ISR entry or exit to the ISR at a nesting level.  Levels
+*              deeper than OS_STAT_INT_NEST_MAX are charged to the ISR at OS_STAT_INT_NEST_MAX.
+*
+* Arguments  : nesting    is the nesting level of the ISR (1 for the outermost ISR).
+*
+*              ts         is the current timestamp.
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_StatIntCharge (OS_NESTING_CTR  nesting,
+                                CPU_TS          ts)
+{
+    CPU_INT16U  nbr;
+
+
+    if (nesting > OS_STAT_INT_NEST_MAX) {
+        nesting = OS_STAT_INT_NEST_MAX;
+    }
+    nbr                            = OSStatIntNbrTbl[nesting - 1u];
+    OSStatISRTbl[nbr].CyclesTotal += (OS_CYCLES)(ts - OSStatIntTS);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           UPDATE THE OVERALL AND ISR CPU USAGE
+*
+* Description: This function computes the CPU usage over the last statistic task period from the run time of the idle
+*              task, the CPU usage of all the ISRs and of each ISR, and updates their moving averages.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) The idle task is switched out while the statistic task runs : its 'CyclesTotal' is up to date.
+************************************************************************************************************************
+*/
+
+static  void  OS_StatCPUUsageUpdate (void)
+{
+    CPU_TS        ts;
+    CPU_TS        ts_elapsed;
+    OS_TICK       ticks;
+    OS_CYCLES     cycles_idle;
+    OS_CYCLES     cycles_int;
+    OS_CYCLES     cycles;
+    OS_CPU_USAGE  usage;
+    OS_STAT_ISR  *p_isr;
+    CPU_INT16U    i;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    ts                   = OS_TS_GET() + OSStatSleepTS;         /* See Note #2e at the top                              */
+    ticks                = OSTickCtr - OSStatTickCtr;
+    OSStatTickCtr        = OSTickCtr;
+    cycles_idle          = OSIdleTaskTCB.CyclesTotal - OSStatIdleCyclesPrev;
+    OSStatIdleCyclesPrev = OSIdleTaskTCB.CyclesTotal;
+    cycles_int           = OSStatIntCyclesTotal - OSStatIntCyclesPrev;
+    OSStatIntCyclesPrev  = OSStatIntCyclesTotal;
+    CPU_CRITICAL_EXIT();
+    ts_elapsed           = ts - OSStatTS;
+    OSStatTS             = ts;
+                                                                /* ---------------- OVERALL CPU USAGE ----------------- */
+    usage              = OS_StatUsageCalc(cycles_idle, ts_elapsed);
+    OSStatTaskCPUUsage = (OS_CPU_USAGE)(10000u - usage);
+    if (OSStatTaskCPUUsageMax < OSStatTaskCPUUsage) {
+        OSStatTaskCPUUsageMax = OSStatTaskCPUUsage;
+    }
+    OS_StatEMAUpdate(&OSStatTaskCPUUsageEMA[0], OSStatTaskCPUUsage, ticks);
+
+    OSStatIntCPUUsage  = OS_StatUsageCalc(cycles_int, ts_elapsed);
+    OS_StatEMAUpdate(&OSStatIntCPUUsageEMA[0], OSStatIntCPUUsage, ticks);
+
+                                                                /* ------------------ ISR CPU USAGE ------------------- */
+    for (i = 0u; i < OS_CFG_STAT_ISR_TBL_SIZE; i++) {
+        p_isr = &OSStatISRTbl[i];
+        if (p_isr->Ctr == 0u) {                                 /* ISR never ran                                        */
+            continue;
+        }
+        CPU_CRITICAL_ENTER();
+        cycles                 = p_isr->CyclesTotal - p_isr->CyclesTotalPrev;
+        p_isr->CyclesTotalPrev = p_isr->CyclesTotal;
+        CPU_CRITICAL_EXIT();
+
+        usage           = OS_StatUsageCalc(cycles, ts_elapsed);
+        p_isr->CPUUsage = usage;
+        if (p_isr->CPUUsageMax < usage) {
+            p_isr->CPUUsageMax = usage;
+        }
+        OS_StatEMAUpdate(&p_isr->CPUUsageEMA[0], usage, ticks);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                             UPDATE A BATCH OF TASKS
+*
+* Description: This function computes the CPU usage of up to OS_CFG_STAT_TASK_BATCH tasks of the debug list, from where
+*              the previous call stopped, over the time since their previous update.  It also checks their stacks.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) OS_TaskDbgListRemove() moves 'OSStatTaskTCBPtr' past a task deleted while it is being updated.
+*
+*              2) A batch ends at the end of the list, the next one starts from the head.
+************************************************************************************************************************
+*/
+
+static  void  OS_StatTaskUpdate (void)
+{
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    OS_TICK        tick_ctr;
+    OS_CYCLES      cycles;
+    OS_CPU_USAGE   usage;
+    OS_OBJ_QTY     nbr;
+#if (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED)
+    OS_ERR         err;
+#endif
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OSStatTaskTCBPtr == DEF_NULL) {                         /* See Note #2                                          */
+        OSStatTaskTCBPtr = OSTaskDbgListPtr;
+    }
+    p_tcb = OSStatTaskTCBPtr;
+    CPU_CRITICAL_EXIT();
+
+    nbr = 0u;
+    while ((p_tcb != DEF_NULL) &&
+           (nbr   <  OS_CFG_STAT_TASK_BATCH)) {
+        CPU_CRITICAL_ENTER();
+        ts                     = OS_TS_GET() + OSStatSleepTS;
+        tick_ctr               = OSTickCtr;
+        cycles                 = p_tcb->CyclesTotal - p_tcb->CyclesTotalPrev;
+        p_tcb->CyclesTotalPrev = p_tcb->CyclesTotal;
+        CPU_CRITICAL_EXIT();
+
+        usage              = OS_StatUsageCalc(cycles, ts - p_tcb->StatTS);
+        p_tcb->StatTS      = ts;
+        p_tcb->CPUUsage    = usage;
+        if (p_tcb->CPUUsageMax < usage) {                       /* Detect peak CPU usage                                */
+            p_tcb->CPUUsageMax = usage;
+        }
+        OS_StatEMAUpdate(&p_tcb->CPUUsageEMA[0], usage, tick_ctr - p_tcb->StatTickCtr);
+        p_tcb->StatTickCtr = tick_ctr;
+
+#if (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED)
+        OSTaskStkChk( p_tcb,
+                     &p_tcb->StkFree,
+                     &p_tcb->StkUsed,
+                     &err);
+#endif
+        nbr++;
+
+        CPU_CRITICAL_ENTER();
+        if (OSStatTaskTCBPtr == p_tcb) {                        /* See Note #1                                          */
+            OSStatTaskTCBPtr = p_tcb->DbgNextPtr;
+        }
+        p_tcb = OSStatTaskTCBPtr;
+        CPU_CRITICAL_EXIT();
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 COMPUTE A CPU USAGE
+*
+* Description: This function returns the fraction of an interval spent running something.
+*
+* Arguments  : cycles       is the number of cycles spent running.
+*
+*              ts_elapsed   is the length of the interval, in timestamp counts.
+*
+* Returns    : The CPU usage (0.00-100.00%)
+************************************************************************************************************************
+*/
+
+static  OS_CPU_USAGE  OS_StatUsageCalc (OS_CYCLES  cycles,
+                                        CPU_TS     ts_elapsed)
+{
+    CPU_INT64U  usage;
+
+
+    if (ts_elapsed == 0u) {
+        return (0u);
+    }
+    usage = ((CPU_INT64U)cycles * 10000u) / (CPU_INT64U)ts_elapsed;
+    if (usage > 10000u) {
+        usage = 10000u;
+    }
+    return ((OS_CPU_USAGE)usage);
+}
+
+
+/*
+************************************************************************************************************************
+*                                             UPDATE THE MOVING AVERAGES
+*
+* Description: This function moves the OS_STAT_EMA_NBR moving averages of a CPU usage towards a new sample :
+*
+*                  EMA += (usage - EMA) * ticks / tau
+*
+*              which is the first order approximation of 1 - exp(-ticks / tau) for a sample covering 'ticks'.
+*
+* Arguments  : p_ema_tbl    is a pointer to the table of moving averages.
+*
+*              usage        is the CPU usage over the interval (0.00-100.00%).
+*
+*              ticks        is the length of the interval, in ticks.
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_StatEMAUpdate (OS_CPU_USAGE_EMA  *p_ema_tbl,
+                                OS_CPU_USAGE       usage,
+                                OS_TICK            ticks)
+{
+    CPU_INT64S  diff;
+    CPU_INT64S  tau;
+    CPU_INT08U  i;
+
+
+    for (i = 0u; i < OS_STAT_EMA_NBR; i++) {
+        tau  = (CPU_INT64S)OS_StatEMA_TauTbl[i] * (CPU_INT64S)OSCfg_TickRate_Hz;
+        diff = ((CPU_INT64S)usage << 16u) - (CPU_INT64S)p_ema_tbl[i];
+        if ((CPU_INT64S)ticks >= tau) {                         /* Interval longer than the time constant               */
+            p_ema_tbl[i] = (OS_CPU_USAGE_EMA)usage << 16u;
+        } else {
+            p_ema_tbl[i] = (OS_CPU_USAGE_EMA)((CPU_INT64S)p_ema_tbl[i] + ((diff * (CPU_INT64S)ticks) / tau));
+        }
+    }
+}
+#endif
+
 #endif
@@ -99,6 +99,13 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (prio_new == 0u) {                                       /* Priority 0 is reserved for the ISR post queue task   */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
     if (prio_new >= (OS_CFG_PRIO_MAX - 1u)) {                   /* Cannot set to Idle Task priority                     */
        *p_err = OS_ERR_PRIO_INVALID;
         return;
@@ -118,7 +125,12 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
     p_tcb->BasePrio = prio_new;                                 /* Update base priority                                 */
 
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+    if ((p_tcb->MutexGrpHeadPtr  != DEF_NULL) ||                /* Owning a mutex or a write lock?                      */
+        (p_tcb->RWLockGrpHeadPtr != DEF_NULL)) {
+#else
     if (p_tcb->MutexGrpHeadPtr != DEF_NULL) {                   /* Owning a mutex?                                      */
+#endif
         if (prio_new > p_tcb->Prio) {
             prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
             if (prio_new > prio_high) {
@@ -185,7 +197,7 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *              q_size         is the maximum number of messages that can be sent to the task
 *
 *              time_quanta    amount of time (in ticks) for time slice when round-robin between tasks.  Specify 0 to use
-*                             the default.
+*                             the default.  In microseconds when OS_CFG_SCHED_ROUND_ROBIN_US_EN is enabled.
 *
 *              p_ext          is a pointer to a user supplied memory location which is used as a TCB extension.
 *                             For example, this user memory can hold the contents of floating-point registers
@@ -199,7 +211,9 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                                 OS_OPT_TASK_STK_CHK         Stack checking to be allowed for the task
 *                                 OS_OPT_TASK_STK_CLR         Clear the stack when the task is created
 *                                 OS_OPT_TASK_SAVE_FP         If the CPU has floating-point registers, save them
-*                                                             during a context switch.
+*                                                             during a context switch.  Ports which save them
+*                                                             lazily start the task with a FP frame and may set
+*                                                             this option once a task uses the FPU.
 *                                 OS_OPT_TASK_NO_TLS          If the caller doesn't want or need TLS (Thread Local
 *                                                             Storage) support for the task.  If you do not include this
 *                                                             option, TLS will be supported by default.
@@ -253,6 +267,9 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 
     CPU_STK       *p_sp;
     CPU_STK       *p_stk_limit;
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    CPU_INT32U     name_hash;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -327,6 +344,16 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #endif
     }
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (prio == 0u) {
+        if (p_tcb != &OSIntQTaskTCB) {
+            OS_TRACE_TASK_CREATE_FAILED(p_tcb);
+           *p_err = OS_ERR_PRIO_INVALID;                        /* Priority 0 is reserved for the ISR post queue task   */
+            return;
+        }
+    }
+#endif
+
     OS_TaskInitTCB(p_tcb);                                      /* Initialize the TCB to default values                 */
 
    *p_err = OS_ERR_NONE;
@@ -396,11 +423,7 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
     p_tcb->TimeQuanta    = time_quanta;                         /* Save the #ticks for time slice (0 means not sliced)  */
-    if (time_quanta == 0u) {
-        p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta;
-    } else {
-        p_tcb->TimeQuantaCtr = time_quanta;
-    }
+    OS_SchedRoundRobinReload(p_tcb);
 #else
     (void)time_quanta;
 #endif
@@ -438,6 +461,9 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
         p_tcb->TLS_Tbl[id] = 0u;
     }
     OS_TLS_TaskCreate(p_tcb);                                   /* Call TLS hook                                        */
+#endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    name_hash = OS_ObjRegHash(p_name);                          /* Hash the name with interrupts enabled                */
 #endif
                                                                 /* -------------- ADD TASK TO READY LIST -------------- */
     CPU_CRITICAL_ENTER();
@@ -447,6 +473,9 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_TaskDbgListAdd(p_tcb);
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    p_tcb->Handle = OS_ObjRegAdd((void *)p_tcb, OS_OBJ_TYPE_TASK, p_name, name_hash);
+#endif
 
     OSTaskQty++;                                                /* Increment the #tasks counter                         */
 
@@ -495,8 +524,11 @@ void  OSTaskDel (OS_TCB  *p_tcb,
                  OS_ERR  *p_err)
 {
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
-    OS_TCB   *p_tcb_owner;
-    OS_PRIO   prio_new;
+    OS_TCB     *p_tcb_owner;
+    OS_PRIO     prio_new;
+#endif
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+    OS_RWLOCK  *p_rwlock;
 #endif
     CPU_SR_ALLOC();
 
@@ -593,6 +625,15 @@ void  OSTaskDel (OS_TCB  *p_tcb,
                       break;
 #endif
 
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+                 case OS_TASK_PEND_ON_RWLOCK:
+                      p_rwlock = (OS_RWLOCK *)((void *)p_tcb->PendObjPtr);
+                      OS_PendListRemove(p_tcb);
+                      p_tcb->PendOn = OS_TASK_PEND_ON_NOTHING;
+                      OS_RWLockPendRemoved(p_rwlock, p_tcb->Prio); /* Disinherit the writer or grant waiting readers    */
+                      break;
+#endif
+
                  default:
                       break;
              }
@@ -611,15 +652,30 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     }
 
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    OS_MutexFastAdoptAll(p_tcb);                                /* Mutexes taken w/o the kernel join the task's group   */
+#endif
     if(p_tcb->MutexGrpHeadPtr != DEF_NULL) {
         OS_MutexGrpPostAll(p_tcb);
     }
 #endif
 
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+    OS_RWLockGrpPostAll(p_tcb);                                 /* Release the locks write or read locked by the task   */
+#endif
+
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
     (void)OS_MsgQFreeAll(&p_tcb->MsgQ);                         /* Free task's message queue messages                   */
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    OS_EdfTaskRemove(p_tcb);                                    /* Give back the CPU share reserved by the task         */
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    OS_BudgetTaskRemove(p_tcb);                                 /* Stop charging the task                               */
+#endif
+
     OSTaskDelHook(p_tcb);                                       /* Call user defined hook                               */
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
@@ -629,6 +685,9 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_TaskDbgListRemove(p_tcb);
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_ObjRegRemove(p_tcb->Handle);
+#endif
 
     OSTaskQty--;                                                /* One less task being managed                          */
 
@@ -1105,6 +1164,23 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        if (p_tcb == DEF_NULL) {                                /* Post to the task that was interrupted                */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_MSG,                       /* Post to ISR queue                                    */
+                    (void *)p_tcb,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    p_err);
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+        return;
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
@@ -1837,6 +1913,23 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from an ISR                            */
+        if (p_tcb == DEF_NULL) {                                /* Post to the task that was interrupted                */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_SIGNAL,                    /* Post to ISR queue                                    */
+                    (void *)p_tcb,
+                    DEF_NULL,
+                    0u,
+                    0u,
+                    opt,
+                    p_err);
+        OS_TRACE_TASK_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
@@ -2272,7 +2365,8 @@ void   OSTaskSuspend (OS_TCB  *p_tcb,
 * Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
 *                           task is assumed.
 *
-*              time_quanta  is the number of ticks before the CPU is taken away when round-robin scheduling is enabled.
+*              time_quanta  is the number of ticks before the CPU is taken away when round-robin scheduling is enabled
+*                           (microseconds when OS_CFG_SCHED_ROUND_ROBIN_US_EN is enabled).
 *
 *              p_err        is a pointer to an error code returned by this function:
 *
@@ -2318,9 +2412,13 @@ void  OSTaskTimeQuantaSet (OS_TCB   *p_tcb,
     } else {
         p_tcb->TimeQuanta    = time_quanta;
     }
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+    OS_SchedRoundRobinReload(p_tcb);                            /* Start a slice of the new length                      */
+#else
     if (p_tcb->TimeQuanta > p_tcb->TimeQuantaCtr) {
         p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;
     }
+#endif
     CPU_CRITICAL_EXIT();
    *p_err = OS_ERR_NONE;
 }
@@ -2365,6 +2463,17 @@ void  OS_TaskDbgListRemove (OS_TCB  *p_tcb)
     p_tcb_prev = p_tcb->DbgPrevPtr;
     p_tcb_next = p_tcb->DbgNextPtr;
 
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+    if (OSTaskStkScanTCBPtr == p_tcb) {                         /* Do not resume the stack scan on a deleted task       */
+        OSTaskStkScanTCBPtr = p_tcb_next;
+    }
+#endif
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    if (OSStatTaskTCBPtr == p_tcb) {                            /* Nor the statistics                                   */
+        OSStatTaskTCBPtr = p_tcb_next;
+    }
+#endif
+
     if (p_tcb_prev == DEF_NULL) {
         OSTaskDbgListPtr = p_tcb_next;
         if (p_tcb_next != DEF_NULL) {
@@ -2408,6 +2517,9 @@ void  OS_TaskInit (OS_ERR  *p_err)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OSTaskDbgListPtr = DEF_NULL;
 #endif
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+    OSTaskStkScanTCBPtr = DEF_NULL;
+#endif
 
     OSTaskQty        = 0u;                                      /* Clear the number of tasks                            */
 
@@ -2441,6 +2553,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
     OS_TLS_ID   id;
 #endif
+#if ((OS_CFG_STAT_CYCLES_EN == DEF_ENABLED) || (OS_CFG_RWLOCK_EN == DEF_ENABLED))
+    CPU_INT08U  i;
+#endif
 
 
     p_tcb->StkPtr             = DEF_NULL;
@@ -2494,11 +2609,21 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->FlagsPend          = 0u;
     p_tcb->FlagsOpt           = 0u;
     p_tcb->FlagsRdy           = 0u;
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    p_tcb->FlagPendDataTblPtr     = DEF_NULL;
+    p_tcb->FlagPendDataTblEntries = 0u;
+#endif
 #endif
 
 #if (OS_CFG_MON_EN == DEF_ENABLED)
      p_tcb->MonData.p_eval_data = DEF_NULL;
      p_tcb->MonData.p_on_eval   = DEF_NULL;
+#if (OS_CFG_MON_KEY_EN == DEF_ENABLED)
+     p_tcb->MonData.p_key_mon   = DEF_NULL;
+     p_tcb->MonData.p_key_next  = DEF_NULL;
+     p_tcb->MonData.p_key_prev  = DEF_NULL;
+     p_tcb->MonData.key         = 0u;
+#endif
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -2532,6 +2657,10 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->StkFree            = 0u;
     p_tcb->StkUsed            = 0u;
 #endif
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+    p_tcb->StkScanPtr         = DEF_NULL;
+    p_tcb->StkUsedMax         = 0u;
+#endif
 
     p_tcb->Opt                = 0u;
 
@@ -2543,6 +2672,39 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
     p_tcb->TimeQuanta         = 0u;
     p_tcb->TimeQuantaCtr      = 0u;
+#if (OS_CFG_SCHED_ROUND_ROBIN_US_EN == DEF_ENABLED)
+    p_tcb->TimeQuantaCycles        = 0u;
+    p_tcb->TimeQuantaCyclesUsed    = 0u;
+    p_tcb->TimeQuantaCyclesOverMax = 0u;
+#endif
+    p_tcb->TimeQuantaEndCtr   = 0u;
+    p_tcb->TimeQuantaYieldCtr = 0u;
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    p_tcb->EdfPeriod          = 0u;
+    p_tcb->EdfDeadlineRel     = 0u;
+    p_tcb->EdfWCET            = 0u;
+    p_tcb->EdfUtil            = 0u;
+    p_tcb->EdfRelease         = 0u;
+    p_tcb->EdfDeadline        = 0u;
+    p_tcb->EdfJobCtr          = 0u;
+    p_tcb->EdfMissCtr         = 0u;
+    p_tcb->EdfLatenessMax     = 0u;
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    p_tcb->BudgetNextPtr      = DEF_NULL;
+    p_tcb->BudgetPeriod       = 0u;
+    p_tcb->Budget             = 0u;
+    p_tcb->BudgetUsed         = 0u;
+    p_tcb->BudgetRemain       = 0u;
+    p_tcb->BudgetUsedMax      = 0u;
+    p_tcb->BudgetOverrunCtr   = 0u;
+    p_tcb->BudgetOpt          = OS_OPT_BUDGET_DEMOTE;
+    p_tcb->BudgetPrio         = 0u;
+    p_tcb->BudgetPrioSave     = 0u;
+    p_tcb->BudgetThrottled    = DEF_FALSE;
 #endif
 
 #if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)
@@ -2556,6 +2718,19 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->CyclesStart        = 0u;
 #endif
     p_tcb->CyclesTotal        = 0u;
+    p_tcb->CyclesTotalPrev    = 0u;
+#endif
+
+#if (OS_CFG_STAT_CYCLES_EN == DEF_ENABLED)
+    p_tcb->StatTS             = p_tcb->CyclesStart + OSStatSleepTS;
+    p_tcb->StatTickCtr        = OSTickCtr;
+    for (i = 0u; i < OS_STAT_EMA_NBR; i++) {
+        p_tcb->CPUUsageEMA[i] = 0u;
+    }
+#endif
+
+#if (OS_CFG_PROF_EN == DEF_ENABLED)
+    p_tcb->CtxSwCtrPrev       = 0u;
 #endif
 
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
@@ -2577,6 +2752,14 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->BasePrio           = OS_PRIO_INIT;
     p_tcb->MutexGrpHeadPtr    = DEF_NULL;
 #endif
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+    p_tcb->RWLockGrpHeadPtr   = DEF_NULL;
+    p_tcb->RWLockPendOpt      = OS_OPT_NONE;
+    for (i = 0u; i < OS_CFG_RWLOCK_READ_MAX; i++) {
+        p_tcb->RWLockReadTbl[i].RWLockPtr = DEF_NULL;
+        p_tcb->RWLockReadTbl[i].NextPtr   = DEF_NULL;
+    }
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     p_tcb->DbgPrevPtr         = DEF_NULL;
@@ -2622,6 +2805,116 @@ void  OS_TaskReturn (void)
 }
 
 
+/*
+************************************************************************************************************************
+*                                          SCAN THE STACKS FOR THE HIGH-WATER MARK
+*
+* Description: This function is called by the idle task to track the deepest use of every task stack.  Each call
+*              examines at most OS_CFG_TASK_STK_SCAN_CHUNK stack elements of one task, starting where the previous call
+*              stopped, and moves to the next task of the debug list when the first used element has been found.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) Only the stacks created with OS_OPT_TASK_STK_CHK (and thus cleared) are scanned.  The scan stops at
+*                 the known high-water mark 'StkUsedMax' so a pass over a stack that did not grow is short.
+*
+*              3) Interrupts are disabled for the duration of one chunk only.  A task that runs between two chunks may
+*                 use elements already found to be zero; this deeper use is found on the next pass over its stack.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_SCAN_EN == DEF_ENABLED)
+void  OS_TaskStkScan (void)
+{
+    OS_TCB        *p_tcb;
+    CPU_STK       *p_stk;
+    CPU_STK       *p_end;
+    CPU_STK_SIZE   ctr;
+    CPU_BOOLEAN    done;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTaskStkScanTCBPtr;
+    if (p_tcb == DEF_NULL) {                                    /* Start a new pass at the head of the debug list       */
+        p_tcb = OSTaskDbgListPtr;
+        if (p_tcb == DEF_NULL) {
+            CPU_CRITICAL_EXIT();
+            return;
+        }
+        OSTaskStkScanTCBPtr = p_tcb;
+    }
+
+    if (((p_tcb->Opt & OS_OPT_TASK_STK_CHK) == 0u) ||           /* See Note #2.                                         */
+         (p_tcb->StkBasePtr == DEF_NULL)) {
+        OSTaskStkScanTCBPtr = p_tcb->DbgNextPtr;
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    ctr   = OS_CFG_TASK_STK_SCAN_CHUNK;
+    p_stk = p_tcb->StkScanPtr;
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+    if (p_stk == DEF_NULL) {                                    /* Start at the lowest memory and go up                 */
+        p_stk = p_tcb->StkBasePtr;
+#if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
+        p_stk += OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+    }
+    p_end = p_tcb->StkBasePtr + (p_tcb->StkSize - p_tcb->StkUsedMax);
+    while ((ctr       >   0u) &&                                /* Stop at the elements known to be used                */
+           (p_stk     < p_end) &&
+           (*p_stk   == 0u)) {
+        p_stk++;
+        ctr--;
+    }
+    if (p_stk >= p_end) {                                       /* Reached the known high-water mark                    */
+        done = DEF_YES;
+    } else if (*p_stk != 0u) {                                  /* Found a new high-water mark                          */
+        p_tcb->StkUsedMax = (CPU_STK_SIZE)((p_tcb->StkBasePtr + p_tcb->StkSize) - p_stk);
+        done = DEF_YES;
+    } else {                                                    /* Chunk exhausted: resume here on the next call        */
+        done = DEF_NO;
+    }
+#else
+    if (p_stk == DEF_NULL) {                                    /* Start at the highest memory and go down              */
+        p_stk = p_tcb->StkBasePtr + p_tcb->StkSize - 1u;
+#if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
+        p_stk -= OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+    }
+    p_end = p_tcb->StkBasePtr + p_tcb->StkUsedMax;
+    while ((ctr       >   0u) &&                                /* Stop at the elements known to be used                */
+           (p_stk    >= p_end) &&
+           (*p_stk   == 0u)) {
+        p_stk--;
+        ctr--;
+    }
+    if (p_stk < p_end) {                                        /* Reached the known high-water mark                    */
+        done = DEF_YES;
+    } else if (*p_stk != 0u) {                                  /* Found a new high-water mark                          */
+        p_tcb->StkUsedMax = (CPU_STK_SIZE)(p_stk - p_tcb->StkBasePtr) + 1u;
+        done = DEF_YES;
+    } else {                                                    /* Chunk exhausted: resume here on the next call        */
+        done = DEF_NO;
+    }
+#endif
+
+    if (done == DEF_YES) {                                      /* Done with this stack, move to the next task          */
+        p_tcb->StkScanPtr   = DEF_NULL;
+        OSTaskStkScanTCBPtr = p_tcb->DbgNextPtr;
+    } else {
+        p_tcb->StkScanPtr   = p_stk;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                          CHECK THE STACK REDZONE OF A TASK
@@ -2799,6 +3092,33 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
 #endif
                           break;
 
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+                     case OS_TASK_PEND_ON_RWLOCK:
+                          OS_PendListChangePrio(p_tcb);
+                          p_tcb_owner = ((OS_RWLOCK *)((void *)p_tcb->PendObjPtr))->WriterTCBPtr;
+                          if (p_tcb_owner == DEF_NULL) {        /* Read locked, readers do not inherit                  */
+                              break;
+                          }
+                          if (prio_cur > prio_new) {            /* Are we increasing the priority?                      */
+                              if (p_tcb_owner->Prio <= prio_new) { /* Yes, do we need to give this prio to the writer?  */
+                                  p_tcb_owner = DEF_NULL;
+                              } else {
+                                 OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb_owner, prio_new);
+                              }
+                          } else if (p_tcb_owner->Prio == prio_cur) { /* No, is it required to check for a lower prio?  */
+                              prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                              prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                              if (prio_new == p_tcb_owner->Prio) {
+                                  p_tcb_owner = DEF_NULL;
+                              } else {
+                                 OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, prio_new);
+                              }
+                          } else {
+                              p_tcb_owner = DEF_NULL;
+                          }
+                          break;
+#endif
+
                      case OS_TASK_PEND_ON_TASK_Q:
                      case OS_TASK_PEND_ON_TASK_SEM:
                      default:
@@ -112,6 +112,10 @@ void  OS_TickTask (void  *p_arg)
             (void)OS_TickListUpdateTimeout(tick_step);
 #endif
 
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+            OS_BudgetUpdate(tick_step);                         /* Replenish and enforce the CPU budgets                */
+#endif
+
 #if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
             tick_step_dly = (OS_TICK)-1;
             tick_step_timeout = (OS_TICK)-1;
@@ -581,6 +585,9 @@ static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK  ticks)
     OS_TCB       *p_tcb_owner;
     OS_PRIO       prio_new;
 #endif
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+    OS_RWLOCK    *p_rwlock;
+#endif
 
                                                                 /*  ======= UPDATE TASKS WAITING WITH TIMEOUT ========  */
 #if (OS_CFG_TS_EN == DEF_ENABLED)
@@ -610,6 +617,12 @@ static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK  ticks)
                 p_tcb_owner = (OS_TCB *)((OS_MUTEX *)p_tcb->PendObjPtr)->OwnerTCBPtr;
             }
 #endif
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+            p_rwlock = (OS_RWLOCK *)DEF_NULL;
+            if (p_tcb->PendOn == OS_TASK_PEND_ON_RWLOCK) {
+                p_rwlock = (OS_RWLOCK *)((void *)p_tcb->PendObjPtr);
+            }
+#endif
 
 #if (OS_MSG_EN == DEF_ENABLED)
             p_tcb->MsgPtr  = DEF_NULL;
@@ -644,6 +657,11 @@ static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK  ticks)
                 }
             }
 #endif
+#if (OS_CFG_RWLOCK_EN == DEF_ENABLED)
+            if (p_rwlock != DEF_NULL) {                         /* Readers granted here leave the list after 'p_tcb'    */
+                OS_RWLockPendRemoved(p_rwlock, p_tcb->Prio);
+            }
+#endif
 
             p_list->TCB_Ptr = p_tcb->TickNextPtr;
             p_tcb           = p_list->TCB_Ptr;                  /* Get 'p_tcb' again for loop                           */
@@ -590,6 +590,10 @@ void  OSTimeTick (void)
     OS_SchedRoundRobin(&OSRdyList[OSPrioCur]);
 #endif
 
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    OS_BudgetCharge();                                          /* Charge the tick to the interrupted task              */
+#endif
+
 #if (OS_CFG_TMR_EN == DEF_ENABLED)
     OSTmrUpdateCtr--;
     if (OSTmrUpdateCtr == 0u) {
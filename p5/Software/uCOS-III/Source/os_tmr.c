@@ -111,6 +111,11 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
                    void                 *p_callback_arg,
                    OS_ERR               *p_err)
 {
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    CPU_INT32U  name_hash;
+#endif
+
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == DEF_NULL) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -164,6 +169,9 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
     }
 #endif
 
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    name_hash = OS_ObjRegHash(p_name);                          /* Hash the name with interrupts enabled                */
+#endif
     if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only lock when the kernel is running                 */
         OS_TmrLock();
     }
@@ -189,6 +197,9 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_TmrDbgListAdd(p_tmr);
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    p_tmr->Handle = OS_ObjRegAdd((void *)p_tmr, OS_OBJ_TYPE_TMR, p_name, name_hash);
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OSTmrQty++;                                                 /* Keep track of the number of timers created           */
 #endif
@@ -283,6 +294,9 @@ CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_TmrDbgListRemove(p_tmr);
 #endif
+#if (OS_CFG_OBJ_REG_EN == DEF_ENABLED)
+    OS_ObjRegRemove(p_tmr->Handle);
+#endif
 
     switch (p_tmr->State) {
         case OS_TMR_STATE_RUNNING:
@@ -213,6 +213,34 @@
 #define  OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb, prio)
 #endif
 
+#ifndef  OS_TRACE_RWLOCK_CREATE
+#define  OS_TRACE_RWLOCK_CREATE(p_rwlock, p_name)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_DEL
+#define  OS_TRACE_RWLOCK_DEL(p_rwlock)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_POST
+#define  OS_TRACE_RWLOCK_POST(p_rwlock)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_POST_FAILED
+#define  OS_TRACE_RWLOCK_POST_FAILED(p_rwlock)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_PEND
+#define  OS_TRACE_RWLOCK_PEND(p_rwlock, opt)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_PEND_FAILED
+#define  OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_PEND_BLOCK
+#define  OS_TRACE_RWLOCK_PEND_BLOCK(p_rwlock, opt)
+#endif
+
 #ifndef  OS_TRACE_SEM_CREATE
 #define  OS_TRACE_SEM_CREATE(p_sem, p_name)
 #endif
@@ -55,6 +55,8 @@ typedef   CPU_INT32U      OS_CTX_SW_CTR;               /* Counter of context swi
 
 typedef   CPU_INT32U      OS_CYCLES;                   /* CPU clock cycles,                                   <32>/64 */
 
+typedef   CPU_INT32U      OS_EDF_UTIL;                 /* EDF utilization, OS_EDF_UTIL_ONE is all of the CPU,      32 */
+
 typedef   CPU_INT32U      OS_FLAGS;                    /* Event flags,                                      8/16/<32> */
 
 typedef   CPU_INT32U      OS_IDLE_CTR;                 /* Holds the number of times the idle task runs,       <32>/64 */
@@ -67,12 +69,15 @@ typedef   CPU_INT16U      OS_MSG_SIZE;                 /* Size of messages in nu
 
 typedef   CPU_INT08U      OS_NESTING_CTR;              /* Interrupt and scheduler nesting,                  <8>/16/32 */
 
+typedef   CPU_INT16U      OS_OBJ_HANDLE;               /* Kernel object handle, generation and slot index,         16 */
 typedef   CPU_INT16U      OS_OBJ_QTY;                  /* Number of kernel objects counter,                   <16>/32 */
 typedef   CPU_INT32U      OS_OBJ_TYPE;                 /* Special flag to determine object type,                   32 */
 
 typedef   CPU_INT16U      OS_OPT;                      /* Holds function options,                             <16>/32 */
 
 typedef   CPU_INT32U      OS_MON_RES;                  /* Monitor result flags,                                       */
+typedef   CPU_INT08U      OS_MON_KEY;                  /* Monitor condition key,                              <8>/16/32 */
+typedef   CPU_INT32U      OS_MON_KEYS;                 /* Set of monitor condition keys, one bit per key,             */
 
 typedef   CPU_INT08U      OS_PRIO;                     /* Priority of a task,                               <8>/16/32 */
 
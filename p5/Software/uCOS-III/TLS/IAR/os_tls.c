@@ -0,0 +1,663 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                   THREAD LOCAL STORAGE (TLS) MANAGEMENT - IAR DLIB
+*
+* File    : OS_TLS.C
+* By      : JJL
+* Version : V3.06.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at https://doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+/*
+************************************************************************************************************************
+* Note(s) : (1) Each task has OS_CFG_TLS_TBL_SIZE TLS registers in its OS_TCB.  An application gets an ID with
+*               OS_TLS_GetID() and reads or writes the register of that ID of any task with OS_TLS_GetValue() and
+*               OS_TLS_SetValue().  A destructor given with OS_TLS_SetDestruct() is called for each task deleted with a
+*               non-NULL value in the register.
+*
+*           (2) The first ID is taken by OS_TLS_Init() for the per-thread data of the IAR DLib: 'errno', the state
+*               of strtok(), rand(), the multibyte conversions, the locale, ...  The library must be configured for
+*               thread support ('Enable thread support in library', i.e. the linker option '--threaded_lib').  Each
+*               task created without OS_OPT_TASK_NO_TLS then gets its own copy of this data and the formatting and
+*               conversion functions run without any lock.
+*
+*           (3) The copies come from a pool of OS_CFG_TLS_LIB_TASK_MAX blocks of OS_CFG_TLS_LIB_SIZE bytes, not from
+*               the heap : OS_TLS_TaskDel() runs in a critical section and can't call free().  A task created once the
+*               pool is empty uses the data of main(), shared with the other such tasks, and is counted in
+*               'OS_TLS_LibPoolEmptyCtr'.  OS_TLS_Init() fails when the data of the library doesn't fit a block.
+*
+*           (4) The library still locks the heap and the FILE streams.  Its locks are mutexes taken from a pool of
+*               OS_TLS_LOCK_MAX, created by OS_TLS_Init().  They are not taken before OSStart() nor from an ISR.
+*
+*           (5) OS_TLS_TaskDel() is called with interrupts disabled : the destructors must be short and must not
+*               block.  The C++ 'thread_local' destructors are not called.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+#include <stdio.h>
+#include <DLib_Threads.h>
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_tls__c = "$Id: $";
+#endif
+
+
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+/*
+************************************************************************************************************************
+*                                                   DEFAULT CONFIGURATION
+************************************************************************************************************************
+*/
+
+#ifndef  OS_CFG_TLS_LIB_TASK_MAX
+#define  OS_CFG_TLS_LIB_TASK_MAX             8u                 /* Tasks with their own copy of the library data        */
+#endif
+
+#ifndef  OS_CFG_TLS_LIB_SIZE
+#define  OS_CFG_TLS_LIB_SIZE               256u                 /* Size of a copy, in bytes                             */
+#endif
+
+#if (OS_CFG_MUTEX_EN != DEF_ENABLED)
+#error  "os_cfg.h, OS_CFG_MUTEX_EN must be DEF_ENABLED for the library locks of the IAR TLS (see os_tls.c)"
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                       DEFINES
+************************************************************************************************************************
+*/
+
+#if (__VER__ >= 8000000)                                        /* EWARM V8: ARM EABI thread pointer                    */
+#define  OS_TLS_LIB_SIZE_GET()              __iar_tls_size()
+#define  OS_TLS_LIB_DATA_INIT(p_data)       __iar_tls_init(p_data)
+#else                                                           /* EWARM V7: DLib per-thread segment                    */
+#define  OS_TLS_LIB_SIZE_GET()              __IAR_DLIB_PERTHREAD_SIZE
+#define  OS_TLS_LIB_DATA_INIT(p_data)       __iar_dlib_perthread_initialize(p_data)
+#endif
+
+#if (_DLIB_FILE_DESCRIPTOR > 0) && (_FILE_OP_LOCKS > 0)
+#define  OS_TLS_LOCK_MAX                  ((_MAX_LOCK) + (FOPEN_MAX))
+#else
+#define  OS_TLS_LOCK_MAX                   (_MAX_LOCK)
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                      DATA TYPES
+************************************************************************************************************************
+*/
+
+typedef  struct  os_tls_lock  OS_TLS_LOCK;
+
+struct  os_tls_lock {
+    OS_MUTEX             Mutex;
+    OS_TLS_LOCK         *NextPtr;                               /* Next free lock                                       */
+};
+
+typedef  union  os_tls_lib_blk  OS_TLS_LIB_BLK;
+
+union  os_tls_lib_blk {
+    CPU_INT64U           Data[(OS_CFG_TLS_LIB_SIZE + 7u) / 8u]; /* Aligned for any member of the library data          */
+    OS_TLS_LIB_BLK      *NextPtr;                               /* Next free block                                      */
+};
+
+
+/*
+************************************************************************************************************************
+*                                                    LOCAL VARIABLES
+************************************************************************************************************************
+*/
+
+static  OS_TLS_ID             OS_TLS_NextAvailID;               /* Next available TLS ID                                */
+static  OS_TLS_DESTRUCT_PTR   OS_TLS_DestructPtrTbl[OS_CFG_TLS_TBL_SIZE];
+
+static  OS_TLS_ID             OS_TLS_LibID;                     /* ID of the library data, see Note #2                  */
+static  OS_TLS_LIB_BLK        OS_TLS_LibPool[OS_CFG_TLS_LIB_TASK_MAX];
+static  OS_TLS_LIB_BLK       *OS_TLS_LibPoolFreePtr;
+        CPU_INT16U            OS_TLS_LibPoolEmptyCtr;           /* Tasks sharing the data of main(), see Note #3        */
+
+static  OS_TLS_LOCK           OS_TLS_LockTbl[OS_TLS_LOCK_MAX];
+static  OS_TLS_LOCK          *OS_TLS_LockFreePtr;
+static  CPU_INT16U            OS_TLS_LockNbrUsed;               /* Locks never given so far                             */
+
+
+/*
+************************************************************************************************************************
+*                                                   GET THE NEXT TLS ID
+*
+* Description: This function is called by the application to obtain a TLS ID.  The IDs can't be given back.
+*
+* Arguments  : p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                   A TLS ID is returned
+*                               OS_ERR_TLS_NO_MORE_AVAIL      All OS_CFG_TLS_TBL_SIZE IDs are taken
+*
+* Returns    : The next available TLS ID or OS_CFG_TLS_TBL_SIZE if none is available
+************************************************************************************************************************
+*/
+
+OS_TLS_ID  OS_TLS_GetID (OS_ERR  *p_err)
+{
+    OS_TLS_ID  id;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_TLS_ID)OS_CFG_TLS_TBL_SIZE);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OS_TLS_NextAvailID >= OS_CFG_TLS_TBL_SIZE) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TLS_NO_MORE_AVAIL;
+        return ((OS_TLS_ID)OS_CFG_TLS_TBL_SIZE);
+    }
+    id = OS_TLS_NextAvailID;
+    OS_TLS_NextAvailID++;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (id);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                READ THE TLS REGISTER OF A TASK
+*
+* Description: This function returns the value of a TLS register of a task.
+*
+* Arguments  : p_tcb        is a pointer to the task's OS_TCB.  A NULL pointer specifies the calling task.
+*
+*              id           is the ID of the TLS register, from OS_TLS_GetID().
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                   The value is returned
+*                               OS_ERR_OS_NOT_RUNNING         'p_tcb' is NULL and uC/OS-III is not running yet
+*                               OS_ERR_TLS_ID_INVALID         'id' was not given by OS_TLS_GetID()
+*
+* Returns    : The value of the register, NULL on error
+************************************************************************************************************************
+*/
+
+OS_TLS  OS_TLS_GetValue (OS_TCB     *p_tcb,
+                         OS_TLS_ID   id,
+                         OS_ERR     *p_err)
+{
+    OS_TLS  value;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_TLS)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (id >= OS_TLS_NextAvailID) {
+       *p_err = OS_ERR_TLS_ID_INVALID;
+        return ((OS_TLS)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == DEF_NULL) {
+        if (OSRunning != OS_STATE_OS_RUNNING) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_OS_NOT_RUNNING;
+            return ((OS_TLS)0);
+        }
+        p_tcb = OSTCBCurPtr;
+    }
+    value = p_tcb->TLS_Tbl[id];
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (value);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                INITIALIZE THE TLS MANAGEMENT
+*
+* Description: This function is called by OSInit() to initialize the TLS IDs, the library data pool and the library
+*              locks.
+*
+* Arguments  : p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                   The TLS management is initialized
+*                               OS_ERR_TLS_NOT_EN             The library data is larger than OS_CFG_TLS_LIB_SIZE
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_Init (OS_ERR  *p_err)
+{
+    OS_TLS_ID        id;
+    CPU_INT16U       i;
+    OS_TLS_LIB_BLK  *p_blk;
+
+
+    OS_TLS_NextAvailID = 0u;
+    for (id = 0u; id < OS_CFG_TLS_TBL_SIZE; id++) {
+        OS_TLS_DestructPtrTbl[id] = (OS_TLS_DESTRUCT_PTR)0;
+    }
+    OS_TLS_LibID = OS_TLS_GetID(p_err);                         /* See Note #2                                          */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    if (OS_TLS_LIB_SIZE_GET() > sizeof(OS_TLS_LIB_BLK)) {       /* See Note #3                                          */
+       *p_err = OS_ERR_TLS_NOT_EN;
+        return;
+    }
+    p_blk = DEF_NULL;
+    for (i = OS_CFG_TLS_LIB_TASK_MAX; i > 0u; i--) {
+        OS_TLS_LibPool[i - 1u].NextPtr = p_blk;
+        p_blk                          = &OS_TLS_LibPool[i - 1u];
+    }
+    OS_TLS_LibPoolFreePtr  = p_blk;
+    OS_TLS_LibPoolEmptyCtr = 0u;
+
+    for (i = 0u; i < OS_TLS_LOCK_MAX; i++) {                    /* See Note #4                                          */
+        OSMutexCreate(&OS_TLS_LockTbl[i].Mutex,
+                      (CPU_CHAR *)"DLib Lock",
+                      p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                               WRITE THE TLS REGISTER OF A TASK
+*
+* Description: This function sets the value of a TLS register of a task.
+*
+* Arguments  : p_tcb        is a pointer to the task's OS_TCB.  A NULL pointer specifies the calling task.
+*
+*              id           is the ID of the TLS register, from OS_TLS_GetID().
+*
+*              value        is the value to write.
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                   The value is written
+*                               OS_ERR_OS_NOT_RUNNING         'p_tcb' is NULL and uC/OS-III is not running yet
+*                               OS_ERR_TLS_ID_INVALID         'id' was not given by OS_TLS_GetID() or is the ID of the
+*                                                             library data
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OS_TLS_SetValue (OS_TCB     *p_tcb,
+                       OS_TLS_ID   id,
+                       OS_TLS      value,
+                       OS_ERR     *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if ((id >= OS_TLS_NextAvailID) ||
+        (id == OS_TLS_LibID)) {                                 /* The library data belongs to the pool                 */
+       *p_err = OS_ERR_TLS_ID_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == DEF_NULL) {
+        if (OSRunning != OS_STATE_OS_RUNNING) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_OS_NOT_RUNNING;
+            return;
+        }
+        p_tcb = OSTCBCurPtr;
+    }
+    p_tcb->TLS_Tbl[id] = value;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            ASSIGN THE DESTRUCTOR OF A TLS ID
+*
+* Description: This function assigns the function called for each task deleted with a non-NULL value in the TLS
+*              register 'id', see Note #5 at the top.
+*
+* Arguments  : id           is the ID of the TLS register, from OS_TLS_GetID().
+*
+*              p_destruct   is a pointer to the destructor.
+*
+*              p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                               OS_ERR_NONE                   The destructor is assigned
+*                               OS_ERR_TLS_DESTRUCT_ASSIGNED  'id' already has a destructor
+*                               OS_ERR_TLS_ID_INVALID         'id' was not given by OS_TLS_GetID() or is the ID of the
+*                                                             library data
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OS_TLS_SetDestruct (OS_TLS_ID             id,
+                          OS_TLS_DESTRUCT_PTR   p_destruct,
+                          OS_ERR               *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == DEF_NULL) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    if ((id >= OS_TLS_NextAvailID) ||
+        (id == OS_TLS_LibID)) {
+       *p_err = OS_ERR_TLS_ID_INVALID;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (OS_TLS_DestructPtrTbl[id] != (OS_TLS_DESTRUCT_PTR)0) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TLS_DESTRUCT_ASSIGNED;
+        return;
+    }
+    OS_TLS_DestructPtrTbl[id] = p_destruct;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  TASK CREATE HOOK
+*
+* Description: This function is called by OSTaskCreate() to give the task its copy of the library data.
+*
+* Arguments  : p_tcb        is a pointer to the OS_TCB of the task being created.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_TaskCreate (OS_TCB  *p_tcb)
+{
+    OS_TLS_LIB_BLK  *p_blk;
+    CPU_SR_ALLOC();
+
+
+    if ((p_tcb->Opt & OS_OPT_TASK_NO_TLS) != OS_OPT_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_blk = OS_TLS_LibPoolFreePtr;
+    if (p_blk == DEF_NULL) {                                    /* See Note #3                                          */
+        OS_TLS_LibPoolEmptyCtr++;
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+    OS_TLS_LibPoolFreePtr = p_blk->NextPtr;
+    CPU_CRITICAL_EXIT();
+
+    OS_TLS_LIB_DATA_INIT((void *)p_blk);                        /* Copy the initial values of the library data          */
+    p_tcb->TLS_Tbl[OS_TLS_LibID] = (OS_TLS)p_blk;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  TASK DELETE HOOK
+*
+* Description: This function is called by OSTaskDel() to call the destructors of the task's TLS registers and to give
+*              back its copy of the library data.
+*
+* Arguments  : p_tcb        is a pointer to the OS_TCB of the task being deleted.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Interrupts are disabled when this function is called, see Note #5 at the top.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_TaskDel (OS_TCB  *p_tcb)
+{
+    OS_TLS_ID        id;
+    OS_TLS_LIB_BLK  *p_blk;
+
+
+    for (id = 0u; id < OS_TLS_NextAvailID; id++) {
+        if ((OS_TLS_DestructPtrTbl[id] != (OS_TLS_DESTRUCT_PTR)0) &&
+            (p_tcb->TLS_Tbl[id]        != (OS_TLS)0)) {
+            (*OS_TLS_DestructPtrTbl[id])(p_tcb, id, p_tcb->TLS_Tbl[id]);
+            p_tcb->TLS_Tbl[id] = (OS_TLS)0;
+        }
+    }
+
+    p_blk = (OS_TLS_LIB_BLK *)p_tcb->TLS_Tbl[OS_TLS_LibID];
+    if (p_blk != DEF_NULL) {
+        p_blk->NextPtr                = OS_TLS_LibPoolFreePtr;
+        OS_TLS_LibPoolFreePtr         = p_blk;
+        p_tcb->TLS_Tbl[OS_TLS_LibID] = (OS_TLS)0;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  TASK SWITCH HOOK
+*
+* Description: This function is called by the scheduler before a context switch.  The library finds the data of the
+*              running task through OSTCBCurPtr, there is nothing to switch.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_TaskSw (void)
+{
+}
+
+
+/*
+************************************************************************************************************************
+*                                              LIBRARY PER-THREAD DATA ACCESS
+*
+* Description: These functions are called by the IAR DLib to find the data of the running task.  Before OSStart(), in
+*              an ISR and in the tasks without a copy, the data of main() is used.
+************************************************************************************************************************
+*/
+
+#if (__VER__ >= 8000000)
+void  *__aeabi_read_tp (void)
+{
+    void  *p_data;
+
+
+    p_data = DEF_NULL;
+    if ((OSRunning       == OS_STATE_OS_RUNNING) &&
+        (OSIntNestingCtr == 0u)) {
+        p_data = OSTCBCurPtr->TLS_Tbl[OS_TLS_LibID];
+    }
+    if (p_data == DEF_NULL) {
+        p_data = __section_begin("__iar_tls$$DATA");
+    }
+    return (p_data);
+}
+#else
+void _DLIB_TLS_MEMORY  *__iar_dlib_perthread_access (void _DLIB_TLS_MEMORY  *symbp)
+{
+    CPU_INT08U  *p_data;
+
+
+    p_data = DEF_NULL;
+    if ((OSRunning       == OS_STATE_OS_RUNNING) &&
+        (OSIntNestingCtr == 0u)) {
+        p_data = (CPU_INT08U *)OSTCBCurPtr->TLS_Tbl[OS_TLS_LibID];
+    }
+    if (p_data == DEF_NULL) {
+        return (symbp);                                         /* The symbol itself is the instance of main()          */
+    }
+    return ((void _DLIB_TLS_MEMORY *)(p_data + __IAR_DLIB_PERTHREAD_SYMBOL_OFFSET(symbp)));
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                     LIBRARY LOCKS
+*
+* Description: These functions are called by the IAR DLib to create, delete, take and release the locks of the heap
+*              (system locks) and of the FILE streams (file locks), see Note #4 at the top.
+************************************************************************************************************************
+*/
+
+static  void  OS_TLS_LockInit (__iar_Rmtx  *p_lock)
+{
+    OS_TLS_LOCK  *p_tls_lock;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_tls_lock = OS_TLS_LockFreePtr;
+    if (p_tls_lock != DEF_NULL) {
+        OS_TLS_LockFreePtr = p_tls_lock->NextPtr;
+    } else if (OS_TLS_LockNbrUsed < OS_TLS_LOCK_MAX) {          /* May be called before OSInit()                        */
+        p_tls_lock = &OS_TLS_LockTbl[OS_TLS_LockNbrUsed];
+        OS_TLS_LockNbrUsed++;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_lock = (__iar_Rmtx)p_tls_lock;
+}
+
+
+static  void  OS_TLS_LockDel (__iar_Rmtx  *p_lock)
+{
+    OS_TLS_LOCK  *p_tls_lock;
+    CPU_SR_ALLOC();
+
+
+    p_tls_lock = (OS_TLS_LOCK *)*p_lock;
+    if (p_tls_lock == DEF_NULL) {
+        return;
+    }
+    CPU_CRITICAL_ENTER();
+    p_tls_lock->NextPtr = OS_TLS_LockFreePtr;
+    OS_TLS_LockFreePtr  = p_tls_lock;
+    CPU_CRITICAL_EXIT();
+   *p_lock = (__iar_Rmtx)0;
+}
+
+
+static  void  OS_TLS_LockPend (__iar_Rmtx  *p_lock)
+{
+    OS_TLS_LOCK  *p_tls_lock;
+    OS_ERR        err;
+
+
+    p_tls_lock = (OS_TLS_LOCK *)*p_lock;
+    if ((p_tls_lock      == DEF_NULL)            ||
+        (OSRunning       != OS_STATE_OS_RUNNING) ||
+        (OSIntNestingCtr >  0u)) {
+        return;
+    }
+    OSMutexPend(&p_tls_lock->Mutex,                             /* Nested by the same task, e.g. printf() and malloc()  */
+                 0u,
+                 OS_OPT_PEND_BLOCKING,
+                 DEF_NULL,
+                &err);
+}
+
+
+static  void  OS_TLS_LockPost (__iar_Rmtx  *p_lock)
+{
+    OS_TLS_LOCK  *p_tls_lock;
+    OS_ERR        err;
+
+
+    p_tls_lock = (OS_TLS_LOCK *)*p_lock;
+    if ((p_tls_lock      == DEF_NULL)            ||
+        (OSRunning       != OS_STATE_OS_RUNNING) ||
+        (OSIntNestingCtr >  0u)) {
+        return;
+    }
+    OSMutexPost(&p_tls_lock->Mutex,
+                 OS_OPT_POST_NONE,
+                &err);
+}
+
+
+void  __iar_system_Mtxinit   (__iar_Rmtx  *p_lock) { OS_TLS_LockInit(p_lock); }
+void  __iar_system_Mtxdst    (__iar_Rmtx  *p_lock) { OS_TLS_LockDel(p_lock);  }
+void  __iar_system_Mtxlock   (__iar_Rmtx  *p_lock) { OS_TLS_LockPend(p_lock); }
+void  __iar_system_Mtxunlock (__iar_Rmtx  *p_lock) { OS_TLS_LockPost(p_lock); }
+
+#if (_DLIB_FILE_DESCRIPTOR > 0) && (_FILE_OP_LOCKS > 0)
+void  __iar_file_Mtxinit     (__iar_Rmtx  *p_lock) { OS_TLS_LockInit(p_lock); }
+void  __iar_file_Mtxdst      (__iar_Rmtx  *p_lock) { OS_TLS_LockDel(p_lock);  }
+void  __iar_file_Mtxlock     (__iar_Rmtx  *p_lock) { OS_TLS_LockPend(p_lock); }
+void  __iar_file_Mtxunlock   (__iar_Rmtx  *p_lock) { OS_TLS_LockPost(p_lock); }
+#endif
+
+#endif
@@ -0,0 +1,423 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                  RING BUFFER TRACE TO CHROME TRACE EVENT CONVERTER
+*
+* File    : OS_TRACE_JSON.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This file is a HOST tool, it is NOT part of the target build.  Build it with any C99 compiler:
+*
+*                   cc -std=c99 -O2 -o os_trace_json os_trace_json.c
+*
+*           (2) Usage:
+*
+*                   os_trace_json <ring.bin> [<trace.json>]
+*
+*               where 'ring.bin' is either the output of OS_TraceRingDump() or a raw memory dump of the 'OSTraceRing'
+*               symbol taken with the debugger.  The result can be opened with chrome://tracing or ui.perfetto.dev.
+*
+*           (3) Each task is shown as a thread whose slices are the intervals during which the task was running.  ISRs
+*               are shown on a separate 'ISR' thread and kernel object events are shown as instant events on the thread
+*               that was running when they occurred.
+**************************************************************************************************************************
+*/
+
+#include  <stdint.h>
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+*
+* Note(s) : (1) These values MUST match os_trace_events.h.
+**************************************************************************************************************************
+*/
+
+#define  TRACE_MAGIC                    0x5254534Fu
+#define  TRACE_VER                               1u
+#define  TRACE_HDR_SIZE                         24u
+#define  TRACE_EVT_SIZE                         12u
+
+#define  TRACE_EVT_FAILED                   0x8000u
+
+#define  TRACE_EVT_TASK_SWITCHED_IN              1u
+#define  TRACE_EVT_TASK_CREATE                   4u
+#define  TRACE_EVT_TASK_NAME                     5u
+#define  TRACE_EVT_ISR_ENTER                    32u
+#define  TRACE_EVT_ISR_EXIT                     33u
+#define  TRACE_EVT_ISR_EXIT_TO_SCHED            34u
+#define  TRACE_EVT_USER                        256u
+
+#define  TRACE_TASK_MAX                        256u
+#define  TRACE_NAME_LEN_MAX                     16u
+
+#define  TRACE_PID                               1
+#define  TRACE_TID_ISR                           0
+
+
+/*
+**************************************************************************************************************************
+*                                                     DATA TYPES
+**************************************************************************************************************************
+*/
+
+typedef  struct  trace_evt {
+    uint64_t   TS;                                              /* Unwrapped timestamp                                  */
+    uint32_t   Ix;                                              /* Position in the ring, used to keep sort stable       */
+    uint16_t   ID;
+    uint16_t   Arg;
+    uint32_t   Obj;
+} TRACE_EVT;
+
+
+typedef  struct  trace_task {
+    uint32_t   TCB;
+    char       Name[TRACE_NAME_LEN_MAX + 1u];
+} TRACE_TASK;
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL VARIABLES
+**************************************************************************************************************************
+*/
+
+static  TRACE_TASK   TaskTbl[TRACE_TASK_MAX];
+static  uint32_t     TaskNbr;
+
+
+/*
+**************************************************************************************************************************
+*                                                  LOCAL FUNCTIONS
+**************************************************************************************************************************
+*/
+
+static  uint32_t  RdU32 (const uint8_t  *p)
+{
+    return ((uint32_t)p[0]        |
+           ((uint32_t)p[1] <<  8) |
+           ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[3] << 24));
+}
+
+
+static  uint16_t  RdU16 (const uint8_t  *p)
+{
+    return ((uint16_t)(p[0] | (p[1] << 8)));
+}
+
+
+static  int  EvtCmp (const void  *p_a,
+                     const void  *p_b)
+{
+    const  TRACE_EVT  *p_evt_a = (const TRACE_EVT *)p_a;
+    const  TRACE_EVT  *p_evt_b = (const TRACE_EVT *)p_b;
+
+
+    if (p_evt_a->TS != p_evt_b->TS) {
+        return ((p_evt_a->TS < p_evt_b->TS) ? -1 : 1);
+    }
+    return ((p_evt_a->Ix < p_evt_b->Ix) ? -1 : 1);
+}
+
+
+static  int  TaskTID (uint32_t  tcb)                            /* Returns the thread ID of a task, creating it if new  */
+{
+    uint32_t  i;
+
+
+    for (i = 0u; i < TaskNbr; i++) {
+        if (TaskTbl[i].TCB == tcb) {
+            return ((int)i + 1);
+        }
+    }
+    if (TaskNbr >= TRACE_TASK_MAX) {
+        return ((int)TRACE_TASK_MAX);
+    }
+    TaskTbl[TaskNbr].TCB = tcb;
+    sprintf(TaskTbl[TaskNbr].Name, "0x%08lX", (unsigned long)tcb);
+    TaskNbr++;
+    return ((int)TaskNbr);
+}
+
+
+static  const  char  *EvtName (uint16_t  id)
+{
+    switch (id & ~TRACE_EVT_FAILED) {
+        case  2u: return ("TaskReady");
+        case  3u: return ("TaskNotReady");
+        case  4u: return ("TaskCreate");
+        case  6u: return ("TaskDel");
+        case  7u: return ("TaskDly");
+        case  8u: return ("TaskSuspend");
+        case  9u: return ("TaskResume");
+        case 10u: return ("TaskPrioChange");
+        case 11u: return ("TaskSemPost");
+        case 12u: return ("TaskSemPend");
+        case 13u: return ("TaskSemPendBlock");
+        case 14u: return ("TaskQPost");
+        case 15u: return ("TaskQPend");
+        case 16u: return ("TaskQPendBlock");
+        case 48u: return ("SemPost");
+        case 49u: return ("SemPend");
+        case 50u: return ("SemPendBlock");
+        case 51u: return ("QPost");
+        case 52u: return ("QPend");
+        case 53u: return ("QPendBlock");
+        case 54u: return ("MutexPost");
+        case 55u: return ("MutexPend");
+        case 56u: return ("MutexPendBlock");
+        case 57u: return ("MutexPrioInherit");
+        case 58u: return ("MutexPrioDisinherit");
+        case 59u: return ("FlagPost");
+        case 60u: return ("FlagPend");
+        case 61u: return ("FlagPendBlock");
+        case 62u: return ("MemGet");
+        case 63u: return ("MemPut");
+        case 64u: return ("RWLockPost");
+        case 65u: return ("RWLockPend");
+        case 66u: return ("RWLockPendBlock");
+        default:  return ((id & ~TRACE_EVT_FAILED) >= TRACE_EVT_USER ? "User" : "Unknown");
+    }
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                        MAIN
+**************************************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    FILE        *p_in;
+    FILE        *p_out;
+    uint8_t     *p_img;
+    long         img_len;
+    TRACE_EVT   *p_evt_tbl;
+    TRACE_EVT   *p_evt;
+    uint32_t     size;
+    uint32_t     wr_ix;
+    uint32_t     ts_freq;
+    uint32_t     ovrhd;
+    uint32_t     nbr_evt;
+    uint32_t     nbr_file;
+    uint32_t     first;
+    uint32_t     i;
+    uint32_t     ts_prev;
+    uint64_t     ts;
+    uint32_t     last_created;
+    int          cur_tid;
+    int          isr_depth;
+    int          tid;
+    int          sep;
+    double       us;
+
+
+    if ((argc < 2) || (argc > 3)) {
+        fprintf(stderr, "usage: %s <ring.bin> [<trace.json>]\n", argv[0]);
+        return (1);
+    }
+    p_in = fopen(argv[1], "rb");
+    if (p_in == NULL) {
+        perror(argv[1]);
+        return (1);
+    }
+    fseek(p_in, 0L, SEEK_END);
+    img_len = ftell(p_in);
+    fseek(p_in, 0L, SEEK_SET);
+    if (img_len < (long)TRACE_HDR_SIZE) {
+        fprintf(stderr, "%s: image too short\n", argv[1]);
+        return (1);
+    }
+    p_img = (uint8_t *)malloc((size_t)img_len);
+    if ((p_img == NULL) ||
+        (fread(p_img, 1u, (size_t)img_len, p_in) != (size_t)img_len)) {
+        fprintf(stderr, "%s: read error\n", argv[1]);
+        return (1);
+    }
+    fclose(p_in);
+                                                                /* ------------------ PARSE THE HEADER ---------------- */
+    if ((RdU32(&p_img[0]) != TRACE_MAGIC)    ||
+        (RdU16(&p_img[4]) != TRACE_VER)      ||
+        (RdU16(&p_img[6]) != TRACE_EVT_SIZE)) {
+        fprintf(stderr, "%s: not a uC/OS-III ring buffer trace (version %u)\n", argv[1], (unsigned)TRACE_VER);
+        return (1);
+    }
+    size    = RdU32(&p_img[ 8]);
+    wr_ix   = RdU32(&p_img[12]);
+    ts_freq = RdU32(&p_img[16]);
+    ovrhd   = RdU32(&p_img[20]);
+    if ((size == 0u) || ((size & (size - 1u)) != 0u) || (ts_freq == 0u)) {
+        fprintf(stderr, "%s: corrupted header\n", argv[1]);
+        return (1);
+    }
+
+    nbr_evt  = (wr_ix < size) ? wr_ix : size;
+    nbr_file = (uint32_t)((img_len - (long)TRACE_HDR_SIZE) / (long)TRACE_EVT_SIZE);
+    if (nbr_file < nbr_evt) {
+        fprintf(stderr, "%s: truncated, %lu of %lu events\n", argv[1], (unsigned long)nbr_file, (unsigned long)nbr_evt);
+        return (1);
+    }
+    first     = (wr_ix > size) ? (wr_ix & (size - 1u)) : 0u;   /* Oldest event when the ring has wrapped               */
+
+                                                                /* ------------- UNWRAP AND SORT THE EVENTS ----------- */
+    p_evt_tbl = (TRACE_EVT *)calloc((nbr_evt > 0u) ? nbr_evt : 1u, sizeof(TRACE_EVT));
+    if (p_evt_tbl == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return (1);
+    }
+    ts      = 0u;
+    ts_prev = 0u;
+    for (i = 0u; i < nbr_evt; i++) {
+        const  uint8_t  *p_raw = &p_img[TRACE_HDR_SIZE + ((first + i) & (size - 1u)) * TRACE_EVT_SIZE];
+        uint32_t         ts_raw = RdU32(&p_raw[0]);
+
+
+        if (i == 0u) {
+            ts  = (uint64_t)1u << 32;                           /* Leave room for events preempting the first one       */
+        } else {
+            ts += (uint64_t)(int64_t)(int32_t)(ts_raw - ts_prev);
+        }
+        ts_prev          = ts_raw;
+        p_evt            = &p_evt_tbl[i];
+        p_evt->TS        = ts;
+        p_evt->Ix        = i;
+        p_evt->ID        = RdU16(&p_raw[4]);
+        p_evt->Arg       = RdU16(&p_raw[6]);
+        p_evt->Obj       = RdU32(&p_raw[8]);
+    }
+    qsort(p_evt_tbl, nbr_evt, sizeof(TRACE_EVT), EvtCmp);
+
+                                                                /* ---------------- EMIT THE JSON FILE ---------------- */
+    p_out = stdout;
+    if (argc == 3) {
+        p_out = fopen(argv[2], "w");
+        if (p_out == NULL) {
+            perror(argv[2]);
+            return (1);
+        }
+    }
+
+    fprintf(p_out, "{\"displayTimeUnit\":\"ns\",\n"
+                   " \"otherData\":{\"ts_freq_hz\":%lu,\"ovrhd_cycles\":%lu,\"events\":%lu,\"lost\":%lu},\n"
+                   " \"traceEvents\":[\n",
+            (unsigned long)ts_freq,
+            (unsigned long)ovrhd,
+            (unsigned long)nbr_evt,
+            (unsigned long)(wr_ix - nbr_evt));
+
+    sep          = 0;
+    cur_tid      = -1;
+    isr_depth    = 0;
+    last_created = 0u;
+    for (i = 0u; i < nbr_evt; i++) {
+        uint16_t  id;
+
+
+        p_evt = &p_evt_tbl[i];
+        id    = (uint16_t)(p_evt->ID & ~TRACE_EVT_FAILED);
+        us    = (double)(p_evt->TS - p_evt_tbl[0].TS) * 1000000.0 / (double)ts_freq;
+
+        switch (id) {
+            case TRACE_EVT_TASK_SWITCHED_IN:
+                 tid = TaskTID(p_evt->Obj);
+                 if (tid == cur_tid) {
+                     break;
+                 }
+                 if (cur_tid > 0) {
+                     fprintf(p_out, "%s{\"ph\":\"E\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f}",
+                             sep ? ",\n" : "", TRACE_PID, cur_tid, us);
+                     sep = 1;
+                 }
+                 fprintf(p_out, "%s{\"ph\":\"B\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"name\":\"Running\",\"args\":{\"prio\":%u}}",
+                         sep ? ",\n" : "", TRACE_PID, tid, us, (unsigned)p_evt->Arg);
+                 sep     = 1;
+                 cur_tid = tid;
+                 break;
+
+            case TRACE_EVT_TASK_NAME:                           /* Follows the TASK_CREATE event of the task it names   */
+                 if ((last_created != 0u) && (p_evt->Arg < TRACE_NAME_LEN_MAX)) {
+                     char      *p_name;
+                     uint32_t   k;
+
+
+                     tid    = TaskTID(last_created);
+                     p_name = TaskTbl[tid - 1].Name;
+                     if (p_evt->Arg == 0u) {
+                         memset(p_name, 0, sizeof(TaskTbl[0].Name));
+                     }
+                     for (k = 0u; (k < 4u) && ((p_evt->Arg + k) < TRACE_NAME_LEN_MAX); k++) {
+                         char  c = (char)((p_evt->Obj >> (k * 8u)) & 0xFFu);
+
+
+                         if ((c == '"') || (c == '\\') || ((c > 0) && (c < ' '))) {
+                             c = '_';
+                         }
+                         p_name[p_evt->Arg + k] = c;
+                     }
+                 }
+                 break;
+
+            case TRACE_EVT_ISR_ENTER:
+                 fprintf(p_out, "%s{\"ph\":\"B\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"name\":\"%s %d\"}",
+                         sep ? ",\n" : "", TRACE_PID, TRACE_TID_ISR, us,
+                         (p_evt->Arg >= 16u) ? "IRQ" : "Exception",
+                         (p_evt->Arg >= 16u) ? (int)p_evt->Arg - 16 : (int)p_evt->Arg);
+                 sep = 1;
+                 isr_depth++;
+                 break;
+
+            case TRACE_EVT_ISR_EXIT:
+            case TRACE_EVT_ISR_EXIT_TO_SCHED:
+                 if (isr_depth > 0) {                           /* Ignore exits whose entry was overwritten             */
+                     fprintf(p_out, "%s{\"ph\":\"E\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f}",
+                             sep ? ",\n" : "", TRACE_PID, TRACE_TID_ISR, us);
+                     sep = 1;
+                     isr_depth--;
+                 }
+                 break;
+
+            default:
+                 if (id == TRACE_EVT_TASK_CREATE) {
+                     last_created = p_evt->Obj;
+                     (void)TaskTID(p_evt->Obj);
+                 }
+                 tid = (isr_depth > 0) ? TRACE_TID_ISR : ((cur_tid > 0) ? cur_tid : TRACE_TID_ISR);
+                 fprintf(p_out, "%s{\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"name\":\"%s%s\","
+                                "\"args\":{\"obj\":\"0x%08lX\",\"arg\":%u}}",
+                         sep ? ",\n" : "", TRACE_PID, tid, us,
+                         EvtName(p_evt->ID),
+                         ((p_evt->ID & TRACE_EVT_FAILED) != 0u) ? "Failed" : "",
+                         (unsigned long)p_evt->Obj, (unsigned)p_evt->Arg);
+                 sep = 1;
+                 break;
+        }
+    }
+                                                                /* --------------- NAME THE THREADS ------------------- */
+    fprintf(p_out, "%s{\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":\"ISR\"}}",
+            sep ? ",\n" : "", TRACE_PID, TRACE_TID_ISR);
+    for (i = 0u; i < TaskNbr; i++) {
+        fprintf(p_out, ",\n{\"ph\":\"M\",\"pid\":%d,\"tid\":%lu,\"name\":\"thread_name\",\"args\":{\"name\":\"%s\"}}",
+                TRACE_PID, (unsigned long)(i + 1u), TaskTbl[i].Name);
+    }
+    fprintf(p_out, ",\n{\"ph\":\"M\",\"pid\":%d,\"name\":\"process_name\",\"args\":{\"name\":\"uC/OS-III\"}}\n]}\n",
+            TRACE_PID);
+
+    if (p_out != stdout) {
+        fclose(p_out);
+    }
+    free(p_evt_tbl);
+    free(p_img);
+    return (0);
+}
@@ -0,0 +1,278 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                          RING BUFFER TRACE RECORDER EVENTS
+*
+* File    : OS_TRACE_EVENTS.H
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) This recorder keeps the most recent OS_CFG_TRACE_RING_SIZE kernel events in RAM.  Each event is three
+*               32-bit words: a CPU timestamp, an event ID with a 16-bit argument and an object address or value.
+*
+*           (2) Events are reserved in the ring with an exclusive load/store loop on the write index so that tasks
+*               and nested ISRs can record without disabling interrupts.
+*
+*           (3) The ring can be read by a debugger (symbol 'OSTraceRing') or streamed with OS_TraceRingDump().  In both
+*               cases the image is an OS_TRACE_RING_HDR followed by the event table.  Host/os_trace_json.c converts
+*               that image to the Chrome trace event format, which chrome://tracing and Perfetto can open.
+**************************************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_EVENTS_H
+#define  OS_TRACE_EVENTS_H
+
+
+#include  <cpu.h>
+#include  <cpu_core.h>
+#include  <lib_def.h>
+#include  <os_cfg.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                   CONFIGURATION
+**************************************************************************************************************************
+*/
+
+#ifndef  OS_CFG_TRACE_RING_SIZE
+#define  OS_CFG_TRACE_RING_SIZE                 512u            /* Number of events kept (MUST be a power of 2)         */
+#endif
+
+#if     ((OS_CFG_TRACE_RING_SIZE & (OS_CFG_TRACE_RING_SIZE - 1u)) != 0u)
+#error  "OS_CFG.H, OS_CFG_TRACE_RING_SIZE must be a power of 2"
+#endif
+
+#if     (CPU_CFG_TS_TMR_EN != DEF_ENABLED)
+#error  "CPU_CFG.H, the CPU timestamp timer must be enabled to use the ring buffer trace recorder"
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                      DEFINES
+**************************************************************************************************************************
+*/
+
+#define  OS_TRACE_RING_MAGIC                    0x5254534Fu     /* 'OSTR' in little-endian byte order                   */
+#define  OS_TRACE_RING_VER                      1u
+
+#define  OS_TRACE_RING_EVT_FAILED               0x8000u         /* OR'ed with the event ID when the call failed         */
+
+                                                                /* ------------------- TASK EVENTS -------------------- */
+#define  OS_TRACE_RING_EVT_TASK_SWITCHED_IN          1u         /* Obj: TCB        Arg: Prio                            */
+#define  OS_TRACE_RING_EVT_TASK_READY                2u         /* Obj: TCB        Arg: Prio                            */
+#define  OS_TRACE_RING_EVT_TASK_NOT_READY            3u         /* Obj: TCB        Arg: Prio                            */
+#define  OS_TRACE_RING_EVT_TASK_CREATE               4u         /* Obj: TCB        Arg: Prio                            */
+#define  OS_TRACE_RING_EVT_TASK_NAME                 5u         /* Obj: 4 chars    Arg: Offset of chars in name         */
+#define  OS_TRACE_RING_EVT_TASK_DEL                  6u         /* Obj: TCB                                             */
+#define  OS_TRACE_RING_EVT_TASK_DLY                  7u         /* Obj: Ticks                                           */
+#define  OS_TRACE_RING_EVT_TASK_SUSPEND              8u         /* Obj: TCB                                             */
+#define  OS_TRACE_RING_EVT_TASK_RESUME               9u         /* Obj: TCB                                             */
+#define  OS_TRACE_RING_EVT_TASK_PRIO_CHANGE         10u         /* Obj: TCB        Arg: New prio                        */
+#define  OS_TRACE_RING_EVT_TASK_SEM_POST            11u         /* Obj: TCB                                             */
+#define  OS_TRACE_RING_EVT_TASK_SEM_PEND            12u         /* Obj: TCB                                             */
+#define  OS_TRACE_RING_EVT_TASK_SEM_PEND_BLOCK      13u         /* Obj: TCB                                             */
+#define  OS_TRACE_RING_EVT_TASK_Q_POST              14u         /* Obj: OS_MSG_Q                                        */
+#define  OS_TRACE_RING_EVT_TASK_Q_PEND              15u         /* Obj: OS_MSG_Q                                        */
+#define  OS_TRACE_RING_EVT_TASK_Q_PEND_BLOCK        16u         /* Obj: OS_MSG_Q                                        */
+
+                                                                /* -------------------- ISR EVENTS -------------------- */
+#define  OS_TRACE_RING_EVT_ISR_ENTER                32u         /*                 Arg: Exception number                */
+#define  OS_TRACE_RING_EVT_ISR_EXIT                 33u
+#define  OS_TRACE_RING_EVT_ISR_EXIT_TO_SCHED        34u
+
+                                                                /* ------------------ OBJECT EVENTS ------------------- */
+#define  OS_TRACE_RING_EVT_SEM_POST                 48u         /* Obj: OS_SEM                                          */
+#define  OS_TRACE_RING_EVT_SEM_PEND                 49u
+#define  OS_TRACE_RING_EVT_SEM_PEND_BLOCK           50u
+#define  OS_TRACE_RING_EVT_Q_POST                   51u         /* Obj: OS_Q                                            */
+#define  OS_TRACE_RING_EVT_Q_PEND                   52u
+#define  OS_TRACE_RING_EVT_Q_PEND_BLOCK             53u
+#define  OS_TRACE_RING_EVT_MUTEX_POST               54u         /* Obj: OS_MUTEX                                        */
+#define  OS_TRACE_RING_EVT_MUTEX_PEND               55u
+#define  OS_TRACE_RING_EVT_MUTEX_PEND_BLOCK         56u
+#define  OS_TRACE_RING_EVT_MUTEX_PRIO_INHERIT       57u         /* Obj: TCB        Arg: New prio                        */
+#define  OS_TRACE_RING_EVT_MUTEX_PRIO_DISINHERIT    58u         /* Obj: TCB        Arg: New prio                        */
+#define  OS_TRACE_RING_EVT_FLAG_POST                59u         /* Obj: OS_FLAG_GRP                                     */
+#define  OS_TRACE_RING_EVT_FLAG_PEND                60u
+#define  OS_TRACE_RING_EVT_FLAG_PEND_BLOCK          61u
+#define  OS_TRACE_RING_EVT_MEM_GET                  62u         /* Obj: OS_MEM                                          */
+#define  OS_TRACE_RING_EVT_MEM_PUT                  63u
+#define  OS_TRACE_RING_EVT_RWLOCK_POST              64u         /* Obj: OS_RWLOCK                                       */
+#define  OS_TRACE_RING_EVT_RWLOCK_PEND              65u         /* Obj: OS_RWLOCK  Arg: OS_OPT_PEND_RWLOCK_READ/WRITE   */
+#define  OS_TRACE_RING_EVT_RWLOCK_PEND_BLOCK        66u         /* Obj: OS_RWLOCK  Arg: OS_OPT_PEND_RWLOCK_READ/WRITE   */
+
+#define  OS_TRACE_RING_EVT_USER                    256u         /* First ID available to the application                */
+
+
+/*
+**************************************************************************************************************************
+*                                                     DATA TYPES
+**************************************************************************************************************************
+*/
+
+typedef  void  (*OS_TRACE_RING_OUTPUT_FNCT)(void        *p_buf,
+                                            CPU_SIZE_T   len);
+
+
+typedef  struct  os_trace_ring_hdr {
+    CPU_INT32U                  Magic;                          /* OS_TRACE_RING_MAGIC                                  */
+    CPU_INT16U                  Ver;                            /* OS_TRACE_RING_VER                                    */
+    CPU_INT16U                  EvtSize;                        /* sizeof(OS_TRACE_RING_EVT)                            */
+    CPU_INT32U                  Size;                           /* Number of events in the table                        */
+    CPU_INT32U                  WrIx;                           /* Number of events reserved since the last clear       */
+    CPU_INT32U                  TS_Freq;                        /* Frequency of the timestamp counter (Hz)              */
+    CPU_INT32U                  OvrhdCycles;                    /* Measured cost of recording one event (TS counts)     */
+} OS_TRACE_RING_HDR;
+
+
+typedef  struct  os_trace_ring_evt {
+    CPU_INT32U                  TS;                             /* CPU_TS_TmrRd() when the event was recorded           */
+    CPU_INT16U                  ID;                             /* OS_TRACE_RING_EVT_xxx                                */
+    CPU_INT16U                  Arg;                            /* Event specific argument                              */
+    CPU_INT32U                  Obj;                            /* Address of the kernel object or event value          */
+} OS_TRACE_RING_EVT;
+
+
+typedef  struct  os_trace_ring {
+    OS_TRACE_RING_HDR           Hdr;
+    OS_TRACE_RING_EVT           EvtTbl[OS_CFG_TRACE_RING_SIZE];
+} OS_TRACE_RING;
+
+
+/*
+**************************************************************************************************************************
+*                                                  GLOBAL VARIABLES
+**************************************************************************************************************************
+*/
+
+extern  OS_TRACE_RING           OSTraceRing;
+extern  CPU_BOOLEAN    volatile OSTraceRingEn;
+
+
+/*
+**************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+**************************************************************************************************************************
+*/
+
+void        OS_TraceRingInit      (void);
+
+void        OS_TraceRingStart     (void);
+
+void        OS_TraceRingStop      (void);
+
+void        OS_TraceRingClear     (void);
+
+void        OS_TraceRingRec       (CPU_INT16U                 id,
+                                   CPU_INT16U                 arg,
+                                   CPU_INT32U                 obj);
+
+void        OS_TraceRingTaskCreate(void                      *p_tcb,
+                                   CPU_INT08U                 prio,
+                                   CPU_CHAR                  *p_name);
+
+void        OS_TraceRingISR_Enter (void);
+
+void        OS_TraceRingDump      (OS_TRACE_RING_OUTPUT_FNCT  p_fnct);
+
+
+/*
+**************************************************************************************************************************
+*                                               uC/OS-III TRACE MACROS
+*
+* Note(s) : (1) Only the events listed here are recorded, the remaining OS_TRACE_xxx() macros default to nothing in
+*               os_trace.h.  In particular the API enter/exit macros are not recorded to keep the ring for scheduling
+*               events.
+*
+*           (2) These macros are expanded inside the kernel, where all the kernel data types are visible.
+**************************************************************************************************************************
+*/
+
+#define  OS_TRACE_REC_OBJ(id, p_obj)                      OS_TraceRingRec((CPU_INT16U)(id), 0u, (CPU_INT32U)(p_obj))
+#define  OS_TRACE_REC_FAILED(id, p_obj)                   OS_TraceRingRec((CPU_INT16U)((id) | OS_TRACE_RING_EVT_FAILED), 0u, (CPU_INT32U)(p_obj))
+
+#define  OS_TRACE_INIT()                                  OS_TraceRingInit()
+#define  OS_TRACE_START()                                 OS_TraceRingStart()
+#define  OS_TRACE_STOP()                                  OS_TraceRingStop()
+#define  OS_TRACE_CLEAR()                                 OS_TraceRingClear()
+
+#define  OS_TRACE_ISR_ENTER()                             OS_TraceRingISR_Enter()
+#define  OS_TRACE_ISR_EXIT()                              OS_TraceRingRec(OS_TRACE_RING_EVT_ISR_EXIT, 0u, 0u)
+#define  OS_TRACE_ISR_EXIT_TO_SCHEDULER()                 OS_TraceRingRec(OS_TRACE_RING_EVT_ISR_EXIT_TO_SCHED, 0u, 0u)
+
+#define  OS_TRACE_TASK_CREATE(p_tcb)                      OS_TraceRingTaskCreate((void *)(p_tcb), (CPU_INT08U)(p_tcb)->Prio, (p_tcb)->NamePtr)
+#define  OS_TRACE_TASK_DEL(p_tcb)                         OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_TASK_DEL, p_tcb)
+#define  OS_TRACE_TASK_READY(p_tcb)                       OS_TraceRingRec(OS_TRACE_RING_EVT_TASK_READY,       (CPU_INT16U)(p_tcb)->Prio, (CPU_INT32U)(p_tcb))
+#define  OS_TRACE_TASK_SWITCHED_IN(p_tcb)                 OS_TraceRingRec(OS_TRACE_RING_EVT_TASK_SWITCHED_IN, (CPU_INT16U)(p_tcb)->Prio, (CPU_INT32U)(p_tcb))
+#define  OS_TRACE_TASK_SUSPENDED(p_tcb)                   OS_TraceRingRec(OS_TRACE_RING_EVT_TASK_NOT_READY,   (CPU_INT16U)(p_tcb)->Prio, (CPU_INT32U)(p_tcb))
+#define  OS_TRACE_TASK_DLY(dly_ticks)                     OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_TASK_DLY, dly_ticks)
+#define  OS_TRACE_TASK_SUSPEND(p_tcb)                     OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_TASK_SUSPEND, p_tcb)
+#define  OS_TRACE_TASK_RESUME(p_tcb)                      OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_TASK_RESUME, p_tcb)
+#define  OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio)           OS_TraceRingRec(OS_TRACE_RING_EVT_TASK_PRIO_CHANGE, (CPU_INT16U)(prio), (CPU_INT32U)(p_tcb))
+
+#define  OS_TRACE_TASK_MSG_Q_POST(p_msg_q)                OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_TASK_Q_POST, p_msg_q)
+#define  OS_TRACE_TASK_MSG_Q_POST_FAILED(p_msg_q)         OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_TASK_Q_POST, p_msg_q)
+#define  OS_TRACE_TASK_MSG_Q_PEND(p_msg_q)                OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_TASK_Q_PEND, p_msg_q)
+#define  OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q)         OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_TASK_Q_PEND, p_msg_q)
+#define  OS_TRACE_TASK_MSG_Q_PEND_BLOCK(p_msg_q)          OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_TASK_Q_PEND_BLOCK, p_msg_q)
+
+#define  OS_TRACE_TASK_SEM_POST(p_tcb)                    OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_TASK_SEM_POST, p_tcb)
+#define  OS_TRACE_TASK_SEM_POST_FAILED(p_tcb)             OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_TASK_SEM_POST, p_tcb)
+#define  OS_TRACE_TASK_SEM_PEND(p_tcb)                    OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_TASK_SEM_PEND, p_tcb)
+#define  OS_TRACE_TASK_SEM_PEND_FAILED(p_tcb)             OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_TASK_SEM_PEND, p_tcb)
+#define  OS_TRACE_TASK_SEM_PEND_BLOCK(p_tcb)              OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_TASK_SEM_PEND_BLOCK, p_tcb)
+
+#define  OS_TRACE_MUTEX_POST(p_mutex)                     OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_MUTEX_POST, p_mutex)
+#define  OS_TRACE_MUTEX_POST_FAILED(p_mutex)              OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_MUTEX_POST, p_mutex)
+#define  OS_TRACE_MUTEX_PEND(p_mutex)                     OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_MUTEX_PEND, p_mutex)
+#define  OS_TRACE_MUTEX_PEND_FAILED(p_mutex)              OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_MUTEX_PEND, p_mutex)
+#define  OS_TRACE_MUTEX_PEND_BLOCK(p_mutex)               OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_MUTEX_PEND_BLOCK, p_mutex)
+#define  OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, prio)    OS_TraceRingRec(OS_TRACE_RING_EVT_MUTEX_PRIO_INHERIT,    (CPU_INT16U)(prio), (CPU_INT32U)(p_tcb))
+#define  OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb, prio) OS_TraceRingRec(OS_TRACE_RING_EVT_MUTEX_PRIO_DISINHERIT, (CPU_INT16U)(prio), (CPU_INT32U)(p_tcb))
+
+#define  OS_TRACE_SEM_POST(p_sem)                         OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_SEM_POST, p_sem)
+#define  OS_TRACE_SEM_POST_FAILED(p_sem)                  OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_SEM_POST, p_sem)
+#define  OS_TRACE_SEM_PEND(p_sem)                         OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_SEM_PEND, p_sem)
+#define  OS_TRACE_SEM_PEND_FAILED(p_sem)                  OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_SEM_PEND, p_sem)
+#define  OS_TRACE_SEM_PEND_BLOCK(p_sem)                   OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_SEM_PEND_BLOCK, p_sem)
+
+#define  OS_TRACE_Q_POST(p_q)                             OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_Q_POST, p_q)
+#define  OS_TRACE_Q_POST_FAILED(p_q)                      OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_Q_POST, p_q)
+#define  OS_TRACE_Q_PEND(p_q)                             OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_Q_PEND, p_q)
+#define  OS_TRACE_Q_PEND_FAILED(p_q)                      OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_Q_PEND, p_q)
+#define  OS_TRACE_Q_PEND_BLOCK(p_q)                       OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_Q_PEND_BLOCK, p_q)
+
+#define  OS_TRACE_FLAG_POST(p_grp)                        OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_FLAG_POST, p_grp)
+#define  OS_TRACE_FLAG_POST_FAILED(p_grp)                 OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_FLAG_POST, p_grp)
+#define  OS_TRACE_FLAG_PEND(p_grp)                        OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_FLAG_PEND, p_grp)
+#define  OS_TRACE_FLAG_PEND_FAILED(p_grp)                 OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_FLAG_PEND, p_grp)
+#define  OS_TRACE_FLAG_PEND_BLOCK(p_grp)                  OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_FLAG_PEND_BLOCK, p_grp)
+
+#define  OS_TRACE_MEM_GET(p_mem)                          OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_MEM_GET, p_mem)
+#define  OS_TRACE_MEM_GET_FAILED(p_mem)                   OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_MEM_GET, p_mem)
+#define  OS_TRACE_MEM_PUT(p_mem)                          OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_MEM_PUT, p_mem)
+#define  OS_TRACE_MEM_PUT_FAILED(p_mem)                   OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_MEM_PUT, p_mem)
+
+#define  OS_TRACE_RWLOCK_POST(p_rwlock)                   OS_TRACE_REC_OBJ(OS_TRACE_RING_EVT_RWLOCK_POST, p_rwlock)
+#define  OS_TRACE_RWLOCK_POST_FAILED(p_rwlock)            OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_RWLOCK_POST, p_rwlock)
+#define  OS_TRACE_RWLOCK_PEND(p_rwlock, opt)              OS_TraceRingRec(OS_TRACE_RING_EVT_RWLOCK_PEND,       (CPU_INT16U)(opt), (CPU_INT32U)(p_rwlock))
+#define  OS_TRACE_RWLOCK_PEND_FAILED(p_rwlock)            OS_TRACE_REC_FAILED(OS_TRACE_RING_EVT_RWLOCK_PEND, p_rwlock)
+#define  OS_TRACE_RWLOCK_PEND_BLOCK(p_rwlock, opt)        OS_TraceRingRec(OS_TRACE_RING_EVT_RWLOCK_PEND_BLOCK, (CPU_INT16U)(opt), (CPU_INT32U)(p_rwlock))
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
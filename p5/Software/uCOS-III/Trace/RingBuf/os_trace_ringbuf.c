@@ -0,0 +1,371 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                             RING BUFFER TRACE RECORDER
+*
+* File    : OS_TRACE_RINGBUF.C
+* Version : V3.06.00
+**************************************************************************************************************************
+* Note(s) : (1) See os_trace_events.h for the event format.
+**************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include  <os.h>
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_trace_ringbuf__c = "$Id: $";
+#endif
+
+
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
+/*
+**************************************************************************************************************************
+*                                                   LOCAL DEFINES
+**************************************************************************************************************************
+*/
+
+#define  OS_TRACE_RING_MASK                 (OS_CFG_TRACE_RING_SIZE - 1u)
+
+#define  OS_TRACE_RING_NAME_LEN_MAX             16u             /* Nbr of task name chars recorded at creation          */
+
+#define  OS_TRACE_RING_CAL_CNT                  16u             /* Nbr of samples taken to measure the recorder cost    */
+
+
+/*
+**************************************************************************************************************************
+*                                                  GLOBAL VARIABLES
+**************************************************************************************************************************
+*/
+
+OS_TRACE_RING           OSTraceRing;
+CPU_BOOLEAN    volatile OSTraceRingEn;
+
+
+/*
+**************************************************************************************************************************
+*                                              LOCAL FUNCTION PROTOTYPES
+**************************************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_TraceRingReserve  (void);
+
+static  void        OS_TraceRingNameRec  (CPU_CHAR  *p_name);
+
+
+/*
+**************************************************************************************************************************
+*                                            INITIALIZE THE TRACE RECORDER
+*
+* Description: This function is called by OS_TRACE_INIT() to initialize the ring and to measure the cost of recording an
+*              event.  The measurement is the smallest number of timestamp counts taken by OS_TraceRingRec() over
+*              OS_TRACE_RING_CAL_CNT calls, less the cost of reading the timestamp itself.  It is saved in the ring
+*              header so that the host can report it along with the trace.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : (1) This function must be called after CPU_Init() since the timestamp timer must be running.
+*
+*              (2) Recording is stopped when this function returns, call OS_TRACE_START() to start recording.
+**************************************************************************************************************************
+*/
+
+void  OS_TraceRingInit (void)
+{
+    CPU_TS_TMR  ts_start;
+    CPU_TS_TMR  ts_bare;
+    CPU_TS_TMR  ts_rec;
+    CPU_TS_TMR  ts_bare_min;
+    CPU_TS_TMR  ts_rec_min;
+    CPU_INT32U  i;
+    CPU_ERR     err;
+
+
+    OSTraceRingEn               =  DEF_FALSE;
+    OSTraceRing.Hdr.Magic       =  OS_TRACE_RING_MAGIC;
+    OSTraceRing.Hdr.Ver         =  OS_TRACE_RING_VER;
+    OSTraceRing.Hdr.EvtSize     = (CPU_INT16U)sizeof(OS_TRACE_RING_EVT);
+    OSTraceRing.Hdr.Size        =  OS_CFG_TRACE_RING_SIZE;
+    OSTraceRing.Hdr.WrIx        =  0u;
+    OSTraceRing.Hdr.TS_Freq     = (CPU_INT32U)CPU_TS_TmrFreqGet(&err);
+    OSTraceRing.Hdr.OvrhdCycles =  0u;
+
+    ts_bare_min = (CPU_TS_TMR)DEF_INT_32U_MAX_VAL;
+    ts_rec_min  = (CPU_TS_TMR)DEF_INT_32U_MAX_VAL;
+    OSTraceRingEn = DEF_TRUE;
+    for (i = 0u; i < OS_TRACE_RING_CAL_CNT; i++) {
+        ts_start = CPU_TS_TmrRd();
+        ts_bare  = CPU_TS_TmrRd() - ts_start;
+        ts_start = CPU_TS_TmrRd();
+        OS_TraceRingRec(OS_TRACE_RING_EVT_USER, 0u, 0u);
+        ts_rec   = CPU_TS_TmrRd() - ts_start;
+        if (ts_bare < ts_bare_min) {
+            ts_bare_min = ts_bare;
+        }
+        if (ts_rec < ts_rec_min) {
+            ts_rec_min  = ts_rec;
+        }
+    }
+    OSTraceRingEn = DEF_FALSE;
+
+    if (ts_rec_min > ts_bare_min) {
+        OSTraceRing.Hdr.OvrhdCycles = (CPU_INT32U)(ts_rec_min - ts_bare_min);
+    }
+    OS_TraceRingClear();
+}
+
+
+/*
+**************************************************************************************************************************
+*                                         START, STOP AND CLEAR THE RECORDER
+*
+* Description: These functions are called by OS_TRACE_START(), OS_TRACE_STOP() and OS_TRACE_CLEAR().
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : (1) Tasks created before recording started (e.g. the idle and statistic tasks created by OSInit()) are
+*                  named again by OS_TraceRingStart() so that every task in the debug list is named in the trace.
+**************************************************************************************************************************
+*/
+
+void  OS_TraceRingStart (void)
+{
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_TCB  *p_tcb;
+    OS_ERR   err;
+#endif
+
+
+    OSTraceRingEn = DEF_TRUE;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OSSchedLock(&err);
+    p_tcb = OSTaskDbgListPtr;
+    while (p_tcb != (OS_TCB *)0) {                              /* See Note #1                                          */
+        OS_TraceRingTaskCreate((void *)p_tcb, (CPU_INT08U)p_tcb->Prio, p_tcb->NamePtr);
+        p_tcb = p_tcb->DbgNextPtr;
+    }
+    OSSchedUnlock(&err);
+#endif
+}
+
+
+void  OS_TraceRingStop (void)
+{
+    OSTraceRingEn = DEF_FALSE;
+}
+
+
+void  OS_TraceRingClear (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSTraceRing.Hdr.WrIx = 0u;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                  RECORD AN EVENT
+*
+* Description: This function stores one event in the ring, overwriting the oldest event when the ring is full.
+*
+* Arguments  : id       is the event ID (OS_TRACE_RING_EVT_xxx), optionally OR'ed with OS_TRACE_RING_EVT_FAILED.
+*
+*              arg      is an event specific 16-bit argument.
+*
+*              obj      is the address of the kernel object the event applies to or an event specific value.
+*
+* Returns    : none
+*
+* Note(s)    : (1) The slot is reserved before the timestamp is read.  An ISR that preempts this function between both
+*                  steps stores its event in the next slot with an earlier timestamp, the host sorts events by time.
+*
+*              (2) This function may be called from tasks and ISRs, with or without interrupts disabled.
+**************************************************************************************************************************
+*/
+
+void  OS_TraceRingRec (CPU_INT16U  id,
+                       CPU_INT16U  arg,
+                       CPU_INT32U  obj)
+{
+    OS_TRACE_RING_EVT  *p_evt;
+
+
+    if (OSTraceRingEn == DEF_FALSE) {
+        return;
+    }
+    p_evt      = &OSTraceRing.EvtTbl[OS_TraceRingReserve() & OS_TRACE_RING_MASK];
+    p_evt->TS  = (CPU_INT32U)CPU_TS_TmrRd();                   /* See Note #1                                          */
+    p_evt->ID  = id;
+    p_evt->Arg = arg;
+    p_evt->Obj = obj;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                               RECORD SPECIFIC EVENTS
+*
+* Description: OS_TraceRingTaskCreate() records the creation of a task followed by its name, 4 characters per event.
+*              OS_TraceRingISR_Enter() records the entry of an ISR along with the active exception number.
+*
+* Arguments  : p_tcb    is a pointer to the TCB of the task.
+*
+*              prio     is the priority of the task.
+*
+*              p_name   is a pointer to the name of the task.
+*
+* Returns    : none
+**************************************************************************************************************************
+*/
+
+void  OS_TraceRingTaskCreate (void      *p_tcb,
+                              CPU_INT08U  prio,
+                              CPU_CHAR   *p_name)
+{
+    if (OSTraceRingEn == DEF_FALSE) {
+        return;
+    }
+    OS_TraceRingRec(OS_TRACE_RING_EVT_TASK_CREATE, (CPU_INT16U)prio, (CPU_INT32U)p_tcb);
+    OS_TraceRingNameRec(p_name);
+}
+
+
+void  OS_TraceRingISR_Enter (void)
+{
+#if defined(__ICCARM__)
+    OS_TraceRingRec(OS_TRACE_RING_EVT_ISR_ENTER, (CPU_INT16U)(__get_IPSR() & 0x1FFu), 0u);
+#else
+    OS_TraceRingRec(OS_TRACE_RING_EVT_ISR_ENTER, 0u, 0u);
+#endif
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                   DUMP THE RING
+*
+* Description: This function stops the recorder and passes the ring image (header followed by the event table) to a
+*              user supplied output function, e.g. a UART or a semihosting write.  The image can be converted on the host
+*              with Host/os_trace_json.c.
+*
+* Arguments  : p_fnct   is a pointer to the output function.  It may be called more than once.
+*
+* Returns    : none
+*
+* Note(s)    : (1) Recording is not restarted, call OS_TRACE_CLEAR() and OS_TRACE_START() to record a new trace.
+**************************************************************************************************************************
+*/
+
+void  OS_TraceRingDump (OS_TRACE_RING_OUTPUT_FNCT  p_fnct)
+{
+    CPU_INT32U  nbr_evt;
+
+
+    if (p_fnct == (OS_TRACE_RING_OUTPUT_FNCT)0) {
+        return;
+    }
+    OS_TraceRingStop();
+
+    nbr_evt = OSTraceRing.Hdr.WrIx;
+    if (nbr_evt > OS_CFG_TRACE_RING_SIZE) {
+        nbr_evt = OS_CFG_TRACE_RING_SIZE;
+    }
+    p_fnct((void *)&OSTraceRing.Hdr, sizeof(OS_TRACE_RING_HDR));
+    p_fnct((void *)&OSTraceRing.EvtTbl[0], (CPU_SIZE_T)(nbr_evt * sizeof(OS_TRACE_RING_EVT)));
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                  RESERVE A SLOT
+*
+* Description: This function atomically increments the write index and returns its previous value.
+*
+* Arguments  : none
+*
+* Returns    : The index of the reserved event, before masking.
+*
+* Note(s)    : (1) On ARMv7-M the exclusive monitor is cleared on exception entry and return, a preempted reservation
+*                  simply retries.  Interrupts are not disabled.
+**************************************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_TraceRingReserve (void)
+{
+    CPU_INT32U  ix;
+#if defined(__ICCARM__)
+
+
+    do {                                                        /* See Note #1                                          */
+        ix = (CPU_INT32U)__LDREX((unsigned long *)&OSTraceRing.Hdr.WrIx);
+    } while (__STREX((unsigned long)(ix + 1u), (unsigned long *)&OSTraceRing.Hdr.WrIx) != 0u);
+#else
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    ix = OSTraceRing.Hdr.WrIx;
+    OSTraceRing.Hdr.WrIx = ix + 1u;
+    CPU_CRITICAL_EXIT();
+#endif
+
+    return (ix);
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                RECORD A TASK NAME
+*
+* Description: This function records up to OS_TRACE_RING_NAME_LEN_MAX characters of a task name, 4 characters per event.
+*              The first character is stored in the least significant byte of 'Obj' and 'Arg' holds the offset of the
+*              first character in the name.
+*
+* Arguments  : p_name   is a pointer to the name of the task.
+*
+* Returns    : none
+*
+* Note(s)    : (1) The name events immediately follow the OS_TRACE_RING_EVT_TASK_CREATE event of the task they name.
+**************************************************************************************************************************
+*/
+
+static  void  OS_TraceRingNameRec (CPU_CHAR  *p_name)
+{
+    CPU_INT32U  chars;
+    CPU_INT16U  ix;
+    CPU_INT16U  ofs;
+    CPU_INT08U  i;
+
+
+    if (p_name == (CPU_CHAR *)0) {
+        return;
+    }
+    ix = 0u;
+    while ((ix < OS_TRACE_RING_NAME_LEN_MAX) &&
+           (p_name[ix] != (CPU_CHAR)0)) {
+        chars = 0u;
+        ofs   = ix;
+        for (i = 0u; i < 4u; i++) {
+            if (p_name[ix] != (CPU_CHAR)0) {
+                chars |= (CPU_INT32U)(CPU_INT08U)p_name[ix] << (i * 8u);
+                ix++;
+            }
+        }
+        OS_TraceRingRec(OS_TRACE_RING_EVT_TASK_NAME, ofs, chars);
+    }
+}
+
+#endif
@@ -45,6 +45,7 @@
 #include  "bsp.h"
 #include  "bsp_clock.h"
 #include  "bsp_led.h"
+#include  "bsp_mem.h"
 #include  "bsp_pb.h"
 #include  "bsp_test.h"
 #include  "bsp_os.h"
@@ -92,6 +93,7 @@ void  BSP_Init (void)
   BSP_LED_Init();            // LEDs
   BSP_Test_Outputs_Init();   // Test point outputs
   BSP_PB_Init();             // Pushbutton
+  BSP_Mem_Init();            // DMA stream of Mem_Copy() (see bsp_mem.c)
 
 }
 
@@ -0,0 +1,346 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                    MICRIUM BOARD SUPPORT PACKAGE
+*
+*                                         STM32F746G-DISCO
+*                                         Evaluation Board
+*
+* Filename      : bsp_mem.c
+* Version       : V1.00
+*
+* Note(s)       : (1) Provides Mem_CopyDMA() to uC/LIB when LIB_MEM_CFG_COPY_DMA_EN is enabled.  Large
+*                     copies run on DMA2 stream 0 (memory-to-memory) while the calling task pends, so
+*                     lower priority tasks get the CPU for the duration of the transfer.
+*
+*                 (2) The data cache of the Cortex-M7 is NOT enabled by this BSP, so the buffers need no
+*                     cache maintenance (see 'lib_mem.h  Mem_CopyDMA()  Note #4').
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDES
+*********************************************************************************************************
+*/
+
+#include  "cpu.h"
+#include  "lib_def.h"
+#include  "lib_mem.h"
+#include  "os.h"
+#include  "bsp_mem.h"
+
+#include  "stm32f7xx_hal.h"
+
+
+#if (LIB_MEM_CFG_COPY_DMA_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  BSP_MEM_DMA_STREAM                     DMA2_Stream0
+#define  BSP_MEM_DMA_IRQ                        DMA2_Stream0_IRQn
+#define  BSP_MEM_DMA_IRQ_PRIO                   0x06u
+
+#define  BSP_MEM_DMA_NDTR_MAX               65535u              /* Max nbr of items of a DMA transfer.                  */
+
+#define  BSP_MEM_DMA_WORDS_PER_MS            1000u              /* Worst case DMA rate (see Mem_CopyDMA() Note #3).     */
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  DMA_HandleTypeDef  BSP_Mem_DMA_Handle;
+static  OS_SEM             BSP_Mem_DMA_Sem;                     /* Posted when a transfer completes or fails.           */
+static  CPU_BOOLEAN        BSP_Mem_DMA_Busy = DEF_YES;          /* Stream busy, or NOT initialized yet.                 */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  BSP_Mem_DMA_XferDone (DMA_HandleTypeDef  *p_handle);
+
+
+/*
+*********************************************************************************************************
+*                                           BSP_Mem_Init()
+*
+* Description : Initialize the DMA stream used by Mem_CopyDMA().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : BSP_Init().
+*
+* Note(s)     : (1) MUST be called after OSInit().  Until then, Mem_CopyDMA() declines every copy.
+*
+*               (2) Both sides of the transfer are word wide with the FIFO enabled.  Single transfers
+*                   are used so that no burst can cross a 1 KB boundary.
+*********************************************************************************************************
+*/
+
+void  BSP_Mem_Init (void)
+{
+    OS_ERR  err;
+
+
+    OSSemCreate(&BSP_Mem_DMA_Sem,
+                "BSP Mem DMA Sem",
+                 0u,
+                &err);
+    if (err != OS_ERR_NONE) {
+        return;
+    }
+
+    __HAL_RCC_DMA2_CLK_ENABLE();
+
+                                                                /* Cfg word-wide mem-to-mem stream (see Note #2).       */
+    BSP_Mem_DMA_Handle.Instance                 = BSP_MEM_DMA_STREAM;
+    BSP_Mem_DMA_Handle.Init.Channel             = DMA_CHANNEL_0;
+    BSP_Mem_DMA_Handle.Init.Direction           = DMA_MEMORY_TO_MEMORY;
+    BSP_Mem_DMA_Handle.Init.PeriphInc           = DMA_PINC_ENABLE;
+    BSP_Mem_DMA_Handle.Init.MemInc              = DMA_MINC_ENABLE;
+    BSP_Mem_DMA_Handle.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+    BSP_Mem_DMA_Handle.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
+    BSP_Mem_DMA_Handle.Init.Mode                = DMA_NORMAL;
+    BSP_Mem_DMA_Handle.Init.Priority            = DMA_PRIORITY_LOW;
+    BSP_Mem_DMA_Handle.Init.FIFOMode            = DMA_FIFOMODE_ENABLE;
+    BSP_Mem_DMA_Handle.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+    BSP_Mem_DMA_Handle.Init.MemBurst            = DMA_MBURST_SINGLE;
+    BSP_Mem_DMA_Handle.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+    if (HAL_DMA_Init(&BSP_Mem_DMA_Handle) != HAL_OK) {
+        return;
+    }
+    BSP_Mem_DMA_Handle.XferCpltCallback  = BSP_Mem_DMA_XferDone;
+    BSP_Mem_DMA_Handle.XferErrorCallback = BSP_Mem_DMA_XferDone;
+
+    HAL_NVIC_SetPriority(BSP_MEM_DMA_IRQ, BSP_MEM_DMA_IRQ_PRIO, 0u);
+    HAL_NVIC_EnableIRQ(BSP_MEM_DMA_IRQ);
+
+    BSP_Mem_DMA_Busy = DEF_NO;                                  /* Stream ready for Mem_CopyDMA().                      */
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_CopyDMA()
+*
+* Description : Copy a memory buffer with DMA2 stream 0.
+*
+* Argument(s) : pdest       Pointer to destination memory buffer.
+*
+*               psrc        Pointer to source      memory buffer.
+*
+*               size        Number of octets to copy.
+*
+* Return(s)   : DEF_OK,   if ALL octets copied.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Mem_Copy().
+*
+* Note(s)     : (1) The copy is declined, & so performed by the CPU, if :
+*
+*                   (a) the caller can NOT pend : ISR, scheduler locked, kernel NOT started, or
+*                       interrupts disabled by PRIMASK or masked by BASEPRI.  OSSemPend() would
+*                       re-enable the interrupts inside the caller's critical section;
+*                   (b) a buffer is NOT word aligned or the copy exceeds one DMA transfer;
+*                   (c) the stream is used by another task.
+*
+*               (2) The trailing octets that do NOT fill a word are copied by the CPU while the DMA
+*                   transfers the words.
+*
+*               (3) The task pends at most for the transfer time at BSP_MEM_DMA_WORDS_PER_MS, well
+*                   below the actual rate, plus one tick.  On timeout, the stream is aborted & DEF_FAIL
+*                   is returned so that Mem_Copy() copies the buffers with the CPU.  A completion
+*                   posted between the timeout & the abort is discarded.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  Mem_CopyDMA (       void        *pdest,
+                          const  void        *psrc,
+                                 CPU_SIZE_T   size)
+{
+           CPU_SIZE_T    nbr_words;
+           CPU_SIZE_T    nbr_octets;
+           CPU_INT08U   *p_dest_08;
+    const  CPU_INT08U   *p_src_08;
+           OS_TICK       timeout;
+           CPU_BOOLEAN   busy;
+           OS_ERR        err;
+           CPU_SR_ALLOC();
+
+
+    if ((OSIntNestingCtr       >  0u)                 ||        /* See Note #1a.                                        */
+        (OSSchedLockNestingCtr >  0u)                 ||
+        (OSRunning             != OS_STATE_OS_RUNNING) ||
+        (__get_PRIMASK()       != 0u)                 ||
+        (__get_BASEPRI()       != 0u)) {
+        return (DEF_FAIL);
+    }
+
+    nbr_words = size / sizeof(CPU_INT32U);
+    if (((((CPU_ADDR)pdest | (CPU_ADDR)psrc) % sizeof(CPU_INT32U)) != 0u) ||
+         (nbr_words > BSP_MEM_DMA_NDTR_MAX)) {                  /* See Note #1b.                                        */
+        return (DEF_FAIL);
+    }
+
+    CPU_CRITICAL_ENTER();
+    busy = BSP_Mem_DMA_Busy;
+    BSP_Mem_DMA_Busy = DEF_YES;
+    CPU_CRITICAL_EXIT();
+    if (busy == DEF_YES) {                                      /* See Note #1c.                                        */
+        return (DEF_FAIL);
+    }
+
+    if (HAL_DMA_Start_IT(&BSP_Mem_DMA_Handle,
+                         (uint32_t)psrc,
+                         (uint32_t)pdest,
+                         (uint32_t)nbr_words) != HAL_OK) {
+        BSP_Mem_DMA_Busy = DEF_NO;
+        return (DEF_FAIL);
+    }
+
+    nbr_octets = size - (nbr_words * sizeof(CPU_INT32U));       /* Copy trailing octets (see Note #2).                  */
+    p_dest_08  = (      CPU_INT08U *)pdest + (size - nbr_octets);
+    p_src_08   = (const CPU_INT08U *)psrc  + (size - nbr_octets);
+    while (nbr_octets > 0u) {
+       *p_dest_08++ = *p_src_08++;
+        nbr_octets--;
+    }
+
+                                                                /* Bound the wait (see Note #3).                        */
+    timeout = (OS_TICK)(((((nbr_words / BSP_MEM_DMA_WORDS_PER_MS) + 1u) * OSCfg_TickRate_Hz) + 999u) / 1000u) + 1u;
+
+    (void)OSSemPend(&BSP_Mem_DMA_Sem,                           /* Wait for the end of the transfer.                    */
+                     timeout,
+                     OS_OPT_PEND_BLOCKING,
+                     0,
+                    &err);
+    if (err != OS_ERR_NONE) {                                   /* Completion lost: stop the stream.                    */
+        (void)HAL_DMA_Abort(&BSP_Mem_DMA_Handle);
+        OSSemSet(&BSP_Mem_DMA_Sem, 0u, &err);                   /* Discard a late completion.                           */
+        BSP_Mem_DMA_Busy = DEF_NO;
+        return (DEF_FAIL);                                      /* Copy with the CPU instead.                           */
+    }
+
+    BSP_Mem_DMA_Busy = DEF_NO;
+
+    if (HAL_DMA_GetError(&BSP_Mem_DMA_Handle) != HAL_DMA_ERROR_NONE) {
+        return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DMA2_Stream0_IRQHandler()
+*
+* Description : Handle the interrupts of the memory copy DMA stream.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is an ISR.
+*
+* Note(s)     : (1) Overrides the weak handler of the startup file.
+*********************************************************************************************************
+*/
+
+void  DMA2_Stream0_IRQHandler (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell OS that we are starting an ISR                  */
+    CPU_CRITICAL_EXIT();
+
+    HAL_DMA_IRQHandler(&BSP_Mem_DMA_Handle);
+
+    OSIntExit();                                                /* Tell OS that we are leaving the ISR                  */
+}
+
+
+/*
+*********************************************************************************************************
+*                                       BSP_Mem_DMA_XferDone()
+*
+* Description : Wake up the task waiting in Mem_CopyDMA().
+*
+* Argument(s) : p_handle    Pointer to the DMA handle.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HAL_DMA_IRQHandler(), on transfer complete or transfer error.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  BSP_Mem_DMA_XferDone (DMA_HandleTypeDef  *p_handle)
+{
+    OS_ERR  err;
+
+
+    (void)p_handle;
+
+    (void)OSSemPost(&BSP_Mem_DMA_Sem,
+                     OS_OPT_POST_1,
+                    &err);
+}
+
+
+#else
+/*
+*********************************************************************************************************
+*                                           BSP_Mem_Init()
+*
+* Description : Nothing to initialize, DMA-assisted copies are disabled.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : BSP_Init().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  BSP_Mem_Init (void)
+{
+}
+#endif
@@ -51,6 +51,12 @@
 *********************************************************************************************************
 */
 
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+#define  BSP_OS_PWR_LPTIM_FREQ_HZ              LSE_VALUE        /* LPTIM1 clocked by the LSE, prescaler 1               */
+#define  BSP_OS_PWR_LPTIM_CNT_MAX                 0xF000u       /* Leaves time for the clocks restore before wrapping   */
+#define  BSP_OS_PWR_LPTIM_EXTI_LINE            DEF_BIT_23       /* EXTI line of the LPTIM1 wake up event                */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -58,6 +64,11 @@
 *********************************************************************************************************
 */
 
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+static  CPU_INT32U  BSP_OS_PwrCyclesPerUs;                      /* SysTick counts per microsecond                       */
+static  CPU_INT32U  BSP_OS_PwrTickUs;                           /* Tick period, in microseconds                         */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -79,6 +90,16 @@
 *********************************************************************************************************
 */
 
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+static  void        BSP_OS_PwrInit     (void);
+
+static  CPU_INT32U  BSP_OS_PwrWFI      (void);
+
+static  CPU_INT32U  BSP_OS_PwrTickless (CPU_INT08U   state,
+                                        OS_TICK      ticks,
+                                        OS_TICK     *p_ticks_slept);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -110,6 +131,10 @@ void  BSP_OSTickInit (void)
     cpu_clk_freq = BSP_ClkFreqGet(BSP_CLK_ID_HCLK);             /* Determine SysTick reference freq.                    */
 
     OS_CPU_SysTickInitFreq(cpu_clk_freq);                       /* Init uC/OS periodic time src (SysTick).              */
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+    BSP_OS_PwrInit();                                           /* Init. the idle task wake up timer.                   */
+#endif
 }
 
 
@@ -171,3 +196,334 @@ uint32_t  HAL_GetTick(void)
 
     return os_tick_ctr;
 }
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_OS_PwrEnter()
+*
+* Description : Enter a low power state from the idle task, see 'os_pwr.c  OS_PwrIdle()'.
+*
+* Argument(s) : state           Low power state selected by the kernel:
+*
+*                                   OS_PWR_STATE_WFI        WFI, the tick keeps running.
+*                                   OS_PWR_STATE_SLEEP      WFI, the tick is suppressed.
+*                                   OS_PWR_STATE_STOP       STOP mode, the tick is suppressed.
+*
+*               ticks           Number of ticks the CPU may sleep for.
+*
+*               p_ticks_slept   Pointer to a variable that will receive the number of tick periods that
+*                               elapsed while the tick was suppressed.
+*
+* Return(s)   : Time spent in the state, in microseconds.
+*
+* Caller(s)   : OS_PwrIdle().
+*
+* Note(s)     : (1) Called with interrupts disabled.  A pending interrupt still ends the WFI; it is then
+*                   serviced once the kernel leaves its critical section.
+*
+*               (2) While the tick is suppressed, LPTIM1 clocked by the LSE wakes the CPU up.  It keeps
+*                   counting in STOP mode and on an early wake up gives the time slept, with a resolution
+*                   of 1/32768 s.  The wake up is scheduled early by the exit latency of the state so that
+*                   the CPU runs again when the tick is due.
+*
+*               (3) SysTick is stopped with its counter frozen and restarted so that the next tick falls
+*                   where it would have been had the tick never been suppressed: the first reload covers
+*                   the rest of the current period, later reloads the full period.
+*
+*               (4) STOP mode stops the PLLs.  The clocks are restored with BSP_SystemClkCfg(), which also
+*                   restarts the PLLSAI feeding the LTDC; the application must keep STOP out of reach
+*                   while the display is in use (see 'OSPwrLatMaxSet()').
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+CPU_INT32U  BSP_OS_PwrEnter (CPU_INT08U   state,
+                             OS_TICK      ticks,
+                             OS_TICK     *p_ticks_slept)
+{
+    CPU_INT32U  slept_us;
+
+
+   *p_ticks_slept = 0u;
+    if (state == OS_PWR_STATE_WFI) {
+        slept_us = BSP_OS_PwrWFI();
+    } else {
+        slept_us = BSP_OS_PwrTickless(state, ticks, p_ticks_slept);
+    }
+
+    return (slept_us);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          LPTIM1_IRQHandler()
+*
+* Description : LPTIM1 interrupt handler, overrides the weak handler of 'startup_stm32f746xx.s'.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is an ISR.
+*
+* Note(s)     : (1) The interrupt only serves to end the WFI; BSP_OS_PwrTickless() clears it before the
+*                   kernel leaves its critical section.  Should it run anyway, the flags are cleared.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+void  LPTIM1_IRQHandler (void)
+{
+    LPTIM1->ICR = LPTIM_ICR_CMPMCF;
+    EXTI->PR    = BSP_OS_PWR_LPTIM_EXTI_LINE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          MemManage_Handler()
+*
+* Description : MemManage fault handler, overrides the weak handler of 'startup_stm32f746xx.s'.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : This is an ISR.
+*
+* Note(s)     : (1) With OS_CPU_CFG_STK_GUARD_EN enabled, a task stack overflow raises a MemManage fault
+*                   which the port identifies (see 'os_cpu_c.c  OS_CPU_MemManageHandler()').
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_CFG_STK_GUARD_EN == DEF_ENABLED)
+void  MemManage_Handler (void)
+{
+    OS_CPU_MemManageHandler();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          BSP_OS_PwrInit()
+*
+* Description : Initialize the wake up timer used while the tick is suppressed.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : BSP_OSTickInit().
+*
+* Note(s)     : (1) LPTIM1 counts up to 0xFFFF and wakes the CPU up on a compare match, so that the counter
+*                   still measures the time elapsed after the match while the clocks are restored.
+*
+*               (2) The ARR register can only be written while LPTIM1 is enabled and takes effect once
+*                   resynchronized to the LSE clock domain.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+static  void  BSP_OS_PwrInit (void)
+{
+    RCC_OscInitTypeDef        osc_init;
+    RCC_PeriphCLKInitTypeDef  clk_init;
+
+
+    BSP_OS_PwrCyclesPerUs = BSP_ClkFreqGet(BSP_CLK_ID_HCLK) / 1000000u;
+    BSP_OS_PwrTickUs      = 1000000u / OSCfg_TickRate_Hz;
+
+    HAL_PWR_EnableBkUpAccess();                                 /* The LSE lives in the backup domain.                  */
+    osc_init.OscillatorType = RCC_OSCILLATORTYPE_LSE;
+    osc_init.LSEState       = RCC_LSE_ON;
+    osc_init.PLL.PLLState   = RCC_PLL_NONE;
+    (void)HAL_RCC_OscConfig(&osc_init);
+
+    clk_init.PeriphClockSelection = RCC_PERIPHCLK_LPTIM1;
+    clk_init.Lptim1ClockSelection = RCC_LPTIM1CLKSOURCE_LSE;
+    (void)HAL_RCCEx_PeriphCLKConfig(&clk_init);
+    __HAL_RCC_LPTIM1_CLK_ENABLE();
+
+    LPTIM1->CR   = 0u;
+    LPTIM1->CFGR = 0u;                                          /* Internal clock, prescaler 1, software start.         */
+    LPTIM1->IER  = LPTIM_IER_CMPMIE;                            /* Wake up on compare match (see Note #1).              */
+    LPTIM1->CR   = LPTIM_CR_ENABLE;
+    LPTIM1->ARR  = 0xFFFFu;                                     /* See Note #2.                                         */
+    while ((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0u) {
+        ;
+    }
+    LPTIM1->ICR  = LPTIM_ICR_ARROKCF;
+    LPTIM1->CR   = 0u;
+
+    EXTI->IMR   |= BSP_OS_PWR_LPTIM_EXTI_LINE;                  /* The LPTIM1 event wakes the CPU up from STOP.         */
+    EXTI->RTSR  |= BSP_OS_PWR_LPTIM_EXTI_LINE;
+    HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           BSP_OS_PwrWFI()
+*
+* Description : Wait for an interrupt with the tick running.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Time spent in WFI, in microseconds.
+*
+* Caller(s)   : BSP_OS_PwrEnter().
+*
+* Note(s)     : (1) The tick interrupt ends the WFI at the latest, so less than one SysTick period
+*                   elapses and the counter difference modulo the period is the time spent.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+static  CPU_INT32U  BSP_OS_PwrWFI (void)
+{
+    CPU_INT32U  reload;
+    CPU_INT32U  val_start;
+    CPU_INT32U  val_end;
+    CPU_INT32U  cycles;
+
+
+    reload    = SysTick->LOAD + 1u;
+    val_start = SysTick->VAL;
+    __DSB();
+    __WFI();
+    val_end   = SysTick->VAL;
+    cycles    = (val_start + reload - val_end) % reload;        /* SysTick counts down (see Note #1).                   */
+
+    return (cycles / BSP_OS_PwrCyclesPerUs);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        BSP_OS_PwrTickless()
+*
+* Description : Suppress the tick and sleep in SLEEP or STOP mode until LPTIM1 or an interrupt wakes the
+*               CPU up.
+*
+* Argument(s) : state           OS_PWR_STATE_SLEEP or OS_PWR_STATE_STOP.
+*
+*               ticks           Number of ticks the CPU may sleep for.
+*
+*               p_ticks_slept   Pointer to a variable that will receive the number of tick periods that
+*                               elapsed.
+*
+* Return(s)   : Time spent with the tick suppressed, in microseconds.
+*
+* Caller(s)   : BSP_OS_PwrEnter().
+*
+* Note(s)     : (1) A tick that became due while the kernel selected the state is left to the tick ISR.
+*
+*               (2) The counter is read until two reads match since it runs from the LSE clock domain.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_PWR_EN == DEF_ENABLED)
+static  CPU_INT32U  BSP_OS_PwrTickless (CPU_INT08U   state,
+                                        OS_TICK      ticks,
+                                        OS_TICK     *p_ticks_slept)
+{
+    CPU_INT32U  reload;
+    CPU_INT32U  phase_us;
+    CPU_INT32U  lat_us;
+    CPU_INT64U  wake_us;
+    CPU_INT32U  cnt;
+    CPU_INT32U  cnt_slept;
+    CPU_INT32U  slept_us;
+    CPU_INT32U  total_us;
+
+
+    reload          = SysTick->LOAD + 1u;
+    SysTick->CTRL  &= ~SysTick_CTRL_ENABLE_Msk;                 /* Freeze the tick counter.                             */
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0u) {           /* See Note #1.                                         */
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        return (0u);
+    }
+    phase_us = (reload - SysTick->VAL) / BSP_OS_PwrCyclesPerUs; /* Part of the current tick period already elapsed.     */
+
+    if (state == OS_PWR_STATE_STOP) {
+        lat_us = OS_CFG_PWR_STOP_LAT_US;
+    } else {
+        lat_us = OS_CFG_PWR_SLEEP_LAT_US;
+    }
+                                                                /* ------------- PROGRAM THE WAKE UP TIMER ------------ */
+    wake_us = ((CPU_INT64U)ticks * BSP_OS_PwrTickUs) - phase_us;
+    if (wake_us > lat_us) {
+        wake_us -= lat_us;                                      /* Wake up early by the exit latency.                   */
+    } else {
+        wake_us  = 0u;
+    }
+    wake_us = (wake_us * BSP_OS_PWR_LPTIM_FREQ_HZ) / 1000000u;
+    if (wake_us > BSP_OS_PWR_LPTIM_CNT_MAX) {
+        wake_us = BSP_OS_PWR_LPTIM_CNT_MAX;
+    }
+    cnt = (CPU_INT32U)wake_us;
+    if (cnt == 0u) {
+        cnt = 1u;
+    }
+
+    LPTIM1->CR  = LPTIM_CR_ENABLE;
+    LPTIM1->ICR = LPTIM_ICR_CMPMCF | LPTIM_ICR_CMPOKCF;
+    LPTIM1->CMP = cnt;
+    while ((LPTIM1->ISR & LPTIM_ISR_CMPOK) == 0u) {
+        ;
+    }
+    LPTIM1->CR  = LPTIM_CR_ENABLE | LPTIM_CR_CNTSTRT;
+
+                                                                /* ---------------------- SLEEP ----------------------- */
+    if (state == OS_PWR_STATE_STOP) {
+        PWR->CR1 |= PWR_CR1_LPDS | PWR_CR1_FPDS;                /* Regulator in low power, flash powered down.          */
+        SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+    }
+    __DSB();
+    __WFI();
+    if (state == OS_PWR_STATE_STOP) {
+        SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+        BSP_SystemClkCfg();                                     /* The CPU wakes up running on the HSI.                 */
+    }
+
+                                                                /* ------------------ MEASURE THE SLEEP --------------- */
+    do {                                                        /* See Note #2.                                         */
+        cnt_slept = LPTIM1->CNT;
+    } while (cnt_slept != LPTIM1->CNT);
+
+    LPTIM1->CR  = 0u;
+    LPTIM1->ICR = LPTIM_ICR_CMPMCF;
+    EXTI->PR    = BSP_OS_PWR_LPTIM_EXTI_LINE;
+    NVIC_ClearPendingIRQ(LPTIM1_IRQn);
+
+    slept_us       = (CPU_INT32U)(((CPU_INT64U)cnt_slept * 1000000u) / BSP_OS_PWR_LPTIM_FREQ_HZ);
+    total_us       = phase_us + slept_us;
+   *p_ticks_slept  = total_us / BSP_OS_PwrTickUs;
+
+                                                                /* ---------------- RESUME THE TICK ------------------- */
+    SysTick->LOAD  = ((BSP_OS_PwrTickUs - (total_us % BSP_OS_PwrTickUs)) * BSP_OS_PwrCyclesPerUs) - 1u;
+    SysTick->VAL   = 0u;                                        /* Next tick where it was due without the suppression. */
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    while (SysTick->VAL == 0u) {                                /* Wait for the counter to load the shortened period.   */
+        ;
+    }
+    SysTick->LOAD  = reload - 1u;                               /* Later periods are full.                              */
+
+    return (slept_us);
+}
+#endif